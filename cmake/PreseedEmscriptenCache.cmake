@@ -174,6 +174,10 @@ if(EMSCRIPTEN)
     set(HAVE_POLL                                        "1"   CACHE INTERNAL "Have symbol poll")
     set(HAVE_MEMFD_CREATE                                ""    CACHE INTERNAL "Have symbol memfd_create")
     set(HAVE_POSIX_FALLOCATE                             "1"   CACHE INTERNAL "Have symbol posix_fallocate")
+    set(HAVE_PREAD                                       "1"   CACHE INTERNAL "Have symbol pread")
+    set(HAVE_PREADV                                      "1"   CACHE INTERNAL "Have symbol preadv")
+    set(HAVE_COPY_FILE_RANGE                             ""    CACHE INTERNAL "Have symbol copy_file_range")
+    set(HAVE_SENDFILE                                    ""    CACHE INTERNAL "Have symbol sendfile")
     set(HAVE_DLOPEN_IN_LIBC                              "1"   CACHE INTERNAL "Have symbol dlopen")
     set(HAVE_FDATASYNC                                   "1"   CACHE INTERNAL "Have symbol fdatasync")
     set(HAVE_GETHOSTNAME                                 "1"   CACHE INTERNAL "Have symbol gethostname")
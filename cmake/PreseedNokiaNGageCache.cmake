@@ -176,6 +176,10 @@ if(NGAGESDK)
     set(HAVE_POLL                                        ""    CACHE INTERNAL "Have symbol poll")
     set(HAVE_MEMFD_CREATE                                ""    CACHE INTERNAL "Have symbol memfd_create")
     set(HAVE_POSIX_FALLOCATE                             ""    CACHE INTERNAL "Have symbol posix_fallocate")
+    set(HAVE_PREAD                                       ""    CACHE INTERNAL "Have symbol pread")
+    set(HAVE_PREADV                                      ""    CACHE INTERNAL "Have symbol preadv")
+    set(HAVE_COPY_FILE_RANGE                             ""    CACHE INTERNAL "Have symbol copy_file_range")
+    set(HAVE_SENDFILE                                    ""    CACHE INTERNAL "Have symbol sendfile")
     set(HAVE_DLOPEN_IN_LIBC                              ""    CACHE INTERNAL "Have symbol dlopen")
 
     set(HAVE_GETHOSTNAME                                 ""    CACHE INTERNAL "Have symbol gethostname")
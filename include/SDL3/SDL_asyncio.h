@@ -336,7 +336,10 @@ extern SDL_DECLSPEC bool SDLCALL SDL_WriteAsyncIO(SDL_AsyncIO *asyncio, void *pt
  * This function guarantees that the close will happen after any other pending
  * tasks to `asyncio`, so it's safe to open a file, start several operations,
  * close the file immediately, then check for all results later. This function
- * will not block until the tasks have completed.
+ * will not block until the tasks have completed. Requests for `asyncio` that
+ * are sitting in an SDL_AsyncIOBatch count as pending tasks too: the close
+ * waits until they have been submitted and completed, or discarded with
+ * SDL_DestroyAsyncIOBatch().
  *
  * Once this function returns true, `asyncio` is no longer valid, regardless
  * of any future outcomes. Any completed tasks might still contain this
@@ -541,6 +544,272 @@ extern SDL_DECLSPEC void SDLCALL SDL_SignalAsyncIOQueue(SDL_AsyncIOQueue *queue)
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_LoadFileAsync(const char *file, SDL_AsyncIOQueue *queue, void *userdata);
 
+/**
+ * A buffer for vectored (scatter/gather) asynchronous I/O.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_BatchReadVectorAsyncIO
+ * \sa SDL_BatchWriteVectorAsyncIO
+ * \sa SDL_RegisterAsyncIOBuffers
+ */
+typedef struct SDL_AsyncIOVector
+{
+    void *buffer;  /**< memory to read data into or write data from. */
+    Uint64 size;   /**< number of bytes in `buffer`. */
+} SDL_AsyncIOVector;
+
+/**
+ * A set of asynchronous I/O requests that are started together.
+ *
+ * Starting tasks one at a time can mean one system call per task. A batch
+ * collects requests and hands them to the system all at once, which is much
+ * cheaper when loading many small files.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateAsyncIOBatch
+ * \sa SDL_SubmitAsyncIOBatch
+ */
+typedef struct SDL_AsyncIOBatch SDL_AsyncIOBatch;
+
+/**
+ * Create a batch of asynchronous I/O requests.
+ *
+ * All requests in a batch report their results to `queue`.
+ *
+ * A batch can be reused after it is submitted. It should only be used from
+ * one thread at a time.
+ *
+ * \param queue the queue that the batched tasks will be added to when they
+ *              complete.
+ * \returns a new batch or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_BatchReadAsyncIO
+ * \sa SDL_BatchWriteAsyncIO
+ * \sa SDL_SubmitAsyncIOBatch
+ * \sa SDL_DestroyAsyncIOBatch
+ */
+extern SDL_DECLSPEC SDL_AsyncIOBatch * SDLCALL SDL_CreateAsyncIOBatch(SDL_AsyncIOQueue *queue);
+
+/**
+ * Add a read to a batch of asynchronous I/O requests.
+ *
+ * This works like SDL_ReadAsyncIO(), but the read doesn't start until
+ * SDL_SubmitAsyncIOBatch() is called.
+ *
+ * \param batch the batch to add the request to.
+ * \param asyncio a pointer to an SDL_AsyncIO structure.
+ * \param ptr a pointer to a buffer to read data into.
+ * \param offset the position to start reading in the data source.
+ * \param size the number of bytes to read from the data source.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called from the thread that is
+ *               using the batch.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_BatchReadVectorAsyncIO
+ * \sa SDL_SubmitAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_BatchReadAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, void *userdata);
+
+/**
+ * Add a write to a batch of asynchronous I/O requests.
+ *
+ * This works like SDL_WriteAsyncIO(), but the write doesn't start until
+ * SDL_SubmitAsyncIOBatch() is called.
+ *
+ * \param batch the batch to add the request to.
+ * \param asyncio a pointer to an SDL_AsyncIO structure.
+ * \param ptr a pointer to a buffer to write data from.
+ * \param offset the position to start writing to the data source.
+ * \param size the number of bytes to write to the data source.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called from the thread that is
+ *               using the batch.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_BatchWriteVectorAsyncIO
+ * \sa SDL_SubmitAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_BatchWriteAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, void *userdata);
+
+/**
+ * Add a scatter read to a batch of asynchronous I/O requests.
+ *
+ * This reads a contiguous range of the data source, starting at `offset`,
+ * into several buffers in order. It completes as a single task. The outcome's
+ * `buffer` is the first vector's buffer, and `bytes_requested` is the total
+ * size of all the vectors.
+ *
+ * The vector array is copied and does not need to stay around. The buffers
+ * it points to must remain available until the work is done.
+ *
+ * \param batch the batch to add the request to.
+ * \param asyncio a pointer to an SDL_AsyncIO structure.
+ * \param vectors an array of buffers to read data into.
+ * \param num_vectors the number of elements in `vectors`.
+ * \param offset the position to start reading in the data source.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called from the thread that is
+ *               using the batch.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_BatchReadAsyncIO
+ * \sa SDL_SubmitAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_BatchReadVectorAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, const SDL_AsyncIOVector *vectors, int num_vectors, Uint64 offset, void *userdata);
+
+/**
+ * Add a gather write to a batch of asynchronous I/O requests.
+ *
+ * This writes several buffers in order to a contiguous range of the data
+ * source, starting at `offset`. It completes as a single task. The outcome's
+ * `buffer` is the first vector's buffer, and `bytes_requested` is the total
+ * size of all the vectors.
+ *
+ * The vector array is copied and does not need to stay around. The buffers
+ * it points to must remain available until the work is done.
+ *
+ * \param batch the batch to add the request to.
+ * \param asyncio a pointer to an SDL_AsyncIO structure.
+ * \param vectors an array of buffers to write data from.
+ * \param num_vectors the number of elements in `vectors`.
+ * \param offset the position to start writing to the data source.
+ * \param userdata an app-defined pointer that will be provided with the task
+ *                 results.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called from the thread that is
+ *               using the batch.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_BatchWriteAsyncIO
+ * \sa SDL_SubmitAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_BatchWriteVectorAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, const SDL_AsyncIOVector *vectors, int num_vectors, Uint64 offset, void *userdata);
+
+/**
+ * Start all the requests in a batch.
+ *
+ * Where the platform allows it, the whole batch is handed to the system with
+ * a single call.
+ *
+ * Requests are started in the order they were added. If one can't be
+ * started, it and every request after it are discarded and this function
+ * returns false. Requests before it have started and will report their
+ * results as usual.
+ *
+ * Either way, the batch is empty afterwards and can be reused.
+ *
+ * \param batch the batch to submit.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should only be called from the thread that is
+ *               using the batch.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateAsyncIOBatch
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitAsyncIOBatch(SDL_AsyncIOBatch *batch);
+
+/**
+ * Destroy a batch of asynchronous I/O requests.
+ *
+ * Requests that were added but not submitted are discarded, which lets any
+ * pending SDL_CloseAsyncIO() on their files go ahead. Submitted requests are
+ * not affected.
+ *
+ * \param batch the batch to destroy.
+ *
+ * \threadsafety This function should only be called from the thread that is
+ *               using the batch.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateAsyncIOBatch
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyAsyncIOBatch(SDL_AsyncIOBatch *batch);
+
+/**
+ * Register buffers with an async I/O queue for fixed-buffer I/O.
+ *
+ * On platforms that support it, the system pins registered memory once,
+ * instead of mapping it for each request. Any read or write on this queue
+ * that lies entirely within a registered buffer uses it automatically.
+ *
+ * This replaces any buffers previously registered with the queue. Pass a
+ * `num_buffers` of 0 to unregister them all. Don't change the registration
+ * while I/O on the queue is using the registered buffers.
+ *
+ * Registration is an optimization hint. On platforms that don't support it,
+ * this function succeeds and has no effect.
+ *
+ * \param queue the queue to register buffers with.
+ * \param buffers an array of buffers to register, may be NULL if
+ *                `num_buffers` is 0.
+ * \param num_buffers the number of elements in `buffers`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_RegisterAsyncIOFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RegisterAsyncIOBuffers(SDL_AsyncIOQueue *queue, const SDL_AsyncIOVector *buffers, int num_buffers);
+
+/**
+ * Register a file with an async I/O queue.
+ *
+ * On platforms that support it, the system looks up a registered file once,
+ * instead of for each request. Reads and writes on this file that report
+ * their results to `queue` use the registration automatically.
+ *
+ * A file can be registered with only one queue. The registration is removed
+ * when the file is closed.
+ *
+ * Registration is an optimization hint. On platforms that don't support it,
+ * this function succeeds and has no effect.
+ *
+ * \param queue the queue to register the file with.
+ * \param asyncio the file to register.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_RegisterAsyncIOBuffers
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RegisterAsyncIOFile(SDL_AsyncIOQueue *queue, SDL_AsyncIO *asyncio);
+
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
 }
@@ -72,6 +72,96 @@ extern "C" {
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetNumLogicalCPUCores(void);
 
+/**
+ * Get the number of physical CPU cores available.
+ *
+ * On CPUs that include technologies such as hyperthreading, each physical
+ * core shows up as more than one logical core.
+ *
+ * \returns the total number of physical CPU cores. If SDL can't tell how
+ *          the logical cores are grouped, this is the same as the number of
+ *          logical cores.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetCPUTopology
+ * \sa SDL_GetNumLogicalCPUCores
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetNumPhysicalCPUCores(void);
+
+/**
+ * The kinds of CPU core on hybrid CPUs.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetCPUTopology
+ */
+typedef enum SDL_CPUCoreType
+{
+    SDL_CPU_CORE_TYPE_UNKNOWN,      /**< SDL can't tell what kind of core this is */
+    SDL_CPU_CORE_TYPE_PERFORMANCE,  /**< A fast core. On CPUs that aren't hybrid, every core is reported as this type. */
+    SDL_CPU_CORE_TYPE_EFFICIENCY    /**< A slower, more power efficient core */
+} SDL_CPUCoreType;
+
+/**
+ * Information about a logical CPU core, as reported by SDL_GetCPUTopology().
+ *
+ * The `core`, `l2_cache_id` and `l3_cache_id` fields are only meaningful for
+ * comparing against other CPUs: logical CPUs with the same `core` are SMT
+ * siblings that share a physical core, and logical CPUs with the same cache
+ * id share that cache.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetCPUTopology
+ */
+typedef struct SDL_CPUInfo
+{
+    int cpu;                    /**< the number of this logical CPU, as used by SDL_SetThreadAffinity() */
+    int core;                   /**< the physical core this logical CPU belongs to, from 0 to SDL_GetNumPhysicalCPUCores() - 1 */
+    int package;                /**< the physical package (socket) this CPU is in */
+    int numa_node;              /**< the NUMA memory node closest to this CPU */
+    SDL_CPUCoreType core_type;  /**< the kind of core this CPU is part of */
+    int capacity;               /**< the performance of this CPU relative to the fastest one in the system, from 1 to 1024 */
+    int l2_cache_size;          /**< the size of the L2 cache used by this CPU in bytes, or 0 if unknown */
+    int l2_cache_id;            /**< an identifier for the L2 cache used by this CPU, or -1 if unknown */
+    int l3_cache_size;          /**< the size of the L3 cache used by this CPU in bytes, or 0 if unknown */
+    int l3_cache_id;            /**< an identifier for the L3 cache used by this CPU, or -1 if unknown */
+} SDL_CPUInfo;
+
+/**
+ * Get information about how the logical CPU cores in the system are laid
+ * out.
+ *
+ * This can be used to decide which threads should run on which CPUs, for
+ * example to keep latency sensitive threads on performance cores, or to keep
+ * threads that share data on CPUs that share a cache.
+ *
+ * This information is complete on Linux and Android. On other platforms,
+ * every logical CPU is reported as its own physical core, with unknown core
+ * type and cache sizes.
+ *
+ * Only CPUs that are online are reported, so the `cpu` numbers might not be
+ * contiguous.
+ *
+ * \param count a pointer filled in with the number of CPUs returned, may be
+ *              NULL.
+ * \returns a NULL terminated array of pointers to CPU information, sorted by
+ *          `cpu`, or NULL on failure; call SDL_GetError() for more
+ *          information. This is a single allocation that should be freed
+ *          with SDL_free() when it is no longer needed.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetNumPhysicalCPUCores
+ * \sa SDL_SetThreadAffinity
+ */
+extern SDL_DECLSPEC SDL_CPUInfo ** SDLCALL SDL_GetCPUTopology(int *count);
+
 /**
  * Determine the L1 cache line size of the CPU.
  *
@@ -1510,6 +1510,107 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetGamepadSensorDataRate(SDL_Gamepad *game
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *data, int num_values);
 
+/**
+ * The maximum number of touchpad fingers reported in an SDL_GamepadState.
+ *
+ * \since This macro is available since SDL 3.6.0.
+ */
+#define SDL_GAMEPAD_STATE_MAX_FINGERS 4
+
+/**
+ * The number of axis slots in an SDL_GamepadState.
+ *
+ * This is fixed so the struct doesn't change size when axes are added to
+ * SDL_GamepadAxis. Slots past SDL_GAMEPAD_AXIS_COUNT are always zero.
+ *
+ * \since This macro is available since SDL 3.6.0.
+ */
+#define SDL_GAMEPAD_STATE_MAX_AXES 16
+
+/**
+ * The number of sensor slots in an SDL_GamepadState.
+ *
+ * This is fixed so the struct doesn't change size when sensors are added to
+ * SDL_SensorType. Slots past SDL_SENSOR_COUNT are always zero.
+ *
+ * \since This macro is available since SDL 3.6.0.
+ */
+#define SDL_GAMEPAD_STATE_MAX_SENSORS 16
+
+/**
+ * A macro to test whether a button is pressed in SDL_GamepadState::buttons.
+ *
+ * \since This macro is available since SDL 3.6.0.
+ */
+#define SDL_GAMEPAD_BUTTON_MASK(X)  (SDL_UINT64_C(1) << (X))
+
+/**
+ * The state of one touchpad finger in an SDL_GamepadState.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetGamepadState
+ */
+typedef struct SDL_GamepadFingerState
+{
+    Uint8 touchpad;     /**< The index of the touchpad */
+    Uint8 finger;       /**< The index of the finger on the touchpad */
+    bool down;          /**< true if the finger is touching the touchpad */
+    float x;            /**< Normalized in the range 0...1 with 0 being on the left */
+    float y;            /**< Normalized in the range 0...1 with 0 being at the top */
+    float pressure;     /**< Normalized in the range 0...1 */
+} SDL_GamepadFingerState;
+
+/**
+ * A snapshot of the mapped state of a gamepad.
+ *
+ * Every value is what the matching individual query would return at the
+ * moment the snapshot was taken, so the axes are the same as
+ * SDL_GetGamepadAxis() and the buttons are the same as
+ * SDL_GetGamepadButton().
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetGamepadState
+ */
+typedef struct SDL_GamepadState
+{
+    Sint16 axes[SDL_GAMEPAD_STATE_MAX_AXES]; /**< The state of each SDL_GamepadAxis */
+    Uint64 buttons;                         /**< The pressed buttons, test with SDL_GAMEPAD_BUTTON_MASK() */
+    int num_fingers;                        /**< The number of valid entries in fingers */
+    SDL_GamepadFingerState fingers[SDL_GAMEPAD_STATE_MAX_FINGERS]; /**< The fingers of all touchpads, in touchpad order */
+    Uint32 sensors;                         /**< The enabled sensors, bit `(1 << type)` is set for each SDL_SensorType with data */
+    float sensor_data[SDL_GAMEPAD_STATE_MAX_SENSORS][3]; /**< The current data of each enabled sensor, indexed by SDL_SensorType */
+} SDL_GamepadState;
+
+/**
+ * Get a snapshot of the current state of a gamepad.
+ *
+ * This fills in every mapped axis and button, the touchpad fingers and the
+ * data of the enabled sensors at once. Use this instead of calling
+ * SDL_GetGamepadAxis(), SDL_GetGamepadButton(),
+ * SDL_GetGamepadTouchpadFinger() and SDL_GetGamepadSensorData() many times
+ * each frame, since each of those calls takes the joystick lock on its own.
+ *
+ * Touchpads beyond SDL_GAMEPAD_STATE_MAX_FINGERS fingers in total are not
+ * included, use SDL_GetGamepadTouchpadFinger() for those.
+ *
+ * \param gamepad a gamepad.
+ * \param state a pointer filled in with the current state of the gamepad.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetGamepadAxis
+ * \sa SDL_GetGamepadButton
+ * \sa SDL_GetGamepadSensorData
+ * \sa SDL_GetGamepadTouchpadFinger
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetGamepadState(SDL_Gamepad *gamepad, SDL_GamepadState *state);
+
 /**
  * Start a rumble effect on a gamepad.
  *
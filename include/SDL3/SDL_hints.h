@@ -651,6 +651,8 @@ extern "C" {
  * - "neon"
  * - "lsx"
  * - "lasx"
+ * - "pclmul"
+ * - "arm-crc32"
  *
  * The items can be prefixed by '+'/'-' to add/remove features.
  *
@@ -701,6 +703,29 @@ extern "C" {
  */
 #define SDL_HINT_FILE_DIALOG_DRIVER "SDL_FILE_DIALOG_DRIVER"
 
+/**
+ * A variable controlling how many threads SDL_GlobDirectory() uses.
+ *
+ * When this is more than one, the subdirectories of the directory being
+ * searched are walked in parallel, which can help with large directory trees
+ * on slow or networked storage. The results are the same, in the same order,
+ * either way.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "1": Search on the calling thread only. (default)
+ * - "0": Use one thread per logical CPU core.
+ * - Any other number: Use up to that many threads.
+ *
+ * This hint only affects SDL_GlobDirectory(); SDL_GlobStorageDirectory()
+ * always runs on the calling thread.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_FILESYSTEM_GLOB_THREADS "SDL_FILESYSTEM_GLOB_THREADS"
+
 /**
  * Override for SDL_GetDisplayUsableBounds().
  *
@@ -1219,6 +1244,28 @@ extern "C" {
  */
 #define SDL_HINT_IME_IMPLEMENTED_UI "SDL_IME_IMPLEMENTED_UI"
 
+/**
+ * A variable controlling whether SDL's file format loaders and savers buffer
+ * their stream access.
+ *
+ * Loaders like SDL_LoadBMP_IO() and SDL_LoadWAV_IO() read their headers a few
+ * bytes at a time. With buffering enabled, SDL reads ahead in larger blocks
+ * and holds back small writes, so a stream backed by a file descriptor sees
+ * far fewer system calls. When the loader is done, any data that was read
+ * ahead is returned to the stream by seeking back, and pending writes are
+ * flushed.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Every read and write goes directly to the stream.
+ * - "1": Stream access is buffered. (default)
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_IOSTREAM_BUFFERING "SDL_IOSTREAM_BUFFERING"
+
 /**
  * A variable controlling whether the home indicator bar on iPhone X and later
  * should be hidden.
@@ -2261,6 +2308,26 @@ extern "C" {
  */
 #define SDL_HINT_JOYSTICK_LINUX_HAT_DEADZONES "SDL_JOYSTICK_LINUX_HAT_DEADZONES"
 
+/**
+ * A variable controlling whether a separate thread should be used to read
+ * input from Linux evdev joysticks as it arrives.
+ *
+ * Without the thread, input is read when joysticks are updated, so devices
+ * that report faster than the application updates may drop events. With the
+ * thread, events are queued with their original timestamps and delivered at
+ * the next update.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Input is read when joysticks are updated. (default)
+ * - "1": A separate thread is used to read input.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ */
+#define SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD "SDL_JOYSTICK_LINUX_INPUT_THREAD"
+
 /**
  * A variable controlling whether GCController should be used for controller
  * handling.
@@ -3524,6 +3591,13 @@ extern "C" {
  * user to force a specific target, such as "pc" if, say, you are on Steam but
  * want to avoid SteamRemoteStorage for title data.
  *
+ * The "pack" driver is only used when it is named here. It reads the title
+ * data from a single pack file: the `override` path passed to
+ * SDL_OpenTitleStorage() can be the pack file itself, or a directory holding
+ * a "title.pak" file. If there is no override, the base path is used as that
+ * directory. test/testpackstorage.c in the SDL source tree can build these
+ * files.
+ *
  * This hint should be set before SDL is initialized.
  *
  * \since This hint is available since SDL 3.2.0.
@@ -3631,6 +3705,23 @@ extern "C" {
  */
 #define SDL_HINT_TOUCH_MOUSE_EVENTS "SDL_TOUCH_MOUSE_EVENTS"
 
+/**
+ * A variable naming a file to write a Chrome trace of SDL's work to.
+ *
+ * If this is set, SDL calls SDL_StartChromeTrace() with it when SDL is
+ * initialized, and the trace is finished by SDL_Quit(). This is a way to
+ * profile SDL inside an app without changing the app.
+ *
+ * By default no trace is written.
+ *
+ * This hint should be set before SDL is initialized.
+ *
+ * \since This hint is available since SDL 3.6.0.
+ *
+ * \sa SDL_StartChromeTrace
+ */
+#define SDL_HINT_TRACE_FILE "SDL_TRACE_FILE"
+
 /**
  * A variable controlling whether trackpads should be treated as touch
  * devices.
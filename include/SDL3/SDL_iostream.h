@@ -413,6 +413,60 @@ extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromDynamicMem(void);
 #define SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER    "SDL.iostream.dynamic.memory"
 #define SDL_PROP_IOSTREAM_DYNAMIC_CHUNKSIZE_NUMBER  "SDL.iostream.dynamic.chunksize"
 
+/**
+ * Hints for how the contents of a mapped file will be accessed.
+ *
+ * The operating system can use these hints to decide how far ahead of the
+ * current position to read, and how long to keep pages in memory.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_MapFile
+ * \sa SDL_IOFromMappedFile
+ */
+typedef enum SDL_IOAccessPattern
+{
+    SDL_IO_ACCESS_NORMAL,       /**< No particular access pattern */
+    SDL_IO_ACCESS_SEQUENTIAL,   /**< The data will be read from start to end, read ahead aggressively */
+    SDL_IO_ACCESS_RANDOM        /**< The data will be read in no particular order, don't read ahead */
+} SDL_IOAccessPattern;
+
+/**
+ * Use this function to create a read-only SDL_IOStream backed by a memory
+ * mapping of a file.
+ *
+ * The contents of the file are not read up front, they are paged in by the
+ * operating system as the stream is read, and reads from the stream are
+ * copies out of the mapping with no system calls. The mapping itself is
+ * available through the stream properties, so data can be used in place
+ * without copying it at all.
+ *
+ * On platforms that don't support mapping files, the file is loaded into
+ * memory instead.
+ *
+ * The following properties will be set at creation time by SDL:
+ *
+ * - `SDL_PROP_IOSTREAM_MEMORY_POINTER`: a pointer to the contents of the
+ *   file, valid until the stream is closed.
+ * - `SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER`: the size of the file, in bytes.
+ *
+ * \param file a UTF-8 string representing the filename to open.
+ * \param pattern a hint for how the file will be accessed.
+ * \returns a pointer to a new SDL_IOStream structure or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CloseIO
+ * \sa SDL_MapFile
+ * \sa SDL_ReadIO
+ * \sa SDL_SeekIO
+ * \sa SDL_TellIO
+ */
+extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_IOFromMappedFile(const char *file, SDL_IOAccessPattern pattern);
+
 /* @} *//* IOFrom functions */
 
 
@@ -745,10 +799,58 @@ extern SDL_DECLSPEC void * SDLCALL SDL_LoadFile_IO(SDL_IOStream *src, size_t *da
  * \since This function is available since SDL 3.2.0.
  *
  * \sa SDL_LoadFile_IO
+ * \sa SDL_MapFile
  * \sa SDL_SaveFile
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_LoadFile(const char *file, size_t *datasize);
 
+/**
+ * Map all the data from a file path into memory.
+ *
+ * This is like SDL_LoadFile(), but the data isn't copied into an allocated
+ * buffer. The file is mapped into the address space of the process and is
+ * paged in by the operating system as it's accessed, so loading a large
+ * file is nearly free and untouched parts of it never take up memory.
+ *
+ * The mapping is private to the process: the data may be modified, but
+ * changes aren't written back to the file. Unlike SDL_LoadFile(), the data
+ * is not null terminated.
+ *
+ * Only files that are in the filesystem can be mapped. On platforms that
+ * don't support mapping files, the file is loaded into memory instead.
+ *
+ * The data should be released with SDL_UnmapFile().
+ *
+ * \param file the path to map into memory.
+ * \param datasize if not NULL, will store the size of the file.
+ * \param pattern a hint for how the data will be accessed.
+ * \returns the data or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_IOFromMappedFile
+ * \sa SDL_LoadFile
+ * \sa SDL_UnmapFile
+ */
+extern SDL_DECLSPEC void * SDLCALL SDL_MapFile(const char *file, size_t *datasize, SDL_IOAccessPattern pattern);
+
+/**
+ * Release data returned by SDL_MapFile().
+ *
+ * \param mem the pointer returned by SDL_MapFile(), may be NULL.
+ * \param datasize the size returned by SDL_MapFile().
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_MapFile
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_UnmapFile(void *mem, size_t datasize);
+
 /**
  * Save all the data into an SDL data stream.
  *
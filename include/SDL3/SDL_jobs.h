@@ -0,0 +1,345 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* WIKI CATEGORY: Jobs */
+
+/**
+ * # CategoryJobs
+ *
+ * SDL offers a pool of worker threads that run small pieces of work, called
+ * jobs, in parallel.
+ *
+ * A job is just a function and a userdata pointer. Jobs are handed to a pool
+ * with SDL_SubmitJob(), and one of the pool's threads will call the function
+ * as soon as it can. Each worker thread keeps its own queue of jobs, and a
+ * thread that runs out of work takes jobs from the others, so work spreads
+ * across the pool without everyone fighting over a single lock.
+ *
+ * To find out when jobs are done, submit them with an SDL_JobCounter. The
+ * counter goes up by one when a job is submitted with it, and down by one
+ * when the job finishes, so it reaches zero when every job submitted with it
+ * is complete. SDL_WaitJobCounter() blocks until that happens, but instead of
+ * sleeping, the waiting thread runs jobs from the pool itself while it waits.
+ * A job can also be given a counter to depend on, and it won't start until
+ * that counter reaches zero, which is how chains and graphs of jobs are
+ * built.
+ *
+ * Loops over a large number of independent items can be split across the
+ * pool with SDL_ParallelFor(), which takes care of all of this for you.
+ *
+ * Most apps only need one pool. Passing NULL for the pool to any of these
+ * functions uses a default pool, which SDL creates the first time it's
+ * needed, with a worker thread for each physical CPU core except the one the
+ * app is running on. It is destroyed by SDL_Quit().
+ *
+ * Jobs should be short and should not block on other threads, aside from
+ * waiting on job counters; a job that waits for something outside of the
+ * pool ties up a worker thread while it does. Long-running or blocking work
+ * is better off on its own thread, made with SDL_CreateThread().
+ *
+ * On platforms without thread support, the pool has no worker threads, and
+ * jobs run on the calling thread when it waits on a counter or destroys the
+ * pool.
+ */
+
+#ifndef SDL_jobs_h_
+#define SDL_jobs_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_properties.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * A pool of worker threads that run jobs.
+ *
+ * This is an opaque datatype.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobPool
+ */
+typedef struct SDL_JobPool SDL_JobPool;
+
+/**
+ * A count of jobs that haven't finished yet.
+ *
+ * This is an opaque datatype.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobCounter
+ */
+typedef struct SDL_JobCounter SDL_JobCounter;
+
+/**
+ * A callback that runs a job.
+ *
+ * \param userdata the pointer passed to SDL_SubmitJob().
+ *
+ * \threadsafety This will be called on one of the pool's worker threads, or
+ *               on a thread waiting on the pool.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+typedef void (SDLCALL *SDL_JobCallback)(void *userdata);
+
+/**
+ * A callback that handles a range of items in SDL_ParallelFor().
+ *
+ * \param userdata the pointer passed to SDL_ParallelFor().
+ * \param start the first item to handle.
+ * \param end one past the last item to handle.
+ *
+ * \threadsafety This will be called on several threads at the same time,
+ *               each with a different range of items.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_ParallelFor
+ */
+typedef void (SDLCALL *SDL_ParallelForCallback)(void *userdata, int start, int end);
+
+/**
+ * Create a new pool of worker threads.
+ *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_JOBPOOL_CREATE_NUM_THREADS_NUMBER`: the number of worker
+ *   threads to start. Optional, defaults to the number of physical CPU cores
+ *   minus one, leaving a core for the thread that submits and waits on jobs,
+ *   with a minimum of one thread. A pool with no threads runs its jobs on
+ *   whichever thread waits on it.
+ * - `SDL_PROP_JOBPOOL_CREATE_NAME_STRING`: the name to give the worker
+ *   threads, with the thread's index added to the end. Optional, defaults to
+ *   "SDLJob".
+ * - `SDL_PROP_JOBPOOL_CREATE_STACKSIZE_NUMBER`: the size, in bytes, of each
+ *   worker thread's stack. Optional, defaults to 0 (system-defined default).
+ * - `SDL_PROP_JOBPOOL_CREATE_PIN_THREADS_BOOLEAN`: true to keep each worker
+ *   thread on its own physical CPU core, picking performance cores first.
+ *   Optional, defaults to false.
+ *
+ * \param props the properties to use, may be 0 to use the defaults.
+ * \returns a new job pool on success or NULL on failure; call SDL_GetError()
+ *          for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyJobPool
+ * \sa SDL_GetCPUTopology
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC SDL_JobPool * SDLCALL SDL_CreateJobPool(SDL_PropertiesID props);
+
+#define SDL_PROP_JOBPOOL_CREATE_NUM_THREADS_NUMBER      "SDL.jobpool.create.num_threads"
+#define SDL_PROP_JOBPOOL_CREATE_NAME_STRING             "SDL.jobpool.create.name"
+#define SDL_PROP_JOBPOOL_CREATE_STACKSIZE_NUMBER        "SDL.jobpool.create.stacksize"
+#define SDL_PROP_JOBPOOL_CREATE_PIN_THREADS_BOOLEAN     "SDL.jobpool.create.pin_threads"
+
+/**
+ * Get the number of worker threads in a job pool.
+ *
+ * \param pool the job pool to query, or NULL for the default pool.
+ * \returns the number of worker threads, which may be 0 on platforms without
+ *          thread support, or -1 on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobPool
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetNumJobPoolThreads(SDL_JobPool *pool);
+
+/**
+ * Destroy a job pool.
+ *
+ * This runs every job that has been submitted to the pool, including ones
+ * that are still waiting on a dependency, and then stops the worker threads.
+ * It blocks until all of that is done, helping to run jobs in the meantime.
+ *
+ * \param pool the job pool to destroy.
+ *
+ * \threadsafety This function must not be called from one of the pool's own
+ *               jobs. No other thread may use the pool once this has been
+ *               called.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobPool
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobPool(SDL_JobPool *pool);
+
+/**
+ * Create a job counter.
+ *
+ * A counter starts at zero, goes up by one for each job submitted with it,
+ * and goes down by one each time one of those jobs finishes. It can be used
+ * again once it reaches zero.
+ *
+ * \returns a new job counter on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_DestroyJobCounter
+ * \sa SDL_SubmitJob
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC SDL_JobCounter * SDLCALL SDL_CreateJobCounter(void);
+
+/**
+ * Get the number of jobs submitted with a counter that haven't finished.
+ *
+ * \param counter the job counter to query.
+ * \returns the number of unfinished jobs, or -1 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetJobCounterValue(SDL_JobCounter *counter);
+
+/**
+ * Destroy a job counter.
+ *
+ * The counter must have reached zero, and no jobs may be waiting on it as a
+ * dependency.
+ *
+ * \param counter the job counter to destroy.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobCounter
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyJobCounter(SDL_JobCounter *counter);
+
+/**
+ * Submit a job to a job pool.
+ *
+ * The callback will be called once, on one of the pool's worker threads or
+ * on a thread waiting on the pool, as soon as `dependency` reaches zero.
+ *
+ * If `counter` isn't NULL, it goes up by one before this function returns,
+ * and down by one after the callback returns.
+ *
+ * A job submitted from inside another job of the same pool goes into that
+ * worker thread's own queue, and is usually the next job it runs, since the
+ * data it uses is likely still in that CPU's cache.
+ *
+ * A counter should only be used with jobs from a single pool, and waited on
+ * with that pool.
+ *
+ * \param pool the job pool to run the job on, or NULL for the default pool.
+ * \param callback the function to call.
+ * \param userdata a pointer that is passed to `callback`.
+ * \param dependency a counter that must reach zero before the job starts, or
+ *                   NULL to start the job right away.
+ * \param counter a counter to track the job with, or NULL.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateJobCounter
+ * \sa SDL_WaitJobCounter
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SubmitJob(SDL_JobPool *pool, SDL_JobCallback callback, void *userdata, SDL_JobCounter *dependency, SDL_JobCounter *counter);
+
+/**
+ * Wait for a job counter to reach zero.
+ *
+ * While it waits, the calling thread runs jobs from the pool, so it's fine to
+ * call this from inside a job. It only sleeps if there's nothing left in the
+ * pool for it to do.
+ *
+ * \param pool the job pool the counter's jobs were submitted to, or NULL for
+ *             the default pool.
+ * \param counter the job counter to wait on.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_WaitJobCounter(SDL_JobPool *pool, SDL_JobCounter *counter);
+
+/**
+ * Call a function for every item in a range, on several threads at once.
+ *
+ * The items from 0 to `count` - 1 are split up into batches of `batch_size`
+ * items, and `callback` is called once for each batch, with the range of
+ * items in that batch. The calling thread handles batches too, and this
+ * function returns once every batch is done.
+ *
+ * Batches are handed out as threads become free, so uneven amounts of work
+ * per item are spread out evenly. Smaller batches spread the work better,
+ * larger batches cost less to hand out.
+ *
+ * \param pool the job pool to use, or NULL for the default pool.
+ * \param count the number of items.
+ * \param batch_size the number of items in each batch, or 0 to pick a size
+ *                   that gives each thread a few batches.
+ * \param callback the function to call for each batch.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, including
+ *               from inside a job.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SubmitJob
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_ParallelFor(SDL_JobPool *pool, int count, int batch_size, SDL_ParallelForCallback callback, void *userdata);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_jobs_h_ */
@@ -774,6 +774,16 @@ extern SDL_DECLSPEC bool SDLCALL SDL_SendJoystickVirtualSensorData(SDL_Joystick
  * - `SDL_PROP_JOYSTICK_CAP_TRIGGER_RUMBLE_BOOLEAN`: true if this joystick has
  *   simple trigger rumble
  *
+ * On Linux, evdev joysticks also provide these counters, which are updated
+ * when joysticks are updated:
+ *
+ * - `SDL_PROP_JOYSTICK_INPUT_EVENTS_READ_NUMBER`: the number of input events
+ *   read from the device, including the synchronization events that end each
+ *   device report
+ * - `SDL_PROP_JOYSTICK_INPUT_EVENTS_DELIVERED_NUMBER`: the number of axis,
+ *   button, hat and sensor updates generated from those events. Axis changes
+ *   within a single device report are combined into one update.
+ *
  * \param joystick the SDL_Joystick obtained from SDL_OpenJoystick().
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -789,6 +799,8 @@ extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetJoystickProperties(SDL_Joyst
 #define SDL_PROP_JOYSTICK_CAP_PLAYER_LED_BOOLEAN        "SDL.joystick.cap.player_led"
 #define SDL_PROP_JOYSTICK_CAP_RUMBLE_BOOLEAN            "SDL.joystick.cap.rumble"
 #define SDL_PROP_JOYSTICK_CAP_TRIGGER_RUMBLE_BOOLEAN    "SDL.joystick.cap.trigger_rumble"
+#define SDL_PROP_JOYSTICK_INPUT_EVENTS_READ_NUMBER      "SDL.joystick.input.events_read"
+#define SDL_PROP_JOYSTICK_INPUT_EVENTS_DELIVERED_NUMBER "SDL.joystick.input.events_delivered"
 
 /**
  * Get the implementation dependent name of a joystick.
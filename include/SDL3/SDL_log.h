@@ -71,6 +71,7 @@
 #define SDL_log_h_
 
 #include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_properties.h>
 
 #include <SDL3/SDL_begin_code.h>
 /* Set up for C function definitions, even when using C++ */
@@ -531,6 +532,143 @@ extern SDL_DECLSPEC void SDLCALL SDL_GetLogOutputFunction(SDL_LogOutputFunction
  */
 extern SDL_DECLSPEC void SDLCALL SDL_SetLogOutputFunction(SDL_LogOutputFunction callback, void *userdata);
 
+/**
+ * Get the time a log message was generated.
+ *
+ * This is only meaningful when called from inside a log output function, and
+ * returns the time the message currently being output was logged. When
+ * asynchronous logging is enabled this can be noticeably earlier than the
+ * time the output function is called.
+ *
+ * \returns the time the message was logged, in nanoseconds since SDL library
+ *          initialization, as returned by SDL_GetTicksNS(), or 0 if no
+ *          message is being output.
+ *
+ * \threadsafety This function should only be called from a log output
+ *               function.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetLogOutputFunction
+ */
+extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetLogMessageTimestamp(void);
+
+/**
+ * The policy for log messages when the asynchronous log buffer is full.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_StartAsyncLogging
+ */
+typedef enum SDL_LogOverflowPolicy
+{
+    SDL_LOG_OVERFLOW_DROP,      /**< Discard the message */
+    SDL_LOG_OVERFLOW_BLOCK      /**< Wait for the log thread to make room for the message */
+} SDL_LogOverflowPolicy;
+
+/**
+ * Start delivering log messages asynchronously.
+ *
+ * By default the log output function is called on the thread that logs a
+ * message, while holding a lock that serializes all logging threads. Once
+ * asynchronous logging has started, each thread formats its messages into
+ * its own lock-free buffer, and a dedicated thread passes them to the log
+ * output function. Messages from each thread are delivered in the order they
+ * were logged, and messages from different threads are merged by the time
+ * they were logged.
+ *
+ * The output function is then always called on the log thread, so it should
+ * not depend on being called from the thread that logged the message.
+ * SDL_GetLogMessageTimestamp() can be used to find out when a message was
+ * logged.
+ *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_ASYNC_LOGGING_BUFFER_SIZE_NUMBER`: the size in bytes of the
+ *   buffer that each logging thread uses to queue messages, defaults to 64
+ *   KB. Messages longer than a quarter of this size are truncated.
+ * - `SDL_PROP_ASYNC_LOGGING_OVERFLOW_POLICY_NUMBER`: an SDL_LogOverflowPolicy
+ *   value for what to do with new messages when a thread's buffer is full,
+ *   defaults to SDL_LOG_OVERFLOW_DROP. When messages are dropped, a warning
+ *   with the number of dropped messages is logged in the
+ *   SDL_LOG_CATEGORY_SYSTEM category.
+ * - `SDL_PROP_ASYNC_LOGGING_DEFERRED_FORMAT_BOOLEAN`: true if messages should
+ *   be queued as their format string and raw arguments and formatted on the
+ *   log thread, defaults to false. This takes formatting off the logging
+ *   threads. The format string and string arguments are copied, so they
+ *   don't need to outlive the call. Messages with arguments that can't be
+ *   deferred, like wide strings or unusually long conversion
+ *   specifications, are formatted immediately.
+ * - `SDL_PROP_ASYNC_LOGGING_CAPTURE_STREAM_POINTER`: an SDL_IOStream that
+ *   receives log messages in a compact binary format instead of the log
+ *   output function. Deferred messages are written as their arguments, along
+ *   with each format string the first time it's used, so they are never
+ *   formatted while the application is running. The stream is not closed
+ *   when asynchronous logging stops. The testlogdecode program in the SDL
+ *   test directory can be used to turn a capture into text.
+ *
+ * Calling this function while asynchronous logging is running updates the
+ * settings. The buffer size of threads that have already logged a message
+ * changes once their buffer is empty.
+ *
+ * Messages are filtered with SDL_GetLogPriority() before they're queued, so
+ * messages below the priority of their category never reach the buffer or
+ * the capture stream.
+ *
+ * Asynchronous logging is stopped by SDL_Quit(), after any pending messages
+ * have been delivered.
+ *
+ * \param props the properties to use, may be 0.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function should not be called at the same time as
+ *               SDL_StopAsyncLogging().
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_FlushLogs
+ * \sa SDL_StopAsyncLogging
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_StartAsyncLogging(SDL_PropertiesID props);
+
+#define SDL_PROP_ASYNC_LOGGING_BUFFER_SIZE_NUMBER          "SDL.log.async.buffer_size"
+#define SDL_PROP_ASYNC_LOGGING_OVERFLOW_POLICY_NUMBER      "SDL.log.async.overflow_policy"
+#define SDL_PROP_ASYNC_LOGGING_DEFERRED_FORMAT_BOOLEAN     "SDL.log.async.deferred_format"
+#define SDL_PROP_ASYNC_LOGGING_CAPTURE_STREAM_POINTER      "SDL.log.async.capture_stream"
+
+/**
+ * Wait for all queued log messages to be delivered.
+ *
+ * When this function returns, every message logged by this thread before the
+ * call has been passed to the log output function. This does nothing if
+ * asynchronous logging isn't enabled.
+ *
+ * \threadsafety It is safe to call this function from any thread, but it
+ *               should not be called from a log output function.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_StartAsyncLogging
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_FlushLogs(void);
+
+/**
+ * Stop delivering log messages asynchronously.
+ *
+ * Any pending messages are delivered before this function returns, and log
+ * messages are passed to the output function on the logging thread again.
+ * If a capture stream was set, it is flushed and no longer used.
+ *
+ * \threadsafety This function should not be called at the same time as
+ *               SDL_StartAsyncLogging().
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_StartAsyncLogging
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_StopAsyncLogging(void);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
@@ -357,6 +357,89 @@ extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_GetProcessInput(SDL_Process *proc
  */
 extern SDL_DECLSPEC SDL_IOStream * SDLCALL SDL_GetProcessOutput(SDL_Process *process);
 
+/**
+ * A callback that receives process output as it arrives.
+ *
+ * The data points directly at the buffer the output was read into and is
+ * only valid for the duration of the callback; copy anything you need to
+ * keep. When the process closes the stream, the callback is called one last
+ * time with `data` set to NULL and `datasize` set to 0.
+ *
+ * \param userdata an app-controlled pointer passed to
+ *                 SDL_SetProcessOutputCallback().
+ * \param process the process that produced the output.
+ * \param is_stderr true if the data came from standard error, false if it
+ *                  came from standard output.
+ * \param data the output, or NULL at the end of the stream.
+ * \param datasize the number of bytes in `data`.
+ *
+ * \threadsafety This callback is called from the thread that calls
+ *               SDL_WaitProcesses() or SDL_WaitProcess().
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetProcessOutputCallback
+ */
+typedef void (SDLCALL *SDL_ProcessOutputCallback)(void *userdata, SDL_Process *process, bool is_stderr, const void *data, size_t datasize);
+
+/**
+ * Have process output delivered to a callback instead of read from a stream.
+ *
+ * This applies to standard output and standard error when they were created
+ * with `SDL_PROCESS_STDIO_APP`. Once a callback is set, output is read in
+ * large chunks and handed to the callback by SDL_WaitProcesses() and
+ * SDL_WaitProcess(), so one thread can supervise many processes without any
+ * of them blocking on a full pipe. Don't read from the streams returned by
+ * SDL_GetProcessOutput() or the `SDL_PROP_PROCESS_STDERR_POINTER` property
+ * while a callback is set, and SDL_ReadProcess() will fail.
+ *
+ * \param process the process to receive output from.
+ * \param callback the function to call with output, or NULL to go back to
+ *                 reading the streams directly.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety This function is not thread safe.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_WaitProcesses
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetProcessOutputCallback(SDL_Process *process, SDL_ProcessOutputCallback callback, void *userdata);
+
+/**
+ * Wait for output or exit on any of a set of processes.
+ *
+ * This blocks until at least one of the processes produces output or exits,
+ * or until the timeout elapses. Available output from processes that have an
+ * output callback is delivered to the callback, and processes that have
+ * exited are reaped, so a following SDL_WaitProcess() call reports their exit
+ * code without blocking.
+ *
+ * A process counts as finished once it has exited and, if it has an output
+ * callback, all of its output has been delivered. If every process is
+ * already finished, this returns immediately.
+ *
+ * On Linux this waits on the output pipes and a pidfd for each process with
+ * poll(), so the calling thread sleeps until there is something to do.
+ *
+ * \param processes an array of processes to wait on.
+ * \param num_processes the number of processes in the array.
+ * \param timeoutMS the maximum time to wait, in milliseconds, 0 to check
+ *                  without blocking, or -1 to wait indefinitely.
+ * \returns the number of processes in the array that have finished, or -1 on
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety This function is not thread safe.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetProcessOutputCallback
+ * \sa SDL_WaitProcess
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_WaitProcesses(SDL_Process **processes, int num_processes, Sint32 timeoutMS);
+
 /**
  * Stop a process.
  *
@@ -393,7 +476,9 @@ extern SDL_DECLSPEC bool SDLCALL SDL_KillProcess(SDL_Process *process, bool forc
  * (`pipe_stdio` being true) then you should read all of the process output
  * before calling SDL_WaitProcess(). If you don't do this the process might be
  * blocked indefinitely waiting for output to be read and SDL_WaitProcess()
- * will never return true;
+ * will never return true; alternatively, set an output callback with
+ * SDL_SetProcessOutputCallback() and this function will keep delivering
+ * output while it waits.
  *
  * \param process The process to wait for.
  * \param block If true, block until the process finishes; otherwise, report
@@ -410,6 +495,7 @@ extern SDL_DECLSPEC bool SDLCALL SDL_KillProcess(SDL_Process *process, bool forc
  * \sa SDL_CreateProcessWithProperties
  * \sa SDL_KillProcess
  * \sa SDL_DestroyProcess
+ * \sa SDL_WaitProcesses
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_WaitProcess(SDL_Process *process, bool block, int *exitcode);
 
@@ -1633,6 +1633,149 @@ extern SDL_DECLSPEC void SDLCALL SDL_aligned_free(void *mem);
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
 
+/**
+ * Statistics kept by SDL's memory allocator.
+ *
+ * The allocation counts and the per-thread cache figures are only kept when
+ * SDL is built with per-thread allocator caches, and are zero otherwise.
+ * Figures that the allocator doesn't provide are zero.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetMemoryStats
+ */
+typedef struct SDL_MemoryStats
+{
+    Uint64 num_allocations;     /**< the number of blocks allocated so far */
+    Uint64 num_frees;           /**< the number of blocks freed so far */
+    Uint64 cache_hits;          /**< allocations satisfied from a per-thread cache */
+    Uint64 cache_refills;       /**< batches of blocks moved from the shared heap into a per-thread cache */
+    Uint64 cache_flushes;       /**< batches of blocks returned from a per-thread cache to the shared heap */
+    size_t cached_bytes;        /**< the size of the free blocks currently held in per-thread caches */
+    size_t heap_in_use;         /**< the size of the allocated heap blocks, including cached ones */
+    size_t heap_size;           /**< the memory currently obtained from the system for the heap */
+    size_t heap_peak_size;      /**< the largest heap_size has been */
+    int num_thread_caches;      /**< the number of per-thread caches currently allocated, in use or waiting to be reused */
+} SDL_MemoryStats;
+
+/**
+ * Get statistics from SDL's memory allocator.
+ *
+ * When SDL was built without the C runtime library it uses its own
+ * allocator, and all of the statistics are available. Otherwise only the
+ * heap figures the C runtime reports are filled in, which currently means
+ * glibc's `mallinfo2()`, and the rest are zero. The statistics describe the
+ * allocator SDL was built with, even if the application has replaced the
+ * memory functions with SDL_SetMemoryFunctions().
+ *
+ * A thread's allocator cache is returned to the heap and made available to
+ * new threads when the thread calls SDL_CleanupTLS(), which threads created
+ * with SDL_CreateThread() do as they exit. Threads created outside of SDL
+ * should call it too before they exit; otherwise their caches, and the
+ * blocks in them, are never returned. SDL_Quit() frees the caches no thread
+ * is using.
+ *
+ * Getting the heap figures walks the whole heap while holding the heap lock,
+ * so this function is not meant to be called often.
+ *
+ * \param stats a pointer filled in with the current statistics.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread. Each
+ *               thread publishes its counts when it moves blocks between
+ *               its cache and the heap, so the counts of threads that are
+ *               allocating at the same time may be slightly out of date.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetNumAllocations
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_GetMemoryStats(SDL_MemoryStats *stats);
+
+/**
+ * An arena that hands out memory from large blocks and frees it all at once.
+ *
+ * Allocating from an arena is usually just a pointer bump, which makes it a
+ * good fit for scratch memory that lives for one frame or one task. The
+ * memory is freed in one go with SDL_ResetMemoryArena(), and the arena's
+ * blocks are kept and reused for the next round of allocations.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateMemoryArena
+ */
+typedef struct SDL_MemoryArena SDL_MemoryArena;
+
+/**
+ * Create a memory arena.
+ *
+ * \param block_size the size of the blocks the arena allocates from, or 0 for
+ *                   a reasonable default. Allocations bigger than half of
+ *                   this get a block of their own.
+ * \returns a new memory arena or NULL on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_AllocateArenaMemory
+ * \sa SDL_ResetMemoryArena
+ * \sa SDL_DestroyMemoryArena
+ */
+extern SDL_DECLSPEC SDL_MemoryArena * SDLCALL SDL_CreateMemoryArena(size_t block_size);
+
+/**
+ * Allocate memory from a memory arena.
+ *
+ * The memory is aligned to 16 bytes, is not initialized, and stays valid
+ * until the arena is reset or destroyed. It must not be passed to SDL_free().
+ *
+ * If `size` is 0, it will be set to 1.
+ *
+ * \param arena the memory arena to allocate from.
+ * \param size the size to allocate.
+ * \returns a pointer to the allocated memory, or NULL if allocation failed.
+ *
+ * \threadsafety An arena may only be used by one thread at a time.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ResetMemoryArena
+ */
+extern SDL_DECLSPEC SDL_MALLOC void * SDLCALL SDL_AllocateArenaMemory(SDL_MemoryArena *arena, size_t size);
+
+/**
+ * Free all the memory allocated from a memory arena.
+ *
+ * Every pointer returned by SDL_AllocateArenaMemory() for this arena is no
+ * longer valid after this call. The arena keeps its blocks to reuse them
+ * for later allocations.
+ *
+ * \param arena the memory arena to reset.
+ *
+ * \threadsafety An arena may only be used by one thread at a time.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_AllocateArenaMemory
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ResetMemoryArena(SDL_MemoryArena *arena);
+
+/**
+ * Destroy a memory arena and free all of its memory.
+ *
+ * \param arena the memory arena to destroy.
+ *
+ * \threadsafety An arena may only be used by one thread at a time.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateMemoryArena
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_DestroyMemoryArena(SDL_MemoryArena *arena);
+
 /**
  * A thread-safe set of environment variables
  *
@@ -1908,6 +2051,9 @@ typedef int (SDLCALL *SDL_CompareCallback)(const void *a, const void *b);
  * SDL_qsort(values, SDL_arraysize(values), sizeof(values[0]), compare);
  * ```
  *
+ * The sort is not stable, never allocates memory, and takes O(n log n) time
+ * even for arrays arranged to defeat it.
+ *
  * \param base a pointer to the start of the array.
  * \param nmemb the number of elements in the array.
  * \param size the size of the elements in the array.
@@ -1919,6 +2065,7 @@ typedef int (SDLCALL *SDL_CompareCallback)(const void *a, const void *b);
  *
  * \sa SDL_bsearch
  * \sa SDL_qsort_r
+ * \sa SDL_RadixSort
  */
 extern SDL_DECLSPEC void SDLCALL SDL_qsort(void *base, size_t nmemb, size_t size, SDL_CompareCallback compare);
 
@@ -2027,6 +2174,9 @@ typedef int (SDLCALL *SDL_CompareCallback_r)(void *userdata, const void *a, cons
  * SDL_qsort_r(values, SDL_arraysize(values), sizeof(values[0]), compare, (const void *)(uintptr_t)sort_increasing);
  * ```
  *
+ * The sort is not stable, never allocates memory, and takes O(n log n) time
+ * even for arrays arranged to defeat it.
+ *
  * \param base a pointer to the start of the array.
  * \param nmemb the number of elements in the array.
  * \param size the size of the elements in the array.
@@ -2038,6 +2188,7 @@ typedef int (SDLCALL *SDL_CompareCallback_r)(void *userdata, const void *a, cons
  * \since This function is available since SDL 3.2.0.
  *
  * \sa SDL_bsearch_r
+ * \sa SDL_ParallelSort
  * \sa SDL_qsort
  */
 extern SDL_DECLSPEC void SDLCALL SDL_qsort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
@@ -2100,6 +2251,94 @@ extern SDL_DECLSPEC void SDLCALL SDL_qsort_r(void *base, size_t nmemb, size_t si
  */
 extern SDL_DECLSPEC void * SDLCALL SDL_bsearch_r(const void *key, const void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
 
+/**
+ * Sort an array on multiple threads, passing a userdata pointer to the
+ * compare function.
+ *
+ * This sorts the same way as SDL_qsort_r(), but large arrays are split up and
+ * sorted by the threads in the default job pool, with the calling thread
+ * helping until the whole array is sorted. Small arrays, and systems with a
+ * single CPU core, are sorted on the calling thread.
+ *
+ * Sorting a large array creates the default job pool and its worker threads
+ * if nothing has used it yet. Like any use of the default pool, they stay
+ * around for later jobs until SDL_Quit() destroys them.
+ *
+ * The compare function will be called from several threads at the same time,
+ * and must be safe to do so.
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param compare a function used to compare elements in the array.
+ * \param userdata a pointer to pass to the compare function.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_ParallelFor
+ * \sa SDL_qsort_r
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_ParallelSort(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata);
+
+/**
+ * The type of integer key used by SDL_RadixSort().
+ *
+ * Keys are stored in native byte order, and don't need to be aligned.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_RadixSort
+ */
+typedef enum SDL_SortKeyType
+{
+    SDL_SORTKEY_UINT32,     /**< Uint32 keys */
+    SDL_SORTKEY_SINT32,     /**< Sint32 keys */
+    SDL_SORTKEY_UINT64,     /**< Uint64 keys */
+    SDL_SORTKEY_SINT64      /**< Sint64 keys */
+} SDL_SortKeyType;
+
+/**
+ * Sort an array in increasing order of an integer key in each element.
+ *
+ * This is a radix sort, which doesn't compare elements at all, and is much
+ * faster than SDL_qsort() for large arrays. It takes O(n) time, and is
+ * stable: elements with equal keys stay in the order they were in.
+ *
+ * A temporary copy of the array is allocated while sorting.
+ *
+ * For example:
+ *
+ * ```c
+ * typedef struct {
+ *     Uint32 key;
+ *     const char *string;
+ * } data;
+ *
+ * data values[] = {
+ *     { 3, "third" }, { 1, "first" }, { 2, "second" }
+ * };
+ *
+ * SDL_RadixSort(values, SDL_arraysize(values), sizeof(values[0]), offsetof(data, key), SDL_SORTKEY_UINT32);
+ * ```
+ *
+ * \param base a pointer to the start of the array.
+ * \param nmemb the number of elements in the array.
+ * \param size the size of the elements in the array.
+ * \param key_offset the offset of the key in each element, in bytes.
+ * \param key_type the type of the key.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_qsort
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_RadixSort(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type);
+
 /**
  * Compute the absolute value of `x`.
  *
@@ -360,6 +360,22 @@ extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenTitleStorage(const char *overr
  * This allows the backend to properly batch file operations and flush them
  * when the container has been closed; ensuring safe and optimal save I/O.
  *
+ * These are the supported properties:
+ *
+ * - `SDL_PROP_STORAGE_USER_WRITE_BEHIND_BOOLEAN`: true to stage writes in
+ *   memory and commit them from a background thread. SDL_WriteStorageFile()
+ *   returns as soon as the data has been copied, and reads of the same path
+ *   see the staged data immediately. Each file is committed atomically, by
+ *   writing and flushing a temporary file and renaming it over the original,
+ *   so a crash part way through a save leaves either the old or the new
+ *   contents of every file, never a partial one. Use
+ *   SDL_WaitStorageCommits() to wait for the writes to reach the disk and
+ *   SDL_GetStoragePendingCommits() to check on their progress;
+ *   SDL_CloseStorage() waits for all outstanding writes. The temporary files
+ *   are named ".sdl-write-behind-" followed by a unique suffix, so files
+ *   with that prefix are reserved. Currently only honored by the "generic"
+ *   user storage driver; defaults to false.
+ *
  * \param org the name of your organization.
  * \param app the name of your application.
  * \param props a property list that may contain backend-specific information.
@@ -374,10 +390,13 @@ extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenTitleStorage(const char *overr
  * \sa SDL_OpenTitleStorage
  * \sa SDL_ReadStorageFile
  * \sa SDL_StorageReady
+ * \sa SDL_WaitStorageCommits
  * \sa SDL_WriteStorageFile
  */
 extern SDL_DECLSPEC SDL_Storage * SDLCALL SDL_OpenUserStorage(const char *org, const char *app, SDL_PropertiesID props);
 
+#define SDL_PROP_STORAGE_USER_WRITE_BEHIND_BOOLEAN "SDL.storage.user.write_behind"
+
 /**
  * Opens up a container for local filesystem storage.
  *
@@ -637,6 +656,56 @@ extern SDL_DECLSPEC bool SDLCALL SDL_GetStoragePathInfo(SDL_Storage *storage, co
  */
 extern SDL_DECLSPEC Uint64 SDLCALL SDL_GetStorageSpaceRemaining(SDL_Storage *storage);
 
+/**
+ * Wait for the writes to a storage container to be committed.
+ *
+ * Storage opened with `SDL_PROP_STORAGE_USER_WRITE_BEHIND_BOOLEAN` finishes
+ * writes on a background thread. This function blocks until every write
+ * made so far has been committed to disk, or until the timeout elapses. For
+ * storage that writes synchronously this returns true immediately.
+ *
+ * If a background write failed since the last call, this returns false and
+ * the error describes the first failure; the file that failed keeps its
+ * previous contents.
+ *
+ * \param storage a storage container.
+ * \param timeoutMS the maximum time to wait, in milliseconds, or -1 to wait
+ *                  indefinitely.
+ * \returns true if all writes have been committed or false on timeout or
+ *          failure; call SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetStoragePendingCommits
+ * \sa SDL_OpenUserStorage
+ * \sa SDL_WriteStorageFile
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_WaitStorageCommits(SDL_Storage *storage, Sint32 timeoutMS);
+
+/**
+ * Query the number of writes to a storage container that are not yet
+ * committed.
+ *
+ * This counts files written with SDL_WriteStorageFile() that are still
+ * staged in memory or are being written by the background thread. Writing
+ * the same path again before it is committed replaces the staged data and
+ * does not add to the count.
+ *
+ * \param storage a storage container.
+ * \returns the number of outstanding writes, 0 if everything has been
+ *          committed, or -1 on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_WaitStorageCommits
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetStoragePendingCommits(SDL_Storage *storage);
+
 /**
  * Enumerate a directory tree, filtered by pattern, and return a list.
  *
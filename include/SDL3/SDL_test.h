@@ -30,6 +30,7 @@
 
 #include <SDL3/SDL.h>
 #include <SDL3/SDL_test_assert.h>
+#include <SDL3/SDL_test_benchmark.h>
 #include <SDL3/SDL_test_common.h>
 #include <SDL3/SDL_test_compare.h>
 #include <SDL3/SDL_test_crc32.h>
@@ -0,0 +1,134 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/**
+ *  Benchmark related functions of SDL test framework.
+ *
+ *  This code is a part of the SDL test library, not the main SDL library.
+ */
+
+/*
+  Defines types for benchmark definitions and the benchmark execution API.
+
+  A benchmark function runs the code being measured a given number of times.
+  The runner warms it up, picks a number of iterations that takes long enough
+  to time accurately, then times a series of samples and reports the median,
+  95th and 99th percentile time per iteration, along with the time and cycles
+  per item when the benchmark says how many items each iteration handles.
+*/
+
+#ifndef SDL_test_benchmark_h_
+#define SDL_test_benchmark_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_test_common.h> /* SDLTest_CommonState */
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* !< Function pointer to a benchmark setup function (run before every benchmark, failed asserts skip the benchmark) */
+typedef void (SDLCALL *SDLTest_BenchmarkSetUpFp)(void **arg);
+
+/* !< Function pointer to a benchmark function, which runs the code being measured `iterations` times.
+      Returns TEST_COMPLETED, TEST_SKIPPED if it can't run here, or TEST_ABORTED if something went wrong. */
+typedef int (SDLCALL *SDLTest_BenchmarkFp)(void *arg, int iterations);
+
+/* !< Function pointer to a benchmark teardown function (run after every benchmark) */
+typedef void (SDLCALL *SDLTest_BenchmarkTearDownFp)(void *arg);
+
+/*
+ * Holds information about a single benchmark.
+ */
+typedef struct SDLTest_BenchmarkReference {
+    /* !< Func2Benchmark */
+    SDLTest_BenchmarkFp benchmark;
+    /* !< Short name (or function name) "Func2Benchmark" */
+    const char *name;
+    /* !< Long name or full description "Measures func2() on a 1024x1024 image." */
+    const char *description;
+    /* !< Number of items (pixels, samples, events...) handled by each iteration, 0 to only report time per iteration */
+    int itemsPerIteration;
+    /* !< Set to TEST_ENABLED or TEST_DISABLED (benchmark won't be run) */
+    int enabled;
+} SDLTest_BenchmarkReference;
+
+/*
+ * Holds information about a benchmark suite (multiple benchmarks).
+ */
+typedef struct SDLTest_BenchmarkSuiteReference {
+    /* !< "BlitSuite" */
+    const char *name;
+    /* !< The function that is run before each benchmark. NULL skips. */
+    SDLTest_BenchmarkSetUpFp benchmarkSetUp;
+    /* !< The benchmarks that are run as part of the suite. Last item should be NULL. */
+    const SDLTest_BenchmarkReference **benchmarks;
+    /* !< The function that is run after each benchmark. NULL skips. */
+    SDLTest_BenchmarkTearDownFp benchmarkTearDown;
+} SDLTest_BenchmarkSuiteReference;
+
+/*
+ * Holds information about the execution of benchmark suites.
+ */
+typedef struct SDLTest_BenchmarkRunner SDLTest_BenchmarkRunner;
+
+/*
+ * Create a new benchmark runner, that will execute the given benchmark suites.
+ * It will register the benchmark cli arguments to the common SDL state:
+ *
+ * --filter suite_name|benchmark_name  run a single suite or benchmark
+ * --warmup ms                         time to spend warming up each benchmark (default 100)
+ * --time ms                           time to spend measuring each benchmark (default 1000)
+ * --samples N                         number of samples to take of each benchmark (default 50, at least 5)
+ * --json file                         write the results to a JSON file
+ *
+ * \param state Common SDL state on which to register CLI arguments.
+ * \param benchmarkSuites NULL-terminated benchmark suites containing benchmarks.
+ *
+ * \returns the new runner, or NULL on failure.
+ */
+SDLTest_BenchmarkRunner * SDLCALL SDLTest_CreateBenchmarkRunner(SDLTest_CommonState *state, SDLTest_BenchmarkSuiteReference *benchmarkSuites[]);
+
+/*
+ * Destroy a benchmark runner.
+ *
+ * \param runner The runner that should be destroyed.
+ */
+void SDLCALL SDLTest_DestroyBenchmarkRunner(SDLTest_BenchmarkRunner *runner);
+
+/*
+ * Execute the benchmark suites, using the configured filter, timing and output options.
+ *
+ * \param runner The runner that should be executed.
+ *
+ * \returns 0 when all benchmarks ran or were skipped, 1 if any failed, 2 if the filter didn't match anything.
+ */
+int SDLCALL SDLTest_ExecuteBenchmarkRunner(SDLTest_BenchmarkRunner *runner);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_test_benchmark_h_ */
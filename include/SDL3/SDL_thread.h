@@ -232,6 +232,12 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThread(SDL_ThreadFunction fn,
  *   only parameter. Optional, defaults to NULL.
  * - `SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER`: the size, in bytes, of the new
  *   thread's stack. Optional, defaults to 0 (system-defined default).
+ * - `SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER`: a pointer to an array of
+ *   `int` logical CPU numbers that the new thread is allowed to run on. The
+ *   array is copied and doesn't need to outlive this call. Optional,
+ *   defaults to NULL (run on any CPU).
+ * - `SDL_PROP_THREAD_CREATE_CPU_AFFINITY_COUNT_NUMBER`: the number of CPUs
+ *   in `SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER`.
  *
  * SDL makes an attempt to report `SDL_PROP_THREAD_CREATE_NAME_STRING` to the
  * system, so that debuggers can display it. Not all platforms support this.
@@ -258,6 +264,10 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThread(SDL_ThreadFunction fn,
  * of the system's page size (in many cases, this is 4 kilobytes, but check
  * your system documentation).
  *
+ * The CPU affinity is set by the new thread before it calls the entry
+ * function, see SDL_SetThreadAffinity() for details. If the affinity can't
+ * be set, the thread is still created and runs on any CPU.
+ *
  * Note that this "function" is actually a macro that calls an internal
  * function with two extra parameters not listed here; they are hidden through
  * preprocessor macros and are needed to support various C runtimes at the
@@ -281,6 +291,7 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThread(SDL_ThreadFunction fn,
  * \since This function is available since SDL 3.2.0.
  *
  * \sa SDL_CreateThread
+ * \sa SDL_SetThreadAffinity
  * \sa SDL_WaitThread
  */
 extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThreadWithProperties(SDL_PropertiesID props);
@@ -289,6 +300,8 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThreadWithProperties(SDL_Prop
 #define SDL_PROP_THREAD_CREATE_NAME_STRING                             "SDL.thread.create.name"
 #define SDL_PROP_THREAD_CREATE_USERDATA_POINTER                        "SDL.thread.create.userdata"
 #define SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER                        "SDL.thread.create.stacksize"
+#define SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER                   "SDL.thread.create.cpu_affinity"
+#define SDL_PROP_THREAD_CREATE_CPU_AFFINITY_COUNT_NUMBER              "SDL.thread.create.cpu_affinity_count"
 
 /* end wiki documentation for macros that are meant to look like functions. */
 #endif
@@ -361,6 +374,8 @@ extern SDL_DECLSPEC SDL_Thread * SDLCALL SDL_CreateThreadWithPropertiesRuntime(S
 #define SDL_PROP_THREAD_CREATE_NAME_STRING                             "SDL.thread.create.name"
 #define SDL_PROP_THREAD_CREATE_USERDATA_POINTER                        "SDL.thread.create.userdata"
 #define SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER                        "SDL.thread.create.stacksize"
+#define SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER                   "SDL.thread.create.cpu_affinity"
+#define SDL_PROP_THREAD_CREATE_CPU_AFFINITY_COUNT_NUMBER              "SDL.thread.create.cpu_affinity_count"
 #endif
 
 
@@ -433,6 +448,32 @@ extern SDL_DECLSPEC SDL_ThreadID SDLCALL SDL_GetThreadID(SDL_Thread *thread);
  */
 extern SDL_DECLSPEC bool SDLCALL SDL_SetCurrentThreadPriority(SDL_ThreadPriority priority);
 
+/**
+ * Set the logical CPUs that a thread is allowed to run on.
+ *
+ * The CPU numbers are the ones reported in the `cpu` field by
+ * SDL_GetCPUTopology(). Passing a `count` of 0 lets the thread run on any
+ * CPU again.
+ *
+ * This is currently supported on Linux and Windows, and on Android for the
+ * current thread only. On Windows, only CPUs numbered below 64 can be used.
+ *
+ * \param thread the thread to change, or NULL for the current thread.
+ * \param cpus an array of logical CPU numbers the thread can run on, may be
+ *             NULL if `count` is 0.
+ * \param count the number of CPUs in `cpus`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_CreateThreadWithProperties
+ * \sa SDL_GetCPUTopology
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetThreadAffinity(SDL_Thread *thread, const int *cpus, int count);
+
 /**
  * Wait for a thread to finish.
  *
@@ -0,0 +1,302 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/* WIKI CATEGORY: Trace */
+
+/**
+ * # CategoryTrace
+ *
+ * SDL can report what it's doing internally to a profiler, so time spent in
+ * SDL shows up in the same timeline as the app's own work.
+ *
+ * SDL marks the start and end of its busiest work, like presenting a frame,
+ * running a renderer's command queue, mixing audio, pumping events, blitting
+ * surfaces and updating joysticks, as zones. It also reports counters, which
+ * are named values that change over time, and frame marks, which separate
+ * one frame from the next. Apps can add their own zones, counters and frame
+ * marks with the same functions SDL uses.
+ *
+ * All of these are sent to a callback set with SDL_SetTraceCallback(), which
+ * can forward them to whatever profiler the app uses. SDL comes with one
+ * that writes them to a file in the Chrome trace event format, which can be
+ * opened in Perfetto (https://ui.perfetto.dev) or chrome://tracing. Start it
+ * with SDL_StartChromeTrace(), or by setting the SDL_HINT_TRACE_FILE hint
+ * (or the "SDL_TRACE_FILE" environment variable) before SDL is initialized,
+ * which doesn't need any changes to the app.
+ *
+ * When no callback is set, tracing costs a single test of a flag at each
+ * instrumented spot. SDL can also be built without tracing at all, by
+ * configuring it with `-DSDL_TRACE=OFF`, in which case the instrumentation
+ * isn't compiled in and setting a callback fails.
+ */
+
+#ifndef SDL_trace_h_
+#define SDL_trace_h_
+
+#include <SDL3/SDL_stdinc.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_thread.h>
+
+#include <SDL3/SDL_begin_code.h>
+/* Set up for C function definitions, even when using C++ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * The kinds of events sent to a trace callback.
+ *
+ * \since This enum is available since SDL 3.6.0.
+ *
+ * \sa SDL_TraceEvent
+ */
+typedef enum SDL_TraceEventType
+{
+    SDL_TRACE_EVENT_ZONE_BEGIN,     /**< A zone started on the thread, from SDL_BeginTraceZone() */
+    SDL_TRACE_EVENT_ZONE_END,       /**< A zone on the thread ended, from SDL_EndTraceZone() */
+    SDL_TRACE_EVENT_COUNTER,        /**< A counter changed, from SDL_SetTraceCounter() */
+    SDL_TRACE_EVENT_FRAME_MARK      /**< A frame ended, from SDL_MarkTraceFrame() */
+} SDL_TraceEventType;
+
+/**
+ * An event sent to a trace callback.
+ *
+ * The name is usually a string literal, but a callback that keeps it past
+ * the end of the call should make a copy.
+ *
+ * \since This struct is available since SDL 3.6.0.
+ *
+ * \sa SDL_TraceCallback
+ */
+typedef struct SDL_TraceEvent
+{
+    SDL_TraceEventType type;    /**< What happened */
+    const char *name;           /**< The name of the zone, counter, or frame */
+    Uint64 timestamp;           /**< When it happened, in nanoseconds, from SDL_GetTicksNS() */
+    SDL_ThreadID thread;        /**< The thread it happened on */
+    double value;               /**< The new value of a counter, 0 for other events */
+} SDL_TraceEvent;
+
+/**
+ * The prototype for the trace callback function.
+ *
+ * This is called on the thread the event happened on, possibly on several
+ * threads at once, so it needs to be thread-safe. It's called for each event
+ * as it happens, so it should be quick: store the event and return.
+ *
+ * The callback must not call SDL_SetTraceCallback(), SDL_StartChromeTrace()
+ * or SDL_StopChromeTrace(). They wait for every running callback to return,
+ * including the one calling them, so they would never return.
+ *
+ * \param userdata what was passed as `userdata` to SDL_SetTraceCallback().
+ * \param event the event that happened.
+ *
+ * \threadsafety This may be called from any thread, possibly several at
+ *               once.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetTraceCallback
+ */
+typedef void (SDLCALL *SDL_TraceCallback)(void *userdata, const SDL_TraceEvent *event);
+
+/**
+ * Set the function that trace events are sent to.
+ *
+ * Once this returns, the previous callback is no longer running on any
+ * thread, so its userdata can be freed.
+ *
+ * A callback only sees the end of zones that began while it was set. Zones
+ * that are still open when it's replaced or removed never end in it.
+ *
+ * If a Chrome trace is being written, it is finished and its file is closed,
+ * as if SDL_StopChromeTrace() had been called.
+ *
+ * The callback is removed by SDL_Quit().
+ *
+ * \param callback the function to call with trace events, or NULL to stop
+ *                 tracing.
+ * \param userdata a pointer that is passed to `callback`.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information. This fails if SDL was built without tracing.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               from within a trace callback, where it deadlocks.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_GetTraceCallback
+ * \sa SDL_StartChromeTrace
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata);
+
+/**
+ * Get the function that trace events are sent to.
+ *
+ * \param callback an SDL_TraceCallback filled in with the current trace
+ *                 callback, or NULL if there isn't one.
+ * \param userdata a pointer filled in with the pointer that is passed to
+ *                 `callback`.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_SetTraceCallback
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_GetTraceCallback(SDL_TraceCallback *callback, void **userdata);
+
+/**
+ * A handle for a zone started with SDL_BeginTraceZone().
+ *
+ * This is 0 if the zone isn't being traced, and otherwise identifies the
+ * trace callback that saw the zone begin.
+ *
+ * \since This datatype is available since SDL 3.6.0.
+ *
+ * \sa SDL_BeginTraceZone
+ * \sa SDL_EndTraceZone
+ */
+typedef Uint32 SDL_TraceZone;
+
+/**
+ * Start a zone on the current thread.
+ *
+ * Zones are periods of time spent doing something, and nest within each
+ * other on the same thread. Every call to this function should be matched by
+ * a call to SDL_EndTraceZone() on the same thread, with the handle this
+ * returns.
+ *
+ * Whether the zone is traced is decided here, once: if there is no trace
+ * callback this returns 0, and the zone's end isn't sent even if a callback
+ * is set by then.
+ *
+ * \param name the name of the zone, which should stay valid for the life of
+ *             the program, like a string literal.
+ * \returns a handle to pass to SDL_EndTraceZone(), or 0 if the zone isn't
+ *          being traced.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_EndTraceZone
+ */
+extern SDL_DECLSPEC SDL_TraceZone SDLCALL SDL_BeginTraceZone(const char *name);
+
+/**
+ * End a zone on the current thread.
+ *
+ * The end is only sent to the trace callback that saw the zone begin, so
+ * this does nothing if `zone` is 0, or if the callback has changed since.
+ *
+ * \param zone the handle returned by SDL_BeginTraceZone().
+ * \param name the name the zone was started with.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_BeginTraceZone
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_EndTraceZone(SDL_TraceZone zone, const char *name);
+
+/**
+ * Report a new value for a counter.
+ *
+ * Counters are values that change over time, like the number of items in a
+ * queue or the bytes used by something, and are usually shown as a graph.
+ *
+ * This does nothing if there is no trace callback.
+ *
+ * \param name the name of the counter, which should stay valid for the life
+ *             of the program, like a string literal.
+ * \param value the new value of the counter.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_SetTraceCounter(const char *name, double value);
+
+/**
+ * Mark the end of a frame.
+ *
+ * SDL_RenderPresent() marks the end of each frame it presents, so apps that
+ * use the 2D renderer don't need to call this themselves.
+ *
+ * This does nothing if there is no trace callback.
+ *
+ * \param name the name of the frame, which should stay valid for the life of
+ *             the program, like a string literal, or NULL for the main frame.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.6.0.
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_MarkTraceFrame(const char *name);
+
+/**
+ * Start writing trace events to a file in the Chrome trace event format.
+ *
+ * This sets the trace callback to one that writes each event to `file`,
+ * replacing any callback that was set before. The file can be opened in
+ * Perfetto (https://ui.perfetto.dev) or chrome://tracing.
+ *
+ * If a Chrome trace is already being written, it is finished first.
+ *
+ * \param file the path of the file to write, which is replaced if it
+ *             exists.
+ * \returns true on success or false on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               from within a trace callback, where it deadlocks.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_StopChromeTrace
+ */
+extern SDL_DECLSPEC bool SDLCALL SDL_StartChromeTrace(const char *file);
+
+/**
+ * Finish writing a Chrome trace and close the file.
+ *
+ * This removes the trace callback if it's the one set by
+ * SDL_StartChromeTrace(), and otherwise does nothing. SDL_Quit() calls this
+ * for you.
+ *
+ * \threadsafety It is safe to call this function from any thread, but not
+ *               from within a trace callback, where it deadlocks.
+ *
+ * \since This function is available since SDL 3.6.0.
+ *
+ * \sa SDL_StartChromeTrace
+ */
+extern SDL_DECLSPEC void SDLCALL SDL_StopChromeTrace(void);
+
+/* Ends C function definitions when using C++ */
+#ifdef __cplusplus
+}
+#endif
+#include <SDL3/SDL_close_code.h>
+
+#endif /* SDL_trace_h_ */
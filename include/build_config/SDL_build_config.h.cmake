@@ -41,6 +41,7 @@
 #cmakedefine HAVE_GCC_SYNC_LOCK_TEST_AND_SET 1
 
 #cmakedefine SDL_DISABLE_ALLOCA 1
+#cmakedefine SDL_MALLOC_THREAD_CACHE 1
 
 /* Useful headers */
 #cmakedefine HAVE_FLOAT_H 1
@@ -73,6 +74,7 @@
 #cmakedefine HAVE_DLOPEN 1
 #cmakedefine HAVE_MALLOC 1
 #cmakedefine HAVE_FDATASYNC 1
+#cmakedefine HAVE_MALLINFO2 1
 #cmakedefine HAVE_GETENV 1
 #cmakedefine HAVE_GETHOSTNAME 1
 #cmakedefine HAVE_SETENV 1
@@ -179,6 +181,10 @@
 #cmakedefine HAVE_FSEEKO64 1
 #cmakedefine HAVE_MEMFD_CREATE 1
 #cmakedefine HAVE_POSIX_FALLOCATE 1
+#cmakedefine HAVE_PREAD 1
+#cmakedefine HAVE_PREADV 1
+#cmakedefine HAVE_COPY_FILE_RANGE 1
+#cmakedefine HAVE_SENDFILE 1
 #cmakedefine HAVE_SIGACTION 1
 #cmakedefine HAVE_SIGTIMEDWAIT 1
 #cmakedefine HAVE_SA_SIGACTION 1
@@ -211,6 +217,8 @@
 #cmakedefine HAVE_IBUS_IBUS_H 1
 #cmakedefine HAVE_INOTIFY_INIT1 1
 #cmakedefine HAVE_INOTIFY 1
+#cmakedefine HAVE_EPOLL 1
+#cmakedefine HAVE_EVENTFD 1
 #cmakedefine HAVE_LIBUSB 1
 #cmakedefine HAVE_O_CLOEXEC 1
 
@@ -250,6 +258,9 @@
 #define SDL_DEFAULT_ASSERT_LEVEL @SDL_DEFAULT_ASSERT_LEVEL@
 #endif
 
+/* SDL tracing instrumentation */
+#cmakedefine SDL_TRACE_DISABLED 1
+
 /* Allow disabling of major subsystems */
 #cmakedefine SDL_AUDIO_DISABLED 1
 #cmakedefine SDL_VIDEO_DISABLED 1
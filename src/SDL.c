@@ -44,6 +44,7 @@
 #include "SDL_hints_c.h"
 #include "SDL_log_c.h"
 #include "SDL_properties_c.h"
+#include "SDL_trace_c.h"
 #include "audio/SDL_sysaudio.h"
 #include "camera/SDL_camera_c.h"
 #include "cpuinfo/SDL_cpuinfo_c.h"
@@ -54,6 +55,7 @@
 #include "render/SDL_sysrender.h"
 #include "sensor/SDL_sensor_c.h"
 #include "stdlib/SDL_getenv_c.h"
+#include "stdlib/SDL_sysstdlib.h"
 #include "thread/SDL_thread_c.h"
 #include "tray/SDL_tray_utils.h"
 #include "video/SDL_pixels_c.h"
@@ -299,6 +301,7 @@ void SDL_InitMainThread(void)
     SDL_InitEnvironment();
     SDL_InitTicks();
     SDL_InitFilesystem();
+    SDL_InitTrace();
 
     if (!done_info) {
         const char *value;
@@ -321,6 +324,7 @@ static void SDL_QuitMainThread(void)
     SDL_QuitTicks();
     SDL_QuitEnvironment();
     SDL_QuitTLSData();
+    SDL_FreeMemoryCaches();
 }
 
 bool SDL_InitSubSystem(SDL_InitFlags flags)
@@ -703,6 +707,9 @@ void SDL_Quit(void)
 {
     SDL_bInMainQuit = true;
 
+    // Finish any jobs left in the default job pool while everything they might use is still around
+    SDL_QuitJobs();
+
     // Quit all subsystems
 #ifdef SDL_PLATFORM_WINDOWS
     SDL_HelperWindowDestroy();
@@ -733,6 +740,7 @@ void SDL_Quit(void)
      */
     SDL_zeroa(SDL_SubsystemRefCount);
 
+    SDL_QuitTrace();
     SDL_QuitLog();
     SDL_QuitHints();
     SDL_QuitProperties();
@@ -60,6 +60,7 @@ static void SDLCALL SDL_LogOutput(void *userdata, int category, SDL_LogPriority
 
 static void CleanupLogPriorities(void);
 static void CleanupLogPrefixes(void);
+static void CleanupLogRings(void);
 
 static SDL_InitState SDL_log_init;
 static SDL_Mutex *SDL_log_lock;
@@ -69,6 +70,104 @@ static SDL_LogPriority SDL_log_priorities[SDL_LOG_CATEGORY_CUSTOM] SDL_GUARDED_B
 static SDL_LogPriority SDL_log_default_priority SDL_GUARDED_BY(SDL_log_lock);
 static SDL_LogOutputFunction SDL_log_function SDL_GUARDED_BY(SDL_log_function_lock) = SDL_LogOutput;
 static void *SDL_log_userdata SDL_GUARDED_BY(SDL_log_function_lock) = NULL;
+static Uint64 SDL_log_timestamp SDL_GUARDED_BY(SDL_log_function_lock);
+
+// The default size of each thread's asynchronous log buffer
+#define SDL_DEFAULT_ASYNC_LOG_BUFFER_SIZE (64 * 1024)
+#define SDL_MIN_ASYNC_LOG_BUFFER_SIZE 4096
+
+// How often the log thread checks for messages, and how many empty checks before it goes idle
+#define SDL_ASYNC_LOG_POLL_INTERVAL_NS SDL_MS_TO_NS(1)
+#define SDL_ASYNC_LOG_IDLE_POLLS 10
+
+/* A queued log message, followed by either the null terminated message text,
+ * or if fmt is set, the encoded arguments for the format string and then a
+ * copy of the format string, which fmt points to.
+ * Records are padded to 8 bytes, and a size of 0 marks the point where the
+ * writer wrapped around to the start of the buffer.
+ */
+typedef struct SDL_LogRecord
+{
+    Uint32 size;
+    int category;
+    SDL_LogPriority priority;
+    Uint32 length;
+    Uint64 timestamp;
+    const char *fmt;
+} SDL_LogRecord;
+
+/* Deferred arguments are encoded as a type byte followed by the value in
+ * little endian byte order. Integers are stored after the conversion given by
+ * their length modifier, and strings are stored as a 32-bit length followed
+ * by the null terminated text.
+ */
+#define SDL_LOG_ARG_INT     'i'
+#define SDL_LOG_ARG_DOUBLE  'f'
+#define SDL_LOG_ARG_POINTER 'p'
+#define SDL_LOG_ARG_STRING  's'
+#define SDL_LOG_ARG_NULL    'n'
+
+// The largest set of arguments that will be deferred, longer messages are formatted immediately
+#define SDL_MAX_LOG_ARGUMENTS 512
+
+/* The longest conversion specifications that will be deferred, so they always
+ * fit in the buffer FormatLogArguments() rebuilds them in. Longer ones are
+ * formatted immediately.
+ */
+#define SDL_MAX_LOG_SPEC_FLAGS 5
+#define SDL_MAX_LOG_SPEC_DIGITS 10
+
+/* The capture stream starts with an 8 byte header, followed by records that
+ * start with a record type byte. All values are little endian.
+ *
+ * SDL_LOG_CAPTURE_FORMAT: Uint32 format id, Uint32 length, format text
+ * SDL_LOG_CAPTURE_MESSAGE: Uint32 format id, Sint32 category, Uint32 priority,
+ *                          Uint64 timestamp, Uint32 length, encoded arguments
+ * SDL_LOG_CAPTURE_TEXT: Sint32 category, Uint32 priority, Uint64 timestamp,
+ *                       Uint32 length, message text
+ *
+ * test/testlogdecode.c reads this format, keep it in sync.
+ */
+#define SDL_LOG_CAPTURE_MAGIC   "SDLLOG\x01"
+#define SDL_LOG_CAPTURE_FORMAT  1
+#define SDL_LOG_CAPTURE_MESSAGE 2
+#define SDL_LOG_CAPTURE_TEXT    3
+
+/* A single producer, single consumer ring of log records.
+ * Each thread that logs while asynchronous logging is enabled owns one ring,
+ * and the log thread is the only consumer. Rings are never freed while a
+ * thread owns them, and are reused once the owning thread exits.
+ */
+typedef struct SDL_LogRing
+{
+    SDL_AtomicInt owned;
+    SDL_AtomicU32 head;
+    SDL_AtomicU32 tail;
+    Uint32 capacity;
+    Uint8 *buffer;
+    struct SDL_LogRing *next;
+} SDL_LogRing;
+
+static SDL_Mutex *SDL_log_async_lock;
+static SDL_Condition *SDL_log_async_cond;
+static SDL_Semaphore *SDL_log_async_wakeup;
+static SDL_Thread *SDL_log_async_thread;
+static SDL_ThreadID SDL_log_async_thread_id;
+static SDL_LogRing *SDL_log_rings;
+static SDL_TLSID SDL_log_ring_tls;
+static SDL_AtomicInt SDL_log_async_enabled;
+static SDL_AtomicInt SDL_log_async_producers;
+static SDL_AtomicInt SDL_log_async_idle;
+static SDL_AtomicInt SDL_log_async_quit;
+static SDL_AtomicInt SDL_log_async_dropped;
+static SDL_AtomicInt SDL_log_async_deferred;
+static SDL_IOStream *SDL_log_capture SDL_GUARDED_BY(SDL_log_function_lock);
+static SDL_HashTable *SDL_log_capture_formats SDL_GUARDED_BY(SDL_log_function_lock);
+static Uint32 SDL_log_capture_format_count SDL_GUARDED_BY(SDL_log_function_lock);
+static Uint32 SDL_log_async_buffer_size;
+static SDL_LogOverflowPolicy SDL_log_async_policy;
+static int SDL_log_flush_requested SDL_GUARDED_BY(SDL_log_async_lock);
+static int SDL_log_flush_completed SDL_GUARDED_BY(SDL_log_async_lock);
 
 #ifdef HAVE_GCC_DIAGNOSTIC_PRAGMA
 #pragma GCC diagnostic push
@@ -138,6 +237,7 @@ void SDL_InitLog(void)
     // If these fail we'll continue without them.
     SDL_log_lock = SDL_CreateMutex();
     SDL_log_function_lock = SDL_CreateMutex();
+    SDL_log_async_lock = SDL_CreateMutex();
 
     SDL_AddHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
 
@@ -152,6 +252,9 @@ void SDL_QuitLog(void)
 
     SDL_RemoveHintCallback(SDL_HINT_LOGGING, SDL_LoggingChanged, NULL);
 
+    SDL_StopAsyncLogging();
+    CleanupLogRings();
+
     CleanupLogPriorities();
     CleanupLogPrefixes();
 
@@ -163,6 +266,18 @@ void SDL_QuitLog(void)
         SDL_DestroyMutex(SDL_log_function_lock);
         SDL_log_function_lock = NULL;
     }
+    if (SDL_log_async_cond) {
+        SDL_DestroyCondition(SDL_log_async_cond);
+        SDL_log_async_cond = NULL;
+    }
+    if (SDL_log_async_wakeup) {
+        SDL_DestroySemaphore(SDL_log_async_wakeup);
+        SDL_log_async_wakeup = NULL;
+    }
+    if (SDL_log_async_lock) {
+        SDL_DestroyMutex(SDL_log_async_lock);
+        SDL_log_async_lock = NULL;
+    }
 
     SDL_SetInitialized(&SDL_log_init, false);
 }
@@ -584,6 +699,1061 @@ static const char *GetCategoryPrefix(int category)
 }
 #endif // SDL_PLATFORM_ANDROID
 
+static void SDLCALL ReleaseLogRing(void *data)
+{
+    SDL_LogRing *ring = (SDL_LogRing *)data;
+
+    // Any queued messages are still delivered, and the ring can be reused by another thread
+    SDL_SetAtomicInt(&ring->owned, 0);
+}
+
+// Apply a buffer size change from SDL_StartAsyncLogging(), this is only called by the ring's owner
+static void ResizeLogRing(SDL_LogRing *ring)
+{
+    const Uint32 capacity = SDL_log_async_buffer_size;
+
+    // The log thread doesn't touch the buffer while the ring is empty
+    if (ring->capacity != capacity && SDL_GetAtomicU32(&ring->head) == SDL_GetAtomicU32(&ring->tail)) {
+        Uint8 *buffer = (Uint8 *)SDL_malloc(capacity);
+        if (buffer) {
+            SDL_free(ring->buffer);
+            ring->buffer = buffer;
+            ring->capacity = capacity;
+        }
+    }
+}
+
+static SDL_LogRing *GetLogRing(void)
+{
+    SDL_LogRing *ring = (SDL_LogRing *)SDL_GetTLS(&SDL_log_ring_tls);
+    if (ring) {
+        ResizeLogRing(ring);
+        return ring;
+    }
+
+    // See if there's a ring left over from a thread that exited
+    for (ring = (SDL_LogRing *)SDL_GetAtomicPointer((void **)&SDL_log_rings); ring; ring = ring->next) {
+        if (SDL_CompareAndSwapAtomicInt(&ring->owned, 0, 1)) {
+            ResizeLogRing(ring);
+            break;
+        }
+    }
+
+    if (!ring) {
+        ring = (SDL_LogRing *)SDL_calloc(1, sizeof(*ring));
+        if (!ring) {
+            return NULL;
+        }
+        ring->capacity = SDL_log_async_buffer_size;
+        ring->buffer = (Uint8 *)SDL_malloc(ring->capacity);
+        if (!ring->buffer) {
+            SDL_free(ring);
+            return NULL;
+        }
+        SDL_SetAtomicInt(&ring->owned, 1);
+
+        // The log thread walks this list without locking, so publish the ring only once it's complete
+        SDL_LockMutex(SDL_log_async_lock);
+        ring->next = SDL_log_rings;
+        SDL_SetAtomicPointer((void **)&SDL_log_rings, ring);
+        SDL_UnlockMutex(SDL_log_async_lock);
+    }
+
+    if (!SDL_SetTLS(&SDL_log_ring_tls, ring, ReleaseLogRing)) {
+        SDL_SetAtomicInt(&ring->owned, 0);
+        return NULL;
+    }
+    return ring;
+}
+
+// This is only called when no thread can be logging asynchronously
+static void CleanupLogRings(void)
+{
+    SDL_LogRing **prev = &SDL_log_rings;
+
+    while (*prev) {
+        SDL_LogRing *ring = *prev;
+        if (SDL_GetAtomicInt(&ring->owned)) {
+            // The owning thread still refers to this ring
+            prev = &ring->next;
+        } else {
+            *prev = ring->next;
+            SDL_free(ring->buffer);
+            SDL_free(ring);
+        }
+    }
+}
+
+static void WakeLogThread(void)
+{
+    // Check before the compare and swap, the log thread is usually awake while messages are coming in
+    if (SDL_GetAtomicInt(&SDL_log_async_idle) && SDL_CompareAndSwapAtomicInt(&SDL_log_async_idle, 1, 0)) {
+        SDL_SignalSemaphore(SDL_log_async_wakeup);
+    }
+}
+
+// The most data a record can hold, including the null terminators
+static size_t GetMaxLogRecordLength(const SDL_LogRing *ring)
+{
+    return ring->capacity / 4 - sizeof(SDL_LogRecord);
+}
+
+static void QueueLogRecord(SDL_LogRing *ring, int category, SDL_LogPriority priority, const char *fmt, size_t fmtlen, const void *data, size_t length)
+{
+    const Uint64 timestamp = SDL_GetTicksNS();
+    SDL_LogRecord *record;
+    Uint32 head, offset, size, needed;
+
+    if (!fmt && length > GetMaxLogRecordLength(ring) - 1) {
+        // Deferred records are checked before they're queued, long messages are truncated
+        length = GetMaxLogRecordLength(ring) - 1;
+    }
+    size = (Uint32)((sizeof(SDL_LogRecord) + length + 1 + (fmt ? fmtlen + 1 : 0) + 7) & ~7);
+
+    for (;;) {
+        const Uint32 tail = SDL_GetAtomicU32(&ring->tail);
+
+        head = SDL_GetAtomicU32(&ring->head);
+        offset = head & (ring->capacity - 1);
+        needed = size;
+        if (offset + size > ring->capacity) {
+            // The record doesn't fit before the end of the buffer, so skip to the start
+            needed += ring->capacity - offset;
+        }
+        if (ring->capacity - (head - tail) >= needed) {
+            break;
+        }
+
+        if (SDL_log_async_policy == SDL_LOG_OVERFLOW_DROP) {
+            SDL_AtomicIncRef(&SDL_log_async_dropped);
+            return;
+        }
+
+        // Wait for the log thread to make room
+        SDL_LockMutex(SDL_log_async_lock);
+        SDL_SetAtomicInt(&SDL_log_async_idle, 0);
+        SDL_SignalSemaphore(SDL_log_async_wakeup);
+        SDL_WaitConditionTimeout(SDL_log_async_cond, SDL_log_async_lock, 10);
+        SDL_UnlockMutex(SDL_log_async_lock);
+    }
+
+    if (needed != size) {
+        *(Uint32 *)(ring->buffer + offset) = 0;
+        head += ring->capacity - offset;
+        offset = 0;
+    }
+    record = (SDL_LogRecord *)(ring->buffer + offset);
+    record->size = size;
+    record->category = category;
+    record->priority = priority;
+    record->length = (Uint32)length;
+    record->timestamp = timestamp;
+    record->fmt = NULL;
+    SDL_memcpy(record + 1, data, length);
+    ((char *)(record + 1))[length] = '\0';
+    if (fmt) {
+        // The format string is copied, it might not outlive the record
+        char *copy = (char *)(record + 1) + length + 1;
+        SDL_memcpy(copy, fmt, fmtlen + 1);
+        record->fmt = copy;
+    }
+
+    SDL_SetAtomicU32(&ring->head, head + size);
+
+    WakeLogThread();
+}
+
+// Returns true if the message was queued for the log thread
+static bool QueueLogMessage(int category, SDL_LogPriority priority, const char *message, size_t length)
+{
+    bool queued = false;
+
+    if (!SDL_GetAtomicInt(&SDL_log_async_enabled)) {
+        return false;
+    }
+
+    SDL_AtomicIncRef(&SDL_log_async_producers);
+    if (SDL_GetAtomicInt(&SDL_log_async_enabled) && SDL_GetCurrentThreadID() != SDL_log_async_thread_id) {
+        SDL_LogRing *ring = GetLogRing();
+        if (ring) {
+            QueueLogRecord(ring, category, priority, NULL, 0, message, length);
+            queued = true;
+        }
+    }
+    SDL_AtomicDecRef(&SDL_log_async_producers);
+
+    return queued;
+}
+
+static Uint8 *EncodeLogValue(Uint8 *args, Uint8 type, Uint64 value)
+{
+    value = SDL_Swap64LE(value);
+    *args++ = type;
+    SDL_memcpy(args, &value, sizeof(value));
+    return args + sizeof(value);
+}
+
+/* Encode the arguments for a format string, returning false if the format uses
+ * conversions that can't be deferred or the arguments don't fit in maxlen bytes.
+ */
+static bool EncodeLogArguments(Uint8 *args, size_t maxlen, size_t *length, const char *fmt, va_list ap)
+{
+    Uint8 *start = args;
+    Uint8 *end = args + maxlen;
+
+    while (*fmt) {
+        enum
+        {
+            LENGTH_NONE,
+            LENGTH_CHAR,
+            LENGTH_SHORT,
+            LENGTH_LONG,
+            LENGTH_LONGLONG,
+            LENGTH_SIZE_T,
+            LENGTH_INTMAX,
+            LENGTH_PTRDIFF,
+            LENGTH_LONGDOUBLE
+        } modifier = LENGTH_NONE;
+        Uint64 value;
+
+        int precision = -1;
+        int count;
+
+        if (*fmt++ != '%') {
+            continue;
+        }
+
+        // Each value takes at most 9 bytes, and there can be two * arguments
+        if ((size_t)(end - args) < 27) {
+            return false;
+        }
+
+        for (count = 0; *fmt == '-' || *fmt == '+' || *fmt == ' ' || *fmt == '#' || *fmt == '0'; ++count) {
+            ++fmt;
+        }
+        if (count > SDL_MAX_LOG_SPEC_FLAGS) {
+            return false;
+        }
+        if (*fmt == '*') {
+            ++fmt;
+            args = EncodeLogValue(args, SDL_LOG_ARG_INT, (Uint64)(Sint64)va_arg(ap, int));
+        } else {
+            for (count = 0; *fmt >= '0' && *fmt <= '9'; ++count) {
+                ++fmt;
+            }
+            if (count > SDL_MAX_LOG_SPEC_DIGITS) {
+                return false;
+            }
+        }
+        if (*fmt == '.') {
+            ++fmt;
+            if (*fmt == '*') {
+                ++fmt;
+                precision = va_arg(ap, int);
+                args = EncodeLogValue(args, SDL_LOG_ARG_INT, (Uint64)(Sint64)precision);
+            } else {
+                precision = 0;
+                for (count = 0; *fmt >= '0' && *fmt <= '9'; ++count) {
+                    if (count == SDL_MAX_LOG_SPEC_DIGITS) {
+                        return false;
+                    }
+                    precision = (precision * 10) + (*fmt - '0');
+                    ++fmt;
+                }
+            }
+        }
+
+        switch (*fmt) {
+        case 'h':
+            modifier = (fmt[1] == 'h') ? LENGTH_CHAR : LENGTH_SHORT;
+            fmt += (modifier == LENGTH_CHAR) ? 2 : 1;
+            break;
+        case 'l':
+            modifier = (fmt[1] == 'l') ? LENGTH_LONGLONG : LENGTH_LONG;
+            fmt += (modifier == LENGTH_LONGLONG) ? 2 : 1;
+            break;
+        case 'I':
+            if (SDL_strncmp(fmt, "I64", 3) != 0) {
+                return false;
+            }
+            modifier = LENGTH_LONGLONG;
+            fmt += 3;
+            break;
+        case 'z':
+            modifier = LENGTH_SIZE_T;
+            ++fmt;
+            break;
+        case 'j':
+            modifier = LENGTH_INTMAX;
+            ++fmt;
+            break;
+        case 't':
+            modifier = LENGTH_PTRDIFF;
+            ++fmt;
+            break;
+        case 'L':
+            modifier = LENGTH_LONGDOUBLE;
+            ++fmt;
+            break;
+        default:
+            break;
+        }
+
+        switch (*fmt++) {
+        case '%':
+            break;
+        case 'd':
+        case 'i':
+            switch (modifier) {
+            case LENGTH_NONE:
+                value = (Uint64)(Sint64)va_arg(ap, int);
+                break;
+            case LENGTH_CHAR:
+                value = (Uint64)(Sint64)(signed char)va_arg(ap, int);
+                break;
+            case LENGTH_SHORT:
+                value = (Uint64)(Sint64)(short)va_arg(ap, int);
+                break;
+            case LENGTH_LONG:
+                value = (Uint64)(Sint64)va_arg(ap, long);
+                break;
+            case LENGTH_LONGLONG:
+                value = (Uint64)(Sint64)va_arg(ap, long long);
+                break;
+            case LENGTH_SIZE_T:
+                value = (Uint64)(Sint64)(intptr_t)va_arg(ap, size_t);
+                break;
+            case LENGTH_INTMAX:
+                value = (Uint64)(Sint64)va_arg(ap, intmax_t);
+                break;
+            case LENGTH_PTRDIFF:
+                value = (Uint64)(Sint64)va_arg(ap, ptrdiff_t);
+                break;
+            default:
+                return false;
+            }
+            args = EncodeLogValue(args, SDL_LOG_ARG_INT, value);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            switch (modifier) {
+            case LENGTH_NONE:
+                value = va_arg(ap, unsigned int);
+                break;
+            case LENGTH_CHAR:
+                value = (unsigned char)va_arg(ap, unsigned int);
+                break;
+            case LENGTH_SHORT:
+                value = (unsigned short)va_arg(ap, unsigned int);
+                break;
+            case LENGTH_LONG:
+                value = va_arg(ap, unsigned long);
+                break;
+            case LENGTH_LONGLONG:
+                value = va_arg(ap, unsigned long long);
+                break;
+            case LENGTH_SIZE_T:
+                value = va_arg(ap, size_t);
+                break;
+            case LENGTH_INTMAX:
+                value = va_arg(ap, uintmax_t);
+                break;
+            case LENGTH_PTRDIFF:
+                value = (size_t)va_arg(ap, ptrdiff_t);
+                break;
+            default:
+                return false;
+            }
+            args = EncodeLogValue(args, SDL_LOG_ARG_INT, value);
+            break;
+        case 'c':
+            if (modifier != LENGTH_NONE) {
+                return false;
+            }
+            args = EncodeLogValue(args, SDL_LOG_ARG_INT, (Uint64)(Sint64)va_arg(ap, int));
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+        {
+            double d;
+
+            if (modifier != LENGTH_NONE && modifier != LENGTH_LONG) {
+                return false;
+            }
+            d = va_arg(ap, double);
+            SDL_memcpy(&value, &d, sizeof(value));
+            args = EncodeLogValue(args, SDL_LOG_ARG_DOUBLE, value);
+            break;
+        }
+        case 'p':
+            args = EncodeLogValue(args, SDL_LOG_ARG_POINTER, (Uint64)(uintptr_t)va_arg(ap, void *));
+            break;
+        case 's':
+        {
+            const char *string;
+            Uint32 string_length;
+
+            if (modifier != LENGTH_NONE) {
+                // Wide strings are formatted immediately
+                return false;
+            }
+            string = va_arg(ap, const char *);
+            if (!string) {
+                *args++ = SDL_LOG_ARG_NULL;
+                break;
+            }
+            // With a precision, the string doesn't have to be null terminated
+            if (precision >= 0 && (size_t)precision < (size_t)(end - args)) {
+                string_length = (Uint32)SDL_strnlen(string, precision);
+            } else {
+                string_length = (Uint32)SDL_strnlen(string, end - args);
+            }
+            if ((size_t)(end - args) < 1 + sizeof(string_length) + string_length + 1) {
+                return false;
+            }
+            *args++ = SDL_LOG_ARG_STRING;
+            string_length = SDL_Swap32LE(string_length);
+            SDL_memcpy(args, &string_length, sizeof(string_length));
+            string_length = SDL_Swap32LE(string_length);
+            args += sizeof(string_length);
+            SDL_memcpy(args, string, string_length);
+            args += string_length;
+            *args++ = '\0';
+            break;
+        }
+        default:
+            // %n, wide characters, or an invalid conversion
+            return false;
+        }
+    }
+
+    *length = (size_t)(args - start);
+    return true;
+}
+
+// Returns true if the message was queued for the log thread without formatting it
+static bool QueueDeferredLogMessage(int category, SDL_LogPriority priority, const char *fmt, va_list ap)
+{
+    bool queued = false;
+
+    if (!SDL_GetAtomicInt(&SDL_log_async_deferred) || !fmt) {
+        return false;
+    }
+
+    SDL_AtomicIncRef(&SDL_log_async_producers);
+    if (SDL_GetAtomicInt(&SDL_log_async_enabled) && SDL_GetCurrentThreadID() != SDL_log_async_thread_id) {
+        Uint8 args[SDL_MAX_LOG_ARGUMENTS];
+        size_t length;
+        va_list aq;
+
+        va_copy(aq, ap);
+        if (EncodeLogArguments(args, sizeof(args), &length, fmt, aq)) {
+            SDL_LogRing *ring = GetLogRing();
+            const size_t fmtlen = SDL_strlen(fmt);
+            if (ring && length + 1 + fmtlen + 1 <= GetMaxLogRecordLength(ring)) {
+                QueueLogRecord(ring, category, priority, fmt, fmtlen, args, length);
+                queued = true;
+            }
+        }
+        va_end(aq);
+    }
+    SDL_AtomicDecRef(&SDL_log_async_producers);
+
+    return queued;
+}
+
+static const Uint8 *DecodeLogValue(const Uint8 *args, const Uint8 *end, Uint8 type, Uint64 *value)
+{
+    if (!args || end - args < 9 || *args != type) {
+        return NULL;
+    }
+    SDL_memcpy(value, args + 1, sizeof(*value));
+    *value = SDL_Swap64LE(*value);
+    return args + 9;
+}
+
+/* Format encoded arguments, with the same return value as SDL_snprintf()
+ * This is duplicated in test/testlogdecode.c, keep them in sync.
+ */
+static size_t FormatLogArguments(char *text, size_t maxlen, const char *fmt, const Uint8 *args, size_t arglen)
+{
+    const Uint8 *end = args + arglen;
+    size_t length = 0;
+
+    while (*fmt && args) {
+        char spec[64];
+        size_t speclen = 0;
+        const char *flags;
+        const char *modifier = "";
+        Uint64 value = 0;
+        int result = 0;
+
+        if (*fmt != '%') {
+            if (length < maxlen) {
+                text[length] = *fmt;
+            }
+            ++length;
+            ++fmt;
+            continue;
+        }
+
+        /* EncodeLogArguments() only defers specifications with at most SDL_MAX_LOG_SPEC_FLAGS flags
+           and SDL_MAX_LOG_SPEC_DIGITS digits in the width and precision, so they always fit in spec.
+           Anything longer is a corrupt record, and formatting stops there. */
+        spec[speclen++] = *fmt++;
+        flags = fmt;
+        while (*fmt == '-' || *fmt == '+' || *fmt == ' ' || *fmt == '#' || *fmt == '0') {
+            ++fmt;
+        }
+        if (fmt - flags > SDL_MAX_LOG_SPEC_FLAGS) {
+            break;
+        }
+        SDL_memcpy(&spec[speclen], flags, fmt - flags);
+        speclen += fmt - flags;
+        if (*fmt == '*') {
+            ++fmt;
+            args = DecodeLogValue(args, end, SDL_LOG_ARG_INT, &value);
+            speclen += SDL_snprintf(&spec[speclen], 16, "%d", (int)(Sint64)value);
+        } else {
+            const char *digits = fmt;
+            while (*fmt >= '0' && *fmt <= '9') {
+                ++fmt;
+            }
+            if (fmt - digits > SDL_MAX_LOG_SPEC_DIGITS) {
+                break;
+            }
+            SDL_memcpy(&spec[speclen], digits, fmt - digits);
+            speclen += fmt - digits;
+        }
+        if (*fmt == '.') {
+            ++fmt;
+            if (*fmt == '*') {
+                ++fmt;
+                args = DecodeLogValue(args, end, SDL_LOG_ARG_INT, &value);
+                if ((int)(Sint64)value >= 0) {
+                    speclen += SDL_snprintf(&spec[speclen], 16, ".%d", (int)(Sint64)value);
+                }
+            } else {
+                const char *digits = fmt;
+                while (*fmt >= '0' && *fmt <= '9') {
+                    ++fmt;
+                }
+                if (fmt - digits > SDL_MAX_LOG_SPEC_DIGITS) {
+                    break;
+                }
+                spec[speclen++] = '.';
+                SDL_memcpy(&spec[speclen], digits, fmt - digits);
+                speclen += fmt - digits;
+            }
+        }
+        while (*fmt == 'h' || *fmt == 'l' || *fmt == 'z' || *fmt == 'j' || *fmt == 't' || *fmt == 'L') {
+            ++fmt;
+        }
+        if (SDL_strncmp(fmt, "I64", 3) == 0) {
+            fmt += 3;
+        }
+        if (!args || !*fmt) {
+            break;
+        }
+
+        switch (*fmt) {
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            modifier = "ll";
+            break;
+        default:
+            break;
+        }
+        speclen += SDL_snprintf(&spec[speclen], sizeof(spec) - speclen, "%s%c", modifier, *fmt);
+
+        switch (*fmt++) {
+        case '%':
+            result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, "%%");
+            break;
+        case 'd':
+        case 'i':
+            args = DecodeLogValue(args, end, SDL_LOG_ARG_INT, &value);
+            result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, spec, (long long)(Sint64)value);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            args = DecodeLogValue(args, end, SDL_LOG_ARG_INT, &value);
+            result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, spec, (unsigned long long)value);
+            break;
+        case 'c':
+            args = DecodeLogValue(args, end, SDL_LOG_ARG_INT, &value);
+            result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, spec, (int)(Sint64)value);
+            break;
+        case 'p':
+            args = DecodeLogValue(args, end, SDL_LOG_ARG_POINTER, &value);
+            result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, spec, (void *)(uintptr_t)value);
+            break;
+        case 's':
+            if (args < end && *args == SDL_LOG_ARG_NULL) {
+                ++args;
+                result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, spec, (const char *)NULL);
+            } else if (args < end && *args == SDL_LOG_ARG_STRING && end - args >= 5) {
+                Uint32 string_length;
+
+                SDL_memcpy(&string_length, args + 1, sizeof(string_length));
+                string_length = SDL_Swap32LE(string_length);
+                if ((size_t)(end - args) < 5 + (size_t)string_length + 1) {
+                    args = NULL;
+                    break;
+                }
+                result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, spec, (const char *)(args + 5));
+                args += 5 + string_length + 1;
+            } else {
+                args = NULL;
+            }
+            break;
+        default:
+        {
+            double d;
+
+            args = DecodeLogValue(args, end, SDL_LOG_ARG_DOUBLE, &value);
+            SDL_memcpy(&d, &value, sizeof(d));
+            result = SDL_snprintf(length < maxlen ? &text[length] : NULL, length < maxlen ? maxlen - length : 0, spec, d);
+            break;
+        }
+        }
+        if (args && result > 0) {
+            length += result;
+        }
+    }
+
+    if (maxlen > 0) {
+        text[SDL_min(length, maxlen - 1)] = '\0';
+    }
+    return length;
+}
+
+static Uint8 *PutCaptureU32(Uint8 *dst, Uint32 value)
+{
+    value = SDL_Swap32LE(value);
+    SDL_memcpy(dst, &value, sizeof(value));
+    return dst + sizeof(value);
+}
+
+/* Write a record to the capture stream
+ * This should be called with the log function lock held
+ */
+static void CaptureLogRecord(int category, SDL_LogPriority priority, Uint64 timestamp, const char *fmt, const void *data, size_t length)
+{
+    Uint8 header[32];
+    Uint8 *dst = header;
+
+    if (fmt) {
+        const void *value = NULL;
+        Uint32 id;
+
+        // Formats are matched by their text, the record holds a copy of the caller's string
+        if (SDL_FindInHashTable(SDL_log_capture_formats, fmt, &value)) {
+            id = (Uint32)(uintptr_t)value;
+        } else {
+            const size_t fmtlen = SDL_strlen(fmt);
+            char *key = SDL_strdup(fmt);
+
+            id = ++SDL_log_capture_format_count;
+            if (key && !SDL_InsertIntoHashTable(SDL_log_capture_formats, key, (const void *)(uintptr_t)id, false)) {
+                SDL_free(key);
+            }
+            *dst++ = SDL_LOG_CAPTURE_FORMAT;
+            dst = PutCaptureU32(dst, id);
+            dst = PutCaptureU32(dst, (Uint32)fmtlen);
+            SDL_WriteIO(SDL_log_capture, header, dst - header);
+            SDL_WriteIO(SDL_log_capture, fmt, fmtlen);
+            dst = header;
+        }
+        *dst++ = SDL_LOG_CAPTURE_MESSAGE;
+        dst = PutCaptureU32(dst, id);
+    } else {
+        *dst++ = SDL_LOG_CAPTURE_TEXT;
+    }
+    timestamp = SDL_Swap64LE(timestamp);
+    dst = PutCaptureU32(dst, (Uint32)category);
+    dst = PutCaptureU32(dst, (Uint32)priority);
+    SDL_memcpy(dst, &timestamp, sizeof(timestamp));
+    dst += sizeof(timestamp);
+    dst = PutCaptureU32(dst, (Uint32)length);
+    SDL_WriteIO(SDL_log_capture, header, dst - header);
+    SDL_WriteIO(SDL_log_capture, data, length);
+}
+
+/* Pass a message to the log output function or capture stream
+ * This should be called with the log function lock held
+ */
+static void OutputLogRecord(const SDL_LogRecord *record)
+{
+    char stack_buf[SDL_MAX_LOG_MESSAGE_STACK];
+    char *message = (char *)(record + 1);
+    size_t len;
+
+    if (SDL_log_capture) {
+        CaptureLogRecord(record->category, record->priority, record->timestamp, record->fmt, record + 1, record->length);
+        return;
+    }
+    if (!SDL_log_function) {
+        return;
+    }
+
+    if (record->fmt) {
+        message = stack_buf;
+        len = FormatLogArguments(stack_buf, sizeof(stack_buf), record->fmt, (const Uint8 *)(record + 1), record->length);
+        if (len >= sizeof(stack_buf)) {
+            message = (char *)SDL_malloc(len + 1);
+            if (message) {
+                FormatLogArguments(message, len + 1, record->fmt, (const Uint8 *)(record + 1), record->length);
+            } else {
+                message = stack_buf;
+                len = sizeof(stack_buf) - 1;
+            }
+        }
+
+        // Chop off final endline.
+        if ((len > 0) && (message[len - 1] == '\n')) {
+            message[--len] = '\0';
+            if ((len > 0) && (message[len - 1] == '\r')) { // catch "\r\n", too.
+                message[--len] = '\0';
+            }
+        }
+    }
+
+    SDL_log_timestamp = record->timestamp;
+    SDL_log_function(SDL_log_userdata, record->category, record->priority, message);
+    SDL_log_timestamp = 0;
+
+    if (message != stack_buf && message != (char *)(record + 1)) {
+        SDL_free(message);
+    }
+}
+
+static SDL_LogRecord *PeekLogRecord(SDL_LogRing *ring)
+{
+    for (;;) {
+        const Uint32 head = SDL_GetAtomicU32(&ring->head);
+        const Uint32 tail = SDL_GetAtomicU32(&ring->tail);
+        const Uint32 offset = tail & (ring->capacity - 1);
+        SDL_LogRecord *record;
+
+        if (head == tail) {
+            return NULL;
+        }
+
+        record = (SDL_LogRecord *)(ring->buffer + offset);
+        if (record->size) {
+            return record;
+        }
+        SDL_SetAtomicU32(&ring->tail, tail + (ring->capacity - offset));
+    }
+}
+
+// Deliver queued messages from all threads, merged by the time they were logged
+static int DeliverLogRecords(void)
+{
+    int count = 0;
+    int dropped;
+
+    SDL_LockMutex(SDL_log_function_lock);
+    for (;;) {
+        SDL_LogRing *ring, *next_ring = NULL;
+        SDL_LogRecord *next_record = NULL;
+
+        for (ring = (SDL_LogRing *)SDL_GetAtomicPointer((void **)&SDL_log_rings); ring; ring = ring->next) {
+            SDL_LogRecord *record = PeekLogRecord(ring);
+            if (record && (!next_record || record->timestamp < next_record->timestamp)) {
+                next_ring = ring;
+                next_record = record;
+            }
+        }
+        if (!next_record) {
+            break;
+        }
+
+        OutputLogRecord(next_record);
+        SDL_SetAtomicU32(&next_ring->tail, SDL_GetAtomicU32(&next_ring->tail) + next_record->size);
+
+        if ((++count % 64) == 0) {
+            // Let threads waiting for room in their buffer continue
+            SDL_BroadcastCondition(SDL_log_async_cond);
+        }
+    }
+    SDL_UnlockMutex(SDL_log_function_lock);
+
+    if (count > 0) {
+        SDL_BroadcastCondition(SDL_log_async_cond);
+    }
+
+    dropped = SDL_SetAtomicInt(&SDL_log_async_dropped, 0);
+    if (dropped > 0 && SDL_LOG_PRIORITY_WARN >= SDL_GetLogPriority(SDL_LOG_CATEGORY_SYSTEM)) {
+        struct
+        {
+            SDL_LogRecord record;
+            char text[SDL_MAX_LOG_MESSAGE_STACK];
+        } warning;
+
+        SDL_zero(warning);
+        warning.record.category = SDL_LOG_CATEGORY_SYSTEM;
+        warning.record.priority = SDL_LOG_PRIORITY_WARN;
+        warning.record.timestamp = SDL_GetTicksNS();
+        warning.record.length = (Uint32)SDL_snprintf(warning.text, sizeof(warning.text), "Dropped %d log messages, the asynchronous log buffer was full", dropped);
+
+        SDL_LockMutex(SDL_log_function_lock);
+        OutputLogRecord(&warning.record);
+        SDL_UnlockMutex(SDL_log_function_lock);
+    }
+    return count;
+}
+
+static bool HasQueuedLogRecords(void)
+{
+    SDL_LogRing *ring;
+
+    for (ring = (SDL_LogRing *)SDL_GetAtomicPointer((void **)&SDL_log_rings); ring; ring = ring->next) {
+        if (SDL_GetAtomicU32(&ring->head) != SDL_GetAtomicU32(&ring->tail)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void CompleteLogFlush(int ticket)
+{
+    SDL_LockMutex(SDL_log_async_lock);
+    if (SDL_log_flush_completed - ticket < 0) {
+        SDL_log_flush_completed = ticket;
+        SDL_BroadcastCondition(SDL_log_async_cond);
+    }
+    SDL_UnlockMutex(SDL_log_async_lock);
+}
+
+static int SDLCALL SDL_LogThread(void *unused)
+{
+    int ticket;
+    int idle_polls = 0;
+
+    while (!SDL_GetAtomicInt(&SDL_log_async_quit)) {
+        SDL_LockMutex(SDL_log_async_lock);
+        ticket = SDL_log_flush_requested;
+        SDL_UnlockMutex(SDL_log_async_lock);
+
+        if (DeliverLogRecords() > 0) {
+            idle_polls = 0;
+        }
+        CompleteLogFlush(ticket);
+
+        if (idle_polls++ < SDL_ASYNC_LOG_IDLE_POLLS) {
+            /* Stay awake for a while and deliver messages in batches, so busy
+             * threads don't have to wake this thread up for every message.
+             * Flushes and blocked threads still wake it up immediately.
+             */
+            SDL_WaitSemaphoreTimeoutNS(SDL_log_async_wakeup, SDL_ASYNC_LOG_POLL_INTERVAL_NS);
+        } else {
+            SDL_SetAtomicInt(&SDL_log_async_idle, 1);
+            if (!HasQueuedLogRecords() && !SDL_GetAtomicInt(&SDL_log_async_quit)) {
+                SDL_WaitSemaphoreTimeout(SDL_log_async_wakeup, 100);
+            }
+            SDL_SetAtomicInt(&SDL_log_async_idle, 0);
+        }
+    }
+
+    // Deliver anything that was queued before asynchronous logging was stopped
+    SDL_LockMutex(SDL_log_async_lock);
+    ticket = SDL_log_flush_requested;
+    SDL_UnlockMutex(SDL_log_async_lock);
+    DeliverLogRecords();
+    CompleteLogFlush(ticket);
+
+    return 0;
+}
+
+static bool SetLogCapture(SDL_IOStream *stream)
+{
+    bool result = true;
+
+    SDL_LockMutex(SDL_log_function_lock);
+    {
+        if (stream != SDL_log_capture) {
+            if (SDL_log_capture) {
+                SDL_FlushIO(SDL_log_capture);
+            }
+            if (SDL_log_capture_formats) {
+                SDL_DestroyHashTable(SDL_log_capture_formats);
+                SDL_log_capture_formats = NULL;
+            }
+            SDL_log_capture = NULL;
+
+            if (stream) {
+                SDL_log_capture_formats = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, SDL_DestroyHashKey, NULL);
+                if (SDL_log_capture_formats && SDL_WriteIO(stream, SDL_LOG_CAPTURE_MAGIC, 8) == 8) {
+                    SDL_log_capture = stream;
+                    SDL_log_capture_format_count = 0;
+                } else {
+                    result = false;
+                }
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_log_function_lock);
+
+    return result;
+}
+
+bool SDL_StartAsyncLogging(SDL_PropertiesID props)
+{
+    Sint64 buffer_size = SDL_GetNumberProperty(props, SDL_PROP_ASYNC_LOGGING_BUFFER_SIZE_NUMBER, SDL_DEFAULT_ASYNC_LOG_BUFFER_SIZE);
+    Sint64 policy = SDL_GetNumberProperty(props, SDL_PROP_ASYNC_LOGGING_OVERFLOW_POLICY_NUMBER, SDL_LOG_OVERFLOW_DROP);
+    bool deferred = SDL_GetBooleanProperty(props, SDL_PROP_ASYNC_LOGGING_DEFERRED_FORMAT_BOOLEAN, false);
+    SDL_IOStream *capture = (SDL_IOStream *)SDL_GetPointerProperty(props, SDL_PROP_ASYNC_LOGGING_CAPTURE_STREAM_POINTER, NULL);
+    Uint32 capacity;
+    bool result = true;
+
+    CHECK_PARAM(buffer_size <= 0 || buffer_size > SDL_MAX_SINT32) {
+        return SDL_InvalidParamError(SDL_PROP_ASYNC_LOGGING_BUFFER_SIZE_NUMBER);
+    }
+    CHECK_PARAM(policy != SDL_LOG_OVERFLOW_DROP && policy != SDL_LOG_OVERFLOW_BLOCK) {
+        return SDL_InvalidParamError(SDL_PROP_ASYNC_LOGGING_OVERFLOW_POLICY_NUMBER);
+    }
+
+    SDL_CheckInitLog();
+
+    if (!SDL_log_async_lock) {
+        return SDL_SetError("Log mutex not available");
+    }
+
+    // Ring positions are masked, so the capacity needs to be a power of two
+    capacity = SDL_MIN_ASYNC_LOG_BUFFER_SIZE;
+    while (capacity < (Uint32)buffer_size && capacity < 0x40000000) {
+        capacity <<= 1;
+    }
+
+    if (!SetLogCapture(capture)) {
+        return false;
+    }
+
+    SDL_LockMutex(SDL_log_async_lock);
+    {
+        SDL_SetAtomicInt(&SDL_log_async_deferred, deferred);
+
+        if (SDL_log_async_thread) {
+            // Already running, rings that were already created keep their size
+            SDL_log_async_buffer_size = capacity;
+            SDL_log_async_policy = (SDL_LogOverflowPolicy)policy;
+        } else {
+            if (!SDL_log_async_cond) {
+                SDL_log_async_cond = SDL_CreateCondition();
+            }
+            if (!SDL_log_async_wakeup) {
+                SDL_log_async_wakeup = SDL_CreateSemaphore(0);
+            }
+            if (!SDL_log_async_cond || !SDL_log_async_wakeup) {
+                result = false;
+            } else {
+                SDL_log_async_buffer_size = capacity;
+                SDL_log_async_policy = (SDL_LogOverflowPolicy)policy;
+                SDL_SetAtomicInt(&SDL_log_async_quit, 0);
+                SDL_log_async_thread = SDL_CreateThread(SDL_LogThread, "SDLLog", NULL);
+                if (SDL_log_async_thread) {
+                    SDL_log_async_thread_id = SDL_GetThreadID(SDL_log_async_thread);
+                    SDL_SetAtomicInt(&SDL_log_async_enabled, 1);
+                } else {
+                    result = false;
+                }
+            }
+            if (!result) {
+                SDL_SetAtomicInt(&SDL_log_async_deferred, 0);
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_log_async_lock);
+
+    if (!result) {
+        SetLogCapture(NULL);
+    }
+    return result;
+}
+
+void SDL_FlushLogs(void)
+{
+    int ticket;
+
+    if (!SDL_GetAtomicInt(&SDL_log_async_enabled) || SDL_GetCurrentThreadID() == SDL_log_async_thread_id) {
+        return;
+    }
+
+    SDL_LockMutex(SDL_log_async_lock);
+    {
+        ticket = ++SDL_log_flush_requested;
+        SDL_SetAtomicInt(&SDL_log_async_idle, 0);
+        SDL_SignalSemaphore(SDL_log_async_wakeup);
+        while (SDL_log_async_thread && SDL_log_flush_completed - ticket < 0) {
+            SDL_WaitConditionTimeout(SDL_log_async_cond, SDL_log_async_lock, 100);
+        }
+    }
+    SDL_UnlockMutex(SDL_log_async_lock);
+}
+
+void SDL_StopAsyncLogging(void)
+{
+    SDL_Thread *thread;
+
+    if (!SDL_log_async_lock) {
+        return;
+    }
+
+    SDL_LockMutex(SDL_log_async_lock);
+    thread = SDL_log_async_thread;
+    SDL_SetAtomicInt(&SDL_log_async_enabled, 0);
+    SDL_SetAtomicInt(&SDL_log_async_deferred, 0);
+    SDL_UnlockMutex(SDL_log_async_lock);
+
+    if (!thread) {
+        return;
+    }
+
+    // Let threads finish queuing messages, the log thread keeps making room for them
+    while (SDL_GetAtomicInt(&SDL_log_async_producers) > 0) {
+        SDL_Delay(1);
+    }
+
+    SDL_SetAtomicInt(&SDL_log_async_quit, 1);
+    SDL_SignalSemaphore(SDL_log_async_wakeup);
+    SDL_WaitThread(thread, NULL);
+
+    SDL_LockMutex(SDL_log_async_lock);
+    SDL_log_async_thread = NULL;
+    SDL_log_async_thread_id = 0;
+    SDL_BroadcastCondition(SDL_log_async_cond);
+    SDL_UnlockMutex(SDL_log_async_lock);
+
+    SetLogCapture(NULL);
+}
+
+Uint64 SDL_GetLogMessageTimestamp(void)
+{
+    Uint64 timestamp;
+
+    SDL_LockMutex(SDL_log_function_lock);
+    timestamp = SDL_log_timestamp;
+    SDL_UnlockMutex(SDL_log_function_lock);
+
+    return timestamp;
+}
+
 void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_STRING const char *fmt, va_list ap)
 {
     char *message = NULL;
@@ -602,6 +1772,10 @@ void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_S
         return;
     }
 
+    if (QueueDeferredLogMessage(category, priority, fmt, ap)) {
+        return;
+    }
+
     // Render into stack buffer
     va_copy(aq, ap);
     len = SDL_vsnprintf(stack_buf, sizeof(stack_buf), fmt, aq);
@@ -639,11 +1813,15 @@ void SDL_LogMessageV(int category, SDL_LogPriority priority, SDL_PRINTF_FORMAT_S
         }
     }
 
-    SDL_LockMutex(SDL_log_function_lock);
-    {
-        SDL_log_function(SDL_log_userdata, category, priority, message);
+    if (!QueueLogMessage(category, priority, message, len)) {
+        SDL_LockMutex(SDL_log_function_lock);
+        {
+            SDL_log_timestamp = SDL_GetTicksNS();
+            SDL_log_function(SDL_log_userdata, category, priority, message);
+            SDL_log_timestamp = 0;
+        }
+        SDL_UnlockMutex(SDL_log_function_lock);
     }
-    SDL_UnlockMutex(SDL_log_function_lock);
 
     // Free only if dynamically allocated
     if (message != stack_buf) {
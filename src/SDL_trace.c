@@ -0,0 +1,416 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_trace_c.h"
+
+#ifndef SDL_TRACE_DISABLED
+
+// Trace events are collected here and written to the file in large pieces
+#define SDL_CHROME_TRACE_BUFFER_SIZE    (64 * 1024)
+
+// Longest name written to a Chrome trace, after escaping
+#define SDL_CHROME_TRACE_MAX_NAME       128
+
+typedef struct SDL_ChromeTrace
+{
+    SDL_Mutex *lock;
+    SDL_IOStream *io;
+    bool first;
+    size_t used;
+    char buffer[SDL_CHROME_TRACE_BUFFER_SIZE];
+} SDL_ChromeTrace;
+
+static SDL_InitState SDL_trace_init;
+static SDL_RWLock *SDL_trace_lock;
+static SDL_TraceCallback SDL_trace_callback SDL_GUARDED_BY(SDL_trace_lock);
+static void *SDL_trace_userdata SDL_GUARDED_BY(SDL_trace_lock);
+static int SDL_trace_serial SDL_GUARDED_BY(SDL_trace_lock);
+SDL_AtomicInt SDL_trace_enabled;
+
+static void SDLCALL SDL_ChromeTraceCallback(void *userdata, const SDL_TraceEvent *event);
+static void SDL_CloseChromeTrace(SDL_ChromeTrace *trace);
+
+bool SDL_InitTrace(void)
+{
+    const char *file;
+
+    if (!SDL_ShouldInit(&SDL_trace_init)) {
+        return true;
+    }
+
+    // Callbacks can't be changed safely without this, so tracing isn't available if it can't be created
+    SDL_trace_lock = SDL_CreateRWLock();
+    if (!SDL_trace_lock) {
+        SDL_SetInitialized(&SDL_trace_init, false);
+        return false;
+    }
+
+    SDL_SetInitialized(&SDL_trace_init, true);
+
+    file = SDL_GetHint(SDL_HINT_TRACE_FILE);
+    if (file && *file && !SDL_StartChromeTrace(file)) {
+        SDL_LogWarn(SDL_LOG_CATEGORY_SYSTEM, "Couldn't start a trace in '%s': %s", file, SDL_GetError());
+    }
+    return true;
+}
+
+static bool SDL_CheckInitTrace(void)
+{
+    int status = SDL_GetAtomicInt(&SDL_trace_init.status);
+    if (status == SDL_INIT_STATUS_INITIALIZED ||
+        (status == SDL_INIT_STATUS_INITIALIZING && SDL_trace_init.thread == SDL_GetCurrentThreadID())) {
+        return true;
+    }
+
+    return SDL_InitTrace();
+}
+
+// If only_chrome is set, the callback is only replaced if it's the Chrome trace writer
+static void SDL_SetTraceCallbackInternal(SDL_TraceCallback callback, void *userdata, bool only_chrome)
+{
+    SDL_TraceCallback previous;
+    void *previous_userdata;
+
+    // Taking the lock for writing waits for any callbacks that are still running
+    SDL_LockRWLockForWriting(SDL_trace_lock);
+    {
+        previous = SDL_trace_callback;
+        previous_userdata = SDL_trace_userdata;
+        if (!only_chrome || previous == SDL_ChromeTraceCallback) {
+            SDL_trace_callback = callback;
+            SDL_trace_userdata = userdata;
+            if (callback) {
+                // Each callback gets its own serial number, so zones only end in the callback they began in
+                SDL_trace_serial = (SDL_trace_serial == SDL_MAX_SINT32) ? 1 : SDL_trace_serial + 1;
+                SDL_SetAtomicInt(&SDL_trace_enabled, SDL_trace_serial);
+            } else {
+                SDL_SetAtomicInt(&SDL_trace_enabled, 0);
+            }
+        }
+    }
+    SDL_UnlockRWLock(SDL_trace_lock);
+
+    // Nothing can be writing to the Chrome trace now, so it can be finished and freed
+    if (previous == SDL_ChromeTraceCallback && previous_userdata != userdata) {
+        SDL_CloseChromeTrace((SDL_ChromeTrace *)previous_userdata);
+    }
+}
+
+bool SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata)
+{
+    if (!SDL_CheckInitTrace()) {
+        return false;
+    }
+    SDL_SetTraceCallbackInternal(callback, userdata, false);
+    return true;
+}
+
+void SDL_GetTraceCallback(SDL_TraceCallback *callback, void **userdata)
+{
+    SDL_LockRWLockForReading(SDL_trace_lock);
+    {
+        if (callback) {
+            *callback = SDL_trace_callback;
+        }
+        if (userdata) {
+            *userdata = SDL_trace_userdata;
+        }
+    }
+    SDL_UnlockRWLock(SDL_trace_lock);
+}
+
+// Sends the event to the current callback, or only to the one identified by zone if it's not 0, and returns the callback's serial number, or 0 if it wasn't sent
+static SDL_TraceZone SDL_SendTraceEvent(SDL_TraceEventType type, const char *name, double value, SDL_TraceZone zone)
+{
+    SDL_TraceEvent event;
+    SDL_TraceZone sent = 0;
+
+    event.type = type;
+    event.name = name;
+    event.timestamp = SDL_GetTicksNS();
+    event.thread = SDL_GetCurrentThreadID();
+    event.value = value;
+
+    SDL_LockRWLockForReading(SDL_trace_lock);
+    {
+        // This only changes while the lock is held for writing
+        const SDL_TraceZone serial = (SDL_TraceZone)SDL_GetAtomicInt(&SDL_trace_enabled);
+
+        if (SDL_trace_callback && (!zone || zone == serial)) {
+            SDL_trace_callback(SDL_trace_userdata, &event);
+            sent = serial;
+        }
+    }
+    SDL_UnlockRWLock(SDL_trace_lock);
+
+    return sent;
+}
+
+SDL_TraceZone SDL_BeginTraceZone(const char *name)
+{
+    if (!SDL_GetAtomicInt(&SDL_trace_enabled)) {
+        return 0;
+    }
+    return SDL_SendTraceEvent(SDL_TRACE_EVENT_ZONE_BEGIN, name ? name : "", 0.0, 0);
+}
+
+void SDL_EndTraceZone(SDL_TraceZone zone, const char *name)
+{
+    if (zone && (SDL_TraceZone)SDL_GetAtomicInt(&SDL_trace_enabled) == zone) {
+        SDL_SendTraceEvent(SDL_TRACE_EVENT_ZONE_END, name ? name : "", 0.0, zone);
+    }
+}
+
+void SDL_SetTraceCounter(const char *name, double value)
+{
+    if (SDL_GetAtomicInt(&SDL_trace_enabled)) {
+        SDL_SendTraceEvent(SDL_TRACE_EVENT_COUNTER, name ? name : "", value, 0);
+    }
+}
+
+void SDL_MarkTraceFrame(const char *name)
+{
+    if (SDL_GetAtomicInt(&SDL_trace_enabled)) {
+        SDL_SendTraceEvent(SDL_TRACE_EVENT_FRAME_MARK, name ? name : "Frame", 0.0, 0);
+    }
+}
+
+static void SDL_FlushChromeTrace(SDL_ChromeTrace *trace)
+{
+    if (trace->used > 0) {
+        SDL_WriteIO(trace->io, trace->buffer, trace->used);
+        trace->used = 0;
+    }
+}
+
+static void SDL_WriteChromeTrace(SDL_ChromeTrace *trace, const char *data, size_t length)
+{
+    if (trace->used + length > sizeof(trace->buffer)) {
+        SDL_FlushChromeTrace(trace);
+    }
+    SDL_memcpy(trace->buffer + trace->used, data, length);
+    trace->used += length;
+}
+
+static void SDL_EscapeChromeTraceName(const char *name, char *escaped)
+{
+    size_t length = 0;
+
+    for (; *name; ++name) {
+        const unsigned char ch = (unsigned char)*name;
+
+        if (ch == '"' || ch == '\\') {
+            if (length + 2 >= SDL_CHROME_TRACE_MAX_NAME) {
+                break;
+            }
+            escaped[length++] = '\\';
+            escaped[length++] = (char)ch;
+        } else if (ch < 0x20) {
+            if (length + 6 >= SDL_CHROME_TRACE_MAX_NAME) {
+                break;
+            }
+            SDL_snprintf(&escaped[length], 7, "\\u%04x", ch);
+            length += 6;
+        } else {
+            if (length + 1 >= SDL_CHROME_TRACE_MAX_NAME) {
+                break;
+            }
+            escaped[length++] = (char)ch;
+        }
+    }
+    escaped[length] = '\0';
+}
+
+static void SDLCALL SDL_ChromeTraceCallback(void *userdata, const SDL_TraceEvent *event)
+{
+    SDL_ChromeTrace *trace = (SDL_ChromeTrace *)userdata;
+    char name[SDL_CHROME_TRACE_MAX_NAME];
+    char line[SDL_CHROME_TRACE_MAX_NAME + 128];
+    const Uint64 us = event->timestamp / SDL_NS_PER_US;
+    const unsigned int ns = (unsigned int)(event->timestamp % SDL_NS_PER_US);
+    int length;
+
+    SDL_EscapeChromeTraceName(event->name, name);
+
+    switch (event->type) {
+    case SDL_TRACE_EVENT_ZONE_BEGIN:
+    case SDL_TRACE_EVENT_ZONE_END:
+        length = SDL_snprintf(line, sizeof(line), "{\"name\":\"%s\",\"cat\":\"SDL\",\"ph\":\"%c\",\"ts\":%" SDL_PRIu64 ".%03u,\"pid\":1,\"tid\":%" SDL_PRIu64 "}",
+                              name, (event->type == SDL_TRACE_EVENT_ZONE_BEGIN) ? 'B' : 'E', us, ns, event->thread);
+        break;
+    case SDL_TRACE_EVENT_COUNTER:
+        length = SDL_snprintf(line, sizeof(line), "{\"name\":\"%s\",\"cat\":\"SDL\",\"ph\":\"C\",\"ts\":%" SDL_PRIu64 ".%03u,\"pid\":1,\"tid\":%" SDL_PRIu64 ",\"args\":{\"value\":%.17g}}",
+                              name, us, ns, event->thread, (SDL_isinf(event->value) || SDL_isnan(event->value)) ? 0.0 : event->value);
+        break;
+    case SDL_TRACE_EVENT_FRAME_MARK:
+        length = SDL_snprintf(line, sizeof(line), "{\"name\":\"%s\",\"cat\":\"SDL\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%" SDL_PRIu64 ".%03u,\"pid\":1,\"tid\":%" SDL_PRIu64 "}",
+                              name, us, ns, event->thread);
+        break;
+    default:
+        return;
+    }
+    if (length <= 0 || length >= (int)sizeof(line)) {
+        return;
+    }
+
+    SDL_LockMutex(trace->lock);
+    {
+        SDL_WriteChromeTrace(trace, trace->first ? "\n" : ",\n", trace->first ? 1 : 2);
+        SDL_WriteChromeTrace(trace, line, length);
+        trace->first = false;
+    }
+    SDL_UnlockMutex(trace->lock);
+}
+
+static void SDL_CloseChromeTrace(SDL_ChromeTrace *trace)
+{
+    SDL_WriteChromeTrace(trace, "\n]\n", 3);
+    SDL_FlushChromeTrace(trace);
+    SDL_CloseIO(trace->io);
+    SDL_DestroyMutex(trace->lock);
+    SDL_free(trace);
+}
+
+bool SDL_StartChromeTrace(const char *file)
+{
+    SDL_ChromeTrace *trace;
+
+    CHECK_PARAM(!file) {
+        return SDL_InvalidParamError("file");
+    }
+
+    if (!SDL_CheckInitTrace()) {
+        return false;
+    }
+
+    // Finish the old trace before opening the file, in case it's the same one
+    SDL_SetTraceCallbackInternal(NULL, NULL, true);
+
+    trace = (SDL_ChromeTrace *)SDL_calloc(1, sizeof(*trace));
+    if (!trace) {
+        return false;
+    }
+    trace->first = true;
+
+    trace->lock = SDL_CreateMutex();
+    if (!trace->lock) {
+        SDL_free(trace);
+        return false;
+    }
+
+    trace->io = SDL_IOFromFile(file, "wb");
+    if (!trace->io) {
+        SDL_DestroyMutex(trace->lock);
+        SDL_free(trace);
+        return false;
+    }
+
+    // This is the JSON array format, which is still readable if the app exits without finishing the trace
+    SDL_WriteChromeTrace(trace, "[", 1);
+
+    SDL_SetTraceCallbackInternal(SDL_ChromeTraceCallback, trace, false);
+    return true;
+}
+
+void SDL_StopChromeTrace(void)
+{
+    if (SDL_CheckInitTrace()) {
+        SDL_SetTraceCallbackInternal(NULL, NULL, true);
+    }
+}
+
+void SDL_QuitTrace(void)
+{
+    if (!SDL_ShouldQuit(&SDL_trace_init)) {
+        return;
+    }
+
+    SDL_SetTraceCallbackInternal(NULL, NULL, false);
+
+    SDL_DestroyRWLock(SDL_trace_lock);
+    SDL_trace_lock = NULL;
+
+    SDL_SetInitialized(&SDL_trace_init, false);
+}
+
+#else
+
+bool SDL_InitTrace(void)
+{
+    return true;
+}
+
+void SDL_QuitTrace(void)
+{
+}
+
+bool SDL_SetTraceCallback(SDL_TraceCallback callback, void *userdata)
+{
+    (void)callback;
+    (void)userdata;
+    return SDL_Unsupported();
+}
+
+void SDL_GetTraceCallback(SDL_TraceCallback *callback, void **userdata)
+{
+    if (callback) {
+        *callback = NULL;
+    }
+    if (userdata) {
+        *userdata = NULL;
+    }
+}
+
+SDL_TraceZone SDL_BeginTraceZone(const char *name)
+{
+    (void)name;
+    return 0;
+}
+
+void SDL_EndTraceZone(SDL_TraceZone zone, const char *name)
+{
+    (void)zone;
+    (void)name;
+}
+
+void SDL_SetTraceCounter(const char *name, double value)
+{
+    (void)name;
+    (void)value;
+}
+
+void SDL_MarkTraceFrame(const char *name)
+{
+    (void)name;
+}
+
+bool SDL_StartChromeTrace(const char *file)
+{
+    (void)file;
+    return SDL_Unsupported();
+}
+
+void SDL_StopChromeTrace(void)
+{
+}
+
+#endif // SDL_TRACE_DISABLED
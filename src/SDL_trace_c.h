@@ -0,0 +1,75 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+// This file defines the macros SDL uses to instrument itself for tracing
+
+#ifndef SDL_trace_c_h_
+#define SDL_trace_c_h_
+
+extern bool SDL_InitTrace(void);
+extern void SDL_QuitTrace(void);
+
+#ifndef SDL_TRACE_DISABLED
+
+/* This is 0 while there's no trace callback, so instrumentation costs a
+   single test otherwise, and a number identifying the callback while there
+   is one. It's read without a lock: an event that races with the callback
+   changing is checked again under the lock, and dropped if there's no
+   callback by then. */
+extern SDL_AtomicInt SDL_trace_enabled;
+
+/* Declares `zone` as the handle for the zone, deciding once whether it's
+   traced, so the end is only sent to the callback that saw it begin. */
+#define SDL_TRACE_ZONE_BEGIN(zone, name) \
+    SDL_TraceZone zone = SDL_GetAtomicInt(&SDL_trace_enabled) ? SDL_BeginTraceZone(name) : 0
+
+#define SDL_TRACE_ZONE_END(zone, name)              \
+    do {                                            \
+        if (zone) {                                 \
+            SDL_EndTraceZone(zone, name);           \
+        }                                           \
+    } while (0)
+
+#define SDL_TRACE_COUNTER(name, value)              \
+    do {                                            \
+        if (SDL_GetAtomicInt(&SDL_trace_enabled)) { \
+            SDL_SetTraceCounter(name, value);       \
+        }                                           \
+    } while (0)
+
+#define SDL_TRACE_FRAME_MARK(name)                  \
+    do {                                            \
+        if (SDL_GetAtomicInt(&SDL_trace_enabled)) { \
+            SDL_MarkTraceFrame(name);               \
+        }                                           \
+    } while (0)
+
+#else
+
+#define SDL_TRACE_ZONE_BEGIN(zone, name)
+#define SDL_TRACE_ZONE_END(zone, name)
+#define SDL_TRACE_COUNTER(name, value)
+#define SDL_TRACE_FRAME_MARK(name)
+
+#endif // !SDL_TRACE_DISABLED
+
+#endif // SDL_trace_c_h_
@@ -22,6 +22,7 @@
 
 #include "SDL_audio_c.h"
 #include "SDL_sysaudio.h"
+#include "../SDL_trace_c.h"
 #include "../thread/SDL_systhread.h"
 
 // Available audio drivers
@@ -1180,6 +1181,8 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
         return false;  // we're done, shut it down.
     }
 
+    SDL_TRACE_ZONE_BEGIN(trace_zone, "SDL_PlaybackAudioThreadIterate");
+
     bool failed = false;
     int buffer_size = device->buffer_size;
     Uint8 *device_buffer = device->GetDeviceBuf(device, &buffer_size);
@@ -1285,6 +1288,8 @@ bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
 
     SDL_UnlockMutex(device->lock);
 
+    SDL_TRACE_ZONE_END(trace_zone, "SDL_PlaybackAudioThreadIterate");
+
     if (failed) {
         SDL_AudioDeviceDisconnected(device);  // doh.
     }
@@ -35,6 +35,7 @@ SDL_COMPILE_TIME_ASSERT(int_size, sizeof(int) == sizeof(Sint32));
 
 #include "SDL_wave.h"
 #include "SDL_sysaudio.h"
+#include "../io/SDL_iostream_c.h"
 
 /* Reads the value stored at the location of the f1 pointer, multiplies it
  * with the second argument and then stores the result to f1.
@@ -2088,6 +2089,7 @@ static bool WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uin
 bool SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
 {
     bool result = false;
+    bool buffered;
     WaveFile file;
 
     if (spec) {
@@ -2123,6 +2125,9 @@ bool SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec, Uint8
     file.trunchint = WaveGetTruncationHint();
     file.facthint = WaveGetFactChunkHint();
 
+    // The chunk headers are small reads scattered around the file
+    buffered = SDL_BeginBufferedIO(src);
+
     result = WaveLoad(src, &file, spec, audio_buf, audio_len);
     if (!result) {
         SDL_free(*audio_buf);
@@ -2134,6 +2139,9 @@ bool SDL_LoadWAV_IO(SDL_IOStream *src, bool closeio, SDL_AudioSpec *spec, Uint8
     if (!closeio) {
         SDL_SeekIO(src, file.chunk.position, SDL_IO_SEEK_SET);
     }
+    if (buffered) {
+        SDL_EndBufferedIO(src);
+    }
     WaveFreeChunkData(&file.chunk);
     SDL_free(file.decoderdata);
 done:
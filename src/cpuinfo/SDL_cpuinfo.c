@@ -53,6 +53,15 @@
 #include <setjmp.h>
 #endif
 
+#if (defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)) && defined(__aarch64__)
+#ifndef AT_HWCAP
+#define AT_HWCAP 16
+#endif
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#endif
+
 #if (defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)) && defined(__arm__)
 #include <unistd.h>
 #include <sys/types.h>
@@ -76,6 +85,11 @@
 #include <sys/param.h>
 #endif
 
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 #if defined(HAVE_GETAUXVAL) || defined(HAVE_ELF_AUX_INFO) || defined(SDL_PLATFORM_ANDROID)
 #include <sys/auxv.h>
 #endif
@@ -109,6 +123,8 @@
 #define CPU_HAS_ARM_SIMD (1 << 11)
 #define CPU_HAS_LSX      (1 << 12)
 #define CPU_HAS_LASX     (1 << 13)
+#define CPU_HAS_PCLMUL   (1 << 14)
+#define CPU_HAS_ARM_CRC32 (1 << 15)
 
 #define CPU_CFG2      0x2
 #define CPU_CFG2_LSX  (1 << 6)
@@ -514,6 +530,24 @@ static int CPU_haveNEON(void)
 #endif
 }
 
+static int CPU_haveARMCRC32(void)
+{
+#if defined(__ARM_FEATURE_CRC32)
+    return 1; // the compiler was told the CRC32 instructions are always there.
+#elif defined(SDL_PLATFORM_WINDOWS) && defined(_M_ARM64)
+#ifndef PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE
+#define PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE 31
+#endif
+    return IsProcessorFeaturePresent(PF_ARM_V8_CRC32_INSTRUCTIONS_AVAILABLE) != 0;
+#elif defined(SDL_PLATFORM_APPLE) && defined(__aarch64__)
+    return 1; // every 64-bit Apple CPU has the CRC32 instructions.
+#elif defined(__aarch64__) && (defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)) && (defined(HAVE_GETAUXVAL) || defined(SDL_PLATFORM_ANDROID))
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) == HWCAP_CRC32;
+#else
+    return 0;
+#endif
+}
+
 static int CPU_readCPUCFG(void)
 {
     uint32_t cfg2 = 0;
@@ -565,6 +599,11 @@ static int CPU_readCPUCFG(void)
 #else
 #define CPU_haveAVX() (0)
 #endif
+#ifdef __PCLMUL__
+#define CPU_havePCLMUL() (1)
+#else
+#define CPU_havePCLMUL() (0)
+#endif
 #else
 #define CPU_haveMMX()   (CPU_CPUIDFeatures[3] & 0x00800000)
 #define CPU_haveSSE()   (CPU_CPUIDFeatures[3] & 0x02000000)
@@ -573,6 +612,7 @@ static int CPU_readCPUCFG(void)
 #define CPU_haveSSE41() (CPU_CPUIDFeatures[2] & 0x00080000)
 #define CPU_haveSSE42() (CPU_CPUIDFeatures[2] & 0x00100000)
 #define CPU_haveAVX()   (CPU_OSSavesYMM && (CPU_CPUIDFeatures[2] & 0x10000000))
+#define CPU_havePCLMUL() (CPU_CPUIDFeatures[2] & 0x00000002)
 #endif
 
 #ifdef __e2k__
@@ -663,6 +703,393 @@ int SDL_GetNumLogicalCPUCores(void)
     return SDL_NumLogicalCPUCores;
 }
 
+#if defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)
+#define SDL_CPU_TOPOLOGY_SYSFS
+#endif
+
+#ifdef SDL_CPU_TOPOLOGY_SYSFS
+// Reads a small sysfs file, without the trailing newline
+static bool CPU_readSysfsFile(const char *path, char *buf, size_t buflen)
+{
+    ssize_t len;
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    len = read(fd, buf, buflen - 1);
+    close(fd);
+    if (len <= 0) {
+        return false;
+    }
+    while (len > 0 && (buf[len - 1] == '\n' || buf[len - 1] == ' ')) {
+        --len;
+    }
+    buf[len] = '\0';
+    return true;
+}
+
+static bool CPU_readSysfsCPUFile(int cpu, const char *file, char *buf, size_t buflen)
+{
+    char path[128];
+    SDL_snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/%s", cpu, file);
+    return CPU_readSysfsFile(path, buf, buflen);
+}
+
+static int CPU_readSysfsCPUInt(int cpu, const char *file, int default_value)
+{
+    char buf[32];
+    if (!CPU_readSysfsCPUFile(cpu, file, buf, sizeof(buf))) {
+        return default_value;
+    }
+    return SDL_atoi(buf);
+}
+
+/* Calls the callback for each CPU in a list like "0-3,8,10-11", stopping if
+   it returns false. Returns false if the list didn't parse or was stopped. */
+static bool CPU_forEachInList(const char *list, bool (*callback)(int cpu, void *userdata), void *userdata)
+{
+    while (*list) {
+        char *end;
+        long first = SDL_strtol(list, &end, 10);
+        long last = first;
+
+        if (end == list || first < 0) {
+            return false;
+        }
+        list = end;
+        if (*list == '-') {
+            ++list;
+            last = SDL_strtol(list, &end, 10);
+            if (end == list || last < first) {
+                return false;
+            }
+            list = end;
+        }
+        for (; first <= last; ++first) {
+            if (!callback((int)first, userdata)) {
+                return false;
+            }
+        }
+        if (*list == ',') {
+            ++list;
+        } else if (*list) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool CPU_findInList(int cpu, void *userdata)
+{
+    int *wanted = (int *)userdata;
+    if (cpu == *wanted) {
+        *wanted = -1;
+        return false;
+    }
+    return true;
+}
+
+static bool CPU_listContains(const char *list, int cpu)
+{
+    CPU_forEachInList(list, CPU_findInList, &cpu);
+    return cpu == -1;
+}
+
+static bool CPU_getFirstInList(int cpu, void *userdata)
+{
+    *(int *)userdata = cpu;
+    return false;
+}
+
+static int CPU_firstInList(const char *list)
+{
+    int cpu = -1;
+    CPU_forEachInList(list, CPU_getFirstInList, &cpu);
+    return cpu;
+}
+
+static bool CPU_getLastInList(int cpu, void *userdata)
+{
+    *(int *)userdata = cpu;
+    return true;
+}
+
+typedef struct CPU_TopologyBuilder
+{
+    SDL_CPUInfo *cpus;
+    int count;
+    int capacity;
+} CPU_TopologyBuilder;
+
+static bool CPU_addOnlineCPU(int cpu, void *userdata)
+{
+    CPU_TopologyBuilder *builder = (CPU_TopologyBuilder *)userdata;
+    SDL_CPUInfo *info;
+
+    if (builder->count == builder->capacity) {
+        int capacity = builder->capacity ? builder->capacity * 2 : 16;
+        SDL_CPUInfo *cpus = (SDL_CPUInfo *)SDL_realloc(builder->cpus, capacity * sizeof(*cpus));
+        if (!cpus) {
+            return false;
+        }
+        builder->cpus = cpus;
+        builder->capacity = capacity;
+    }
+    info = &builder->cpus[builder->count++];
+    SDL_zerop(info);
+    info->cpu = cpu;
+    return true;
+}
+
+// Returns a size like "32K" or "8M" in bytes
+static int CPU_parseCacheSize(const char *size)
+{
+    char *end;
+    long value = SDL_strtol(size, &end, 10);
+    if (*end == 'K') {
+        value *= 1024;
+    } else if (*end == 'M') {
+        value *= 1024 * 1024;
+    }
+    return (int)SDL_clamp(value, 0, SDL_MAX_SINT32);
+}
+
+static void CPU_readCacheInfo(SDL_CPUInfo *info)
+{
+    int index;
+
+    info->l2_cache_id = -1;
+    info->l3_cache_id = -1;
+    for (index = 0;; ++index) {
+        char file[64];
+        char buf[256];
+        int level, id;
+
+        SDL_snprintf(file, sizeof(file), "cache/index%d/level", index);
+        if (!CPU_readSysfsCPUFile(info->cpu, file, buf, sizeof(buf))) {
+            break;
+        }
+        level = SDL_atoi(buf);
+        if (level != 2 && level != 3) {
+            continue;
+        }
+        SDL_snprintf(file, sizeof(file), "cache/index%d/type", index);
+        if (CPU_readSysfsCPUFile(info->cpu, file, buf, sizeof(buf)) && SDL_strcmp(buf, "Instruction") == 0) {
+            continue;
+        }
+
+        // Caches are identified by the first CPU that shares them, since the id file isn't unique across levels
+        SDL_snprintf(file, sizeof(file), "cache/index%d/shared_cpu_list", index);
+        if (CPU_readSysfsCPUFile(info->cpu, file, buf, sizeof(buf))) {
+            id = CPU_firstInList(buf);
+        } else {
+            id = info->cpu;
+        }
+        SDL_snprintf(file, sizeof(file), "cache/index%d/size", index);
+        if (!CPU_readSysfsCPUFile(info->cpu, file, buf, sizeof(buf))) {
+            buf[0] = '\0';
+        }
+        if (level == 2) {
+            info->l2_cache_size = CPU_parseCacheSize(buf);
+            info->l2_cache_id = id;
+        } else {
+            info->l3_cache_size = CPU_parseCacheSize(buf);
+            info->l3_cache_id = id;
+        }
+    }
+}
+
+static bool CPU_readSysfsTopology(CPU_TopologyBuilder *builder)
+{
+    char *list;
+    char *atom_cpus = NULL;
+    int num_nodes = -1;
+    int max_capacity = 0, min_capacity = SDL_MAX_SINT32;
+    int i, j;
+
+    list = (char *)SDL_malloc(4096);
+    if (!list) {
+        return false;
+    }
+    if (!CPU_readSysfsFile("/sys/devices/system/cpu/online", list, 4096) ||
+        !CPU_forEachInList(list, CPU_addOnlineCPU, builder) ||
+        builder->count == 0) {
+        SDL_free(list);
+        return false;
+    }
+
+    if (CPU_readSysfsFile("/sys/devices/system/node/possible", list, 4096)) {
+        CPU_forEachInList(list, CPU_getLastInList, &num_nodes);
+        ++num_nodes;
+    }
+
+    // Intel hybrid CPUs list their efficiency cores here
+    if (CPU_readSysfsFile("/sys/devices/cpu_atom/cpus", list, 4096)) {
+        atom_cpus = SDL_strdup(list);
+    }
+
+    for (i = 0; i < builder->count; ++i) {
+        SDL_CPUInfo *info = &builder->cpus[i];
+
+        // For now, the core is identified by its first logical CPU
+        info->core = -1;
+        if (CPU_readSysfsCPUFile(info->cpu, "topology/core_cpus_list", list, 4096) ||
+            CPU_readSysfsCPUFile(info->cpu, "topology/thread_siblings_list", list, 4096)) {
+            info->core = CPU_firstInList(list);
+        }
+        if (info->core < 0) {
+            info->core = info->cpu;
+        }
+        info->package = SDL_max(CPU_readSysfsCPUInt(info->cpu, "topology/physical_package_id", 0), 0);
+
+        for (j = 0; j < num_nodes; ++j) {
+            char path[128];
+            SDL_snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", j);
+            if (CPU_readSysfsFile(path, list, 4096) && CPU_listContains(list, info->cpu)) {
+                info->numa_node = j;
+                break;
+            }
+        }
+
+        info->capacity = CPU_readSysfsCPUInt(info->cpu, "cpu_capacity", 0);
+        if (info->capacity <= 0) {
+            // Fall back to the maximum frequency, which is scaled below
+            info->capacity = CPU_readSysfsCPUInt(info->cpu, "cpufreq/cpuinfo_max_freq", 0);
+        }
+        max_capacity = SDL_max(max_capacity, info->capacity);
+        min_capacity = SDL_min(min_capacity, info->capacity);
+
+        CPU_readCacheInfo(info);
+    }
+    SDL_free(list);
+
+    for (i = 0; i < builder->count; ++i) {
+        SDL_CPUInfo *info = &builder->cpus[i];
+
+        if (atom_cpus) {
+            info->core_type = CPU_listContains(atom_cpus, info->cpu) ? SDL_CPU_CORE_TYPE_EFFICIENCY : SDL_CPU_CORE_TYPE_PERFORMANCE;
+        } else if (min_capacity > 0 && min_capacity < max_capacity && CPU_readSysfsCPUInt(info->cpu, "cpu_capacity", 0) > 0) {
+            // On big.LITTLE systems, the slowest cores are the efficiency cores
+            info->core_type = (info->capacity == min_capacity) ? SDL_CPU_CORE_TYPE_EFFICIENCY : SDL_CPU_CORE_TYPE_PERFORMANCE;
+        } else {
+            info->core_type = SDL_CPU_CORE_TYPE_PERFORMANCE;
+        }
+
+        if (max_capacity > 0 && info->capacity > 0) {
+            info->capacity = (int)SDL_max((Sint64)info->capacity * 1024 / max_capacity, 1);
+        } else {
+            info->capacity = 1024;
+        }
+    }
+    SDL_free(atom_cpus);
+    return true;
+}
+#endif // SDL_CPU_TOPOLOGY_SYSFS
+
+static bool CPU_getTopology(CPU_TopologyBuilder *builder)
+{
+    int i, j, num_cores = 0;
+
+    SDL_zerop(builder);
+#ifdef SDL_CPU_TOPOLOGY_SYSFS
+    if (!CPU_readSysfsTopology(builder)) {
+        SDL_free(builder->cpus);
+        SDL_zerop(builder);
+    }
+#endif
+    if (builder->count == 0) {
+        const int count = SDL_GetNumLogicalCPUCores();
+
+        builder->cpus = (SDL_CPUInfo *)SDL_calloc(count, sizeof(*builder->cpus));
+        if (!builder->cpus) {
+            return false;
+        }
+        builder->count = count;
+        for (i = 0; i < count; ++i) {
+            SDL_CPUInfo *info = &builder->cpus[i];
+            info->cpu = i;
+            info->core = i;
+            info->core_type = SDL_CPU_CORE_TYPE_UNKNOWN;
+            info->capacity = 1024;
+            info->l2_cache_id = -1;
+            info->l3_cache_id = -1;
+        }
+    }
+
+    // Number the physical cores from 0, in the order of their first logical CPU
+    for (i = 0; i < builder->count; ++i) {
+        SDL_CPUInfo *info = &builder->cpus[i];
+        for (j = 0; j < i; ++j) {
+            if (builder->cpus[j].cpu == info->core) {
+                break;
+            }
+        }
+        if (j < i) {
+            info->core = builder->cpus[j].core;
+        } else {
+            info->core = num_cores++;
+        }
+    }
+    return true;
+}
+
+static int SDL_NumPhysicalCPUCores = 0;
+
+int SDL_GetNumPhysicalCPUCores(void)
+{
+    if (!SDL_NumPhysicalCPUCores) {
+        CPU_TopologyBuilder builder;
+        int num_cores = 0;
+        int i;
+
+        if (CPU_getTopology(&builder)) {
+            for (i = 0; i < builder.count; ++i) {
+                num_cores = SDL_max(num_cores, builder.cpus[i].core + 1);
+            }
+            SDL_free(builder.cpus);
+        }
+        if (num_cores <= 0) {
+            num_cores = SDL_GetNumLogicalCPUCores();
+        }
+        SDL_NumPhysicalCPUCores = num_cores;
+    }
+    return SDL_NumPhysicalCPUCores;
+}
+
+SDL_CPUInfo **SDL_GetCPUTopology(int *count)
+{
+    CPU_TopologyBuilder builder;
+    SDL_CPUInfo **result;
+    SDL_CPUInfo *cpus;
+    int i;
+
+    if (count) {
+        *count = 0;
+    }
+
+    if (!CPU_getTopology(&builder)) {
+        return NULL;
+    }
+
+    result = (SDL_CPUInfo **)SDL_malloc((builder.count + 1) * sizeof(*result) + builder.count * sizeof(**result));
+    if (!result) {
+        SDL_free(builder.cpus);
+        return NULL;
+    }
+    cpus = (SDL_CPUInfo *)(result + builder.count + 1);
+    SDL_memcpy(cpus, builder.cpus, builder.count * sizeof(*cpus));
+    for (i = 0; i < builder.count; ++i) {
+        result[i] = &cpus[i];
+    }
+    result[i] = NULL;
+    SDL_free(builder.cpus);
+
+    if (count) {
+        *count = builder.count;
+    }
+    return result;
+}
+
 #ifdef __e2k__
 inline const char *
 SDL_GetCPUType(void)
@@ -960,6 +1387,10 @@ static Uint32 SDLCALL SDL_CPUFeatureMaskFromHint(void)
                 spot_mask = CPU_HAS_LSX;
             } else if (ref_string_equals("lasx", spot, end)) {
                 spot_mask = CPU_HAS_LASX;
+            } else if (ref_string_equals("pclmul", spot, end)) {
+                spot_mask = CPU_HAS_PCLMUL;
+            } else if (ref_string_equals("arm-crc32", spot, end)) {
+                spot_mask = CPU_HAS_ARM_CRC32;
             } else {
                 // Ignore unknown/incorrect cpu feature(s)
                 continue;
@@ -1036,6 +1467,12 @@ static Uint32 SDL_GetCPUFeatures(void)
             SDL_CPUFeatures |= CPU_HAS_LASX;
             SDL_SIMDAlignment = SDL_max(SDL_SIMDAlignment, 32);
         }
+        if (CPU_havePCLMUL()) {
+            SDL_CPUFeatures |= CPU_HAS_PCLMUL;
+        }
+        if (CPU_haveARMCRC32()) {
+            SDL_CPUFeatures |= CPU_HAS_ARM_CRC32;
+        }
         SDL_CPUFeatures &= SDL_CPUFeatureMaskFromHint();
     }
     return SDL_CPUFeatures;
@@ -1117,6 +1554,16 @@ bool SDL_HasLASX(void)
     return CPU_FEATURE_AVAILABLE(CPU_HAS_LASX);
 }
 
+bool SDL_HasPCLMUL(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_PCLMUL);
+}
+
+bool SDL_HasARMCRC32(void)
+{
+    return CPU_FEATURE_AVAILABLE(CPU_HAS_ARM_CRC32);
+}
+
 static int SDL_SystemRAM = 0;
 
 int SDL_GetSystemRAM(void)
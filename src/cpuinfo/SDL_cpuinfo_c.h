@@ -24,4 +24,8 @@
 
 extern void SDL_QuitCPUInfo(void);
 
+// Features that only SDL itself uses, so they aren't in the public API
+extern bool SDL_HasPCLMUL(void);
+extern bool SDL_HasARMCRC32(void);
+
 #endif // SDL_cpuinfo_c_h_
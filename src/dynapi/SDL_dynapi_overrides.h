@@ -1306,3 +1306,51 @@
 #define SDL_OpenXR_UnloadLibrary SDL_OpenXR_UnloadLibrary_REAL
 #define SDL_OpenXR_GetXrGetInstanceProcAddr SDL_OpenXR_GetXrGetInstanceProcAddr_REAL
 #define SDL_CreateTrayWithProperties SDL_CreateTrayWithProperties_REAL
+#define SDL_GetLogMessageTimestamp SDL_GetLogMessageTimestamp_REAL
+#define SDL_StartAsyncLogging SDL_StartAsyncLogging_REAL
+#define SDL_FlushLogs SDL_FlushLogs_REAL
+#define SDL_StopAsyncLogging SDL_StopAsyncLogging_REAL
+#define SDL_IOFromMappedFile SDL_IOFromMappedFile_REAL
+#define SDL_MapFile SDL_MapFile_REAL
+#define SDL_UnmapFile SDL_UnmapFile_REAL
+#define SDL_CreateAsyncIOBatch SDL_CreateAsyncIOBatch_REAL
+#define SDL_BatchReadAsyncIO SDL_BatchReadAsyncIO_REAL
+#define SDL_BatchWriteAsyncIO SDL_BatchWriteAsyncIO_REAL
+#define SDL_BatchReadVectorAsyncIO SDL_BatchReadVectorAsyncIO_REAL
+#define SDL_BatchWriteVectorAsyncIO SDL_BatchWriteVectorAsyncIO_REAL
+#define SDL_SubmitAsyncIOBatch SDL_SubmitAsyncIOBatch_REAL
+#define SDL_DestroyAsyncIOBatch SDL_DestroyAsyncIOBatch_REAL
+#define SDL_RegisterAsyncIOBuffers SDL_RegisterAsyncIOBuffers_REAL
+#define SDL_RegisterAsyncIOFile SDL_RegisterAsyncIOFile_REAL
+#define SDL_GetGamepadState SDL_GetGamepadState_REAL
+#define SDL_WaitStorageCommits SDL_WaitStorageCommits_REAL
+#define SDL_GetStoragePendingCommits SDL_GetStoragePendingCommits_REAL
+#define SDL_SetProcessOutputCallback SDL_SetProcessOutputCallback_REAL
+#define SDL_WaitProcesses SDL_WaitProcesses_REAL
+#define SDL_GetMemoryStats SDL_GetMemoryStats_REAL
+#define SDL_CreateMemoryArena SDL_CreateMemoryArena_REAL
+#define SDL_AllocateArenaMemory SDL_AllocateArenaMemory_REAL
+#define SDL_ResetMemoryArena SDL_ResetMemoryArena_REAL
+#define SDL_DestroyMemoryArena SDL_DestroyMemoryArena_REAL
+#define SDL_ParallelSort SDL_ParallelSort_REAL
+#define SDL_RadixSort SDL_RadixSort_REAL
+#define SDL_GetNumPhysicalCPUCores SDL_GetNumPhysicalCPUCores_REAL
+#define SDL_GetCPUTopology SDL_GetCPUTopology_REAL
+#define SDL_SetThreadAffinity SDL_SetThreadAffinity_REAL
+#define SDL_CreateJobPool SDL_CreateJobPool_REAL
+#define SDL_GetNumJobPoolThreads SDL_GetNumJobPoolThreads_REAL
+#define SDL_DestroyJobPool SDL_DestroyJobPool_REAL
+#define SDL_CreateJobCounter SDL_CreateJobCounter_REAL
+#define SDL_GetJobCounterValue SDL_GetJobCounterValue_REAL
+#define SDL_DestroyJobCounter SDL_DestroyJobCounter_REAL
+#define SDL_SubmitJob SDL_SubmitJob_REAL
+#define SDL_WaitJobCounter SDL_WaitJobCounter_REAL
+#define SDL_ParallelFor SDL_ParallelFor_REAL
+#define SDL_SetTraceCallback SDL_SetTraceCallback_REAL
+#define SDL_GetTraceCallback SDL_GetTraceCallback_REAL
+#define SDL_BeginTraceZone SDL_BeginTraceZone_REAL
+#define SDL_EndTraceZone SDL_EndTraceZone_REAL
+#define SDL_SetTraceCounter SDL_SetTraceCounter_REAL
+#define SDL_MarkTraceFrame SDL_MarkTraceFrame_REAL
+#define SDL_StartChromeTrace SDL_StartChromeTrace_REAL
+#define SDL_StopChromeTrace SDL_StopChromeTrace_REAL
@@ -1314,3 +1314,51 @@ SDL_DYNAPI_PROC(bool,SDL_OpenXR_LoadLibrary,(void),(),return)
 SDL_DYNAPI_PROC(void,SDL_OpenXR_UnloadLibrary,(void),(),)
 SDL_DYNAPI_PROC(PFN_xrGetInstanceProcAddr,SDL_OpenXR_GetXrGetInstanceProcAddr,(void),(),return)
 SDL_DYNAPI_PROC(SDL_Tray*,SDL_CreateTrayWithProperties,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(Uint64,SDL_GetLogMessageTimestamp,(void),(),return)
+SDL_DYNAPI_PROC(bool,SDL_StartAsyncLogging,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_FlushLogs,(void),(),)
+SDL_DYNAPI_PROC(void,SDL_StopAsyncLogging,(void),(),)
+SDL_DYNAPI_PROC(SDL_IOStream*,SDL_IOFromMappedFile,(const char *a,SDL_IOAccessPattern b),(a,b),return)
+SDL_DYNAPI_PROC(void*,SDL_MapFile,(const char *a,size_t *b,SDL_IOAccessPattern c),(a,b,c),return)
+SDL_DYNAPI_PROC(void,SDL_UnmapFile,(void *a,size_t b),(a,b),)
+SDL_DYNAPI_PROC(SDL_AsyncIOBatch*,SDL_CreateAsyncIOBatch,(SDL_AsyncIOQueue *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_BatchReadAsyncIO,(SDL_AsyncIOBatch *a,SDL_AsyncIO *b,void *c,Uint64 d,Uint64 e,void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(bool,SDL_BatchWriteAsyncIO,(SDL_AsyncIOBatch *a,SDL_AsyncIO *b,void *c,Uint64 d,Uint64 e,void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(bool,SDL_BatchReadVectorAsyncIO,(SDL_AsyncIOBatch *a,SDL_AsyncIO *b,const SDL_AsyncIOVector *c,int d,Uint64 e,void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(bool,SDL_BatchWriteVectorAsyncIO,(SDL_AsyncIOBatch *a,SDL_AsyncIO *b,const SDL_AsyncIOVector *c,int d,Uint64 e,void *f),(a,b,c,d,e,f),return)
+SDL_DYNAPI_PROC(bool,SDL_SubmitAsyncIOBatch,(SDL_AsyncIOBatch *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyAsyncIOBatch,(SDL_AsyncIOBatch *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_RegisterAsyncIOBuffers,(SDL_AsyncIOQueue *a,const SDL_AsyncIOVector *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_RegisterAsyncIOFile,(SDL_AsyncIOQueue *a,SDL_AsyncIO *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_GetGamepadState,(SDL_Gamepad *a,SDL_GamepadState *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_WaitStorageCommits,(SDL_Storage *a,Sint32 b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetStoragePendingCommits,(SDL_Storage *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetProcessOutputCallback,(SDL_Process *a,SDL_ProcessOutputCallback b,void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_WaitProcesses,(SDL_Process **a,int b,Sint32 c),(a,b,c),return)
+SDL_DYNAPI_PROC(bool,SDL_GetMemoryStats,(SDL_MemoryStats *a),(a),return)
+SDL_DYNAPI_PROC(SDL_MemoryArena*,SDL_CreateMemoryArena,(size_t a),(a),return)
+SDL_DYNAPI_PROC(void*,SDL_AllocateArenaMemory,(SDL_MemoryArena *a,size_t b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_ResetMemoryArena,(SDL_MemoryArena *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_DestroyMemoryArena,(SDL_MemoryArena *a),(a),)
+SDL_DYNAPI_PROC(void,SDL_ParallelSort,(void *a,size_t b,size_t c,SDL_CompareCallback_r d,void *e),(a,b,c,d,e),)
+SDL_DYNAPI_PROC(bool,SDL_RadixSort,(void *a,size_t b,size_t c,size_t d,SDL_SortKeyType e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(int,SDL_GetNumPhysicalCPUCores,(void),(),return)
+SDL_DYNAPI_PROC(SDL_CPUInfo**,SDL_GetCPUTopology,(int *a),(a),return)
+SDL_DYNAPI_PROC(bool,SDL_SetThreadAffinity,(SDL_Thread *a,const int *b,int c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_JobPool*,SDL_CreateJobPool,(SDL_PropertiesID a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_GetNumJobPoolThreads,(SDL_JobPool *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobPool,(SDL_JobPool *a),(a),)
+SDL_DYNAPI_PROC(SDL_JobCounter*,SDL_CreateJobCounter,(void),(),return)
+SDL_DYNAPI_PROC(int,SDL_GetJobCounterValue,(SDL_JobCounter *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_DestroyJobCounter,(SDL_JobCounter *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_SubmitJob,(SDL_JobPool *a,SDL_JobCallback b,void *c,SDL_JobCounter *d,SDL_JobCounter *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_WaitJobCounter,(SDL_JobPool *a,SDL_JobCounter *b),(a,b),return)
+SDL_DYNAPI_PROC(bool,SDL_ParallelFor,(SDL_JobPool *a,int b,int c,SDL_ParallelForCallback d,void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(bool,SDL_SetTraceCallback,(SDL_TraceCallback a,void *b),(a,b),return)
+SDL_DYNAPI_PROC(void,SDL_GetTraceCallback,(SDL_TraceCallback *a,void **b),(a,b),)
+SDL_DYNAPI_PROC(SDL_TraceZone,SDL_BeginTraceZone,(const char *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_EndTraceZone,(SDL_TraceZone a,const char *b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_SetTraceCounter,(const char *a,double b),(a,b),)
+SDL_DYNAPI_PROC(void,SDL_MarkTraceFrame,(const char *a),(a),)
+SDL_DYNAPI_PROC(bool,SDL_StartChromeTrace,(const char *a),(a),return)
+SDL_DYNAPI_PROC(void,SDL_StopChromeTrace,(void),(),)
@@ -26,10 +26,12 @@
 #include "SDL_eventwatch_c.h"
 #include "SDL_windowevents_c.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_trace_c.h"
 #include "../audio/SDL_audio_c.h"
 #include "../camera/SDL_camera_c.h"
 #include "../timer/SDL_timer_c.h"
 #include "../core/linux/SDL_udev.h"
+#include "../stdlib/SDL_sysstdlib.h"
 #ifndef SDL_JOYSTICK_DISABLED
 #include "../joystick/SDL_joystick_c.h"
 #endif
@@ -126,17 +128,22 @@ typedef struct
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static SDL_AtomicInt SDL_userevents;
 
-typedef struct SDL_TemporaryMemory
-{
-    void *memory;
-    struct SDL_TemporaryMemory *prev;
-    struct SDL_TemporaryMemory *next;
-} SDL_TemporaryMemory;
+/* Temporary memory comes from a per-thread memory arena that is reset when
+   the thread next polls for events. Events that refer to temporary memory
+   retain the arena blocks it lives in while they're in the queue, and the
+   thread that takes an event off the queue releases them on its next poll. */
+#define SDL_MAX_EVENT_MEMORY 2
+
+// Each temporary allocation starts with its size, so it can be claimed
+#define SDL_TEMPORARY_MEMORY_HEADER 16
+#define SDL_TEMPORARY_MEMORY_CLAIMED SDL_SIZE_MAX
 
 typedef struct SDL_TemporaryMemoryState
 {
-    SDL_TemporaryMemory *head;
-    SDL_TemporaryMemory *tail;
+    SDL_MemoryArena *arena;
+    SDL_MemoryArenaBlock **released;
+    int num_released;
+    int max_released;
 } SDL_TemporaryMemoryState;
 
 static SDL_TLSID SDL_temporary_memory;
@@ -144,7 +151,7 @@ static SDL_TLSID SDL_temporary_memory;
 typedef struct SDL_EventEntry
 {
     SDL_Event event;
-    SDL_TemporaryMemory *memory;
+    SDL_MemoryArenaBlock *memory[SDL_MAX_EVENT_MEMORY];
     struct SDL_EventEntry *prev;
     struct SDL_EventEntry *next;
 } SDL_EventEntry;
@@ -166,6 +173,8 @@ static void SDL_CleanupTemporaryMemory(void *data)
     SDL_TemporaryMemoryState *state = (SDL_TemporaryMemoryState *)data;
 
     SDL_FreeTemporaryMemory();
+    SDL_DestroyMemoryArena(state->arena);
+    SDL_free(state->released);
     SDL_free(state);
 }
 
@@ -184,7 +193,14 @@ static SDL_TemporaryMemoryState *SDL_GetTemporaryMemoryState(bool create)
             return NULL;
         }
 
+        state->arena = SDL_CreateMemoryArena(0);
+        if (!state->arena) {
+            SDL_free(state);
+            return NULL;
+        }
+
         if (!SDL_SetTLS(&SDL_temporary_memory, state, SDL_CleanupTemporaryMemory)) {
+            SDL_DestroyMemoryArena(state->arena);
             SDL_free(state);
             return NULL;
         }
@@ -192,76 +208,53 @@ static SDL_TemporaryMemoryState *SDL_GetTemporaryMemoryState(bool create)
     return state;
 }
 
-static SDL_TemporaryMemory *SDL_GetTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, const void *mem)
+// Temporary memory is either from this thread or from events this thread took off the queue
+static SDL_MemoryArenaBlock *SDL_FindTemporaryMemoryBlock(SDL_TemporaryMemoryState *state, const void *mem)
 {
-    SDL_TemporaryMemory *entry;
+    SDL_MemoryArenaBlock *block;
+    int i;
 
-    // Start from the end, it's likely to have been recently allocated
-    for (entry = state->tail; entry; entry = entry->prev) {
-        if (mem == entry->memory) {
-            return entry;
+    block = SDL_FindArenaBlock(state->arena, mem);
+    for (i = 0; !block && i < state->num_released; ++i) {
+        if (SDL_ArenaBlockContains(state->released[i], mem)) {
+            block = state->released[i];
         }
     }
-    return NULL;
-}
-
-static void SDL_LinkTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry)
-{
-    entry->prev = state->tail;
-    entry->next = NULL;
-
-    if (state->tail) {
-        state->tail->next = entry;
-    } else {
-        state->head = entry;
-    }
-    state->tail = entry;
-}
-
-static void SDL_UnlinkTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry)
-{
-    if (state->head == entry) {
-        state->head = entry->next;
-    }
-    if (state->tail == entry) {
-        state->tail = entry->prev;
-    }
-
-    if (entry->prev) {
-        entry->prev->next = entry->next;
-    }
-    if (entry->next) {
-        entry->next->prev = entry->prev;
-    }
-
-    entry->prev = NULL;
-    entry->next = NULL;
-}
-
-static void SDL_FreeTemporaryMemoryEntry(SDL_TemporaryMemoryState *state, SDL_TemporaryMemory *entry, bool free_data)
-{
-    if (free_data) {
-        SDL_free(entry->memory);
-    }
-    SDL_free(entry);
+    return block;
 }
 
 static void SDL_LinkTemporaryMemoryToEvent(SDL_EventEntry *event, const void *mem)
 {
     SDL_TemporaryMemoryState *state;
-    SDL_TemporaryMemory *entry;
+    SDL_MemoryArenaBlock *block;
+    int i;
+
+    if (!mem) {
+        return;
+    }
 
     state = SDL_GetTemporaryMemoryState(false);
     if (!state) {
         return;
     }
 
-    entry = SDL_GetTemporaryMemoryEntry(state, mem);
-    if (entry) {
-        SDL_UnlinkTemporaryMemoryEntry(state, entry);
-        entry->next = event->memory;
-        event->memory = entry;
+    // The event might be going back on the queue with memory from an event this thread took off it
+    block = SDL_FindTemporaryMemoryBlock(state, mem);
+    if (!block) {
+        return;
     }
+
+    for (i = 0; i < SDL_MAX_EVENT_MEMORY; ++i) {
+        if (event->memory[i] == block) {
+            return;
+        }
+        if (!event->memory[i]) {
+            SDL_RetainArenaBlock(block);
+            event->memory[i] = block;
+            return;
+        }
+    }
+    SDL_assert(!"Event refers to too many temporary memory blocks");
 }
 
 static void SDL_TransferSysWMMemoryToEvent(SDL_EventEntry *event)
@@ -275,7 +268,7 @@ static void SDL_TransferSysWMMemoryToEvent(SDL_EventEntry *event)
     }
 }
 
-// Transfer the event memory from the thread-local event memory list to the event
+// Keep the temporary memory the event refers to alive while it's in the queue
 static void SDL_TransferTemporaryMemoryToEvent(SDL_EventEntry *event)
 {
     switch (event->event.type) {
@@ -308,13 +301,13 @@ static void SDL_TransferTemporaryMemoryToEvent(SDL_EventEntry *event)
     }
 }
 
-// Transfer the event memory from the event to the thread-local event memory list
+// Hand the event memory to this thread, to be released when it next frees temporary memory
 static void SDL_TransferTemporaryMemoryFromEvent(SDL_EventEntry *event)
 {
     SDL_TemporaryMemoryState *state;
-    SDL_TemporaryMemory *entry, *next;
+    int i;
 
-    if (!event->memory) {
+    if (!event->memory[0]) {
         return;
     }
 
@@ -323,50 +316,53 @@ static void SDL_TransferTemporaryMemoryFromEvent(SDL_EventEntry *event)
         return;  // this is now a leak, but you probably have bigger problems if malloc failed.
     }
 
-    for (entry = event->memory; entry; entry = next) {
-        next = entry->next;
-        SDL_LinkTemporaryMemoryEntry(state, entry);
+    for (i = 0; i < SDL_MAX_EVENT_MEMORY && event->memory[i]; ++i) {
+        if (state->num_released == state->max_released) {
+            int max_released = state->max_released ? state->max_released * 2 : 16;
+            SDL_MemoryArenaBlock **released = (SDL_MemoryArenaBlock **)SDL_realloc(state->released, max_released * sizeof(*released));
+            if (!released) {
+                break;  // this is now a leak, but you probably have bigger problems if malloc failed.
+            }
+            state->released = released;
+            state->max_released = max_released;
+        }
+        state->released[state->num_released++] = event->memory[i];
     }
-    event->memory = NULL;
+    SDL_zeroa(event->memory);
 }
 
-static void *SDL_FreeLater(void *memory)
+void *SDL_AllocateTemporaryMemory(size_t size)
 {
     SDL_TemporaryMemoryState *state;
-
-    if (memory == NULL) {
-        return NULL;
-    }
-
-    // Make sure we're not adding this to the list twice
-    //SDL_assert(!SDL_ClaimTemporaryMemory(memory));
+    Uint8 *mem;
 
     state = SDL_GetTemporaryMemoryState(true);
     if (!state) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed.
+        return NULL;
     }
 
-    SDL_TemporaryMemory *entry = (SDL_TemporaryMemory *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed. We could probably pool up and reuse entries, though.
+    if (size > SDL_SIZE_MAX - SDL_TEMPORARY_MEMORY_HEADER) {
+        SDL_OutOfMemory();
+        return NULL;
     }
 
-    entry->memory = memory;
-
-    SDL_LinkTemporaryMemoryEntry(state, entry);
-
-    return memory;
-}
-
-void *SDL_AllocateTemporaryMemory(size_t size)
-{
-    return SDL_FreeLater(SDL_malloc(size));
+    mem = (Uint8 *)SDL_AllocateArenaMemory(state->arena, SDL_TEMPORARY_MEMORY_HEADER + size);
+    if (!mem) {
+        return NULL;
+    }
+    SDL_memcpy(mem, &size, sizeof(size));
+    return mem + SDL_TEMPORARY_MEMORY_HEADER;
 }
 
 const char *SDL_CreateTemporaryString(const char *string)
 {
     if (string) {
-        return (const char *)SDL_FreeLater(SDL_strdup(string));
+        size_t length = SDL_strlen(string) + 1;
+        char *copy = (char *)SDL_AllocateTemporaryMemory(length);
+        if (copy) {
+            SDL_memcpy(copy, string, length);
+        }
+        return copy;
     }
     return NULL;
 }
@@ -374,34 +370,53 @@ const char *SDL_CreateTemporaryString(const char *string)
 void *SDL_ClaimTemporaryMemory(const void *mem)
 {
     SDL_TemporaryMemoryState *state;
+    SDL_MemoryArenaBlock *block;
+    const Uint8 *header;
+    size_t size;
+    void *claimed;
 
     state = SDL_GetTemporaryMemoryState(false);
-    if (state && mem) {
-        SDL_TemporaryMemory *entry = SDL_GetTemporaryMemoryEntry(state, mem);
-        if (entry) {
-            SDL_UnlinkTemporaryMemoryEntry(state, entry);
-            SDL_FreeTemporaryMemoryEntry(state, entry, false);
-            return (void *)mem;
-        }
+    if (!state || !mem) {
+        return NULL;
     }
-    return NULL;
+
+    header = (const Uint8 *)mem - SDL_TEMPORARY_MEMORY_HEADER;
+    block = SDL_FindTemporaryMemoryBlock(state, header);
+    if (!block) {
+        return NULL;
+    }
+
+    SDL_memcpy(&size, header, sizeof(size));
+    if (size == SDL_TEMPORARY_MEMORY_CLAIMED || !SDL_ArenaBlockContains(block, (const Uint8 *)mem + size - 1)) {
+        return NULL;
+    }
+
+    // Arena memory can't be freed on its own, so the caller gets a copy
+    claimed = SDL_malloc(size);
+    if (claimed) {
+        SDL_memcpy(claimed, mem, size);
+        size = SDL_TEMPORARY_MEMORY_CLAIMED;
+        SDL_memcpy((Uint8 *)header, &size, sizeof(size));
+    }
+    return claimed;
 }
 
 void SDL_FreeTemporaryMemory(void)
 {
     SDL_TemporaryMemoryState *state;
+    int i;
 
     state = SDL_GetTemporaryMemoryState(false);
     if (!state) {
         return;
     }
 
-    while (state->head) {
-        SDL_TemporaryMemory *entry = state->head;
-
-        SDL_UnlinkTemporaryMemoryEntry(state, entry);
-        SDL_FreeTemporaryMemoryEntry(state, entry, true);
+    for (i = 0; i < state->num_released; ++i) {
+        SDL_ReleaseArenaBlock(state->released[i]);
     }
+    state->num_released = 0;
+
+    SDL_ResetMemoryArena(state->arena);
 }
 
 #ifndef SDL_JOYSTICK_DISABLED
@@ -1069,7 +1084,7 @@ static int SDL_AddEvent(SDL_Event *event)
     if (event->type == SDL_EVENT_POLL_SENTINEL) {
         SDL_AddAtomicInt(&SDL_sentinel_pending, 1);
     }
-    entry->memory = NULL;
+    SDL_zeroa(entry->memory);
     SDL_TransferTemporaryMemoryToEvent(entry);
 
     if (SDL_EventQ.tail) {
@@ -1499,6 +1514,8 @@ static void SDL_PumpEventsInternal(bool push_sentinel)
     // This should only be called on the main thread, check in debug builds
     SDL_assert(SDL_IsMainThread());
 
+    SDL_TRACE_ZONE_BEGIN(trace_zone, "SDL_PumpEvents");
+
     // Free any temporary memory from old events
     SDL_FreeTemporaryMemory();
 
@@ -1538,6 +1555,9 @@ static void SDL_PumpEventsInternal(bool push_sentinel)
         sentinel.common.timestamp = 0;
         SDL_PushEvent(&sentinel);
     }
+
+    SDL_TRACE_COUNTER("SDL event queue", (double)SDL_GetAtomicInt(&SDL_EventQ.count));
+    SDL_TRACE_ZONE_END(trace_zone, "SDL_PumpEvents");
 }
 
 void SDL_PumpEvents(void)
@@ -142,73 +142,6 @@ bool SDL_GetPathInfo(const char *path, SDL_PathInfo *info)
     return SDL_SYS_GetPathInfo(path, info);
 }
 
-static bool EverythingMatch(const char *pattern, const char *str, bool *matched_to_dir)
-{
-    SDL_assert(pattern == NULL);
-    SDL_assert(str != NULL);
-    SDL_assert(matched_to_dir != NULL);
-
-    *matched_to_dir = true;
-    return true;  // everything matches!
-}
-
-// this is just '*' and '?', with '/' matching nothing.
-static bool WildcardMatch(const char *pattern, const char *str, bool *matched_to_dir)
-{
-    SDL_assert(pattern != NULL);
-    SDL_assert(str != NULL);
-    SDL_assert(matched_to_dir != NULL);
-
-    const char *str_backtrack = NULL;
-    const char *pattern_backtrack = NULL;
-    char sch_backtrack = 0;
-    char sch = *str;
-    char pch = *pattern;
-
-    while (sch) {
-        if (pch == '*') {
-            str_backtrack = str;
-            pattern_backtrack = ++pattern;
-            sch_backtrack = sch;
-            pch = *pattern;
-        } else if (pch == sch) {
-            if (pch == '/') {
-                str_backtrack = pattern_backtrack = NULL;
-            }
-            sch = *(++str);
-            pch = *(++pattern);
-        } else if ((pch == '?') && (sch != '/')) {  // end of string (checked at `while`) or path separator do not match '?'.
-            sch = *(++str);
-            pch = *(++pattern);
-        } else if (!pattern_backtrack || (sch_backtrack == '/')) { // we didn't have a match. Are we in a '*' and NOT on a path separator? Keep going. Otherwise, fail.
-            *matched_to_dir = false;
-            return false;
-        } else {  // still here? Wasn't a match, but we're definitely in a '*' pattern.
-            str = ++str_backtrack;
-            pattern = pattern_backtrack;
-            sch_backtrack = sch;
-            sch = *str;
-            pch = *pattern;
-        }
-
-        #ifdef SDL_PLATFORM_WINDOWS
-        if (sch == '\\') {
-            sch = '/';
-        }
-        #endif
-    }
-
-    // '*' at the end can be ignored, they are allowed to match nothing.
-    while (pch == '*') {
-        pch = *(++pattern);
-    }
-
-    *matched_to_dir = ((pch == '/') || (pch == '\0'));  // end of string and the pattern is complete or failed at a '/'? We should descend into this directory.
-
-    return (pch == '\0');  // survived the whole pattern? That's a match!
-}
-
-
 // Note that this will currently encode illegal codepoints: UTF-16 surrogates, 0xFFFE, and 0xFFFF.
 // and a codepoint > 0x10FFFF will fail the same as if there wasn't enough memory.
 // clean this up if you want to move this to SDL_string.c.
@@ -288,10 +221,97 @@ static char *CaseFoldUtf8String(const char *fname)
 }
 
 
+// The pattern, split into one piece per path element, since '*' and '?' never match a path separator.
+typedef struct GlobPattern
+{
+    char *storage;          // the (possibly case-folded) pattern, with the '/' separators replaced by '\0'.
+    const char **elements;  // NULL if there was no pattern, which matches everything.
+    int num_elements;
+} GlobPattern;
+
+static bool CompileGlobPattern(GlobPattern *compiled, const char *pattern, bool casefold)
+{
+    SDL_zerop(compiled);
+
+    if (!pattern) {
+        return true;  // no pattern? Everything matches.
+    }
+
+    compiled->storage = casefold ? CaseFoldUtf8String(pattern) : SDL_strdup(pattern);
+    if (!compiled->storage) {
+        return false;
+    }
+
+    int num_elements = 1;
+    for (const char *ptr = compiled->storage; *ptr; ptr++) {
+        if (*ptr == '/') {
+            num_elements++;
+        }
+    }
+
+    compiled->elements = (const char **) SDL_malloc(num_elements * sizeof (*compiled->elements));
+    if (!compiled->elements) {
+        SDL_free(compiled->storage);
+        compiled->storage = NULL;
+        return false;
+    }
+
+    char *ptr = compiled->storage;
+    compiled->elements[0] = ptr;
+    for (int i = 1; *ptr; ptr++) {
+        if (*ptr == '/') {
+            *ptr = '\0';
+            compiled->elements[i++] = ptr + 1;
+        }
+    }
+    compiled->num_elements = num_elements;
+
+    return true;
+}
+
+static void DestroyGlobPattern(GlobPattern *compiled)
+{
+    SDL_free(compiled->elements);
+    SDL_free(compiled->storage);
+    SDL_zerop(compiled);
+}
+
+// this is just '*' and '?', against a single path element.
+static bool WildcardMatch(const char *pattern, const char *str)
+{
+    SDL_assert(pattern != NULL);
+    SDL_assert(str != NULL);
+
+    const char *str_backtrack = NULL;
+    const char *pattern_backtrack = NULL;
+
+    while (*str) {
+        if (*pattern == '*') {
+            pattern_backtrack = ++pattern;
+            str_backtrack = str;
+        } else if ((*pattern == *str) || (*pattern == '?')) {
+            pattern++;
+            str++;
+        } else if (pattern_backtrack) {  // still in a '*' pattern? Let it eat one more char and try again.
+            pattern = pattern_backtrack;
+            str = ++str_backtrack;
+        } else {
+            return false;
+        }
+    }
+
+    // '*' at the end can be ignored, they are allowed to match nothing.
+    while (*pattern == '*') {
+        pattern++;
+    }
+
+    return (*pattern == '\0');  // survived the whole pattern? That's a match!
+}
+
 typedef struct GlobDirCallbackData
 {
-    bool (*matcher)(const char *pattern, const char *str, bool *matched_to_dir);
-    const char *pattern;
+    const GlobPattern *pattern;
+    int depth;  // how many path elements below the base directory we are.
     int num_entries;
     SDL_GlobFlags flags;
     SDL_GlobEnumeratorFunc enumerator;
@@ -299,9 +319,82 @@ typedef struct GlobDirCallbackData
     void *fsuserdata;
     size_t basedirlen;
     SDL_IOStream *string_stream;
+    char *path;  // scratch space for the full path of the current entry.
+    size_t pathlen;
+    char *folded;  // scratch space for the case-folded name of the current entry.
+    size_t foldedlen;
+    struct GlobRootEntries *root_entries;  // if non-NULL, collect the top-level entries instead of descending into them.
 } GlobDirCallbackData;
 
-static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const char *dirname, const char *fname)
+// Keeps the top-level subdirectories around, so they can be searched by several threads.
+typedef struct GlobRootEntry
+{
+    char *fullpath;
+    SDL_PathType type;
+    bool matched;
+    bool descend;
+    int num_entries;
+    SDL_IOStream *string_stream;
+    char *error;
+} GlobRootEntry;
+
+typedef struct GlobRootEntries
+{
+    GlobRootEntry *entries;
+    int num_entries;
+    int max_entries;
+} GlobRootEntries;
+
+static bool EnsureGlobScratchSpace(char **buffer, size_t *buflen, size_t needed)
+{
+    if (needed > *buflen) {
+        size_t newlen = *buflen ? *buflen : 256;
+        while (newlen < needed) {
+            newlen *= 2;
+        }
+        char *ptr = (char *) SDL_realloc(*buffer, newlen);
+        if (!ptr) {
+            return false;
+        }
+        *buffer = ptr;
+        *buflen = newlen;
+    }
+    return true;
+}
+
+static const char *CaseFoldGlobName(GlobDirCallbackData *data, const char *fname)
+{
+    const size_t len = SDL_strlen(fname);
+    if (!EnsureGlobScratchSpace(&data->folded, &data->foldedlen, len + 1)) {
+        return NULL;
+    }
+
+    // most filenames are ASCII, where case folding is just lowercasing.
+    for (size_t i = 0; i < len; i++) {
+        const char ch = fname[i];
+        if (ch & 0x80) {
+            char *folded = CaseFoldUtf8String(fname);
+            if (!folded) {
+                return NULL;
+            }
+            const size_t foldedlen = SDL_strlen(folded) + 1;
+            if (!EnsureGlobScratchSpace(&data->folded, &data->foldedlen, foldedlen)) {
+                SDL_free(folded);
+                return NULL;
+            }
+            SDL_memcpy(data->folded, folded, foldedlen);
+            SDL_free(folded);
+            return data->folded;
+        }
+        data->folded[i] = ((ch >= 'A') && (ch <= 'Z')) ? (ch + ('a' - 'A')) : ch;
+    }
+    data->folded[len] = '\0';
+    return data->folded;
+}
+
+static bool GlobSubdirectory(GlobDirCallbackData *data, const char *fullpath);
+
+static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const char *dirname, const char *fname, SDL_PathType type)
 {
     SDL_assert(userdata != NULL);
     SDL_assert(dirname != NULL);
@@ -310,55 +403,238 @@ static SDL_EnumerationResult SDLCALL GlobDirectoryCallback(void *userdata, const
     //SDL_Log("GlobDirectoryCallback('%s', '%s')", dirname, fname);
 
     GlobDirCallbackData *data = (GlobDirCallbackData *) userdata;
+    const GlobPattern *pattern = data->pattern;
+    bool matched, matched_to_dir;
 
-    // !!! FIXME: if we're careful, we can keep a single buffer in `data` that we push and pop paths off the end of as we walk the tree,
-    // !!! FIXME: and only casefold the new pieces instead of allocating and folding full paths for all of this.
+    if (!pattern->elements) {
+        matched = matched_to_dir = true;
+    } else if (data->depth >= pattern->num_elements) {
+        matched = matched_to_dir = false;  // we never descend this far, but just in case.
+    } else {
+        const char *name = fname;
+        if (data->flags & SDL_GLOB_CASEINSENSITIVE) {
+            name = CaseFoldGlobName(data, fname);
+            if (!name) {
+                return SDL_ENUM_FAILURE;
+            }
+        }
+        const bool last_element = (data->depth == (pattern->num_elements - 1));
+        const bool element_matched = WildcardMatch(pattern->elements[data->depth], name);
+        matched = element_matched && last_element;
+        matched_to_dir = element_matched && !last_element;  // nothing below this entry can match if the pattern ends here.
+    }
+
+    //SDL_Log("GlobDirectoryCallback: Considered name='%s' at depth %d: %smatched (matched_to_dir=%s)", fname, data->depth, matched ? "" : "NOT ", matched_to_dir ? "TRUE" : "FALSE");
 
-    char *fullpath = NULL;
-    if (SDL_asprintf(&fullpath, "%s%s", dirname, fname) < 0) {
+    if (!matched && !matched_to_dir) {
+        return SDL_ENUM_CONTINUE;
+    }
+
+    const size_t dirlen = SDL_strlen(dirname);
+    const size_t fnamelen = SDL_strlen(fname);
+    if (!EnsureGlobScratchSpace(&data->path, &data->pathlen, dirlen + fnamelen + 1)) {
         return SDL_ENUM_FAILURE;
     }
+    SDL_memcpy(data->path, dirname, dirlen);
+    SDL_memcpy(data->path + dirlen, fname, fnamelen + 1);
 
-    char *folded = NULL;
-    if (data->flags & SDL_GLOB_CASEINSENSITIVE) {
-        folded = CaseFoldUtf8String(fullpath);
-        if (!folded) {
+    if (data->root_entries) {
+        GlobRootEntries *root = data->root_entries;
+        if (root->num_entries >= root->max_entries) {
+            const int max_entries = root->max_entries ? (root->max_entries * 2) : 64;
+            GlobRootEntry *entries = (GlobRootEntry *) SDL_realloc(root->entries, max_entries * sizeof (*entries));
+            if (!entries) {
+                return SDL_ENUM_FAILURE;
+            }
+            root->entries = entries;
+            root->max_entries = max_entries;
+        }
+        GlobRootEntry *entry = &root->entries[root->num_entries];
+        SDL_zerop(entry);
+        entry->fullpath = SDL_strdup(data->path);
+        if (!entry->fullpath) {
             return SDL_ENUM_FAILURE;
         }
+        entry->type = type;
+        entry->matched = matched;
+        entry->descend = matched_to_dir;
+        root->num_entries++;
+        return SDL_ENUM_CONTINUE;
     }
 
-    bool matched_to_dir = false;
-    const bool matched = data->matcher(data->pattern, (folded ? folded : fullpath) + data->basedirlen, &matched_to_dir);
-    //SDL_Log("GlobDirectoryCallback: Considered %spath='%s' vs pattern='%s': %smatched (matched_to_dir=%s)", folded ? "(folded) " : "", (folded ? folded : fullpath) + data->basedirlen, data->pattern, matched ? "" : "NOT ", matched_to_dir ? "TRUE" : "FALSE");
-    SDL_free(folded);
-
     if (matched) {
-        const char *subpath = fullpath + data->basedirlen;
-        const size_t slen = SDL_strlen(subpath) + 1;
+        const char *subpath = data->path + data->basedirlen;
+        const size_t slen = dirlen + fnamelen + 1 - data->basedirlen;
         if (SDL_WriteIO(data->string_stream, subpath, slen) != slen) {
-            SDL_free(fullpath);
             return SDL_ENUM_FAILURE;  // stop enumerating, return failure to the app.
         }
         data->num_entries++;
     }
 
-    SDL_EnumerationResult result = SDL_ENUM_CONTINUE;  // keep enumerating by default.
     if (matched_to_dir) {
-        SDL_PathInfo info;
-        if (data->getpathinfo(fullpath, &info, data->fsuserdata) && (info.type == SDL_PATHTYPE_DIRECTORY)) {
+        if (type == SDL_PATHTYPE_NONE) {  // the enumerator didn't know, we have to ask.
+            SDL_PathInfo info;
+            if (data->getpathinfo(data->path, &info, data->fsuserdata)) {
+                type = info.type;
+            }
+        }
+        if (type == SDL_PATHTYPE_DIRECTORY) {
             //SDL_Log("GlobDirectoryCallback: Descending into subdir '%s'", fname);
-            if (!data->enumerator(fullpath, GlobDirectoryCallback, data, data->fsuserdata)) {
-                result = SDL_ENUM_FAILURE;
+            if (!GlobSubdirectory(data, data->path)) {
+                return SDL_ENUM_FAILURE;
             }
         }
     }
 
-    SDL_free(fullpath);
+    return SDL_ENUM_CONTINUE;  // keep enumerating by default.
+}
 
+static bool GlobSubdirectory(GlobDirCallbackData *data, const char *fullpath)
+{
+    // the scratch buffer gets reused while we're in there, so the enumerator needs its own copy.
+    char *path = SDL_strdup(fullpath);
+    if (!path) {
+        return false;
+    }
+    data->depth++;
+    const bool result = data->enumerator(path, GlobDirectoryCallback, data, data->fsuserdata);
+    data->depth--;
+    SDL_free(path);
     return result;
 }
 
-char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata)
+typedef struct GlobThreadData
+{
+    GlobDirCallbackData *template_data;
+    GlobRootEntries *root;
+    SDL_AtomicInt next_entry;
+    SDL_AtomicInt failed;
+} GlobThreadData;
+
+static int SDLCALL GlobThread(void *userdata)
+{
+    GlobThreadData *thread_data = (GlobThreadData *) userdata;
+    GlobDirCallbackData data;
+
+    SDL_copyp(&data, thread_data->template_data);
+    data.path = NULL;
+    data.pathlen = 0;
+    data.folded = NULL;
+    data.foldedlen = 0;
+    data.depth = 1;
+
+    while (!SDL_GetAtomicInt(&thread_data->failed)) {
+        const int i = SDL_AddAtomicInt(&thread_data->next_entry, 1);
+        if (i >= thread_data->root->num_entries) {
+            break;
+        }
+
+        GlobRootEntry *entry = &thread_data->root->entries[i];
+        if (!entry->descend) {
+            continue;
+        }
+
+        if (entry->type == SDL_PATHTYPE_NONE) {
+            SDL_PathInfo info;
+            if (data.getpathinfo(entry->fullpath, &info, data.fsuserdata)) {
+                entry->type = info.type;
+            }
+        }
+        if (entry->type != SDL_PATHTYPE_DIRECTORY) {
+            continue;
+        }
+
+        data.num_entries = 0;
+        data.string_stream = entry->string_stream = SDL_IOFromDynamicMem();
+        if (!data.string_stream || !data.enumerator(entry->fullpath, GlobDirectoryCallback, &data, data.fsuserdata)) {
+            entry->error = SDL_strdup(SDL_GetError());
+            SDL_SetAtomicInt(&thread_data->failed, 1);
+            break;
+        }
+        entry->num_entries = data.num_entries;
+    }
+
+    SDL_free(data.path);
+    SDL_free(data.folded);
+    return 0;
+}
+
+// Enumerates the top-level directory, then searches its subdirectories on several threads, keeping the results in the same order.
+static bool GlobDirectoryParallel(GlobDirCallbackData *data, const char *path, int num_threads)
+{
+    GlobRootEntries root;
+    SDL_zero(root);
+
+    data->root_entries = &root;
+    bool result = data->enumerator(path, GlobDirectoryCallback, data, data->fsuserdata);
+    data->root_entries = NULL;
+
+    if (result) {
+        GlobThreadData thread_data;
+        SDL_Thread *threads[64];
+        int i;
+
+        SDL_zero(thread_data);
+        thread_data.template_data = data;
+        thread_data.root = &root;
+
+        num_threads = SDL_min(num_threads, root.num_entries);
+        num_threads = SDL_min(num_threads, (int) SDL_arraysize(threads) + 1);
+        for (i = 0; i < num_threads - 1; i++) {
+            threads[i] = SDL_CreateThread(GlobThread, "SDLGlob", &thread_data);
+            if (!threads[i]) {
+                break;  // we'll make do with fewer threads.
+            }
+        }
+        num_threads = i;
+
+        GlobThread(&thread_data);  // this thread helps out, too.
+
+        for (i = 0; i < num_threads; i++) {
+            SDL_WaitThread(threads[i], NULL);
+        }
+
+        for (i = 0; result && (i < root.num_entries); i++) {
+            const GlobRootEntry *entry = &root.entries[i];
+            if (entry->error) {
+                result = SDL_SetError("%s", entry->error);
+                break;
+            }
+            if (entry->matched) {
+                const char *subpath = entry->fullpath + data->basedirlen;
+                const size_t slen = SDL_strlen(subpath) + 1;
+                if (SDL_WriteIO(data->string_stream, subpath, slen) != slen) {
+                    result = false;
+                    break;
+                }
+                data->num_entries++;
+            }
+            if (entry->string_stream && (entry->num_entries > 0)) {
+                const void *mem = SDL_GetPointerProperty(SDL_GetIOProperties(entry->string_stream), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+                const size_t memlen = (size_t) SDL_GetIOSize(entry->string_stream);
+                if (!mem || (SDL_WriteIO(data->string_stream, mem, memlen) != memlen)) {
+                    result = false;
+                    break;
+                }
+                data->num_entries += entry->num_entries;
+            }
+        }
+    }
+
+    for (int i = 0; i < root.num_entries; i++) {
+        GlobRootEntry *entry = &root.entries[i];
+        if (entry->string_stream) {
+            SDL_CloseIO(entry->string_stream);
+        }
+        SDL_free(entry->error);
+        SDL_free(entry->fullpath);
+    }
+    SDL_free(root.entries);
+
+    return result;
+}
+
+static char **GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata, int num_threads)
 {
     int dummycount;
     if (!count) {
@@ -390,46 +666,41 @@ char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_Glob
         flags &= ~SDL_GLOB_CASEINSENSITIVE;  // avoid some unnecessary allocations and work later.
     }
 
-    char *folded = NULL;
-    if (flags & SDL_GLOB_CASEINSENSITIVE) {
-        SDL_assert(pattern != NULL);
-        folded = CaseFoldUtf8String(pattern);
-        if (!folded) {
-            SDL_free(pathcpy);
-            return NULL;
-        }
+    // !!! FIXME
+    //if (flags & SDL_GLOB_GITIGNORE) {
+    //    use a GitIgnoreMatch matcher instead...
+
+    GlobPattern compiled;
+    if (!CompileGlobPattern(&compiled, pattern, (flags & SDL_GLOB_CASEINSENSITIVE) != 0)) {
+        SDL_free(pathcpy);
+        return NULL;
     }
 
     GlobDirCallbackData data;
     SDL_zero(data);
     data.string_stream = SDL_IOFromDynamicMem();
     if (!data.string_stream) {
-        SDL_free(folded);
+        DestroyGlobPattern(&compiled);
         SDL_free(pathcpy);
         return NULL;
     }
 
-    if (!pattern) {
-        data.matcher = EverythingMatch;  // no pattern? Everything matches.
-
-    // !!! FIXME
-    //} else if (flags & SDL_GLOB_GITIGNORE) {
-    //    data.matcher = GitIgnoreMatch;
-
-    } else {
-        data.matcher = WildcardMatch;
-    }
-
-    data.pattern = folded ? folded : pattern;
+    data.pattern = &compiled;
     data.flags = flags;
     data.enumerator = enumerator;
     data.getpathinfo = getpathinfo;
     data.fsuserdata = userdata;
     data.basedirlen = *path ? (SDL_strlen(path) + 1) : 0;  // +1 for the '/' we'll be adding.
 
+    bool enumerated;
+    if (num_threads > 1) {
+        enumerated = GlobDirectoryParallel(&data, path, num_threads);
+    } else {
+        enumerated = data.enumerator(path, GlobDirectoryCallback, &data, data.fsuserdata);
+    }
 
     char **result = NULL;
-    if (data.enumerator(path, GlobDirectoryCallback, &data, data.fsuserdata)) {
+    if (enumerated) {
         const size_t streamlen = (size_t) SDL_GetIOSize(data.string_stream);
         const size_t buflen = streamlen + ((data.num_entries + 1) * sizeof (char *));  // +1 for NULL terminator at end of array.
         result = (char **) SDL_malloc(buflen);
@@ -451,26 +722,42 @@ char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_Glob
     }
 
     SDL_CloseIO(data.string_stream);
-    SDL_free(folded);
+    SDL_free(data.path);
+    SDL_free(data.folded);
+    DestroyGlobPattern(&compiled);
     SDL_free(pathcpy);
 
     return result;
 }
 
+char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata)
+{
+    return GlobDirectory(path, pattern, flags, count, enumerator, getpathinfo, userdata, 1);
+}
+
 static bool GlobDirectoryGetPathInfo(const char *path, SDL_PathInfo *info, void *userdata)
 {
     return SDL_GetPathInfo(path, info);
 }
 
-static bool GlobDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+static bool GlobDirectoryEnumerator(const char *path, SDL_SYS_EnumerateDirectoryTypedCallback cb, void *cbuserdata, void *userdata)
 {
-    return SDL_EnumerateDirectory(path, cb, cbuserdata);
+    return SDL_SYS_EnumerateDirectoryTyped(path, cb, cbuserdata);
 }
 
 char **SDL_GlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
 {
+    int num_threads = 1;
+    const char *hint = SDL_GetHint(SDL_HINT_FILESYSTEM_GLOB_THREADS);
+    if (hint && *hint) {
+        num_threads = SDL_atoi(hint);
+        if (num_threads <= 0) {
+            num_threads = SDL_GetNumLogicalCPUCores();
+        }
+    }
+
     //SDL_Log("SDL_GlobDirectory('%s', '%s') ...", path, pattern);
-    return SDL_InternalGlobDirectory(path, pattern, flags, count, GlobDirectoryEnumerator, GlobDirectoryGetPathInfo, NULL);
+    return GlobDirectory(path, pattern, flags, count, GlobDirectoryEnumerator, GlobDirectoryGetPathInfo, NULL, num_threads);
 }
 
 
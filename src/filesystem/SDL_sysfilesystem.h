@@ -29,13 +29,20 @@ extern char *SDL_SYS_GetUserFolder(SDL_Folder folder);
 extern char *SDL_SYS_GetCurrentDirectory(void);
 
 extern bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata);
+
+// Like SDL_SYS_EnumerateDirectory(), but also reports the type of each entry if the platform knows it for free.
+// The type is SDL_PATHTYPE_NONE if it isn't known (or the entry is a symlink), and the caller has to ask SDL_SYS_GetPathInfo().
+typedef SDL_EnumerationResult (SDLCALL *SDL_SYS_EnumerateDirectoryTypedCallback)(void *userdata, const char *dirname, const char *fname, SDL_PathType type);
+extern bool SDL_SYS_EnumerateDirectoryTyped(const char *path, SDL_SYS_EnumerateDirectoryTypedCallback cb, void *userdata);
 extern bool SDL_SYS_RemovePath(const char *path);
 extern bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath);
+// Makes the entries of a directory durable, e.g. after renaming a file into it.
+extern bool SDL_SYS_SyncDirectory(const char *path);
 extern bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath);
 extern bool SDL_SYS_CreateDirectory(const char *path);
 extern bool SDL_SYS_GetPathInfo(const char *path, SDL_PathInfo *info);
 
-typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata);
+typedef bool (*SDL_GlobEnumeratorFunc)(const char *path, SDL_SYS_EnumerateDirectoryTypedCallback cb, void *cbuserdata, void *userdata);
 typedef bool (*SDL_GlobGetPathInfoFunc)(const char *path, SDL_PathInfo *info, void *userdata);
 extern char **SDL_InternalGlobDirectory(const char *path, const char *pattern, SDL_GlobFlags flags, int *count, SDL_GlobEnumeratorFunc enumerator, SDL_GlobGetPathInfoFunc getpathinfo, void *userdata);
 
@@ -33,6 +33,11 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
     return SDL_Unsupported();
 }
 
+bool SDL_SYS_EnumerateDirectoryTyped(const char *path, SDL_SYS_EnumerateDirectoryTypedCallback cb, void *userdata)
+{
+    return SDL_Unsupported();
+}
+
 bool SDL_SYS_RemovePath(const char *path)
 {
     return SDL_Unsupported();
@@ -43,6 +48,11 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return SDL_Unsupported();
 }
 
+bool SDL_SYS_SyncDirectory(const char *path)
+{
+    return SDL_Unsupported();
+}
+
 bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
 {
     return SDL_Unsupported();
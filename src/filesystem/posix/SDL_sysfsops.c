@@ -32,15 +32,59 @@
 #include <string.h>
 #include <errno.h>
 #include <dirent.h>
+#include <fcntl.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#ifdef SDL_PLATFORM_LINUX
+#include <sys/ioctl.h>
+#include <linux/fs.h> // for FICLONE
+#endif
+#ifdef HAVE_SENDFILE
+#include <sys/sendfile.h>
+#endif
+
 #ifdef SDL_PLATFORM_ANDROID
 #include "../../core/android/SDL_android.h"
 #endif
 
+// The buffer size used when the kernel can't copy file data for us
+#define COPY_BUFFER_SIZE (1024 * 1024)
 
-bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+#ifdef SDL_PLATFORM_ANDROID
+typedef struct TypedEnumerationData
+{
+    SDL_SYS_EnumerateDirectoryTypedCallback cb;
+    void *userdata;
+} TypedEnumerationData;
+
+static SDL_EnumerationResult SDLCALL TypedEnumerationCallback(void *userdata, const char *dirname, const char *fname)
+{
+    TypedEnumerationData *data = (TypedEnumerationData *)userdata;
+    return data->cb(data->userdata, dirname, fname, SDL_PATHTYPE_NONE);
+}
+#endif
+
+static SDL_PathType GetDirectoryEntryType(const struct dirent *ent)
+{
+#ifdef DT_DIR
+    switch (ent->d_type) {
+    case DT_DIR:
+        return SDL_PATHTYPE_DIRECTORY;
+    case DT_REG:
+        return SDL_PATHTYPE_FILE;
+    case DT_UNKNOWN:
+    case DT_LNK:
+        break;  // needs a stat() to find out where it leads.
+    default:
+        return SDL_PATHTYPE_OTHER;
+    }
+#endif
+    return SDL_PATHTYPE_NONE;
+}
+
+// exactly one of `cb` and `typedcb` is non-NULL.
+static bool EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, SDL_SYS_EnumerateDirectoryTypedCallback typedcb, void *userdata)
 {
     char *apath = NULL;  // absolute path (for Android, iOS, etc). Overrides `path`.
 
@@ -90,7 +134,13 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
     DIR *dir = opendir(pathwithsep);
     if (!dir) {
 #ifdef SDL_PLATFORM_ANDROID  // Maybe it's an asset...?
-        const bool retval = Android_JNI_EnumerateAssetDirectory(pathwithsep + extralen, cb, userdata);
+        bool retval;
+        if (typedcb) {
+            TypedEnumerationData data = { typedcb, userdata };
+            retval = Android_JNI_EnumerateAssetDirectory(pathwithsep + extralen, TypedEnumerationCallback, &data);
+        } else {
+            retval = Android_JNI_EnumerateAssetDirectory(pathwithsep + extralen, cb, userdata);
+        }
         SDL_free(pathwithsep);
         return retval;
 #else
@@ -106,7 +156,11 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
         if ((SDL_strcmp(name, ".") == 0) || (SDL_strcmp(name, "..") == 0)) {
             continue;
         }
-        result = cb(userdata, pathwithsep + extralen, name);
+        if (typedcb) {
+            result = typedcb(userdata, pathwithsep + extralen, name, GetDirectoryEntryType(ent));
+        } else {
+            result = cb(userdata, pathwithsep + extralen, name);
+        }
     }
 
     closedir(dir);
@@ -116,6 +170,16 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
     return (result != SDL_ENUM_FAILURE);
 }
 
+bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+{
+    return EnumerateDirectory(path, cb, NULL, userdata);
+}
+
+bool SDL_SYS_EnumerateDirectoryTyped(const char *path, SDL_SYS_EnumerateDirectoryTypedCallback cb, void *userdata)
+{
+    return EnumerateDirectory(path, NULL, cb, userdata);
+}
+
 bool SDL_SYS_RemovePath(const char *path)
 {
     int rc;
@@ -229,12 +293,205 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
-bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+bool SDL_SYS_SyncDirectory(const char *path)
+{
+    int fd, rc;
+
+#ifdef O_DIRECTORY
+    fd = open(path, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+#else
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+#endif
+    if (fd < 0) {
+        return SDL_SetError("Couldn't open %s: %s", path, strerror(errno));
+    }
+    do {
+        rc = fsync(fd);
+    } while (rc < 0 && errno == EINTR);
+    close(fd);
+
+    // Some filesystems can't sync directories, their entries are as durable as they're going to get.
+    if (rc < 0 && errno != EINVAL && errno != EBADF) {
+        return SDL_SetError("Couldn't sync %s: %s", path, strerror(errno));
+    }
+    return true;
+}
+
+static int SyncFileData(int fd)
+{
+    int result = 0;
+
+#if defined(SDL_PLATFORM_APPLE)  // Apple doesn't have fdatasync (rather, the symbol exists as an incompatible system call).
+    result = fcntl(fd, F_FULLFSYNC);
+#elif defined(SDL_PLATFORM_HAIKU)
+    result = fsync(fd);
+#elif defined(HAVE_FDATASYNC)
+    result = fdatasync(fd);
+#endif
+    return result;
+}
+
+// Returns false if the copy failed, sets *done to false if the rest of the file still needs to be copied
+static bool CopyFileDataInKernel(int input, int output, Sint64 size, bool *done)
+{
+    Sint64 copied = 0;
+
+    *done = false;
+
+    if (size <= 0) {
+        // This might be a special file that doesn't know its size, just read it
+        return true;
+    }
+
+#ifdef FICLONE
+    // Share the data blocks if the filesystem supports it (btrfs, XFS, bcachefs, ...)
+    if (ioctl(output, FICLONE, input) == 0) {
+        *done = true;
+        return true;
+    }
+#endif
+
+#ifdef HAVE_COPY_FILE_RANGE
+    // Let the kernel copy the data, which might be offloaded to the filesystem or the storage device
+    while (copied < size) {
+        const ssize_t amount = copy_file_range(input, NULL, output, NULL, (size_t)SDL_min(size - copied, SDL_MAX_SINT32), 0);
+        if (amount < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (copied == 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP || errno == EPERM)) {
+                break; // Not supported between these files, try something else
+            }
+            return SDL_SetError("Couldn't copy file data: %s", strerror(errno));
+        } else if (amount == 0) {
+            return true; // The file is shorter than we thought, copy whatever is left
+        }
+        copied += amount;
+    }
+    if (copied > 0) {
+        *done = (copied == size);
+        return true;
+    }
+#endif
+
+#ifdef HAVE_SENDFILE
+    // This avoids copying the data through user space
+    while (copied < size) {
+        const ssize_t amount = sendfile(output, input, NULL, (size_t)SDL_min(size - copied, SDL_MAX_SINT32));
+        if (amount < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (copied == 0 && (errno == ENOSYS || errno == EINVAL)) {
+                break; // Not supported between these files, try something else
+            }
+            return SDL_SetError("Couldn't copy file data: %s", strerror(errno));
+        } else if (amount == 0) {
+            break;
+        }
+        copied += amount;
+    }
+    if (copied == size) {
+        *done = true;
+    }
+#endif
+
+    (void)copied;
+    return true;
+}
+
+// Copies whatever is left of the input, from the current file offsets
+static bool CopyFileDataInUserSpace(int input, int output)
+{
+    char *buffer = (char *)SDL_malloc(COPY_BUFFER_SIZE);
+    bool result = true;
+
+    if (!buffer) {
+        return false;
+    }
+
+    while (result) {
+        ssize_t len = read(input, buffer, COPY_BUFFER_SIZE);
+        if (len < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            result = SDL_SetError("Couldn't read file data: %s", strerror(errno));
+        } else if (len == 0) {
+            break;
+        } else {
+            ssize_t written = 0;
+            while (written < len) {
+                ssize_t amount = write(output, buffer + written, len - written);
+                if (amount < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    result = SDL_SetError("Couldn't write file data: %s", strerror(errno));
+                    break;
+                }
+                written += amount;
+            }
+        }
+    }
+    SDL_free(buffer);
+
+    return result;
+}
+
+static bool CopyFileWithDescriptors(const char *oldpath, const char *newpath)
+{
+    struct stat info;
+    int input, output;
+    bool done = false;
+    bool result;
+
+    input = open(oldpath, O_RDONLY | O_CLOEXEC);
+    if (input < 0) {
+        return SDL_SetError("Couldn't open %s: %s", oldpath, strerror(errno));
+    }
+    if (fstat(input, &info) < 0) {
+        info.st_mode = 0;
+        info.st_size = 0;
+    }
+
+    output = open(newpath, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (output < 0) {
+        result = SDL_SetError("Couldn't open %s: %s", newpath, strerror(errno));
+        close(input);
+        return result;
+    }
+
+    result = CopyFileDataInKernel(input, output, S_ISREG(info.st_mode) ? (Sint64)info.st_size : 0, &done);
+    if (result && !done) {
+        result = CopyFileDataInUserSpace(input, output);
+    }
+    close(input);
+
+    // Make sure the data is on disk, so the copy can safely be renamed over another file
+    if (result) {
+        int rc;
+        do {
+            rc = SyncFileData(output);
+        } while (rc < 0 && errno == EINTR);
+
+        if (rc < 0 && errno != EINVAL) {
+            result = SDL_SetError("Error flushing datastream: %s", strerror(errno));
+        }
+    }
+    if (close(output) < 0 && result) {
+        result = SDL_SetError("Error writing to datastream: %s", strerror(errno));
+    }
+    return result;
+}
+
+#if defined(SDL_PLATFORM_ANDROID) || defined(SDL_PLATFORM_IOS)
+static bool CopyFileWithIOStreams(const char *oldpath, const char *newpath)
 {
     char *buffer = NULL;
     SDL_IOStream *input = NULL;
     SDL_IOStream *output = NULL;
-    const size_t maxlen = 4096;
+    const size_t maxlen = COPY_BUFFER_SIZE;
     size_t len;
     bool result = false;
 
@@ -283,6 +540,18 @@ done:
 
     return result;
 }
+#endif // SDL_PLATFORM_ANDROID || SDL_PLATFORM_IOS
+
+bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
+{
+#if defined(SDL_PLATFORM_ANDROID) || defined(SDL_PLATFORM_IOS)
+    // Relative paths are resolved by SDL_IOFromFile(), and might be Android assets
+    if (*oldpath != '/' || *newpath != '/') {
+        return CopyFileWithIOStreams(oldpath, newpath);
+    }
+#endif
+    return CopyFileWithDescriptors(oldpath, newpath);
+}
 
 bool SDL_SYS_CreateDirectory(const char *path)
 {
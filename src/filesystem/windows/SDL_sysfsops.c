@@ -33,7 +33,20 @@
 #define COPY_FILE_NO_BUFFERING 0x00001000
 #endif
 
-bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+static SDL_PathType GetDirectoryEntryType(const WIN32_FIND_DATAW *entw)
+{
+    if (entw->dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) {
+        return SDL_PATHTYPE_NONE;  // needs a GetFileAttributesEx() to find out where it leads.
+    } else if (entw->dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) {
+        return SDL_PATHTYPE_DIRECTORY;
+    } else if (entw->dwFileAttributes & FILE_ATTRIBUTE_DEVICE) {
+        return SDL_PATHTYPE_OTHER;
+    }
+    return SDL_PATHTYPE_FILE;
+}
+
+// exactly one of `cb` and `typedcb` is non-NULL.
+static bool EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, SDL_SYS_EnumerateDirectoryTypedCallback typedcb, void *userdata)
 {
     SDL_EnumerationResult result = SDL_ENUM_CONTINUE;
     if (*path == '\0') {  // if empty (completely at the root), we need to enumerate drive letters.
@@ -42,7 +55,11 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
         for (int i = 'A'; (result == SDL_ENUM_CONTINUE) && (i <= 'Z'); i++) {
             if (drives & (1 << (i - 'A'))) {
                 name[0] = (char) i;
-                result = cb(userdata, "", name);
+                if (typedcb) {
+                    result = typedcb(userdata, "", name, SDL_PATHTYPE_DIRECTORY);
+                } else {
+                    result = cb(userdata, "", name);
+                }
             }
         }
     } else {
@@ -93,7 +110,11 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
             if (!utf8fn) {
                 result = SDL_ENUM_FAILURE;
             } else {
-                result = cb(userdata, pattern, utf8fn);
+                if (typedcb) {
+                    result = typedcb(userdata, pattern, utf8fn, GetDirectoryEntryType(&entw));
+                } else {
+                    result = cb(userdata, pattern, utf8fn);
+                }
                 SDL_free(utf8fn);
             }
         } while ((result == SDL_ENUM_CONTINUE) && (FindNextFileW(dir, &entw) != 0));
@@ -105,6 +126,16 @@ bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback
     return (result != SDL_ENUM_FAILURE);
 }
 
+bool SDL_SYS_EnumerateDirectory(const char *path, SDL_EnumerateDirectoryCallback cb, void *userdata)
+{
+    return EnumerateDirectory(path, cb, NULL, userdata);
+}
+
+bool SDL_SYS_EnumerateDirectoryTyped(const char *path, SDL_SYS_EnumerateDirectoryTypedCallback cb, void *userdata)
+{
+    return EnumerateDirectory(path, NULL, cb, userdata);
+}
+
 bool SDL_SYS_RemovePath(const char *path)
 {
     WCHAR *wpath = WIN_UTF8ToStringW(path);
@@ -153,6 +184,12 @@ bool SDL_SYS_RenamePath(const char *oldpath, const char *newpath)
     return true;
 }
 
+bool SDL_SYS_SyncDirectory(const char *path)
+{
+    // NTFS journals directory entries itself, and a directory can't be flushed without backup privileges.
+    return true;
+}
+
 bool SDL_SYS_CopyFile(const char *oldpath, const char *newpath)
 {
     WCHAR *woldpath = WIN_UTF8ToStringW(oldpath);
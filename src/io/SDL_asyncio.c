@@ -92,21 +92,38 @@ Sint64 SDL_GetAsyncIOSize(SDL_AsyncIO *asyncio)
     return asyncio->iface.size(asyncio->userdata);
 }
 
-static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
+static SDL_AsyncIOTask *CreateAsyncIOTask(bool reading, SDL_AsyncIO *asyncio, void *ptr, const SDL_AsyncIOVector *vectors, int num_vectors, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
-    CHECK_PARAM(!asyncio) {
-        return SDL_InvalidParamError("asyncio");
-    }
-    CHECK_PARAM(!ptr) {
-        return SDL_InvalidParamError("ptr");
-    }
-    CHECK_PARAM(!queue) {
-        return SDL_InvalidParamError("queue");
+    // vectors are stored right after the task, in the same allocation.
+    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task) + (num_vectors * sizeof (*vectors)));
+    if (!task) {
+        return NULL;
     }
 
-    SDL_AsyncIOTask *task = (SDL_AsyncIOTask *) SDL_calloc(1, sizeof (*task));
-    if (!task) {
-        return false;
+    if (vectors) {
+        task->vectors = (SDL_AsyncIOVector *) (task + 1);
+        task->num_vectors = num_vectors;
+        SDL_memcpy(task->vectors, vectors, num_vectors * sizeof (*vectors));
+        ptr = vectors[0].buffer;
+        size = 0;
+        for (int i = 0; i < num_vectors; i++) {
+            size += vectors[i].size;
+        }
+
+        // backends without scatter/gather get a single buffer, which is copied to or from the vectors by the core.
+        if (!asyncio->iface.vectored) {
+            if (size > SDL_SIZE_MAX) {
+                SDL_free(task);
+                SDL_SetError("Scatter/gather task is too large");
+                return NULL;
+            }
+            task->staging = SDL_malloc((size_t) size);
+            if (!task->staging) {
+                SDL_free(task);
+                return NULL;
+            }
+            ptr = task->staging;
+        }
     }
 
     task->asyncio = asyncio;
@@ -116,10 +133,42 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
     task->requested_size = size;
     task->app_userdata = userdata;
     task->queue = queue;
+    return task;
+}
+
+static void FreeAsyncIOTask(SDL_AsyncIOTask *task)
+{
+    SDL_free(task->staging);
+    SDL_free(task);
+}
+
+// you must hold asyncio->lock when calling this! Queues a pending close request if nothing else is holding it off.
+static void MaybeQueueCloseTask(SDL_AsyncIO *asyncio)
+{
+    SDL_AsyncIOTask *closing = asyncio->closing;
+    if (closing && (asyncio->batched == 0) && (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL)) {
+        LINKED_LIST_PREPEND(closing, asyncio->tasks, asyncio);
+        SDL_AddAtomicInt(&closing->queue->tasks_inflight, 1);
+        const bool async_close_task_was_queued = asyncio->iface.close(asyncio->userdata, closing);
+        SDL_assert(async_close_task_was_queued);  // !!! FIXME: if this fails to queue the task, we're leaking resources!
+        if (!async_close_task_was_queued) {
+            SDL_AddAtomicInt(&closing->queue->tasks_inflight, -1);
+        }
+    }
+}
+
+// this takes ownership of the task, and frees it if it can't be started.
+static bool StartAsyncIOTask(SDL_AsyncIOTask *task)
+{
+    SDL_AsyncIO *asyncio = task->asyncio;
+    SDL_AsyncIOQueue *queue = task->queue;
+    const bool reading = (task->type == SDL_ASYNCIO_TASK_READ);
 
     SDL_LockMutex(asyncio->lock);
-    if (asyncio->closing) {
-        SDL_free(task);
+    if (task->batched) {
+        asyncio->batched--;  // it was added before any close request, so it still runs, and the close waits for it.
+    } else if (asyncio->closing) {
+        FreeAsyncIOTask(task);
         SDL_UnlockMutex(asyncio->lock);
         return SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
     }
@@ -127,19 +176,47 @@ static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64
     SDL_AddAtomicInt(&queue->tasks_inflight, 1);
     SDL_UnlockMutex(asyncio->lock);
 
+    if (task->staging && !reading) {
+        Uint8 *dst = (Uint8 *) task->staging;
+        for (int i = 0; i < task->num_vectors; i++) {
+            SDL_memcpy(dst, task->vectors[i].buffer, (size_t) task->vectors[i].size);
+            dst += (size_t) task->vectors[i].size;
+        }
+    }
+
     const bool queued = reading ? asyncio->iface.read(asyncio->userdata, task) : asyncio->iface.write(asyncio->userdata, task);
     if (!queued) {
         SDL_AddAtomicInt(&queue->tasks_inflight, -1);
         SDL_LockMutex(asyncio->lock);
         LINKED_LIST_UNLINK(task, asyncio);
+        MaybeQueueCloseTask(asyncio);
         SDL_UnlockMutex(asyncio->lock);
-        SDL_free(task);
+        FreeAsyncIOTask(task);
         task = NULL;
     }
 
     return (task != NULL);
 }
 
+static bool RequestAsyncIO(bool reading, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
+{
+    CHECK_PARAM(!asyncio) {
+        return SDL_InvalidParamError("asyncio");
+    }
+    CHECK_PARAM(!ptr) {
+        return SDL_InvalidParamError("ptr");
+    }
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+
+    SDL_AsyncIOTask *task = CreateAsyncIOTask(reading, asyncio, ptr, NULL, 0, offset, size, queue, userdata);
+    if (!task) {
+        return false;
+    }
+    return StartAsyncIOTask(task);
+}
+
 bool SDL_ReadAsyncIO(SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, SDL_AsyncIOQueue *queue, void *userdata)
 {
     return RequestAsyncIO(true, asyncio, ptr, offset, size, queue, userdata);
@@ -175,7 +252,7 @@ bool SDL_CloseAsyncIO(SDL_AsyncIO *asyncio, bool flush, SDL_AsyncIOQueue *queue,
 
         asyncio->closing = task;
 
-        if (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL) { // no tasks? Queue the close task now.
+        if ((asyncio->batched == 0) && (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL)) { // no tasks? Queue the close task now.
             LINKED_LIST_PREPEND(task, asyncio->tasks, asyncio);
             SDL_AddAtomicInt(&queue->tasks_inflight, 1);
             if (!asyncio->iface.close(asyncio->userdata, task)) {
@@ -219,6 +296,20 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     outcome->result = task->result;
     outcome->type = task->type;
     outcome->buffer = task->buffer;
+    if (task->staging) {
+        if (task->type == SDL_ASYNCIO_TASK_READ) {
+            // scatter what was read into the app's buffers.
+            const Uint8 *src = (const Uint8 *) task->staging;
+            Uint64 remaining = task->result_size;
+            for (int i = 0; (i < task->num_vectors) && (remaining > 0); i++) {
+                const size_t len = (size_t) SDL_min(remaining, task->vectors[i].size);
+                SDL_memcpy(task->vectors[i].buffer, src, len);
+                src += len;
+                remaining -= len;
+            }
+        }
+        outcome->buffer = task->vectors[0].buffer;
+    }
     outcome->offset = task->offset;
     outcome->bytes_requested = task->requested_size;
     outcome->bytes_transferred = task->result_size;
@@ -230,14 +321,8 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
     LINKED_LIST_UNLINK(task, asyncio);
     // see if it's time to queue a pending close request (close requested and no other pending tasks)
     SDL_AsyncIOTask *closing = asyncio->closing;
-    if (closing && (task != closing) && (LINKED_LIST_START(asyncio->tasks, asyncio) == NULL)) {
-        LINKED_LIST_PREPEND(closing, asyncio->tasks, asyncio);
-        SDL_AddAtomicInt(&closing->queue->tasks_inflight, 1);
-        const bool async_close_task_was_queued = asyncio->iface.close(asyncio->userdata, closing);
-        SDL_assert(async_close_task_was_queued);  // !!! FIXME: if this fails to queue the task, we're leaking resources!
-        if (!async_close_task_was_queued) {
-            SDL_AddAtomicInt(&closing->queue->tasks_inflight, -1);
-        }
+    if (task != closing) {
+        MaybeQueueCloseTask(asyncio);
     }
     SDL_UnlockMutex(lock);
 
@@ -247,13 +332,16 @@ static bool GetAsyncIOTaskOutcome(SDL_AsyncIOTask *task, SDL_AsyncIOOutcome *out
         if (asyncio->oneshot) {
             retval = false;  // don't send the close task results on to the app, just the read task for these.
         }
+        if (asyncio->registered_queue) {
+            asyncio->registered_queue->iface.unregister_file(asyncio->registered_queue->userdata, asyncio);
+        }
         asyncio->iface.destroy(asyncio->userdata);
         SDL_DestroyMutex(asyncio->lock);
         SDL_free(asyncio);
     }
 
     SDL_AddAtomicInt(&task->queue->tasks_inflight, -1);
-    SDL_free(task);
+    FreeAsyncIOTask(task);
 
     return retval;
 }
@@ -302,6 +390,209 @@ void SDL_DestroyAsyncIOQueue(SDL_AsyncIOQueue *queue)
     }
 }
 
+struct SDL_AsyncIOBatch
+{
+    SDL_AsyncIOQueue *queue;
+    SDL_AsyncIOTask **tasks;
+    int num_tasks;
+    int max_tasks;
+};
+
+SDL_AsyncIOBatch *SDL_CreateAsyncIOBatch(SDL_AsyncIOQueue *queue)
+{
+    CHECK_PARAM(!queue) {
+        SDL_InvalidParamError("queue");
+        return NULL;
+    }
+
+    SDL_AsyncIOBatch *batch = (SDL_AsyncIOBatch *) SDL_calloc(1, sizeof (*batch));
+    if (batch) {
+        batch->queue = queue;
+    }
+    return batch;
+}
+
+static bool AddAsyncIOBatchTask(bool reading, SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, void *ptr, const SDL_AsyncIOVector *vectors, int num_vectors, Uint64 offset, Uint64 size, void *userdata)
+{
+    CHECK_PARAM(!batch) {
+        return SDL_InvalidParamError("batch");
+    }
+    CHECK_PARAM(!asyncio) {
+        return SDL_InvalidParamError("asyncio");
+    }
+
+    if (batch->num_tasks == batch->max_tasks) {
+        const int max_tasks = batch->max_tasks ? (batch->max_tasks * 2) : 64;
+        SDL_AsyncIOTask **tasks = (SDL_AsyncIOTask **) SDL_realloc(batch->tasks, max_tasks * sizeof (*tasks));
+        if (!tasks) {
+            return false;
+        }
+        batch->tasks = tasks;
+        batch->max_tasks = max_tasks;
+    }
+
+    SDL_AsyncIOTask *task = CreateAsyncIOTask(reading, asyncio, ptr, vectors, num_vectors, offset, size, batch->queue, userdata);
+    if (!task) {
+        return false;
+    }
+
+    // the file can't go away while this task is waiting to be submitted, so a close request waits for it, like any pending task.
+    SDL_LockMutex(asyncio->lock);
+    if (asyncio->closing) {
+        SDL_UnlockMutex(asyncio->lock);
+        FreeAsyncIOTask(task);
+        return SDL_SetError("SDL_AsyncIO is closing, can't start new tasks");
+    }
+    asyncio->batched++;
+    SDL_UnlockMutex(asyncio->lock);
+
+    task->batched = true;
+    batch->tasks[batch->num_tasks++] = task;
+    return true;
+}
+
+// drops a task that was never submitted, which might let its file close.
+static void DiscardAsyncIOBatchTask(SDL_AsyncIOTask *task)
+{
+    SDL_AsyncIO *asyncio = task->asyncio;
+    SDL_LockMutex(asyncio->lock);
+    asyncio->batched--;
+    MaybeQueueCloseTask(asyncio);
+    SDL_UnlockMutex(asyncio->lock);
+    FreeAsyncIOTask(task);
+}
+
+static bool AddAsyncIOBatchVectorTask(bool reading, SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, const SDL_AsyncIOVector *vectors, int num_vectors, Uint64 offset, void *userdata)
+{
+    CHECK_PARAM(!vectors) {
+        return SDL_InvalidParamError("vectors");
+    }
+    CHECK_PARAM(num_vectors <= 0) {
+        return SDL_InvalidParamError("num_vectors");
+    }
+    for (int i = 0; i < num_vectors; i++) {
+        CHECK_PARAM(!vectors[i].buffer) {
+            return SDL_InvalidParamError("vectors");
+        }
+    }
+    return AddAsyncIOBatchTask(reading, batch, asyncio, NULL, vectors, num_vectors, offset, 0, userdata);
+}
+
+bool SDL_BatchReadAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, void *userdata)
+{
+    CHECK_PARAM(!ptr) {
+        return SDL_InvalidParamError("ptr");
+    }
+    return AddAsyncIOBatchTask(true, batch, asyncio, ptr, NULL, 0, offset, size, userdata);
+}
+
+bool SDL_BatchWriteAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, void *ptr, Uint64 offset, Uint64 size, void *userdata)
+{
+    CHECK_PARAM(!ptr) {
+        return SDL_InvalidParamError("ptr");
+    }
+    return AddAsyncIOBatchTask(false, batch, asyncio, ptr, NULL, 0, offset, size, userdata);
+}
+
+bool SDL_BatchReadVectorAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, const SDL_AsyncIOVector *vectors, int num_vectors, Uint64 offset, void *userdata)
+{
+    return AddAsyncIOBatchVectorTask(true, batch, asyncio, vectors, num_vectors, offset, userdata);
+}
+
+bool SDL_BatchWriteVectorAsyncIO(SDL_AsyncIOBatch *batch, SDL_AsyncIO *asyncio, const SDL_AsyncIOVector *vectors, int num_vectors, Uint64 offset, void *userdata)
+{
+    return AddAsyncIOBatchVectorTask(false, batch, asyncio, vectors, num_vectors, offset, userdata);
+}
+
+bool SDL_SubmitAsyncIOBatch(SDL_AsyncIOBatch *batch)
+{
+    CHECK_PARAM(!batch) {
+        return SDL_InvalidParamError("batch");
+    }
+
+    SDL_AsyncIOQueue *queue = batch->queue;
+    bool result = true;
+    int i;
+
+    for (i = 0; i < batch->num_tasks; i++) {
+        if (!StartAsyncIOTask(batch->tasks[i])) {
+            result = false;
+            i++;  // StartAsyncIOTask() freed the failed task.
+            break;
+        }
+    }
+
+    // drop anything that didn't get started.
+    for (; i < batch->num_tasks; i++) {
+        DiscardAsyncIOBatchTask(batch->tasks[i]);
+    }
+    batch->num_tasks = 0;
+
+    // everything is prepared, hand it all to the system at once.
+    if (queue->iface.submit) {
+        queue->iface.submit(queue->userdata);
+    }
+    return result;
+}
+
+void SDL_DestroyAsyncIOBatch(SDL_AsyncIOBatch *batch)
+{
+    if (batch) {
+        for (int i = 0; i < batch->num_tasks; i++) {
+            DiscardAsyncIOBatchTask(batch->tasks[i]);
+        }
+        SDL_free(batch->tasks);
+        SDL_free(batch);
+    }
+}
+
+bool SDL_RegisterAsyncIOBuffers(SDL_AsyncIOQueue *queue, const SDL_AsyncIOVector *buffers, int num_buffers)
+{
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    CHECK_PARAM(num_buffers < 0 || (num_buffers > 0 && !buffers)) {
+        return SDL_InvalidParamError("buffers");
+    }
+
+    if (!queue->iface.register_buffers) {
+        return true;  // it's just a hint, so it's fine if the backend doesn't support it.
+    }
+    return queue->iface.register_buffers(queue->userdata, buffers, num_buffers);
+}
+
+bool SDL_RegisterAsyncIOFile(SDL_AsyncIOQueue *queue, SDL_AsyncIO *asyncio)
+{
+    CHECK_PARAM(!queue) {
+        return SDL_InvalidParamError("queue");
+    }
+    CHECK_PARAM(!asyncio) {
+        return SDL_InvalidParamError("asyncio");
+    }
+
+    if (!queue->iface.register_file) {
+        return true;  // it's just a hint, so it's fine if the backend doesn't support it.
+    }
+
+    SDL_LockMutex(asyncio->lock);
+    bool result;
+    if (asyncio->closing) {
+        result = SDL_SetError("SDL_AsyncIO is closing, can't register it");
+    } else if (asyncio->registered_queue == queue) {
+        result = true;
+    } else if (asyncio->registered_queue) {
+        result = SDL_SetError("SDL_AsyncIO is already registered with another queue");
+    } else {
+        result = queue->iface.register_file(queue->userdata, asyncio);
+        if (result) {
+            SDL_MemoryBarrierRelease();  // make sure the backend's registered_index is visible before this is.
+            asyncio->registered_queue = queue;
+        }
+    }
+    SDL_UnlockMutex(asyncio->lock);
+    return result;
+}
+
 void SDL_QuitAsyncIO(void)
 {
     SDL_SYS_QuitAsyncIO();
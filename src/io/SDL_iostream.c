@@ -41,6 +41,14 @@
 
 #include "SDL_iostream_c.h"
 
+#if defined(SDL_HAVE_FILE_MAPPING) && !defined(SDL_PLATFORM_WINDOWS)
+#define HAVE_MAPPED_FILES
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 /* This file provides a general interface for SDL to read and write
    data sources.  It can easily be extended to files, memory, etc.
 */
@@ -51,8 +59,19 @@ struct SDL_IOStream
     void *userdata;
     SDL_IOStatus status;
     SDL_PropertiesID props;
+
+    // Optional read-ahead/write-behind buffer, see SDL_BeginBufferedIO()
+    Uint8 *buffer;
+    size_t buffer_size;
+    size_t buffer_pos;      // next byte to read, or the end of pending writes
+    size_t buffer_avail;    // the end of the read-ahead data
+    Sint64 buffer_offset;   // stream position of buffer[0], or -1 if unknown
+    bool buffer_dirty;      // true if the buffer holds pending writes
 };
 
+// Large enough to hold any file header, small enough to not waste reads
+#define SDL_IO_BUFFER_SIZE  4096
+
 #ifdef SDL_PLATFORM_3DS
 #include "n3ds/SDL_iostreamromfs.h"
 #endif // SDL_PLATFORM_3DS
@@ -1348,12 +1367,71 @@ SDL_IOStream *SDL_OpenIO(const SDL_IOStreamInterface *iface, void *userdata)
     return iostr;
 }
 
+// Write out any data held back by the buffer
+static bool FlushIOBuffer(SDL_IOStream *context)
+{
+    size_t written = 0;
+
+    while (written < context->buffer_pos) {
+        size_t amount = context->iface.write(context->userdata, context->buffer + written, context->buffer_pos - written, &context->status);
+        if (amount == 0) {
+            break;
+        }
+        written += amount;
+    }
+    if (context->buffer_offset >= 0) {
+        context->buffer_offset += written;
+    }
+
+    if (written < context->buffer_pos) {
+        SDL_memmove(context->buffer, context->buffer + written, context->buffer_pos - written);
+        context->buffer_pos -= written;
+        if (context->status == SDL_IO_STATUS_READY) {
+            context->status = SDL_IO_STATUS_ERROR;
+        }
+        return false;
+    }
+    context->buffer_pos = 0;
+    context->buffer_dirty = false;
+    return true;
+}
+
+// Seek the stream back over any data that was read ahead but not consumed
+static bool ReturnReadAhead(SDL_IOStream *context)
+{
+    if (context->buffer_pos < context->buffer_avail) {
+        Sint64 position;
+
+        if (context->buffer_offset < 0 || !context->iface.seek) {
+            return false;
+        }
+        position = context->buffer_offset + (Sint64)context->buffer_pos;
+        if (context->iface.seek(context->userdata, position, SDL_IO_SEEK_SET) != position) {
+            return false;
+        }
+        context->buffer_offset = position;
+    } else if (context->buffer_offset >= 0) {
+        context->buffer_offset += context->buffer_avail;
+    }
+    context->buffer_pos = 0;
+    context->buffer_avail = 0;
+    return true;
+}
+
 bool SDL_CloseIO(SDL_IOStream *iostr)
 {
     bool result = true;
     if (iostr) {
+        if (iostr->buffer) {
+            if (iostr->buffer_dirty && !FlushIOBuffer(iostr)) {
+                result = false;
+            }
+            SDL_free(iostr->buffer);
+        }
         if (iostr->iface.close) {
-            result = iostr->iface.close(iostr->userdata);
+            if (!iostr->iface.close(iostr->userdata)) {
+                result = false;
+            }
         }
         SDL_DestroyProperties(iostr->props);
         SDL_free(iostr);
@@ -1361,6 +1439,60 @@ bool SDL_CloseIO(SDL_IOStream *iostr)
     return result;
 }
 
+bool SDL_BeginBufferedIO(SDL_IOStream *context)
+{
+    if (!context || context->buffer) {
+        return false;
+    }
+
+    // Memory streams are already as fast as the buffer would be
+    if (context->iface.read == mem_read || context->iface.read == dynamic_mem_read) {
+        return false;
+    }
+
+    if (!SDL_GetHintBoolean(SDL_HINT_IOSTREAM_BUFFERING, true)) {
+        return false;
+    }
+
+    context->buffer = (Uint8 *)SDL_malloc(SDL_IO_BUFFER_SIZE);
+    if (!context->buffer) {
+        return false;
+    }
+    context->buffer_size = SDL_IO_BUFFER_SIZE;
+    context->buffer_pos = 0;
+    context->buffer_avail = 0;
+    context->buffer_dirty = false;
+    context->buffer_offset = -1;
+    if (context->iface.seek) {
+        context->buffer_offset = context->iface.seek(context->userdata, 0, SDL_IO_SEEK_CUR);
+    }
+    return true;
+}
+
+bool SDL_EndBufferedIO(SDL_IOStream *context)
+{
+    if (!context || !context->buffer) {
+        return true;
+    }
+
+    bool result = true;
+    if (context->buffer_dirty) {
+        // If this fails the pending data is lost, but the error is reported
+        result = FlushIOBuffer(context);
+    } else if (!ReturnReadAhead(context)) {
+        // The stream can't seek back, so keep serving reads from the buffer
+        return true;
+    }
+
+    SDL_free(context->buffer);
+    context->buffer = NULL;
+    context->buffer_size = 0;
+    context->buffer_pos = 0;
+    context->buffer_avail = 0;
+    context->buffer_dirty = false;
+    return result;
+}
+
 // Load all the data from an SDL data stream
 void *SDL_LoadFile_IO(SDL_IOStream *src, size_t *datasize, bool closeio)
 {
@@ -1445,6 +1577,185 @@ void *SDL_LoadFile(const char *file, size_t *datasize)
     return SDL_LoadFile_IO(stream, datasize, true);
 }
 
+// An empty file has nothing to map, so this is returned instead
+static Uint8 SDL_empty_file_mapping[1];
+
+#ifdef HAVE_MAPPED_FILES
+static void SetMappedFileAccessPattern(void *mem, size_t size, SDL_IOAccessPattern pattern)
+{
+#if defined(MADV_SEQUENTIAL) && defined(MADV_RANDOM)
+    switch (pattern) {
+    case SDL_IO_ACCESS_SEQUENTIAL:
+        madvise(mem, size, MADV_SEQUENTIAL);
+        break;
+    case SDL_IO_ACCESS_RANDOM:
+        madvise(mem, size, MADV_RANDOM);
+        break;
+    default:
+        break;
+    }
+#endif
+}
+#endif // HAVE_MAPPED_FILES
+
+void *SDL_MapFile(const char *file, size_t *datasize, SDL_IOAccessPattern pattern)
+{
+    void *mem = NULL;
+    size_t size = 0;
+
+    if (datasize) {
+        *datasize = 0;
+    }
+
+    CHECK_PARAM(!file || !*file) {
+        SDL_InvalidParamError("file");
+        return NULL;
+    }
+
+#if defined(SDL_PLATFORM_WINDOWS)
+    HANDLE handle = windows_file_open(file, "rb");
+    if (handle == INVALID_HANDLE_VALUE) {
+        return NULL;
+    }
+
+    LARGE_INTEGER filesize;
+    if (!GetFileSizeEx(handle, &filesize)) {
+        WIN_SetError("GetFileSizeEx");
+    } else if ((Uint64)filesize.QuadPart > SDL_SIZE_MAX) {
+        SDL_SetError("%s is too large to map", file);
+    } else if (filesize.QuadPart == 0) {
+        mem = SDL_empty_file_mapping;
+    } else {
+        // A copy-on-write view, so the data can be modified like memory from SDL_LoadFile()
+        HANDLE mapping = CreateFileMappingW(handle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+        if (!mapping) {
+            WIN_SetError("CreateFileMapping");
+        } else {
+            mem = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+            if (!mem) {
+                WIN_SetError("MapViewOfFile");
+            } else {
+                size = (size_t)filesize.QuadPart;
+            }
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(handle);
+
+    // The access pattern is only a hint, and there's no equivalent for views of files
+    (void)pattern;
+
+#elif defined(HAVE_MAPPED_FILES)
+    int flags = O_RDONLY;
+#ifdef O_CLOEXEC
+    flags |= O_CLOEXEC;
+#endif
+    int fd;
+    do {
+        fd = open(file, flags);
+    } while (fd < 0 && errno == EINTR);
+    if (fd < 0) {
+        SDL_SetError("Couldn't open %s: %s", file, strerror(errno));
+        return NULL;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        SDL_SetError("Couldn't stat %s: %s", file, strerror(errno));
+    } else if (!S_ISREG(st.st_mode)) {
+        SDL_SetError("%s is not a regular file", file);
+    } else if ((Uint64)st.st_size > SDL_SIZE_MAX) {
+        SDL_SetError("%s is too large to map", file);
+    } else if (st.st_size == 0) {
+        mem = SDL_empty_file_mapping;
+    } else {
+        // A private mapping, so the data can be modified like memory from SDL_LoadFile()
+        mem = mmap(NULL, (size_t)st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (mem == MAP_FAILED) {
+            SDL_SetError("Couldn't map %s: %s", file, strerror(errno));
+            mem = NULL;
+        } else {
+            size = (size_t)st.st_size;
+            SetMappedFileAccessPattern(mem, size, pattern);
+        }
+    }
+    close(fd);
+
+#else
+    // Mapping isn't available, load the file instead
+    (void)pattern;
+    mem = SDL_LoadFile(file, &size);
+#endif
+
+    if (mem && datasize) {
+        *datasize = size;
+    }
+    return mem;
+}
+
+void SDL_UnmapFile(void *mem, size_t datasize)
+{
+    if (!mem || mem == SDL_empty_file_mapping) {
+        return;
+    }
+
+#if defined(SDL_PLATFORM_WINDOWS)
+    UnmapViewOfFile(mem);
+#elif defined(HAVE_MAPPED_FILES)
+    munmap(mem, datasize);
+#else
+    SDL_free(mem);
+#endif
+}
+
+static bool SDLCALL mapped_close(void *userdata)
+{
+    IOStreamMemData *iodata = (IOStreamMemData *) userdata;
+    SDL_UnmapFile(iodata->base, (size_t)(iodata->stop - iodata->base));
+    SDL_free(userdata);
+    return true;
+}
+
+SDL_IOStream *SDL_IOFromMappedFile(const char *file, SDL_IOAccessPattern pattern)
+{
+    size_t size = 0;
+    void *mem = SDL_MapFile(file, &size, pattern);
+    if (!mem) {
+        return NULL;
+    }
+
+    IOStreamMemData *iodata = (IOStreamMemData *) SDL_calloc(1, sizeof (*iodata));
+    if (!iodata) {
+        SDL_UnmapFile(mem, size);
+        return NULL;
+    }
+
+    SDL_IOStreamInterface iface;
+    SDL_INIT_INTERFACE(&iface);
+    iface.size = mem_size;
+    iface.seek = mem_seek;
+    iface.read = mem_read;
+    // leave iface.write as NULL, the stream is read-only.
+    iface.close = mapped_close;
+
+    iodata->base = (Uint8 *)mem;
+    iodata->here = iodata->base;
+    iodata->stop = iodata->base + size;
+
+    SDL_IOStream *iostr = SDL_OpenIO(&iface, iodata);
+    if (!iostr) {
+        iface.close(iodata);
+    } else {
+        const SDL_PropertiesID props = SDL_GetIOProperties(iostr);
+        if (props) {
+            iodata->props = props;
+            SDL_SetPointerProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, mem);
+            SDL_SetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, size);
+        }
+    }
+    return iostr;
+}
+
 bool SDL_SaveFile_IO(SDL_IOStream *src, const void *data, size_t datasize, bool closeio)
 {
     size_t size_written = 0;
@@ -1516,6 +1827,10 @@ Sint64 SDL_GetIOSize(SDL_IOStream *context)
         return SDL_InvalidParamError("context");
     }
 
+    if (context->buffer_dirty && !FlushIOBuffer(context)) {
+        return -1;
+    }
+
     if (!context->iface.size) {
         Sint64 pos, size;
 
@@ -1531,6 +1846,46 @@ Sint64 SDL_GetIOSize(SDL_IOStream *context)
     return context->iface.size(context->userdata);
 }
 
+static Sint64 SeekIOBuffered(SDL_IOStream *context, Sint64 offset, SDL_IOWhence whence)
+{
+    Sint64 result;
+
+    if (context->buffer_offset >= 0 && whence != SDL_IO_SEEK_END) {
+        const Sint64 position = context->buffer_offset + (Sint64)context->buffer_pos;
+        const Sint64 target = (whence == SDL_IO_SEEK_SET) ? offset : (position + offset);
+
+        if (target == position) {
+            return position;
+        }
+
+        // Seeking within the read-ahead data doesn't need to touch the stream
+        if (!context->buffer_dirty &&
+            target >= context->buffer_offset &&
+            target <= context->buffer_offset + (Sint64)context->buffer_avail) {
+            context->buffer_pos = (size_t)(target - context->buffer_offset);
+            return target;
+        }
+
+        offset = target;
+        whence = SDL_IO_SEEK_SET;
+    } else if (whence == SDL_IO_SEEK_CUR && !context->buffer_dirty) {
+        // The stream is ahead of us by the unconsumed read-ahead data
+        offset -= (Sint64)(context->buffer_avail - context->buffer_pos);
+    }
+
+    if (context->buffer_dirty && !FlushIOBuffer(context)) {
+        return -1;
+    }
+
+    result = context->iface.seek(context->userdata, offset, whence);
+    if (result >= 0) {
+        context->buffer_pos = 0;
+        context->buffer_avail = 0;
+        context->buffer_offset = result;
+    }
+    return result;
+}
+
 Sint64 SDL_SeekIO(SDL_IOStream *context, Sint64 offset, SDL_IOWhence whence)
 {
     CHECK_PARAM(!context) {
@@ -1542,6 +1897,9 @@ Sint64 SDL_SeekIO(SDL_IOStream *context, Sint64 offset, SDL_IOWhence whence)
         SDL_Unsupported();
         return -1;
     }
+    if (context->buffer) {
+        return SeekIOBuffered(context, offset, whence);
+    }
     return context->iface.seek(context->userdata, offset, whence);
 }
 
@@ -1550,6 +1908,64 @@ Sint64 SDL_TellIO(SDL_IOStream *context)
     return SDL_SeekIO(context, 0, SDL_IO_SEEK_CUR);
 }
 
+static size_t ReadIOBuffered(SDL_IOStream *context, void *ptr, size_t size)
+{
+    Uint8 *dst = (Uint8 *)ptr;
+    size_t total = 0;
+
+    if (context->buffer_dirty && !FlushIOBuffer(context)) {
+        return 0;
+    }
+
+    while (size > 0) {
+        size_t amount = context->buffer_avail - context->buffer_pos;
+        if (amount > 0) {
+            if (amount > size) {
+                amount = size;
+            }
+            SDL_memcpy(dst, context->buffer + context->buffer_pos, amount);
+            context->buffer_pos += amount;
+            dst += amount;
+            size -= amount;
+            total += amount;
+            continue;
+        }
+
+        // A previous refill stopped at the end of the stream or on an error
+        if (context->status != SDL_IO_STATUS_READY) {
+            break;
+        }
+
+        if (context->buffer_offset >= 0) {
+            context->buffer_offset += context->buffer_avail;
+        }
+        context->buffer_pos = 0;
+        context->buffer_avail = 0;
+
+        if (size >= context->buffer_size) {
+            // Large reads go straight into the caller's memory
+            amount = context->iface.read(context->userdata, dst, size, &context->status);
+            if (context->buffer_offset >= 0) {
+                context->buffer_offset += amount;
+            }
+            total += amount;
+            size -= amount;
+            break;
+        }
+
+        context->buffer_avail = context->iface.read(context->userdata, context->buffer, context->buffer_size, &context->status);
+        if (context->buffer_avail == 0) {
+            break;
+        }
+    }
+
+    // Running short on a refill only matters if the caller didn't get everything
+    if (size == 0) {
+        context->status = SDL_IO_STATUS_READY;
+    }
+    return total;
+}
+
 size_t SDL_ReadIO(SDL_IOStream *context, void *ptr, size_t size)
 {
     CHECK_PARAM(!context) {
@@ -1570,9 +1986,42 @@ size_t SDL_ReadIO(SDL_IOStream *context, void *ptr, size_t size)
     context->status = SDL_IO_STATUS_READY;
     SDL_ClearError();
 
+    if (context->buffer) {
+        return ReadIOBuffered(context, ptr, size);
+    }
     return context->iface.read(context->userdata, ptr, size, &context->status);
 }
 
+static size_t WriteIOBuffered(SDL_IOStream *context, const void *ptr, size_t size)
+{
+    size_t amount;
+
+    if (!context->buffer_dirty && !ReturnReadAhead(context)) {
+        context->status = SDL_IO_STATUS_ERROR;
+        SDL_SetError("Couldn't seek back over buffered data");
+        return 0;
+    }
+
+    if (context->buffer_pos + size > context->buffer_size) {
+        if (context->buffer_dirty && !FlushIOBuffer(context)) {
+            return 0;
+        }
+        if (size >= context->buffer_size) {
+            // Large writes go straight to the stream
+            amount = context->iface.write(context->userdata, ptr, size, &context->status);
+            if (context->buffer_offset >= 0) {
+                context->buffer_offset += amount;
+            }
+            return amount;
+        }
+    }
+
+    SDL_memcpy(context->buffer + context->buffer_pos, ptr, size);
+    context->buffer_pos += size;
+    context->buffer_dirty = true;
+    return size;
+}
+
 size_t SDL_WriteIO(SDL_IOStream *context, const void *ptr, size_t size)
 {
     CHECK_PARAM(!context) {
@@ -1593,6 +2042,9 @@ size_t SDL_WriteIO(SDL_IOStream *context, const void *ptr, size_t size)
     context->status = SDL_IO_STATUS_READY;
     SDL_ClearError();
 
+    if (context->buffer) {
+        return WriteIOBuffered(context, ptr, size);
+    }
     return context->iface.write(context->userdata, ptr, size, &context->status);
 }
 
@@ -1642,7 +2094,10 @@ bool SDL_FlushIO(SDL_IOStream *context)
     context->status = SDL_IO_STATUS_READY;
     SDL_ClearError();
 
-    if (context->iface.flush) {
+    if (context->buffer_dirty) {
+        result = FlushIOBuffer(context);
+    }
+    if (result && context->iface.flush) {
         result = context->iface.flush(context->userdata, &context->status);
     }
     if (!result && (context->status == SDL_IO_STATUS_READY)) {
@@ -1653,12 +2108,35 @@ bool SDL_FlushIO(SDL_IOStream *context)
 
 // Functions for dynamically reading and writing endian-specific values
 
+// Serve small reads straight from the buffer, if there is one
+static SDL_INLINE bool ReadIOExact(SDL_IOStream *src, void *data, size_t size)
+{
+    if (src && src->buffer_pos + size <= src->buffer_avail) {
+        SDL_memcpy(data, src->buffer + src->buffer_pos, size);
+        src->buffer_pos += size;
+        src->status = SDL_IO_STATUS_READY;
+        return true;
+    }
+    return (SDL_ReadIO(src, data, size) == size);
+}
+
+static SDL_INLINE bool WriteIOExact(SDL_IOStream *dst, const void *data, size_t size)
+{
+    if (dst && dst->buffer_dirty && dst->buffer_pos + size <= dst->buffer_size) {
+        SDL_memcpy(dst->buffer + dst->buffer_pos, data, size);
+        dst->buffer_pos += size;
+        dst->status = SDL_IO_STATUS_READY;
+        return true;
+    }
+    return (SDL_WriteIO(dst, data, size) == size);
+}
+
 bool SDL_ReadU8(SDL_IOStream *src, Uint8 *value)
 {
     Uint8 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1672,7 +2150,7 @@ bool SDL_ReadS8(SDL_IOStream *src, Sint8 *value)
     Sint8 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1686,7 +2164,7 @@ bool SDL_ReadU16LE(SDL_IOStream *src, Uint16 *value)
     Uint16 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1705,7 +2183,7 @@ bool SDL_ReadU16BE(SDL_IOStream *src, Uint16 *value)
     Uint16 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1724,7 +2202,7 @@ bool SDL_ReadU32LE(SDL_IOStream *src, Uint32 *value)
     Uint32 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1743,7 +2221,7 @@ bool SDL_ReadU32BE(SDL_IOStream *src, Uint32 *value)
     Uint32 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1762,7 +2240,7 @@ bool SDL_ReadU64LE(SDL_IOStream *src, Uint64 *value)
     Uint64 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1781,7 +2259,7 @@ bool SDL_ReadU64BE(SDL_IOStream *src, Uint64 *value)
     Uint64 data = 0;
     bool result = false;
 
-    if (SDL_ReadIO(src, &data, sizeof(data)) == sizeof(data)) {
+    if (ReadIOExact(src, &data, sizeof(data))) {
         result = true;
     }
     if (value) {
@@ -1797,18 +2275,18 @@ bool SDL_ReadS64BE(SDL_IOStream *src, Sint64 *value)
 
 bool SDL_WriteU8(SDL_IOStream *dst, Uint8 value)
 {
-    return (SDL_WriteIO(dst, &value, sizeof(value)) == sizeof(value));
+    return WriteIOExact(dst, &value, sizeof(value));
 }
 
 bool SDL_WriteS8(SDL_IOStream *dst, Sint8 value)
 {
-    return (SDL_WriteIO(dst, &value, sizeof(value)) == sizeof(value));
+    return WriteIOExact(dst, &value, sizeof(value));
 }
 
 bool SDL_WriteU16LE(SDL_IOStream *dst, Uint16 value)
 {
     const Uint16 swapped = SDL_Swap16LE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteIOExact(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS16LE(SDL_IOStream *dst, Sint16 value)
@@ -1819,7 +2297,7 @@ bool SDL_WriteS16LE(SDL_IOStream *dst, Sint16 value)
 bool SDL_WriteU16BE(SDL_IOStream *dst, Uint16 value)
 {
     const Uint16 swapped = SDL_Swap16BE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteIOExact(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS16BE(SDL_IOStream *dst, Sint16 value)
@@ -1830,7 +2308,7 @@ bool SDL_WriteS16BE(SDL_IOStream *dst, Sint16 value)
 bool SDL_WriteU32LE(SDL_IOStream *dst, Uint32 value)
 {
     const Uint32 swapped = SDL_Swap32LE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteIOExact(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS32LE(SDL_IOStream *dst, Sint32 value)
@@ -1841,7 +2319,7 @@ bool SDL_WriteS32LE(SDL_IOStream *dst, Sint32 value)
 bool SDL_WriteU32BE(SDL_IOStream *dst, Uint32 value)
 {
     const Uint32 swapped = SDL_Swap32BE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteIOExact(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS32BE(SDL_IOStream *dst, Sint32 value)
@@ -1852,7 +2330,7 @@ bool SDL_WriteS32BE(SDL_IOStream *dst, Sint32 value)
 bool SDL_WriteU64LE(SDL_IOStream *dst, Uint64 value)
 {
     const Uint64 swapped = SDL_Swap64LE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteIOExact(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS64LE(SDL_IOStream *dst, Sint64 value)
@@ -1863,7 +2341,7 @@ bool SDL_WriteS64LE(SDL_IOStream *dst, Sint64 value)
 bool SDL_WriteU64BE(SDL_IOStream *dst, Uint64 value)
 {
     const Uint64 swapped = SDL_Swap64BE(value);
-    return (SDL_WriteIO(dst, &swapped, sizeof(swapped)) == sizeof(swapped));
+    return WriteIOExact(dst, &swapped, sizeof(swapped));
 }
 
 bool SDL_WriteS64BE(SDL_IOStream *dst, Sint64 value)
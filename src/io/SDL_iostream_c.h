@@ -23,6 +23,12 @@
 #ifndef SDL_iostream_c_h_
 #define SDL_iostream_c_h_
 
+/* SDL_MapFile() maps files into memory on these platforms, and loads the
+ * whole file into memory everywhere else. */
+#if defined(SDL_PLATFORM_WINDOWS) || ((defined(SDL_PLATFORM_UNIX) || defined(SDL_PLATFORM_APPLE)) && !defined(SDL_PLATFORM_EMSCRIPTEN))
+#define SDL_HAVE_FILE_MAPPING 1
+#endif
+
 #if defined(SDL_PLATFORM_WINDOWS)
 SDL_IOStream *SDL_IOFromHandle(HANDLE handle, const char *mode, bool autoclose);
 #else
@@ -32,4 +38,14 @@ extern SDL_IOStream *SDL_IOFromFP(FILE *fp, bool autoclose);
 extern SDL_IOStream *SDL_IOFromFD(int fd, bool autoclose);
 #endif
 
+/* Buffer small reads and writes on a stream, for parsers that access it a
+ * few bytes at a time. This returns true if the buffer was added by this
+ * call, in which case SDL_EndBufferedIO() should be called when done, which
+ * flushes pending writes and seeks back over any unconsumed read-ahead.
+ * This does nothing for memory streams, or if SDL_HINT_IOSTREAM_BUFFERING
+ * is disabled.
+ */
+extern bool SDL_BeginBufferedIO(SDL_IOStream *context);
+extern bool SDL_EndBufferedIO(SDL_IOStream *context);
+
 #endif // SDL_iostream_c_h_
@@ -81,6 +81,12 @@ struct SDL_AsyncIOTask
     Uint64 requested_size;
     Uint64 result_size;
     void *app_userdata;
+    SDL_AsyncIOVector *vectors;  // non-NULL for scatter/gather tasks, allocated with the task. `buffer` is vectors[0].buffer.
+    int num_vectors;
+    int parts_pending;  // for backends that split a vectored task into several operations.
+    void *staging;  // for backends that can't do scatter/gather, the single buffer that is read or written instead of `vectors`. `buffer` points here until the task completes.
+    bool batched;  // true if the backend can hold off on submitting this task until SDL_AsyncIOQueueInterface::submit is called.
+    void *sys_data;  // backend-specific data for this task, the backend frees it.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, asyncio);
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, queue);      // the generic backend uses this, so I've added it here to avoid the extra allocation.
     LINKED_LIST_DECLARE_FIELDS(struct SDL_AsyncIOTask, threadpool); // the generic backend uses this, so I've added it here to avoid the extra allocation.
@@ -94,6 +100,10 @@ typedef struct SDL_AsyncIOQueueInterface
     SDL_AsyncIOTask * (*wait_results)(void *userdata, Sint32 timeoutMS);
     void (*signal)(void *userdata);
     void (*destroy)(void *userdata);
+    void (*submit)(void *userdata);  // submits tasks held back by `batched`. Can be NULL if the backend never holds them back.
+    bool (*register_buffers)(void *userdata, const SDL_AsyncIOVector *buffers, int num_buffers);  // Can be NULL if unsupported.
+    bool (*register_file)(void *userdata, SDL_AsyncIO *asyncio);  // Can be NULL if unsupported.
+    void (*unregister_file)(void *userdata, SDL_AsyncIO *asyncio);
 } SDL_AsyncIOQueueInterface;
 
 struct SDL_AsyncIOQueue
@@ -114,6 +124,7 @@ typedef struct SDL_AsyncIOInterface
     bool (*write)(void *userdata, SDL_AsyncIOTask *task);
     bool (*close)(void *userdata, SDL_AsyncIOTask *task);
     void (*destroy)(void *userdata);
+    bool vectored;  // true if read and write handle `vectors` themselves. Otherwise scatter/gather tasks go through a single `staging` buffer.
 } SDL_AsyncIOInterface;
 
 struct SDL_AsyncIO
@@ -125,6 +136,9 @@ struct SDL_AsyncIO
     SDL_AsyncIOTask *closing;  // The close task, which isn't queued until all pending work for this file is done.
     bool oneshot;  // true if this is a SDL_LoadFileAsync open.
     bool readonly;  // true if this file is opened read-only.
+    int batched;  // tasks for this file sitting in unsubmitted batches. Like pending tasks, these hold off the close task.
+    SDL_AsyncIOQueue *registered_queue;  // the queue this file is registered with by SDL_RegisterAsyncIOFile, if any.
+    int registered_index;  // the backend's slot for the registered file.
 };
 
 // This is implemented for various platforms; param validation is done before calling this. Open file, fill in iface and userdata.
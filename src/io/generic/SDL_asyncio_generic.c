@@ -37,6 +37,19 @@
 #define SDL_ASYNCIO_USE_THREADPOOL 1
 #endif
 
+#if SDL_ASYNCIO_USE_THREADPOOL && defined(HAVE_PREAD)
+#define SDL_ASYNCIO_USE_PREAD 1
+#include <errno.h>
+#include <unistd.h>
+#ifdef HAVE_PREADV
+#include <sys/uio.h>
+#endif
+#endif
+
+// Adjacent tasks on the same file are gathered into one run and done with a single
+// preadv/pwritev (or a single seek), this is how many tasks a run can hold.
+#define MAX_RUN_TASKS 64
+
 typedef struct GenericAsyncIOQueueData
 {
     SDL_Mutex *lock;
@@ -46,8 +59,16 @@ typedef struct GenericAsyncIOQueueData
 
 typedef struct GenericAsyncIOData
 {
-    SDL_Mutex *lock;  // !!! FIXME: we can skip this lock if we have an equivalent of pread/pwrite
+    SDL_Mutex *lock;  // protects the pending tasks and the scheduling state below, not the i/o itself.
     SDL_IOStream *io;
+    int fd;  // >= 0 if we can use pread/pwrite on this file, which lets reads run in parallel without seeking.
+    SDL_AsyncIOTask pending;  // tasks that haven't started yet, in the order they were queued.
+    SDL_AsyncIOTask *pending_tail;
+    int running;  // number of threads doing i/o on this file right now.
+    bool running_exclusive;  // true if the i/o in progress needs the file to itself (seeks, writes, close).
+    bool scheduled;  // true if this file is sitting in a threadpool work queue.
+    struct GenericAsyncIOData *work_prev;
+    struct GenericAsyncIOData *work_next;
 } GenericAsyncIOData;
 
 static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
@@ -60,144 +81,525 @@ static void AsyncIOTaskComplete(SDL_AsyncIOTask *task)
     SDL_UnlockMutex(data->lock);
 }
 
-// synchronous i/o is offloaded onto the threadpool. This function does the threaded work.
-// This is called directly, without a threadpool, if !SDL_ASYNCIO_USE_THREADPOOL.
-static void SynchronousIO(SDL_AsyncIOTask *task)
+static bool IsWriteTask(const SDL_AsyncIOTask *task)
 {
-    SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
+    return (task->type == SDL_ASYNCIO_TASK_WRITE);
+}
 
-    GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
-    SDL_IOStream *io = data->io;
-    const size_t size = (size_t) task->requested_size;
-    void *ptr = task->buffer;
+static int GetTaskBufferCount(const SDL_AsyncIOTask *task)
+{
+    return task->vectors ? task->num_vectors : 1;
+}
 
-    // this seek won't work if two tasks are reading from the same file at the same time,
-    // so we lock here. This makes multiple reads from a single file serialize, but different
-    // files will still run in parallel. An app can also open the same file twice to avoid this.
-    SDL_LockMutex(data->lock);
-    if (task->type == SDL_ASYNCIO_TASK_CLOSE) {
-        bool okay = true;
-        if (task->flush) {
-            okay = SDL_FlushIO(data->io);
-        }
-        okay = SDL_CloseIO(data->io) && okay;
-        task->result = okay ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
-    } else if (SDL_SeekIO(io, (Sint64) task->offset, SDL_IO_SEEK_SET) < 0) {
+static void *GetTaskBuffer(const SDL_AsyncIOTask *task, int i, size_t *size)
+{
+    if (task->vectors) {
+        *size = (size_t) task->vectors[i].size;
+        return task->vectors[i].buffer;
+    }
+    *size = (size_t) task->requested_size;
+    return task->buffer;
+}
+
+static void SetTaskResult(SDL_AsyncIOTask *task, bool failed, SDL_IOStatus status)
+{
+    if (failed) {
         task->result = SDL_ASYNCIO_FAILURE;
+    } else if (task->result_size == task->requested_size) {
+        task->result = SDL_ASYNCIO_COMPLETE;
+    } else if (IsWriteTask(task)) {
+        task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
     } else {
-        const bool writing = (task->type == SDL_ASYNCIO_TASK_WRITE);
-        task->result_size = (Uint64) (writing ? SDL_WriteIO(io, ptr, size) : SDL_ReadIO(io, ptr, size));
-        if (task->result_size == task->requested_size) {
-            task->result = SDL_ASYNCIO_COMPLETE;
-        } else {
-            if (writing) {
-                task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
-            } else {
-                const SDL_IOStatus status = SDL_GetIOStatus(io);
-                SDL_assert(status != SDL_IO_STATUS_READY);  // this should have either failed or been EOF.
-                SDL_assert(status != SDL_IO_STATUS_NOT_READY);  // these should not be non-blocking reads!
-                task->result = (status == SDL_IO_STATUS_EOF) ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+        SDL_assert(status != SDL_IO_STATUS_READY);  // this should have either failed or been EOF.
+        SDL_assert(status != SDL_IO_STATUS_NOT_READY);  // these should not be non-blocking reads!
+        task->result = (status == SDL_IO_STATUS_EOF) ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+    }
+}
+
+// Does the i/o for a run of adjacent tasks through the SDL_IOStream. The caller makes sure
+// nothing else touches the stream while this runs, since the seek position is shared.
+static void StreamIO(GenericAsyncIOData *data, SDL_AsyncIOTask **tasks, int num_tasks)
+{
+    SDL_IOStream *io = data->io;
+
+    for (int i = 0; i < num_tasks; i++) {
+        SDL_AsyncIOTask *task = tasks[i];
+
+        SDL_assert(task->result != SDL_ASYNCIO_CANCELED);  // shouldn't have gotten in here if canceled!
+
+        if (task->type == SDL_ASYNCIO_TASK_CLOSE) {
+            bool okay = true;
+            if (task->flush) {
+                okay = SDL_FlushIO(io);
             }
+            okay = SDL_CloseIO(io) && okay;
+            task->result = okay ? SDL_ASYNCIO_COMPLETE : SDL_ASYNCIO_FAILURE;
+            continue;
         }
+
+        // tasks in a run are adjacent, so we only need to seek for the first one, or after a short transfer.
+        const bool need_seek = (i == 0) || (tasks[i - 1]->result_size != tasks[i - 1]->requested_size);
+        if (need_seek && SDL_SeekIO(io, (Sint64) task->offset, SDL_IO_SEEK_SET) < 0) {
+            task->result = SDL_ASYNCIO_FAILURE;
+            continue;
+        }
+
+        // scatter/gather is just each buffer in turn, stopping at the first short one.
+        const bool writing = IsWriteTask(task);
+        const int num_buffers = GetTaskBufferCount(task);
+        task->result_size = 0;
+        for (int j = 0; j < num_buffers; j++) {
+            size_t size;
+            void *ptr = GetTaskBuffer(task, j, &size);
+            const size_t transferred = writing ? SDL_WriteIO(io, ptr, size) : SDL_ReadIO(io, ptr, size);
+            task->result_size += transferred;
+            if (transferred < size) {
+                break;
+            }
+        }
+        SetTaskResult(task, false, SDL_GetIOStatus(io));
     }
-    SDL_UnlockMutex(data->lock);
+}
 
+#ifdef SDL_ASYNCIO_USE_PREAD
+// pread/pwrite until everything transferred, EOF, or an error. Returns -1 on error.
+static Sint64 TransferAt(int fd, bool writing, void *ptr, size_t size, Uint64 offset)
+{
+    size_t total = 0;
+    while (total < size) {
+        const ssize_t rc = writing ? pwrite(fd, (const Uint8 *) ptr + total, size - total, (off_t) (offset + total))
+                                   : pread(fd, (Uint8 *) ptr + total, size - total, (off_t) (offset + total));
+        if (rc < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return -1;
+        } else if (rc == 0) {
+            break;  // EOF
+        }
+        total += (size_t) rc;
+    }
+    return (Sint64) total;
+}
+
+static void PositionalTaskIO(GenericAsyncIOData *data, SDL_AsyncIOTask *task)
+{
+    const bool writing = IsWriteTask(task);
+    const int num_buffers = GetTaskBufferCount(task);
+    bool failed = false;
+
+    task->result_size = 0;
+    for (int i = 0; i < num_buffers; i++) {
+        size_t size;
+        void *ptr = GetTaskBuffer(task, i, &size);
+        const Sint64 transferred = TransferAt(data->fd, writing, ptr, size, task->offset + task->result_size);
+        if (transferred < 0) {
+            failed = true;
+            break;
+        }
+        task->result_size += (Uint64) transferred;
+        if ((size_t) transferred < size) {
+            break;
+        }
+    }
+    SetTaskResult(task, failed, SDL_IO_STATUS_EOF);
+}
+
+// Does the i/o for a run of adjacent tasks with pread/pwrite, which doesn't touch the
+// file position, so several of these can run on the same file at once.
+static void PositionalIO(GenericAsyncIOData *data, SDL_AsyncIOTask **tasks, int num_tasks)
+{
+    int first_unfinished = 0;
+
+#ifdef HAVE_PREADV
+    struct iovec iov[MAX_RUN_TASKS];
+    int num_iov = 0;
+    for (int i = 0; i < num_tasks; i++) {
+        const int num_buffers = GetTaskBufferCount(tasks[i]);
+        if ((num_iov + num_buffers) > MAX_RUN_TASKS) {
+            num_iov = 0;  // too many buffers to do in one call, do it the slow way.
+            break;
+        }
+        for (int j = 0; j < num_buffers; j++) {
+            size_t size;
+            iov[num_iov].iov_base = GetTaskBuffer(tasks[i], j, &size);
+            iov[num_iov].iov_len = size;
+            num_iov++;
+        }
+    }
+
+    if (num_iov > 1) {
+        const bool writing = IsWriteTask(tasks[0]);
+        ssize_t rc;
+        do {
+            rc = writing ? pwritev(data->fd, iov, num_iov, (off_t) tasks[0]->offset) : preadv(data->fd, iov, num_iov, (off_t) tasks[0]->offset);
+        } while ((rc < 0) && (errno == EINTR));
+
+        // hand out what we got in order. Anything that came up short gets redone alone below,
+        // which sorts out EOF and partial transfers without any special cases here.
+        Uint64 remaining = (rc > 0) ? (Uint64) rc : 0;
+        while ((first_unfinished < num_tasks) && (remaining >= tasks[first_unfinished]->requested_size)) {
+            SDL_AsyncIOTask *task = tasks[first_unfinished++];
+            task->result_size = task->requested_size;
+            task->result = SDL_ASYNCIO_COMPLETE;
+            remaining -= task->requested_size;
+        }
+    }
+#endif
+
+    for (int i = first_unfinished; i < num_tasks; i++) {
+        PositionalTaskIO(data, tasks[i]);
+    }
+}
+#endif
+
+#if !SDL_ASYNCIO_USE_THREADPOOL
+// without a threadpool, tasks run as soon as they're queued. This is called directly.
+static void SynchronousIO(SDL_AsyncIOTask *task)
+{
+    GenericAsyncIOData *data = (GenericAsyncIOData *) task->asyncio->userdata;
+    SDL_LockMutex(data->lock);
+    StreamIO(data, &task, 1);
+    SDL_UnlockMutex(data->lock);
     AsyncIOTaskComplete(task);
 }
+#endif
 
 #if SDL_ASYNCIO_USE_THREADPOOL
+// The threadpool schedules files, not tasks. Each file keeps its own FIFO of pending
+// tasks, and a file with work that can start goes into one of the per-thread work queues.
+// A thread takes files from the back of its own queue, and when that's empty, steals from
+// the front of the others. This keeps the threads from fighting over a single lock, and
+// gives us a place to keep tasks on the same file in order when they need to be.
+#define MAX_THREADPOOL_THREADS 8  // 8 is probably more than enough.
+#define THREADPOOL_SEARCH_YIELDS 4  // times an idle thread yields and looks for work again before it sleeps.
+
+typedef struct AsyncIOWorkQueue
+{
+    SDL_SpinLock lock;
+    GenericAsyncIOData *head;  // other threads steal from here.
+    GenericAsyncIOData *tail;  // the owning thread pushes and pops here.
+} AsyncIOWorkQueue;
+
 static SDL_InitState threadpool_init;
 static SDL_Mutex *threadpool_lock = NULL;
-static bool stop_threadpool = false;
-static SDL_AsyncIOTask threadpool_tasks;
 static SDL_Condition *threadpool_condition = NULL;
+static AsyncIOWorkQueue threadpool_queues[MAX_THREADPOOL_THREADS];
+static SDL_AtomicInt threadpool_stopping;
+static SDL_AtomicInt threadpool_pending;  // number of files sitting in work queues.
+static SDL_AtomicInt threadpool_next_queue;  // round-robin for tasks queued by the app.
+static SDL_AtomicInt running_threadpool_threads;
+static SDL_AtomicInt idle_threadpool_threads;
 static int max_threadpool_threads = 0;
-static int running_threadpool_threads = 0;
-static int idle_threadpool_threads = 0;
 static int threadpool_threads_spun = 0;
 
-static int SDLCALL AsyncIOThreadpoolWorker(void *data)
+static int SDLCALL AsyncIOThreadpoolWorker(void *data);
+
+static bool MaybeSpinNewWorkerThread(void)
 {
+    bool okay = true;
+
+    // if all existing threads are busy and the pool of threads isn't maxed out, make a new one.
+    // Check without the lock first, since this happens every time a file gets scheduled.
+    if ((SDL_GetAtomicInt(&idle_threadpool_threads) > 0) || (SDL_GetAtomicInt(&running_threadpool_threads) >= max_threadpool_threads)) {
+        return true;
+    }
+
     SDL_LockMutex(threadpool_lock);
+    if ((SDL_GetAtomicInt(&idle_threadpool_threads) == 0) && (SDL_GetAtomicInt(&running_threadpool_threads) < max_threadpool_threads)) {
+        char threadname[32];
+        const int home = threadpool_threads_spun % max_threadpool_threads;
+        SDL_snprintf(threadname, sizeof (threadname), "SDLasyncio%d", threadpool_threads_spun);
+        SDL_Thread *thread = SDL_CreateThread(AsyncIOThreadpoolWorker, threadname, (void *) (intptr_t) home);
+        if (thread == NULL) {
+            okay = false;
+        } else {
+            SDL_DetachThread(thread);  // these terminate themselves when idle too long, so we never WaitThread.
+            SDL_AddAtomicInt(&running_threadpool_threads, 1);
+            threadpool_threads_spun++;
+        }
+    }
+    SDL_UnlockMutex(threadpool_lock);
 
-    while (!stop_threadpool) {
-        SDL_AsyncIOTask *task = LINKED_LIST_START(threadpool_tasks, threadpool);
-        if (!task) {
-            // if we go 30 seconds without a new task, terminate unless we're the only thread left.
-            idle_threadpool_threads++;
-            const bool rc = SDL_WaitConditionTimeout(threadpool_condition, threadpool_lock, 30000);
-            idle_threadpool_threads--;
-
-            if (!rc) {
-                // decide if we have too many idle threads, and if so, quit to let thread pool shrink when not busy.
-                if (idle_threadpool_threads) {
-                    break;
+    return okay;
+}
+
+// file->lock must be held. `which` is the calling thread's own work queue, or -1 if the app is calling.
+static void ScheduleFile(GenericAsyncIOData *file, int which)
+{
+    const bool from_app = (which < 0);
+
+    SDL_assert(!file->scheduled);
+
+    if (from_app) {
+        which = (int) ((Uint32) SDL_AddAtomicInt(&threadpool_next_queue, 1) % (Uint32) max_threadpool_threads);
+    }
+
+    AsyncIOWorkQueue *wq = &threadpool_queues[which];
+    file->scheduled = true;
+    SDL_LockSpinlock(&wq->lock);
+    file->work_next = NULL;
+    file->work_prev = wq->tail;
+    if (wq->tail) {
+        wq->tail->work_next = file;
+    } else {
+        wq->head = file;
+    }
+    wq->tail = file;
+    SDL_UnlockSpinlock(&wq->lock);
+
+    // This is an atomic read-modify-write, and so is the idle count change in AsyncIOThreadpoolWorker,
+    // so either that thread sees this file before it sleeps or we see that it's idle and wake it up.
+    const int pending = SDL_AddAtomicInt(&threadpool_pending, 1) + 1;
+    if (!from_app && (pending == 1)) {
+        // a thread putting a file in its own queue will get to it next anyhow, only bother
+        // the others if there's more work piled up than this thread can take right now.
+    } else if (SDL_GetAtomicInt(&idle_threadpool_threads) > 0) {
+        SDL_LockMutex(threadpool_lock);
+        SDL_SignalCondition(threadpool_condition);
+        SDL_UnlockMutex(threadpool_lock);
+    } else {
+        MaybeSpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
+    }
+}
+
+static GenericAsyncIOData *TakeScheduledFile(int home)
+{
+    for (int i = 0; i < max_threadpool_threads; i++) {
+        AsyncIOWorkQueue *wq = &threadpool_queues[(home + i) % max_threadpool_threads];
+        GenericAsyncIOData *file;
+
+        SDL_LockSpinlock(&wq->lock);
+        if (i == 0) {
+            file = wq->tail;  // our own queue, take the newest, it's likely still warm.
+            if (file) {
+                wq->tail = file->work_prev;
+                if (wq->tail) {
+                    wq->tail->work_next = NULL;
+                } else {
+                    wq->head = NULL;
                 }
             }
+        } else {
+            file = wq->head;  // someone else's, steal the oldest.
+            if (file) {
+                wq->head = file->work_next;
+                if (wq->head) {
+                    wq->head->work_prev = NULL;
+                } else {
+                    wq->tail = NULL;
+                }
+            }
+        }
+        SDL_UnlockSpinlock(&wq->lock);
 
-            continue;
+        if (file) {
+            file->work_prev = file->work_next = NULL;
+            SDL_AddAtomicInt(&threadpool_pending, -1);
+            return file;
         }
+    }
+    return NULL;
+}
+
+// positional reads can overlap each other, everything else has the file to itself, in order.
+static bool CanTaskOverlap(const GenericAsyncIOData *file, const SDL_AsyncIOTask *task)
+{
+    return (file->fd >= 0) && (task->type == SDL_ASYNCIO_TASK_READ);
+}
+
+// file->lock must be held.
+static bool CanStartTask(const GenericAsyncIOData *file, const SDL_AsyncIOTask *task)
+{
+    return CanTaskOverlap(file, task) ? !file->running_exclusive : (file->running == 0);
+}
+
+// file->lock must be held.
+static void AppendPendingTask(GenericAsyncIOData *file, SDL_AsyncIOTask *task)
+{
+    task->threadpoolnext = NULL;
+    task->threadpoolprev = file->pending_tail;
+    file->pending_tail->threadpoolnext = task;
+    file->pending_tail = task;
+}
+
+// file->lock must be held.
+static void RemovePendingTask(GenericAsyncIOData *file, SDL_AsyncIOTask *task)
+{
+    if (file->pending_tail == task) {
+        file->pending_tail = task->threadpoolprev;
+    }
+    LINKED_LIST_UNLINK(task, threadpool);
+}
+
+// file->lock must be held. Moves the pending tasks into `canceled` so they can be completed after the lock is released.
+static void CancelPendingTasks(GenericAsyncIOData *file, SDL_AsyncIOTask *canceled)
+{
+    SDL_AsyncIOTask *task;
+    while ((task = LINKED_LIST_START(file->pending, threadpool)) != NULL) {
+        RemovePendingTask(file, task);
+        task->result = SDL_ASYNCIO_CANCELED;
+        LINKED_LIST_PREPEND(task, (*canceled), threadpool);
+    }
+}
 
+static void CompleteCanceledTasks(SDL_AsyncIOTask *canceled)
+{
+    SDL_AsyncIOTask *task;
+    while ((task = LINKED_LIST_START((*canceled), threadpool)) != NULL) {
         LINKED_LIST_UNLINK(task, threadpool);
+        AsyncIOTaskComplete(task);
+    }
+}
 
-        SDL_UnlockMutex(threadpool_lock);
+// file->lock must be held. If the first pending task can start now, make sure a thread will get to it.
+static void MaybeScheduleFile(GenericAsyncIOData *file, int which)
+{
+    const SDL_AsyncIOTask *next = LINKED_LIST_START(file->pending, threadpool);
+    if (next && !file->scheduled && CanStartTask(file, next)) {
+        ScheduleFile(file, which);
+    }
+}
 
-        // bookkeeping is done, so we drop the mutex and fire the work.
-        SynchronousIO(task);
+// Takes the first pending task and any adjacent ones after it that can go in the same call.
+static int TakeRun(GenericAsyncIOData *file, SDL_AsyncIOTask **run)
+{
+    SDL_AsyncIOTask *task = LINKED_LIST_START(file->pending, threadpool);
+    int num_tasks = 0;
 
-        SDL_LockMutex(threadpool_lock);  // take the lock again and see if there's another task (if not, we'll wait on the Condition).
+    if (!task || !CanStartTask(file, task)) {
+        return 0;
     }
 
-    running_threadpool_threads--;
+    while (task && (num_tasks < MAX_RUN_TASKS)) {
+        if (num_tasks > 0) {
+            const SDL_AsyncIOTask *prev = run[num_tasks - 1];
+            if ((task->type != prev->type) || (task->type == SDL_ASYNCIO_TASK_CLOSE) || (task->offset != (prev->offset + prev->requested_size))) {
+                break;
+            }
+        }
+        SDL_AsyncIOTask *next = LINKED_LIST_NEXT(task, threadpool);
+        RemovePendingTask(file, task);
+        run[num_tasks++] = task;
+        task = next;
+    }
 
-    // this is kind of a hack, but this lets us reuse threadpool_condition to block on shutdown until all threads have exited.
-    if (stop_threadpool) {
-        SDL_BroadcastCondition(threadpool_condition);
+    file->running++;
+    file->running_exclusive = !CanTaskOverlap(file, run[0]);
+    return num_tasks;
+}
+
+static void RunScheduledFile(GenericAsyncIOData *file, int home)
+{
+    SDL_AsyncIOTask *run[MAX_RUN_TASKS];
+    SDL_AsyncIOTask canceled;
+
+    SDL_LockMutex(file->lock);
+    file->scheduled = false;
+    const int num_tasks = TakeRun(file, run);
+    if (num_tasks > 0) {
+        MaybeScheduleFile(file, home);  // if more reads can go in parallel with this run, let another thread steal them.
     }
+    SDL_UnlockMutex(file->lock);
 
-    SDL_UnlockMutex(threadpool_lock);
+    if (num_tasks == 0) {
+        return;  // someone else got to it first, or it was canceled.
+    }
 
-    return 0;
+    // bookkeeping is done, so we drop the lock and fire the work.
+#ifdef SDL_ASYNCIO_USE_PREAD
+    if ((file->fd >= 0) && (run[0]->type != SDL_ASYNCIO_TASK_CLOSE)) {
+        PositionalIO(file, run, num_tasks);
+    } else
+#endif
+    {
+        StreamIO(file, run, num_tasks);
+    }
+
+    // update the file before completing anything, since completing the close task lets the app destroy it.
+    SDL_zero(canceled);
+    SDL_LockMutex(file->lock);
+    file->running--;
+    file->running_exclusive = false;
+    if (SDL_GetAtomicInt(&threadpool_stopping)) {
+        CancelPendingTasks(file, &canceled);
+    } else {
+        MaybeScheduleFile(file, home);
+    }
+    SDL_UnlockMutex(file->lock);
+
+    for (int i = 0; i < num_tasks; i++) {
+        AsyncIOTaskComplete(run[i]);
+    }
+    CompleteCanceledTasks(&canceled);
 }
 
-static bool MaybeSpinNewWorkerThread(void)
+static int SDLCALL AsyncIOThreadpoolWorker(void *data)
 {
-    // if all existing threads are busy and the pool of threads isn't maxed out, make a new one.
-    if ((idle_threadpool_threads == 0) && (running_threadpool_threads < max_threadpool_threads)) {
-        char threadname[32];
-        SDL_snprintf(threadname, sizeof (threadname), "SDLasyncio%d", threadpool_threads_spun);
-        SDL_Thread *thread = SDL_CreateThread(AsyncIOThreadpoolWorker, threadname, NULL);
-        if (thread == NULL) {
-            return false;
+    const int home = (int) (intptr_t) data;
+    bool shrink = false;
+    int searches = 0;
+
+    while (!shrink && !SDL_GetAtomicInt(&threadpool_stopping)) {
+        GenericAsyncIOData *file = TakeScheduledFile(home);
+        if (file) {
+            RunScheduledFile(file, home);
+            searches = 0;
+            continue;
         }
-        SDL_DetachThread(thread);  // these terminate themselves when idle too long, so we never WaitThread.
-        running_threadpool_threads++;
-        threadpool_threads_spun++;
+
+        // the app is often still queueing tasks, so give it a moment before paying for a sleep and a wakeup.
+        if (searches < THREADPOOL_SEARCH_YIELDS) {
+            searches++;
+            SDL_Delay(0);
+            continue;
+        }
+        searches = 0;
+
+        SDL_LockMutex(threadpool_lock);
+        SDL_AddAtomicInt(&idle_threadpool_threads, 1);
+        bool rc = true;
+        if (!SDL_GetAtomicInt(&threadpool_pending) && !SDL_GetAtomicInt(&threadpool_stopping)) {
+            // if we go 30 seconds without a new task, terminate unless we're the only thread left.
+            rc = SDL_WaitConditionTimeout(threadpool_condition, threadpool_lock, 30000);
+        }
+        const int other_idle_threads = SDL_AddAtomicInt(&idle_threadpool_threads, -1) - 1;
+
+        // decide if we have too many idle threads, and if so, quit to let thread pool shrink when not busy.
+        // Our work queue doesn't need draining, the other threads steal from it.
+        shrink = (!rc && (other_idle_threads > 0) && !SDL_GetAtomicInt(&threadpool_pending));
+        SDL_UnlockMutex(threadpool_lock);
     }
-    return true;
+
+    SDL_LockMutex(threadpool_lock);
+    SDL_AddAtomicInt(&running_threadpool_threads, -1);
+    // this is kind of a hack, but this lets us reuse threadpool_condition to block on shutdown until all threads have exited.
+    if (SDL_GetAtomicInt(&threadpool_stopping)) {
+        SDL_BroadcastCondition(threadpool_condition);
+    }
+    SDL_UnlockMutex(threadpool_lock);
+
+    return 0;
 }
 
 static void QueueAsyncIOTask(SDL_AsyncIOTask *task)
 {
     SDL_assert(task != NULL);
 
-    SDL_LockMutex(threadpool_lock);
+    GenericAsyncIOData *file = (GenericAsyncIOData *) task->asyncio->userdata;
 
-    if (stop_threadpool) {  // just in case.
+    SDL_LockMutex(file->lock);
+    const bool stopping = (SDL_GetAtomicInt(&threadpool_stopping) != 0);
+    if (!stopping) {
+        AppendPendingTask(file, task);
+        MaybeScheduleFile(file, -1);
+    }
+    SDL_UnlockMutex(file->lock);
+
+    if (stopping) {  // just in case.
         task->result = SDL_ASYNCIO_CANCELED;
         AsyncIOTaskComplete(task);
-    } else {
-        LINKED_LIST_PREPEND(task, threadpool_tasks, threadpool);
-        MaybeSpinNewWorkerThread();  // okay if this fails or the thread pool is maxed out. Something will get there eventually.
-
-        // tell idle threads to get to work.
-        // This is a broadcast because we want someone from the thread pool to wake up, but
-        // also shutdown might also be blocking on this. One of the threads will grab
-        // it, the others will go back to sleep.
-        SDL_BroadcastCondition(threadpool_condition);
     }
-
-    SDL_UnlockMutex(threadpool_lock);
 }
 
 // We don't initialize async i/o at all until it's used, so
@@ -208,7 +610,14 @@ static bool PrepareThreadpool(void)
     bool okay = true;
     if (SDL_ShouldInit(&threadpool_init)) {
         max_threadpool_threads = (SDL_GetNumLogicalCPUCores() * 2) + 1;  // !!! FIXME: this should probably have a hint to override.
-        max_threadpool_threads = SDL_clamp(max_threadpool_threads, 1, 8);  // 8 is probably more than enough.
+        max_threadpool_threads = SDL_clamp(max_threadpool_threads, 1, MAX_THREADPOOL_THREADS);
+
+        SDL_zeroa(threadpool_queues);
+        SDL_SetAtomicInt(&threadpool_stopping, 0);
+        SDL_SetAtomicInt(&threadpool_pending, 0);
+        SDL_SetAtomicInt(&threadpool_next_queue, 0);
+        SDL_SetAtomicInt(&running_threadpool_threads, 0);
+        SDL_SetAtomicInt(&idle_threadpool_threads, 0);
 
         okay = (okay && ((threadpool_lock = SDL_CreateMutex()) != NULL));
         okay = (okay && ((threadpool_condition = SDL_CreateCondition()) != NULL));
@@ -235,33 +644,38 @@ static void ShutdownThreadpool(void)
     if (SDL_ShouldQuit(&threadpool_init)) {
         SDL_LockMutex(threadpool_lock);
 
-        // cancel anything that's still pending.
-        SDL_AsyncIOTask *task;
-        while ((task = LINKED_LIST_START(threadpool_tasks, threadpool)) != NULL) {
-            LINKED_LIST_UNLINK(task, threadpool);
-            task->result = SDL_ASYNCIO_CANCELED;
-            AsyncIOTaskComplete(task);
-        }
-
-        stop_threadpool = true;
+        SDL_SetAtomicInt(&threadpool_stopping, 1);
         SDL_BroadcastCondition(threadpool_condition);  // tell the whole threadpool to wake up and quit.
 
-        while (running_threadpool_threads > 0) {
-            // each threadpool thread will broadcast this condition before it terminates if stop_threadpool is set.
+        while (SDL_GetAtomicInt(&running_threadpool_threads) > 0) {
+            // each threadpool thread will broadcast this condition before it terminates if threadpool_stopping is set.
             // we can't just join the threads because they are detached, so the thread pool can automatically shrink as necessary.
             SDL_WaitCondition(threadpool_condition, threadpool_lock);
         }
 
         SDL_UnlockMutex(threadpool_lock);
 
+        // cancel anything that's still pending. Nothing is running anymore, so anything
+        // with pending tasks is sitting in a work queue.
+        GenericAsyncIOData *file;
+        while ((file = TakeScheduledFile(0)) != NULL) {
+            SDL_AsyncIOTask canceled;
+            SDL_zero(canceled);
+            SDL_LockMutex(file->lock);
+            file->scheduled = false;
+            CancelPendingTasks(file, &canceled);
+            SDL_UnlockMutex(file->lock);
+            CompleteCanceledTasks(&canceled);
+        }
+
         SDL_DestroyMutex(threadpool_lock);
         threadpool_lock = NULL;
         SDL_DestroyCondition(threadpool_condition);
         threadpool_condition = NULL;
 
-        max_threadpool_threads = running_threadpool_threads = idle_threadpool_threads = threadpool_threads_spun = 0;
+        max_threadpool_threads = threadpool_threads_spun = 0;
 
-        stop_threadpool = false;
+        SDL_SetAtomicInt(&threadpool_stopping, 0);
         SDL_SetInitialized(&threadpool_init, false);
     }
 }
@@ -304,13 +718,19 @@ static void generic_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *ta
     AsyncIOTaskComplete(task);
     #else
     // we can't stop i/o that's in-flight, but we _can_ just refuse to start it if the threadpool hadn't picked it up yet.
-    SDL_LockMutex(threadpool_lock);
+    GenericAsyncIOData *file = (GenericAsyncIOData *) task->asyncio->userdata;
+    bool canceled = false;
+    SDL_LockMutex(file->lock);
     if (LINKED_LIST_PREV(task, threadpool) != NULL) {  // still in the queue waiting to be run? Take it out.
-        LINKED_LIST_UNLINK(task, threadpool);
+        RemovePendingTask(file, task);
+        MaybeScheduleFile(file, -1);
+        canceled = true;
+    }
+    SDL_UnlockMutex(file->lock);
+    if (canceled) {
         task->result = SDL_ASYNCIO_CANCELED;
         AsyncIOTaskComplete(task);
     }
-    SDL_UnlockMutex(threadpool_lock);
     #endif
 }
 
@@ -425,12 +845,20 @@ bool SDL_SYS_AsyncIOFromFile_Generic(const char *file, const char *mode, SDL_Asy
         return false;
     }
 
+    data->pending_tail = &data->pending;
+    data->fd = -1;
+    #ifdef SDL_ASYNCIO_USE_PREAD
+    // we do all the i/o through the descriptor, so it doesn't matter that it might be under a buffered FILE*.
+    data->fd = (int) SDL_GetNumberProperty(SDL_GetIOProperties(data->io), SDL_PROP_IOSTREAM_FILE_DESCRIPTOR_NUMBER, -1);
+    #endif
+
     static const SDL_AsyncIOInterface SDL_AsyncIOFile_Generic = {
         generic_asyncio_size,
         generic_asyncio_io,
         generic_asyncio_io,
         generic_asyncio_io,
-        generic_asyncio_destroy
+        generic_asyncio_destroy,
+        true  // vectored
     };
 
     SDL_copyp(&asyncio->iface, &SDL_AsyncIOFile_Generic);
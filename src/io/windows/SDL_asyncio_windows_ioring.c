@@ -148,11 +148,23 @@ static Sint64 ioring_asyncio_size(void *userdata)
 // you must hold sqe_lock when calling this!
 static bool ioring_asyncioqueue_queue_task(void *userdata, SDL_AsyncIOTask *task)
 {
+    if (task->batched) {
+        return true;  // this will go to the kernel with the rest of the batch in ioring_asyncioqueue_submit.
+    }
+
     WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) userdata;
     const HRESULT hr = ioring.SubmitIoRing(queuedata->ring, 0, 0, NULL);
     return (FAILED(hr) ? WIN_SetErrorFromHRESULT("SubmitIoRing", hr) : true);
 }
 
+static void ioring_asyncioqueue_submit(void *userdata)
+{
+    WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) userdata;
+    SDL_LockMutex(queuedata->sqe_lock);
+    ioring.SubmitIoRing(queuedata->ring, 0, 0, NULL);
+    SDL_UnlockMutex(queuedata->sqe_lock);
+}
+
 static void ioring_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *task)
 {
     if (!task->asyncio || !task->asyncio->userdata) {
@@ -178,7 +190,7 @@ static void ioring_asyncioqueue_cancel_task(void *userdata, SDL_AsyncIOTask *tas
     }
 
     cancel_task->app_userdata = task;
-    ioring_asyncioqueue_queue_task(userdata, task);
+    ioring_asyncioqueue_queue_task(userdata, cancel_task);
     SDL_UnlockMutex(queuedata->sqe_lock);
 }
 
@@ -194,10 +206,34 @@ static SDL_AsyncIOTask *ProcessCQE(WinIoRingAsyncIOQueueData *queuedata, IORING_
             SDL_AsyncIOTask *cancel_task = task;
             task = (SDL_AsyncIOTask *) cancel_task->app_userdata;
             SDL_free(cancel_task);
-            if (SUCCEEDED(cqe->ResultCode)) {  // cancel was successful?
+            if (FAILED(cqe->ResultCode)) {
+                task = NULL; // it already finished or was too far along to cancel, so we'll pick up the actual results later.
+            } else if (task->vectors) {
+                // the other parts of a scatter/gather task still have completions coming, which will report it when the last one arrives.
+                SDL_LockMutex(queuedata->cqe_lock);
                 task->result = SDL_ASYNCIO_CANCELED;
+                SDL_UnlockMutex(queuedata->cqe_lock);
+                task = NULL;
             } else {
-                task = NULL; // it already finished or was too far along to cancel, so we'll pick up the actual results later.
+                task->result = SDL_ASYNCIO_CANCELED;
+            }
+        } else if (task->vectors) {
+            // scatter/gather tasks are one operation per vector; only report the task when the last one finishes.
+            SDL_LockMutex(queuedata->cqe_lock);
+            if (FAILED(cqe->ResultCode)) {
+                if (task->result != SDL_ASYNCIO_CANCELED) {
+                    task->result = SDL_ASYNCIO_FAILURE;
+                }
+            } else {
+                task->result_size += (Uint64) cqe->Information;
+            }
+            const bool done = (--task->parts_pending == 0);
+            SDL_UnlockMutex(queuedata->cqe_lock);
+
+            if (!done) {
+                task = NULL;
+            } else if ((task->type == SDL_ASYNCIO_TASK_WRITE) && (task->result == SDL_ASYNCIO_COMPLETE) && (task->result_size < task->requested_size)) {
+                task->result = SDL_ASYNCIO_FAILURE;  // it's always a failure on short writes.
             }
         } else if (FAILED(cqe->ResultCode)) {
             if ((task->type == SDL_ASYNCIO_TASK_CLOSE) && (cqe->ResultCode == E_ACCESSDENIED) && task->asyncio->readonly) {
@@ -222,7 +258,7 @@ static SDL_AsyncIOTask *ProcessCQE(WinIoRingAsyncIOQueueData *queuedata, IORING_
 
         // we currently send all close operations through as flushes, requested or not, so the actually closing is (in theory) fast. We do that here.
         // if a later IoRing interface version offers an asynchronous close operation, revisit this to only flush if requested, like we do in the Linux io_uring code.
-        if (task->type == SDL_ASYNCIO_TASK_CLOSE) {
+        if (task && (task->type == SDL_ASYNCIO_TASK_CLOSE)) {
             SDL_assert(task->asyncio != NULL);
             SDL_assert(task->asyncio->userdata != NULL);
             HANDLE handle = (HANDLE) task->asyncio->userdata;
@@ -353,7 +389,8 @@ static bool SDL_SYS_CreateAsyncIOQueue_ioring(SDL_AsyncIOQueue *queue)
         ioring_asyncioqueue_get_results,
         ioring_asyncioqueue_wait_results,
         ioring_asyncioqueue_signal,
-        ioring_asyncioqueue_destroy
+        ioring_asyncioqueue_destroy,
+        ioring_asyncioqueue_submit
     };
 
     SDL_copyp(&queue->iface, &SDL_AsyncIOQueue_ioring);
@@ -377,58 +414,99 @@ failed:
     return false;
 }
 
-static bool ioring_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
+// you must hold sqe_lock when calling this!
+static HRESULT BuildIoRingOperation(WinIoRingAsyncIOQueueData *queuedata, bool writing, IORING_HANDLE_REF href, void *ptr, UINT32 size, UINT64 offset, SDL_AsyncIOTask *task)
 {
-    // !!! FIXME: UINT32 smaller than requested_size's Uint64. If we overflow it, we could try submitting multiple SQEs
-    // !!! FIXME:  and make a note in the task that there are several in sequence.
-    if (task->requested_size > 0xFFFFFFFF) {
-        return SDL_SetError("ioring: i/o task is too large");
-    }
-
-    HANDLE handle = (HANDLE) userdata;
-    WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) task->queue->userdata;
-    IORING_HANDLE_REF href = IoRingHandleRefFromHandle(handle);
-    IORING_BUFFER_REF bref = IoRingBufferRefFromPointer(task->buffer);
-
-    // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
-    SDL_LockMutex(queuedata->sqe_lock);
-    bool retval;
-    const HRESULT hr = ioring.BuildIoRingReadFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, (UINT_PTR) task, IOSQE_FLAGS_NONE);
-    if (FAILED(hr)) {
-        retval = WIN_SetErrorFromHRESULT("BuildIoRingReadFile", hr);
-    } else {
-        retval = task->queue->iface.queue_task(task->queue->userdata, task);
+    IORING_BUFFER_REF bref = IoRingBufferRefFromPointer(ptr);
+    HRESULT hr;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        if (writing) {
+            hr = ioring.BuildIoRingWriteFile(queuedata->ring, href, bref, size, offset, 0 /*FILE_WRITE_FLAGS_NONE*/, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+        } else {
+            hr = ioring.BuildIoRingReadFile(queuedata->ring, href, bref, size, offset, (UINT_PTR) task, IOSQE_FLAGS_NONE);
+        }
+#ifdef IORING_E_SUBMISSION_QUEUE_FULL
+        if (hr == IORING_E_SUBMISSION_QUEUE_FULL) {
+            // the submission queue is full of batched work; hand it to the kernel to make room.
+            ioring.SubmitIoRing(queuedata->ring, 0, 0, NULL);
+            continue;
+        }
+#endif
+        break;
     }
-    SDL_UnlockMutex(queuedata->sqe_lock);
-    return retval;
+    return hr;
 }
 
-static bool ioring_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
+static bool ioring_asyncio_io(bool writing, void *userdata, SDL_AsyncIOTask *task)
 {
     // !!! FIXME: UINT32 smaller than requested_size's Uint64. If we overflow it, we could try submitting multiple SQEs
     // !!! FIXME:  and make a note in the task that there are several in sequence.
-    if (task->requested_size > 0xFFFFFFFF) {
+    if (task->vectors) {
+        for (int i = 0; i < task->num_vectors; i++) {
+            if (task->vectors[i].size > 0xFFFFFFFF) {
+                return SDL_SetError("ioring: i/o task is too large");
+            }
+        }
+    } else if (task->requested_size > 0xFFFFFFFF) {
         return SDL_SetError("ioring: i/o task is too large");
     }
 
     HANDLE handle = (HANDLE) userdata;
     WinIoRingAsyncIOQueueData *queuedata = (WinIoRingAsyncIOQueueData *) task->queue->userdata;
     IORING_HANDLE_REF href = IoRingHandleRefFromHandle(handle);
-    IORING_BUFFER_REF bref = IoRingBufferRefFromPointer(task->buffer);
+    const char *what = writing ? "BuildIoRingWriteFile" : "BuildIoRingReadFile";
 
     // have to hold a lock because otherwise two threads could get_sqe and submit while one request isn't fully set up.
     SDL_LockMutex(queuedata->sqe_lock);
     bool retval;
-    const HRESULT hr = ioring.BuildIoRingWriteFile(queuedata->ring, href, bref, (UINT32) task->requested_size, task->offset, 0 /*FILE_WRITE_FLAGS_NONE*/, (UINT_PTR) task, IOSQE_FLAGS_NONE);
-    if (FAILED(hr)) {
-        retval = WIN_SetErrorFromHRESULT("BuildIoRingWriteFile", hr);
+    if (task->vectors) {
+        // IoRing has no scatter/gather operations, so this is one operation per vector, covering consecutive ranges of the file.
+        // A full submission queue makes BuildIoRingOperation submit the parts built so far, so hold cqe_lock until parts_pending
+        // is set, or a part could complete and count it down to zero while later parts are still being built.
+        UINT64 offset = task->offset;
+        HRESULT hr = S_OK;
+        int i;
+        SDL_LockMutex(queuedata->cqe_lock);
+        for (i = 0; i < task->num_vectors; i++) {
+            hr = BuildIoRingOperation(queuedata, writing, href, task->vectors[i].buffer, (UINT32) task->vectors[i].size, offset, task);
+            if (FAILED(hr)) {
+                break;
+            }
+            offset += task->vectors[i].size;
+        }
+        task->parts_pending = i;
+        SDL_UnlockMutex(queuedata->cqe_lock);
+
+        if (i == 0) {
+            retval = WIN_SetErrorFromHRESULT(what, hr);
+        } else {
+            if (i < task->num_vectors) {
+                task->result = SDL_ASYNCIO_FAILURE;  // some of it is already in the ring, so let that finish and report the failure then.
+            }
+            retval = task->queue->iface.queue_task(task->queue->userdata, task);
+        }
     } else {
-        retval = task->queue->iface.queue_task(task->queue->userdata, task);
+        const HRESULT hr = BuildIoRingOperation(queuedata, writing, href, task->buffer, (UINT32) task->requested_size, task->offset, task);
+        if (FAILED(hr)) {
+            retval = WIN_SetErrorFromHRESULT(what, hr);
+        } else {
+            retval = task->queue->iface.queue_task(task->queue->userdata, task);
+        }
     }
     SDL_UnlockMutex(queuedata->sqe_lock);
     return retval;
 }
 
+static bool ioring_asyncio_read(void *userdata, SDL_AsyncIOTask *task)
+{
+    return ioring_asyncio_io(false, userdata, task);
+}
+
+static bool ioring_asyncio_write(void *userdata, SDL_AsyncIOTask *task)
+{
+    return ioring_asyncio_io(true, userdata, task);
+}
+
 static bool ioring_asyncio_close(void *userdata, SDL_AsyncIOTask *task)
 {
     // current IoRing operations don't offer asynchronous closing, but let's assume most of the potential work is flushing to disk, so just do it for everything, explicit flush or not. We'll close when it finishes.
@@ -499,7 +577,8 @@ static bool SDL_SYS_AsyncIOFromFile_ioring(const char *file, const char *mode, S
         ioring_asyncio_read,
         ioring_asyncio_write,
         ioring_asyncio_close,
-        ioring_asyncio_destroy
+        ioring_asyncio_destroy,
+        true  // vectored
     };
 
     SDL_copyp(&asyncio->iface, &SDL_AsyncIOFile_ioring);
@@ -103,7 +103,13 @@ typedef struct GamepadMapping_t
     SDL_GUID guid _guarded;
     char *name _guarded;
     char *mapping _guarded;
+    bool has_crc _guarded; // the mapping has a crc: field
+    Uint16 crc _guarded;
+    bool parsed _guarded; // the bindings have been parsed from the mapping string
+    int num_bindings _guarded;
+    SDL_GamepadBinding *bindings _guarded;
     SDL_GamepadMappingPriority priority _guarded;
+    struct GamepadMapping_t *next_with_guid _guarded; // next mapping with the same GUID, ignoring version and CRC
     struct GamepadMapping_t *next _guarded;
 } GamepadMapping_t;
 
@@ -114,6 +120,7 @@ typedef struct
     GamepadMapping_t **joystick_mappings _guarded;
 
     int num_changed_mappings _guarded;
+    int max_changed_mappings _guarded;
     GamepadMapping_t **changed_mappings _guarded;
 
 } MappingChangeTracker;
@@ -122,6 +129,8 @@ typedef struct
 
 static SDL_GUID s_zeroGUID;
 static GamepadMapping_t *s_pSupportedGamepads SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static GamepadMapping_t *s_pSupportedGamepadsTail SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
+static SDL_HashTable *s_gamepadMappingsByGUID SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static GamepadMapping_t *s_pDefaultMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static GamepadMapping_t *s_pXInputMapping SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
 static MappingChangeTracker *s_mappingChangeTracker SDL_GUARDED_BY(SDL_joystick_lock) = NULL;
@@ -129,6 +138,11 @@ static SDL_HashTable *s_gamepadInstanceIDs SDL_GUARDED_BY(SDL_joystick_lock) = N
 
 #define _guarded SDL_GUARDED_BY(SDL_joystick_lock)
 
+// Outputs are indexed with the axes first, then the buttons
+#define SDL_GAMEPAD_OUTPUT_AXIS(axis)       ((int)(axis))
+#define SDL_GAMEPAD_OUTPUT_BUTTON(button)   (SDL_GAMEPAD_AXIS_COUNT + (int)(button))
+#define SDL_GAMEPAD_OUTPUT_COUNT            (SDL_GAMEPAD_AXIS_COUNT + SDL_GAMEPAD_BUTTON_COUNT)
+
 // The SDL gamepad structure
 struct SDL_Gamepad
 {
@@ -141,6 +155,8 @@ struct SDL_Gamepad
     GamepadMapping_t *mapping _guarded;
     int num_bindings _guarded;
     SDL_GamepadBinding *bindings _guarded;
+    int *output_bindings _guarded; // indices into bindings, grouped by output
+    int output_binding_offsets[SDL_GAMEPAD_OUTPUT_COUNT + 1] _guarded; // the bindings for output N are output_bindings[offsets[N]] to output_bindings[offsets[N + 1] - 1]
     SDL_GamepadBinding **last_match_axis _guarded;
     Uint8 *last_hat_mask _guarded;
     Uint64 guide_button_down _guarded;
@@ -218,7 +234,8 @@ static const struct SDL_GamepadBlacklistWords SDL_gamepad_blacklist_words[] = {
 };
 
 static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char *mappingString, bool *existing, SDL_GamepadMappingPriority priority);
-static void SDL_PrivateLoadButtonMapping(SDL_Gamepad *gamepad, GamepadMapping_t *pGamepadMapping);
+static int SDL_PrivateAddGamepadMapping(const char *mappingString, SDL_GamepadMappingPriority priority);
+static bool SDL_PrivateLoadButtonMapping(SDL_Gamepad *gamepad, GamepadMapping_t *pGamepadMapping);
 static GamepadMapping_t *SDL_PrivateGetGamepadMapping(SDL_JoystickID instance_id, bool create_mapping);
 static void SDL_SendGamepadAxis(Uint64 timestamp, SDL_Gamepad *gamepad, SDL_GamepadAxis axis, Sint16 value);
 static void SDL_SendGamepadButton(Uint64 timestamp, SDL_Gamepad *gamepad, SDL_GamepadButton button, bool down);
@@ -628,12 +645,18 @@ static void AddMappingChangeTracking(GamepadMapping_t *mapping)
     SDL_assert(s_mappingChangeTracker != NULL);
     tracker = s_mappingChangeTracker;
     num_mappings = tracker->num_changed_mappings;
-    new_mappings = (GamepadMapping_t **)SDL_realloc(tracker->changed_mappings, (num_mappings + 1) * sizeof(*new_mappings));
-    if (new_mappings) {
+    if (num_mappings == tracker->max_changed_mappings) {
+        // Loading a mapping database can change a lot of mappings, so grow geometrically
+        int max_mappings = (num_mappings > 0) ? (num_mappings * 2) : 16;
+        new_mappings = (GamepadMapping_t **)SDL_realloc(tracker->changed_mappings, max_mappings * sizeof(*new_mappings));
+        if (!new_mappings) {
+            return;
+        }
         tracker->changed_mappings = new_mappings;
-        tracker->changed_mappings[num_mappings] = mapping;
-        tracker->num_changed_mappings = (num_mappings + 1);
+        tracker->max_changed_mappings = max_mappings;
     }
+    tracker->changed_mappings[num_mappings] = mapping;
+    tracker->num_changed_mappings = (num_mappings + 1);
 }
 
 static bool HasMappingChangeTracking(MappingChangeTracker *tracker, GamepadMapping_t *mapping)
@@ -685,8 +708,8 @@ static void PopMappingChangeTracking(void)
                 }
                 SDL_PrivateGamepadRemoved(joystick);
             } else if (old_mapping != new_mapping || HasMappingChangeTracking(tracker, new_mapping)) {
-                if (gamepad) {
-                    SDL_PrivateLoadButtonMapping(gamepad, new_mapping);
+                if (gamepad && !SDL_PrivateLoadButtonMapping(gamepad, new_mapping)) {
+                    SDL_LogError(SDL_LOG_CATEGORY_INPUT, "Couldn't apply the new mapping for %s: %s", new_mapping->name, SDL_GetError());
                 }
                 SDL_PrivateGamepadRemapped(joystick);
             }
@@ -1341,6 +1364,91 @@ static GamepadMapping_t *SDL_CreateMappingForWGIGamepad(SDL_GUID guid)
     return SDL_PrivateAddMappingForGUID(guid, mapping_string, &existing, SDL_GAMEPAD_MAPPING_PRIORITY_DEFAULT);
 }
 
+/*
+ * The mappings are indexed by GUID, ignoring the version and CRC, so lookups only need to look at mappings that could match
+ */
+static SDL_GUID SDL_GetGamepadMappingIndexGUID(const SDL_GUID *guid)
+{
+    SDL_GUID index_guid;
+
+    SDL_memcpy(&index_guid, guid, sizeof(index_guid));
+    SDL_SetJoystickGUIDCRC(&index_guid, 0);
+    SDL_SetJoystickGUIDVersion(&index_guid, 0);
+    return index_guid;
+}
+
+static Uint32 SDLCALL SDL_HashGamepadMappingGUID(void *unused, const void *key)
+{
+    SDL_GUID index_guid = SDL_GetGamepadMappingIndexGUID((const SDL_GUID *)key);
+
+    (void)unused;
+    return SDL_murmur3_32(&index_guid, sizeof(index_guid), 0);
+}
+
+static bool SDLCALL SDL_KeyMatchGamepadMappingGUID(void *unused, const void *a, const void *b)
+{
+    SDL_GUID a_guid = SDL_GetGamepadMappingIndexGUID((const SDL_GUID *)a);
+    SDL_GUID b_guid = SDL_GetGamepadMappingIndexGUID((const SDL_GUID *)b);
+
+    (void)unused;
+    return SDL_memcmp(&a_guid, &b_guid, sizeof(a_guid)) == 0;
+}
+
+static void SDL_PrivateIndexGamepadMapping(GamepadMapping_t *mapping)
+{
+    GamepadMapping_t *first;
+
+    SDL_AssertJoysticksLocked();
+
+    if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
+        // Mappings without a GUID are never matched by GUID
+        return;
+    }
+
+    if (!s_gamepadMappingsByGUID) {
+        s_gamepadMappingsByGUID = SDL_CreateHashTable(0, false, SDL_HashGamepadMappingGUID, SDL_KeyMatchGamepadMappingGUID, NULL, NULL);
+        if (!s_gamepadMappingsByGUID) {
+            return;
+        }
+    }
+
+    if (SDL_FindInHashTable(s_gamepadMappingsByGUID, &mapping->guid, (const void **)&first)) {
+        // Keep the mappings in the order they were added, so the first match is the same as in the mapping list
+        while (first->next_with_guid) {
+            first = first->next_with_guid;
+        }
+        first->next_with_guid = mapping;
+    } else {
+        // The key points at the GUID of the first mapping, which lives as long as the index
+        SDL_InsertIntoHashTable(s_gamepadMappingsByGUID, &mapping->guid, mapping, false);
+    }
+}
+
+static void SDL_PrivateSetGamepadMappingString(GamepadMapping_t *mapping, char *pchMapping)
+{
+    const char *crc_string;
+
+    SDL_AssertJoysticksLocked();
+
+    SDL_free(mapping->mapping);
+    mapping->mapping = pchMapping;
+
+    crc_string = SDL_strstr(pchMapping, SDL_GAMEPAD_CRC_FIELD);
+    if (crc_string) {
+        mapping->has_crc = true;
+        mapping->crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
+    } else {
+        mapping->has_crc = false;
+        mapping->crc = 0;
+    }
+
+    // The bindings will be parsed again the next time they're needed
+    SDL_free(mapping->bindings);
+    mapping->bindings = NULL;
+    mapping->num_bindings = 0;
+    mapping->parsed = false;
+}
+
 /*
  * Helper function to scan the mappings database for a gamepad with the specified GUID
  */
@@ -1360,12 +1468,13 @@ static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bo
         SDL_SetJoystickGUIDVersion(&guid, 0);
     }
 
-    for (mapping = s_pSupportedGamepads; mapping; mapping = mapping->next) {
-        SDL_GUID mapping_guid;
+    if (!s_gamepadMappingsByGUID ||
+        !SDL_FindInHashTable(s_gamepadMappingsByGUID, &guid, (const void **)&mapping)) {
+        return NULL;
+    }
 
-        if (SDL_memcmp(&mapping->guid, &s_zeroGUID, sizeof(mapping->guid)) == 0) {
-            continue;
-        }
+    for (; mapping; mapping = mapping->next_with_guid) {
+        SDL_GUID mapping_guid;
 
         SDL_memcpy(&mapping_guid, &mapping->guid, sizeof(mapping_guid));
         if (!match_version) {
@@ -1373,10 +1482,8 @@ static GamepadMapping_t *SDL_PrivateMatchGamepadMappingForGUID(SDL_GUID guid, bo
         }
 
         if (SDL_memcmp(&guid, &mapping_guid, sizeof(guid)) == 0) {
-            const char *crc_string = SDL_strstr(mapping->mapping, SDL_GAMEPAD_CRC_FIELD);
-            if (crc_string) {
-                Uint16 mapping_crc = (Uint16)SDL_strtol(crc_string + SDL_GAMEPAD_CRC_FIELD_SIZE, NULL, 16);
-                if (mapping_crc != crc) {
+            if (mapping->has_crc) {
+                if (mapping->crc != crc) {
                     // This mapping specified a CRC and they don't match
                     continue;
                 }
@@ -1640,7 +1747,7 @@ const char *SDL_GetGamepadStringForButton(SDL_GamepadButton button)
 /*
  * given a gamepad button name and a joystick name update our mapping structure with it
  */
-static bool SDL_PrivateParseGamepadElement(SDL_Gamepad *gamepad, const char *szGameButton, const char *szJoystickButton)
+static bool SDL_PrivateParseGamepadElement(GamepadMapping_t *mapping, const char *szGameButton, const char *szJoystickButton, bool axby_mapping, bool baxy_mapping)
 {
     SDL_GamepadBinding bind;
     SDL_GamepadButton button;
@@ -1650,8 +1757,6 @@ static bool SDL_PrivateParseGamepadElement(SDL_Gamepad *gamepad, const char *szG
     char half_axis_output = 0;
     int i;
     SDL_GamepadBinding *new_bindings;
-    bool axby_mapping = false;
-    bool baxy_mapping = false;
 
     SDL_AssertJoysticksLocked();
 
@@ -1661,13 +1766,6 @@ static bool SDL_PrivateParseGamepadElement(SDL_Gamepad *gamepad, const char *szG
         half_axis_output = *szGameButton++;
     }
 
-    if (SDL_strstr(gamepad->mapping->mapping, ",hint:SDL_GAMECONTROLLER_USE_GAMECUBE_LABELS:=1") != NULL) {
-        axby_mapping = true;
-    }
-    if (SDL_strstr(gamepad->mapping->mapping, ",hint:SDL_GAMECONTROLLER_USE_BUTTON_LABELS:=1") != NULL) {
-        baxy_mapping = true;
-    }
-
     // FIXME: We fix these up when loading the mapping, does this ever get hit?
     //SDL_assert(!axby_mapping && !baxy_mapping);
 
@@ -1737,36 +1835,50 @@ static bool SDL_PrivateParseGamepadElement(SDL_Gamepad *gamepad, const char *szG
         return false;
     }
 
-    for (i = 0; i < gamepad->num_bindings; ++i) {
-        if (SDL_memcmp(&gamepad->bindings[i], &bind, sizeof(bind)) == 0) {
+    for (i = 0; i < mapping->num_bindings; ++i) {
+        if (SDL_memcmp(&mapping->bindings[i], &bind, sizeof(bind)) == 0) {
             // We already have this binding, could be different face button names?
             return true;
         }
     }
 
-    ++gamepad->num_bindings;
-    new_bindings = (SDL_GamepadBinding *)SDL_realloc(gamepad->bindings, gamepad->num_bindings * sizeof(*gamepad->bindings));
+    ++mapping->num_bindings;
+    new_bindings = (SDL_GamepadBinding *)SDL_realloc(mapping->bindings, mapping->num_bindings * sizeof(*mapping->bindings));
     if (!new_bindings) {
-        SDL_free(gamepad->bindings);
-        gamepad->num_bindings = 0;
-        gamepad->bindings = NULL;
+        SDL_free(mapping->bindings);
+        mapping->num_bindings = 0;
+        mapping->bindings = NULL;
         return false;
     }
-    gamepad->bindings = new_bindings;
-    gamepad->bindings[gamepad->num_bindings - 1] = bind;
+    mapping->bindings = new_bindings;
+    mapping->bindings[mapping->num_bindings - 1] = bind;
     return true;
 }
 
 /*
  * given a gamepad mapping string update our mapping object
  */
-static bool SDL_PrivateParseGamepadConfigString(SDL_Gamepad *gamepad, const char *pchString)
+static bool SDL_PrivateParseGamepadConfigString(GamepadMapping_t *mapping)
 {
     char szGameButton[20];
     char szJoystickButton[128];
     bool bGameButton = true;
     int i = 0;
-    const char *pchPos = pchString;
+    const char *pchPos = mapping->mapping;
+    bool axby_mapping = false;
+    bool baxy_mapping = false;
+
+    SDL_AssertJoysticksLocked();
+
+    mapping->num_bindings = 0;
+    mapping->parsed = true;
+
+    if (SDL_strstr(mapping->mapping, ",hint:SDL_GAMECONTROLLER_USE_GAMECUBE_LABELS:=1") != NULL) {
+        axby_mapping = true;
+    }
+    if (SDL_strstr(mapping->mapping, ",hint:SDL_GAMECONTROLLER_USE_BUTTON_LABELS:=1") != NULL) {
+        baxy_mapping = true;
+    }
 
     SDL_zeroa(szGameButton);
     SDL_zeroa(szJoystickButton);
@@ -1780,7 +1892,7 @@ static bool SDL_PrivateParseGamepadConfigString(SDL_Gamepad *gamepad, const char
         } else if (*pchPos == ',') {
             i = 0;
             bGameButton = true;
-            SDL_PrivateParseGamepadElement(gamepad, szGameButton, szJoystickButton);
+            SDL_PrivateParseGamepadElement(mapping, szGameButton, szJoystickButton, axby_mapping, baxy_mapping);
             SDL_zeroa(szGameButton);
             SDL_zeroa(szJoystickButton);
 
@@ -1804,7 +1916,7 @@ static bool SDL_PrivateParseGamepadConfigString(SDL_Gamepad *gamepad, const char
 
     // No more values if the string was terminated by a comma. Don't report an error.
     if (szGameButton[0] != '\0' || szJoystickButton[0] != '\0') {
-        SDL_PrivateParseGamepadElement(gamepad, szGameButton, szJoystickButton);
+        SDL_PrivateParseGamepadElement(mapping, szGameButton, szJoystickButton, axby_mapping, baxy_mapping);
     }
     return true;
 }
@@ -1961,11 +2073,70 @@ static void SDL_FixupHIDAPIMapping(SDL_Gamepad *gamepad)
     }
 }
 
+static int SDL_GetGamepadBindingOutput(const SDL_GamepadBinding *binding)
+{
+    if (binding->output_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
+        if (binding->output.axis.axis >= 0 && binding->output.axis.axis < SDL_GAMEPAD_AXIS_COUNT) {
+            return SDL_GAMEPAD_OUTPUT_AXIS(binding->output.axis.axis);
+        }
+    } else if (binding->output_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
+        if (binding->output.button >= 0 && binding->output.button < SDL_GAMEPAD_BUTTON_COUNT) {
+            return SDL_GAMEPAD_OUTPUT_BUTTON(binding->output.button);
+        }
+    }
+    return -1;
+}
+
+/*
+ * Group the bindings by output, so looking up an axis or button doesn't have to scan all of them
+ */
+// If this fails, the gamepad is left with no bindings rather than an index that doesn't match them
+static bool SDL_PrivateBuildBindingIndex(SDL_Gamepad *gamepad)
+{
+    int next[SDL_GAMEPAD_OUTPUT_COUNT];
+    int i;
+
+    SDL_AssertJoysticksLocked();
+
+    SDL_zeroa(gamepad->output_binding_offsets);
+
+    if (gamepad->num_bindings > 0) {
+        int *output_bindings = (int *)SDL_realloc(gamepad->output_bindings, gamepad->num_bindings * sizeof(*output_bindings));
+        if (!output_bindings) {
+            gamepad->num_bindings = 0;
+            return false;
+        }
+        gamepad->output_bindings = output_bindings;
+    }
+
+    // Count the bindings for each output, then turn the counts into offsets
+    for (i = 0; i < gamepad->num_bindings; ++i) {
+        const int output = SDL_GetGamepadBindingOutput(&gamepad->bindings[i]);
+        if (output >= 0) {
+            ++gamepad->output_binding_offsets[output + 1];
+        }
+    }
+    for (i = 0; i < SDL_GAMEPAD_OUTPUT_COUNT; ++i) {
+        gamepad->output_binding_offsets[i + 1] += gamepad->output_binding_offsets[i];
+        next[i] = gamepad->output_binding_offsets[i];
+    }
+
+    // Fill them in, keeping the mapping order for bindings with the same output
+    for (i = 0; i < gamepad->num_bindings; ++i) {
+        const int output = SDL_GetGamepadBindingOutput(&gamepad->bindings[i]);
+        if (output >= 0) {
+            gamepad->output_bindings[next[output]++] = i;
+        }
+    }
+    return true;
+}
+
 /*
  * Make a new button mapping struct
  */
-static void SDL_PrivateLoadButtonMapping(SDL_Gamepad *gamepad, GamepadMapping_t *pGamepadMapping)
+static bool SDL_PrivateLoadButtonMapping(SDL_Gamepad *gamepad, GamepadMapping_t *pGamepadMapping)
 {
+    bool result = true;
     int i;
 
     SDL_AssertJoysticksLocked();
@@ -1980,7 +2151,20 @@ static void SDL_PrivateLoadButtonMapping(SDL_Gamepad *gamepad, GamepadMapping_t
     SDL_UpdateGamepadType(gamepad);
     SDL_UpdateGamepadFaceStyle(gamepad);
 
-    SDL_PrivateParseGamepadConfigString(gamepad, pGamepadMapping->mapping);
+    // The bindings are parsed once per mapping and copied into each gamepad that uses it
+    if (!pGamepadMapping->parsed) {
+        SDL_PrivateParseGamepadConfigString(pGamepadMapping);
+    }
+    if (pGamepadMapping->num_bindings > 0) {
+        SDL_GamepadBinding *new_bindings = (SDL_GamepadBinding *)SDL_realloc(gamepad->bindings, pGamepadMapping->num_bindings * sizeof(*gamepad->bindings));
+        if (new_bindings) {
+            SDL_memcpy(new_bindings, pGamepadMapping->bindings, pGamepadMapping->num_bindings * sizeof(*new_bindings));
+            gamepad->bindings = new_bindings;
+            gamepad->num_bindings = pGamepadMapping->num_bindings;
+        } else {
+            result = false;
+        }
+    }
 
     if (SDL_IsJoystickHIDAPI(pGamepadMapping->guid)) {
         SDL_FixupHIDAPIMapping(gamepad);
@@ -1999,6 +2183,11 @@ static void SDL_PrivateLoadButtonMapping(SDL_Gamepad *gamepad, GamepadMapping_t
             }
         }
     }
+
+    if (!SDL_PrivateBuildBindingIndex(gamepad)) {
+        result = false;
+    }
+    return result;
 }
 
 /*
@@ -2177,8 +2366,7 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
             // Update existing mapping
             SDL_free(pGamepadMapping->name);
             pGamepadMapping->name = pchName;
-            SDL_free(pGamepadMapping->mapping);
-            pGamepadMapping->mapping = pchMapping;
+            SDL_PrivateSetGamepadMappingString(pGamepadMapping, pchMapping);
             pGamepadMapping->priority = priority;
         } else {
             SDL_free(pchName);
@@ -2189,7 +2377,7 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
         }
         AddMappingChangeTracking(pGamepadMapping);
     } else {
-        pGamepadMapping = (GamepadMapping_t *)SDL_malloc(sizeof(*pGamepadMapping));
+        pGamepadMapping = (GamepadMapping_t *)SDL_calloc(1, sizeof(*pGamepadMapping));
         if (!pGamepadMapping) {
             PopMappingChangeTracking();
             SDL_free(pchName);
@@ -2202,23 +2390,18 @@ static GamepadMapping_t *SDL_PrivateAddMappingForGUID(SDL_GUID jGUID, const char
         }
         pGamepadMapping->guid = jGUID;
         pGamepadMapping->name = pchName;
-        pGamepadMapping->mapping = pchMapping;
-        pGamepadMapping->next = NULL;
+        SDL_PrivateSetGamepadMappingString(pGamepadMapping, pchMapping);
         pGamepadMapping->priority = priority;
 
-        if (s_pSupportedGamepads) {
-            // Add the mapping to the end of the list
-            GamepadMapping_t *pCurrMapping, *pPrevMapping;
-
-            for (pPrevMapping = s_pSupportedGamepads, pCurrMapping = pPrevMapping->next;
-                 pCurrMapping;
-                 pPrevMapping = pCurrMapping, pCurrMapping = pCurrMapping->next) {
-                // continue;
-            }
-            pPrevMapping->next = pGamepadMapping;
+        // Add the mapping to the end of the list
+        if (s_pSupportedGamepadsTail) {
+            s_pSupportedGamepadsTail->next = pGamepadMapping;
         } else {
             s_pSupportedGamepads = pGamepadMapping;
         }
+        s_pSupportedGamepadsTail = pGamepadMapping;
+
+        SDL_PrivateIndexGamepadMapping(pGamepadMapping);
         if (existing) {
             *existing = false;
         }
@@ -2415,7 +2598,7 @@ int SDL_AddGamepadMappingsFromIO(SDL_IOStream *src, bool closeio)
                 platform = tmp;
                 platform_len = comma - platform;
                 if (SDL_PrivateIsGamepadPlatformMatch(platform, platform_len) &&
-                    SDL_AddGamepadMapping(line) > 0) {
+                    SDL_PrivateAddGamepadMapping(line, SDL_GAMEPAD_MAPPING_PRIORITY_API) > 0) {
                     gamepads++;
                 }
             }
@@ -3358,7 +3541,17 @@ SDL_Gamepad *SDL_OpenGamepad(SDL_JoystickID instance_id)
         }
     }
 
-    SDL_PrivateLoadButtonMapping(gamepad, pSupportedGamepad);
+    if (!SDL_PrivateLoadButtonMapping(gamepad, pSupportedGamepad)) {
+        SDL_SetObjectValid(gamepad, SDL_OBJECT_TYPE_GAMEPAD, false);
+        SDL_CloseJoystick(gamepad->joystick);
+        SDL_free(gamepad->bindings);
+        SDL_free(gamepad->output_bindings);
+        SDL_free(gamepad->last_hat_mask);
+        SDL_free(gamepad->last_match_axis);
+        SDL_free(gamepad);
+        SDL_UnlockJoysticks();
+        return NULL;
+    }
 
     // Add the gamepad to list
     ++gamepad->ref_count;
@@ -3389,16 +3582,11 @@ bool SDL_GamepadHasAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
 
     SDL_LockJoysticks();
     {
-        int i;
-
         CHECK_GAMEPAD_MAGIC(gamepad, false);
 
-        for (i = 0; i < gamepad->num_bindings; ++i) {
-            const SDL_GamepadBinding *binding = &gamepad->bindings[i];
-            if (binding->output_type == SDL_GAMEPAD_BINDTYPE_AXIS && binding->output.axis.axis == axis) {
-                result = true;
-                break;
-            }
+        if (axis >= 0 && axis < SDL_GAMEPAD_AXIS_COUNT) {
+            const int output = SDL_GAMEPAD_OUTPUT_AXIS(axis);
+            result = (gamepad->output_binding_offsets[output + 1] > gamepad->output_binding_offsets[output]);
         }
     }
     SDL_UnlockJoysticks();
@@ -3406,6 +3594,58 @@ bool SDL_GamepadHasAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
     return result;
 }
 
+static Sint16 SDL_GetGamepadAxisInternal(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
+{
+    const int output = SDL_GAMEPAD_OUTPUT_AXIS(axis);
+    int i;
+
+    SDL_AssertJoysticksLocked();
+
+    for (i = gamepad->output_binding_offsets[output]; i < gamepad->output_binding_offsets[output + 1]; ++i) {
+        const SDL_GamepadBinding *binding = &gamepad->bindings[gamepad->output_bindings[i]];
+        int value = 0;
+        bool valid_input_range;
+        bool valid_output_range;
+
+        if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
+            value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
+            if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
+                valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
+            } else {
+                valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
+            }
+            if (valid_input_range) {
+                if (binding->input.axis.axis_min != binding->output.axis.axis_min || binding->input.axis.axis_max != binding->output.axis.axis_max) {
+                    float normalized_value = (float)(value - binding->input.axis.axis_min) / (binding->input.axis.axis_max - binding->input.axis.axis_min);
+                    value = binding->output.axis.axis_min + (int)(normalized_value * (binding->output.axis.axis_max - binding->output.axis.axis_min));
+                }
+            } else {
+                value = 0;
+            }
+        } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
+            if (SDL_GetJoystickButton(gamepad->joystick, binding->input.button)) {
+                value = binding->output.axis.axis_max;
+            }
+        } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
+            int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
+            if (hat_mask & binding->input.hat.hat_mask) {
+                value = binding->output.axis.axis_max;
+            }
+        }
+
+        if (binding->output.axis.axis_min < binding->output.axis.axis_max) {
+            valid_output_range = (value >= binding->output.axis.axis_min && value <= binding->output.axis.axis_max);
+        } else {
+            valid_output_range = (value >= binding->output.axis.axis_max && value <= binding->output.axis.axis_min);
+        }
+        // If the value is zero, there might be another binding that makes it non-zero
+        if (value != 0 && valid_output_range) {
+            return (Sint16)value;
+        }
+    }
+    return 0;
+}
+
 /*
  * Get the current state of an axis control on a gamepad
  */
@@ -3415,54 +3655,10 @@ Sint16 SDL_GetGamepadAxis(SDL_Gamepad *gamepad, SDL_GamepadAxis axis)
 
     SDL_LockJoysticks();
     {
-        int i;
-
         CHECK_GAMEPAD_MAGIC(gamepad, 0);
 
-        for (i = 0; i < gamepad->num_bindings; ++i) {
-            const SDL_GamepadBinding *binding = &gamepad->bindings[i];
-            if (binding->output_type == SDL_GAMEPAD_BINDTYPE_AXIS && binding->output.axis.axis == axis) {
-                int value = 0;
-                bool valid_input_range;
-                bool valid_output_range;
-
-                if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
-                    value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
-                    if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
-                        valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
-                    } else {
-                        valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
-                    }
-                    if (valid_input_range) {
-                        if (binding->input.axis.axis_min != binding->output.axis.axis_min || binding->input.axis.axis_max != binding->output.axis.axis_max) {
-                            float normalized_value = (float)(value - binding->input.axis.axis_min) / (binding->input.axis.axis_max - binding->input.axis.axis_min);
-                            value = binding->output.axis.axis_min + (int)(normalized_value * (binding->output.axis.axis_max - binding->output.axis.axis_min));
-                        }
-                    } else {
-                        value = 0;
-                    }
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
-                    if (SDL_GetJoystickButton(gamepad->joystick, binding->input.button)) {
-                        value = binding->output.axis.axis_max;
-                    }
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
-                    int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
-                    if (hat_mask & binding->input.hat.hat_mask) {
-                        value = binding->output.axis.axis_max;
-                    }
-                }
-
-                if (binding->output.axis.axis_min < binding->output.axis.axis_max) {
-                    valid_output_range = (value >= binding->output.axis.axis_min && value <= binding->output.axis.axis_max);
-                } else {
-                    valid_output_range = (value >= binding->output.axis.axis_max && value <= binding->output.axis.axis_min);
-                }
-                // If the value is zero, there might be another binding that makes it non-zero
-                if (value != 0 && valid_output_range) {
-                    result = (Sint16)value;
-                    break;
-                }
-            }
+        if (axis >= 0 && axis < SDL_GAMEPAD_AXIS_COUNT) {
+            result = SDL_GetGamepadAxisInternal(gamepad, axis);
         }
     }
     SDL_UnlockJoysticks();
@@ -3479,16 +3675,11 @@ bool SDL_GamepadHasButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
 
     SDL_LockJoysticks();
     {
-        int i;
-
         CHECK_GAMEPAD_MAGIC(gamepad, false);
 
-        for (i = 0; i < gamepad->num_bindings; ++i) {
-            const SDL_GamepadBinding *binding = &gamepad->bindings[i];
-            if (binding->output_type == SDL_GAMEPAD_BINDTYPE_BUTTON && binding->output.button == button) {
-                result = true;
-                break;
-            }
+        if (button >= 0 && button < SDL_GAMEPAD_BUTTON_COUNT) {
+            const int output = SDL_GAMEPAD_OUTPUT_BUTTON(button);
+            result = (gamepad->output_binding_offsets[output + 1] > gamepad->output_binding_offsets[output]);
         }
     }
     SDL_UnlockJoysticks();
@@ -3496,6 +3687,42 @@ bool SDL_GamepadHasButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
     return result;
 }
 
+static bool SDL_GetGamepadButtonInternal(SDL_Gamepad *gamepad, SDL_GamepadButton button)
+{
+    const int output = SDL_GAMEPAD_OUTPUT_BUTTON(button);
+    bool result = false;
+    int i;
+
+    SDL_AssertJoysticksLocked();
+
+    for (i = gamepad->output_binding_offsets[output]; i < gamepad->output_binding_offsets[output + 1]; ++i) {
+        const SDL_GamepadBinding *binding = &gamepad->bindings[gamepad->output_bindings[i]];
+        if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
+            bool valid_input_range;
+
+            int value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
+            int threshold = binding->input.axis.axis_min + (binding->input.axis.axis_max - binding->input.axis.axis_min) / 2;
+            if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
+                valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
+                if (valid_input_range) {
+                    result |= (value >= threshold);
+                }
+            } else {
+                valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
+                if (valid_input_range) {
+                    result |= (value <= threshold);
+                }
+            }
+        } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
+            result |= SDL_GetJoystickButton(gamepad->joystick, binding->input.button);
+        } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
+            int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
+            result |= ((hat_mask & binding->input.hat.hat_mask) != 0);
+        }
+    }
+    return result;
+}
+
 /*
  * Get the current state of a button on a gamepad
  */
@@ -3505,36 +3732,10 @@ bool SDL_GetGamepadButton(SDL_Gamepad *gamepad, SDL_GamepadButton button)
 
     SDL_LockJoysticks();
     {
-        int i;
-
         CHECK_GAMEPAD_MAGIC(gamepad, false);
 
-        for (i = 0; i < gamepad->num_bindings; ++i) {
-            const SDL_GamepadBinding *binding = &gamepad->bindings[i];
-            if (binding->output_type == SDL_GAMEPAD_BINDTYPE_BUTTON && binding->output.button == button) {
-                if (binding->input_type == SDL_GAMEPAD_BINDTYPE_AXIS) {
-                    bool valid_input_range;
-
-                    int value = SDL_GetJoystickAxis(gamepad->joystick, binding->input.axis.axis);
-                    int threshold = binding->input.axis.axis_min + (binding->input.axis.axis_max - binding->input.axis.axis_min) / 2;
-                    if (binding->input.axis.axis_min < binding->input.axis.axis_max) {
-                        valid_input_range = (value >= binding->input.axis.axis_min && value <= binding->input.axis.axis_max);
-                        if (valid_input_range) {
-                            result |= (value >= threshold);
-                        }
-                    } else {
-                        valid_input_range = (value >= binding->input.axis.axis_max && value <= binding->input.axis.axis_min);
-                        if (valid_input_range) {
-                            result |= (value <= threshold);
-                        }
-                    }
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
-                    result |= SDL_GetJoystickButton(gamepad->joystick, binding->input.button);
-                } else if (binding->input_type == SDL_GAMEPAD_BINDTYPE_HAT) {
-                    int hat_mask = SDL_GetJoystickHat(gamepad->joystick, binding->input.hat.hat);
-                    result |= ((hat_mask & binding->input.hat.hat_mask) != 0);
-                }
-            }
+        if (button >= 0 && button < SDL_GAMEPAD_BUTTON_COUNT) {
+            result = SDL_GetGamepadButtonInternal(gamepad, button);
         }
     }
     SDL_UnlockJoysticks();
@@ -3917,6 +4118,65 @@ bool SDL_GetGamepadSensorData(SDL_Gamepad *gamepad, SDL_SensorType type, float *
     return SDL_Unsupported();
 }
 
+/*
+ *  Get a snapshot of the current state of a gamepad.
+ */
+SDL_COMPILE_TIME_ASSERT(SDL_GamepadState_axes, SDL_GAMEPAD_AXIS_COUNT <= SDL_GAMEPAD_STATE_MAX_AXES);
+SDL_COMPILE_TIME_ASSERT(SDL_GamepadState_buttons, SDL_GAMEPAD_BUTTON_COUNT <= 64);
+SDL_COMPILE_TIME_ASSERT(SDL_GamepadState_sensors, SDL_SENSOR_COUNT <= SDL_GAMEPAD_STATE_MAX_SENSORS);
+
+bool SDL_GetGamepadState(SDL_Gamepad *gamepad, SDL_GamepadState *state)
+{
+    CHECK_PARAM(!state) {
+        return SDL_InvalidParamError("state");
+    }
+
+    SDL_zerop(state);
+
+    SDL_LockJoysticks();
+    {
+        SDL_Joystick *joystick;
+        int i, j;
+
+        CHECK_GAMEPAD_MAGIC(gamepad, false);
+
+        for (i = 0; i < SDL_GAMEPAD_AXIS_COUNT; ++i) {
+            state->axes[i] = SDL_GetGamepadAxisInternal(gamepad, (SDL_GamepadAxis)i);
+        }
+        for (i = 0; i < SDL_GAMEPAD_BUTTON_COUNT; ++i) {
+            if (SDL_GetGamepadButtonInternal(gamepad, (SDL_GamepadButton)i)) {
+                state->buttons |= SDL_GAMEPAD_BUTTON_MASK(i);
+            }
+        }
+
+        joystick = gamepad->joystick;
+        for (i = 0; i < joystick->ntouchpads; ++i) {
+            const SDL_JoystickTouchpadInfo *touchpad = &joystick->touchpads[i];
+            for (j = 0; j < touchpad->nfingers && state->num_fingers < SDL_GAMEPAD_STATE_MAX_FINGERS; ++j) {
+                const SDL_JoystickTouchpadFingerInfo *info = &touchpad->fingers[j];
+                SDL_GamepadFingerState *finger = &state->fingers[state->num_fingers++];
+                finger->touchpad = (Uint8)i;
+                finger->finger = (Uint8)j;
+                finger->down = info->down;
+                finger->x = info->x;
+                finger->y = info->y;
+                finger->pressure = info->pressure;
+            }
+        }
+
+        for (i = 0; i < joystick->nsensors; ++i) {
+            const SDL_JoystickSensorInfo *sensor = &joystick->sensors[i];
+            if (sensor->enabled && sensor->type > SDL_SENSOR_UNKNOWN && sensor->type < SDL_SENSOR_COUNT) {
+                state->sensors |= (1u << sensor->type);
+                SDL_memcpy(state->sensor_data[sensor->type], sensor->data, sizeof(state->sensor_data[sensor->type]));
+            }
+        }
+    }
+    SDL_UnlockJoysticks();
+
+    return true;
+}
+
 SDL_JoystickID SDL_GetGamepadID(SDL_Gamepad *gamepad)
 {
     SDL_Joystick *joystick = SDL_GetGamepadJoystick(gamepad);
@@ -4301,6 +4561,7 @@ void SDL_CloseGamepad(SDL_Gamepad *gamepad)
 
     SDL_SetObjectValid(gamepad, SDL_OBJECT_TYPE_GAMEPAD, false);
     SDL_free(gamepad->bindings);
+    SDL_free(gamepad->output_bindings);
     SDL_free(gamepad->last_match_axis);
     SDL_free(gamepad->last_hat_mask);
     SDL_free(gamepad);
@@ -4344,13 +4605,20 @@ void SDL_QuitGamepadMappings(void)
 
     SDL_AssertJoysticksLocked();
 
+    if (s_gamepadMappingsByGUID) {
+        SDL_DestroyHashTable(s_gamepadMappingsByGUID);
+        s_gamepadMappingsByGUID = NULL;
+    }
+
     while (s_pSupportedGamepads) {
         pGamepadMap = s_pSupportedGamepads;
         s_pSupportedGamepads = s_pSupportedGamepads->next;
         SDL_free(pGamepadMap->name);
         SDL_free(pGamepadMap->mapping);
+        SDL_free(pGamepadMap->bindings);
         SDL_free(pGamepadMap);
     }
+    s_pSupportedGamepadsTail = NULL;
 
     SDL_FreeVIDPIDList(&SDL_allowed_gamepads);
     SDL_FreeVIDPIDList(&SDL_ignored_gamepads);
@@ -24,6 +24,7 @@
 
 #include "SDL_sysjoystick.h"
 #include "../SDL_hints_c.h"
+#include "../SDL_trace_c.h"
 #include "SDL_gamepad_c.h"
 #include "SDL_joystick_c.h"
 #include "SDL_steam_virtual_gamepad.h"
@@ -2749,6 +2750,8 @@ void SDL_UpdateJoysticks(void)
 
     SDL_LockJoysticks();
 
+    SDL_TRACE_ZONE_BEGIN(trace_zone, "SDL_UpdateJoysticks");
+
     if (SDL_UpdateSteamVirtualGamepadInfo()) {
         SendSteamHandleUpdateEvents();
     }
@@ -2819,6 +2822,8 @@ void SDL_UpdateJoysticks(void)
         SDL_joystick_drivers[i]->Detect();
     }
 
+    SDL_TRACE_ZONE_END(trace_zone, "SDL_UpdateJoysticks");
+
     SDL_UnlockJoysticks();
 }
 
@@ -36,6 +36,12 @@
 #include <sys/inotify.h>
 #include <string.h> // strerror
 #endif
+#if defined(HAVE_EPOLL) && defined(HAVE_EVENTFD)
+#define SDL_JOYSTICK_LINUX_INPUT_THREAD
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <string.h> // strerror
+#endif
 #include <sys/ioctl.h>
 #include <unistd.h>
 #include <dirent.h>
@@ -195,6 +201,299 @@ static int inotify_fd = -1;
 static Uint64 last_joy_detect_time;
 static time_t last_input_dir_mtime;
 
+#ifdef SDL_JOYSTICK_LINUX_INPUT_THREAD
+
+/* When SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD is set, a thread waits for input on
+   all open event devices and queues the events as they arrive. The queued events
+   are handled by LINUX_JoystickUpdate() just like events read from the device. */
+#define INPUT_RING_SIZE 1024 // must be a power of two
+
+typedef struct LINUX_InputRing
+{
+    int fd;
+    SDL_AtomicU32 head;     // written by the input thread
+    SDL_AtomicU32 tail;     // written by the joystick update
+    SDL_AtomicInt overflow; // events were dropped because the ring was full
+    SDL_AtomicInt gone;     // the device was unplugged
+    struct input_event events[INPUT_RING_SIZE];
+} LINUX_InputRing;
+
+static SDL_Thread *input_thread = NULL;
+static SDL_Mutex *input_thread_lock = NULL;
+static SDL_AtomicInt input_thread_quit;
+static int input_epoll_fd = -1;
+static int input_wakeup_fd = -1;
+static LINUX_InputRing **input_rings SDL_GUARDED_BY(input_thread_lock) = NULL;
+static int num_input_rings SDL_GUARDED_BY(input_thread_lock) = 0;
+
+static void FillInputRing(LINUX_InputRing *ring)
+{
+    struct input_event events[32];
+    int i, len;
+
+    while ((len = read(ring->fd, events, sizeof(events))) > 0) {
+        Uint32 head = SDL_GetAtomicU32(&ring->head);
+        Uint32 tail = SDL_GetAtomicU32(&ring->tail);
+
+        len /= sizeof(events[0]);
+        for (i = 0; i < len; ++i) {
+            if ((head - tail) == INPUT_RING_SIZE) {
+                // The joystick update will resync with the device state when it catches up
+                SDL_SetAtomicInt(&ring->overflow, 1);
+                break;
+            }
+            ring->events[head & (INPUT_RING_SIZE - 1)] = events[i];
+            ++head;
+        }
+        SDL_SetAtomicU32(&ring->head, head);
+    }
+
+    if (len < 0 && errno == ENODEV) {
+        // Stop waiting on the device, it will be removed in the next joystick detect
+        epoll_ctl(input_epoll_fd, EPOLL_CTL_DEL, ring->fd, NULL);
+        SDL_SetAtomicInt(&ring->gone, 1);
+    }
+}
+
+static int ReadInputRing(LINUX_InputRing *ring, struct input_event *events, int maxevents)
+{
+    Uint32 head = SDL_GetAtomicU32(&ring->head);
+    Uint32 tail = SDL_GetAtomicU32(&ring->tail);
+    int count = 0;
+
+    while (tail != head && count < maxevents) {
+        events[count++] = ring->events[tail & (INPUT_RING_SIZE - 1)];
+        ++tail;
+    }
+    SDL_SetAtomicU32(&ring->tail, tail);
+
+    if (count == 0 && maxevents >= 2 && SDL_CompareAndSwapAtomicInt(&ring->overflow, 1, 0)) {
+        // Report the dropped events the same way the kernel does, so we poll the current state
+        SDL_zerop(&events[0]);
+        events[0].type = EV_SYN;
+        events[0].code = SYN_DROPPED;
+        SDL_zerop(&events[1]);
+        events[1].type = EV_SYN;
+        events[1].code = SYN_REPORT;
+        count = 2;
+    }
+    return count;
+}
+
+// Read events from the input ring, if there is one, otherwise directly from the device
+static int ReadJoystickEvents(int fd, LINUX_InputRing *ring, struct input_event *events, size_t size)
+{
+    if (ring) {
+        int count = ReadInputRing(ring, events, (int)(size / sizeof(*events)));
+        if (count > 0) {
+            return count * (int)sizeof(*events);
+        }
+        errno = SDL_GetAtomicInt(&ring->gone) ? ENODEV : EAGAIN;
+        return -1;
+    }
+    return (int)read(fd, events, size);
+}
+
+static int SDLCALL LINUX_InputThread(void *data)
+{
+    struct epoll_event events[16];
+    int i, j, count;
+
+    SDL_SetCurrentThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    while (!SDL_GetAtomicInt(&input_thread_quit)) {
+        count = epoll_wait(input_epoll_fd, events, SDL_arraysize(events), -1);
+        if (count < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        SDL_LockMutex(input_thread_lock);
+        for (i = 0; i < count; ++i) {
+            // Look the device up by fd, it may have been closed since epoll_wait() returned
+            for (j = 0; j < num_input_rings; ++j) {
+                if (input_rings[j]->fd == events[i].data.fd) {
+                    FillInputRing(input_rings[j]);
+                    break;
+                }
+            }
+        }
+        SDL_UnlockMutex(input_thread_lock);
+    }
+    return 0;
+}
+
+static void StopInputThread(void)
+{
+    int i;
+
+    if (input_thread) {
+        Uint64 value = 1;
+
+        SDL_SetAtomicInt(&input_thread_quit, 1);
+        if (write(input_wakeup_fd, &value, sizeof(value)) < 0) {
+            // The thread is already awake
+        }
+        SDL_WaitThread(input_thread, NULL);
+        input_thread = NULL;
+    }
+
+    if (input_wakeup_fd >= 0) {
+        close(input_wakeup_fd);
+        input_wakeup_fd = -1;
+    }
+    if (input_epoll_fd >= 0) {
+        close(input_epoll_fd);
+        input_epoll_fd = -1;
+    }
+
+    for (i = 0; i < num_input_rings; ++i) {
+        SDL_free(input_rings[i]);
+    }
+    SDL_free(input_rings);
+    input_rings = NULL;
+    num_input_rings = 0;
+
+    if (input_thread_lock) {
+        SDL_DestroyMutex(input_thread_lock);
+        input_thread_lock = NULL;
+    }
+}
+
+static bool StartInputThread(void)
+{
+    struct epoll_event event;
+
+    SDL_SetAtomicInt(&input_thread_quit, 0);
+
+    input_thread_lock = SDL_CreateMutex();
+    if (!input_thread_lock) {
+        goto error;
+    }
+
+    input_epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+    if (input_epoll_fd < 0) {
+        SDL_SetError("Couldn't create epoll instance: %s", strerror(errno));
+        goto error;
+    }
+
+    input_wakeup_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (input_wakeup_fd < 0) {
+        SDL_SetError("Couldn't create eventfd: %s", strerror(errno));
+        goto error;
+    }
+    SDL_zero(event);
+    event.events = EPOLLIN;
+    event.data.fd = input_wakeup_fd;
+    if (epoll_ctl(input_epoll_fd, EPOLL_CTL_ADD, input_wakeup_fd, &event) < 0) {
+        SDL_SetError("Couldn't add eventfd to epoll: %s", strerror(errno));
+        goto error;
+    }
+
+    input_thread = SDL_CreateThread(LINUX_InputThread, "SDL joystick input", NULL);
+    if (!input_thread) {
+        goto error;
+    }
+    return true;
+
+error:
+    StopInputThread();
+    return false;
+}
+
+static void StopReadingInput(LINUX_InputRing *ring)
+{
+    int i;
+
+    if (!ring) {
+        return;
+    }
+
+    // This needs to happen before the device is closed
+    epoll_ctl(input_epoll_fd, EPOLL_CTL_DEL, ring->fd, NULL);
+
+    SDL_LockMutex(input_thread_lock);
+    for (i = 0; i < num_input_rings; ++i) {
+        if (input_rings[i] == ring) {
+            input_rings[i] = input_rings[--num_input_rings];
+            break;
+        }
+    }
+    SDL_UnlockMutex(input_thread_lock);
+
+    SDL_free(ring);
+}
+
+// Start reading the device on the input thread, returns NULL if the thread isn't running
+static LINUX_InputRing *StartReadingInput(int fd)
+{
+    LINUX_InputRing *ring, **rings;
+    struct epoll_event event;
+
+    if (!input_thread || fd < 0) {
+        return NULL;
+    }
+
+    ring = (LINUX_InputRing *)SDL_calloc(1, sizeof(*ring));
+    if (!ring) {
+        return NULL;
+    }
+    ring->fd = fd;
+
+    SDL_LockMutex(input_thread_lock);
+    rings = (LINUX_InputRing **)SDL_realloc(input_rings, (num_input_rings + 1) * sizeof(*rings));
+    if (rings) {
+        input_rings = rings;
+        input_rings[num_input_rings++] = ring;
+    }
+    SDL_UnlockMutex(input_thread_lock);
+    if (!rings) {
+        SDL_free(ring);
+        return NULL;
+    }
+
+    SDL_zero(event);
+    event.events = EPOLLIN;
+    event.data.fd = fd;
+    if (epoll_ctl(input_epoll_fd, EPOLL_CTL_ADD, fd, &event) < 0) {
+        StopReadingInput(ring);
+        return NULL;
+    }
+    return ring;
+}
+
+#else
+
+// Without epoll and eventfd (e.g. FreeBSD), input is always read when joysticks are updated
+typedef struct LINUX_InputRing LINUX_InputRing;
+
+static int ReadJoystickEvents(int fd, LINUX_InputRing *ring, struct input_event *events, size_t size)
+{
+    return (int)read(fd, events, size);
+}
+
+static bool StartInputThread(void)
+{
+    return SDL_Unsupported();
+}
+
+static void StopInputThread(void)
+{
+}
+
+static LINUX_InputRing *StartReadingInput(int fd)
+{
+    return NULL;
+}
+
+static void StopReadingInput(LINUX_InputRing *ring)
+{
+}
+
+#endif // SDL_JOYSTICK_LINUX_INPUT_THREAD
+
 static void FixupDeviceInfoForMapping(int fd, struct input_id *inpid)
 {
     if (inpid->vendor == 0x045e && inpid->product == 0x0b05 && inpid->version == 0x0903) {
@@ -1003,6 +1302,12 @@ static bool LINUX_JoystickInit(void)
 
     SDL_classic_joysticks = SDL_GetHintBoolean(SDL_HINT_JOYSTICK_LINUX_CLASSIC, false);
 
+    if (!SDL_classic_joysticks && SDL_GetHintBoolean(SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD, false)) {
+        if (!StartInputThread()) {
+            SDL_LogWarn(SDL_LOG_CATEGORY_INPUT, "Couldn't start joystick input thread, reading input on update: %s", SDL_GetError());
+        }
+    }
+
     enumeration_method = ENUMERATION_UNSET;
 
     // First see if the user specified one or more joysticks to use
@@ -1618,6 +1923,10 @@ static bool LINUX_JoystickOpen(SDL_Joystick *joystick, int device_index)
     joystick->serial = SDL_UDEV_GetProductSerial(item->path);
 #endif
 
+    if (!joystick->hwdata->classic) {
+        joystick->hwdata->ring = StartReadingInput(joystick->hwdata->fd);
+    }
+
     // mark joystick as fresh and ready
     joystick->hwdata->fresh = true;
 
@@ -1717,8 +2026,11 @@ static bool LINUX_JoystickSetSensorsEnabled(SDL_Joystick *joystick, bool enabled
             return SDL_SetError("Couldn't open sensor file %s.", joystick->hwdata->item_sensor->path);
         }
         fcntl(joystick->hwdata->fd_sensor, F_SETFL, O_NONBLOCK);
+        joystick->hwdata->ring_sensor = StartReadingInput(joystick->hwdata->fd_sensor);
     } else {
         SDL_assert(joystick->hwdata->fd_sensor >= 0);
+        StopReadingInput(joystick->hwdata->ring_sensor);
+        joystick->hwdata->ring_sensor = NULL;
         close(joystick->hwdata->fd_sensor);
         joystick->hwdata->fd_sensor = -1;
     }
@@ -1727,7 +2039,8 @@ static bool LINUX_JoystickSetSensorsEnabled(SDL_Joystick *joystick, bool enabled
     return true;
 }
 
-static void HandleHat(Uint64 timestamp, SDL_Joystick *stick, int hatidx, int axis, int value)
+// Returns true if the hat position changed
+static bool HandleHat(Uint64 timestamp, SDL_Joystick *stick, int hatidx, int axis, int value)
 {
     int hatnum;
     struct hwdata_hat *the_hat;
@@ -1773,7 +2086,9 @@ static void HandleHat(Uint64 timestamp, SDL_Joystick *stick, int hatidx, int axi
         the_hat->axis[axis] = value;
         SDL_SendJoystickHat(timestamp, stick, hatnum,
                                position_map[the_hat->axis[1]][the_hat->axis[0]]);
+        return true;
     }
+    return false;
 }
 
 static void HandleBall(SDL_Joystick *stick, Uint8 ball, int axis, int value)
@@ -1818,6 +2133,41 @@ static int AxisCorrect(SDL_Joystick *joystick, int which, int value)
     return value;
 }
 
+// Send the axis values that changed in the last input report
+static void SendPendingAxes(SDL_Joystick *joystick)
+{
+    struct joystick_hwdata *hwdata = joystick->hwdata;
+    Uint64 mask = hwdata->pending_abs_mask;
+    int code;
+
+    SDL_AssertJoysticksLocked();
+
+    for (code = 0; mask; ++code, mask >>= 1) {
+        if (mask & 1) {
+            SDL_SendJoystickAxis(hwdata->pending_abs_timestamp, joystick, hwdata->abs_map[code], hwdata->pending_abs[code]);
+            ++hwdata->events_delivered;
+        }
+    }
+    hwdata->pending_abs_mask = 0;
+}
+
+// Publish the input counters in the joystick properties, if they changed
+static void UpdateInputCounters(SDL_Joystick *joystick)
+{
+    struct joystick_hwdata *hwdata = joystick->hwdata;
+
+    SDL_AssertJoysticksLocked();
+
+    if (hwdata->events_read != hwdata->published_events_read ||
+        hwdata->events_delivered != hwdata->published_events_delivered) {
+        SDL_PropertiesID props = SDL_GetJoystickProperties(joystick);
+        SDL_SetNumberProperty(props, SDL_PROP_JOYSTICK_INPUT_EVENTS_READ_NUMBER, (Sint64)hwdata->events_read);
+        SDL_SetNumberProperty(props, SDL_PROP_JOYSTICK_INPUT_EVENTS_DELIVERED_NUMBER, (Sint64)hwdata->events_delivered);
+        hwdata->published_events_read = hwdata->events_read;
+        hwdata->published_events_delivered = hwdata->events_delivered;
+    }
+}
+
 static void PollAllValues(Uint64 timestamp, SDL_Joystick *joystick)
 {
     struct input_absinfo absinfo;
@@ -1932,7 +2282,8 @@ static void PollAllSensors(Uint64 timestamp, SDL_Joystick *joystick)
 
 static void HandleInputEvents(SDL_Joystick *joystick)
 {
-    struct input_event events[32];
+    // Read in large batches, a busy gamepad with sensors can report thousands of events a second
+    struct input_event events[128];
     int i, len, code, hat_index;
 
     SDL_AssertJoysticksLocked();
@@ -1948,13 +2299,15 @@ static void HandleInputEvents(SDL_Joystick *joystick)
 
     errno = 0;
 
-    while ((len = read(joystick->hwdata->fd, events, sizeof(events))) > 0) {
+    while ((len = ReadJoystickEvents(joystick->hwdata->fd, joystick->hwdata->ring, events, sizeof(events))) > 0) {
         len /= sizeof(events[0]);
         for (i = 0; i < len; ++i) {
             struct input_event *event = &events[i];
 
             code = event->code;
 
+            ++joystick->hwdata->events_read;
+
             /* If the kernel sent a SYN_DROPPED, we are supposed to ignore the
                rest of the packet (the end of it signified by a SYN_REPORT) */
             if (joystick->hwdata->recovering_from_dropped &&
@@ -1970,6 +2323,7 @@ static void HandleInputEvents(SDL_Joystick *joystick)
                 SDL_SendJoystickButton(SDL_EVDEV_GetEventTimestamp(event), joystick,
                                           joystick->hwdata->key_map[code],
                                           (event->value != 0));
+                ++joystick->hwdata->events_delivered;
                 break;
             case EV_ABS:
                 switch (code) {
@@ -1986,7 +2340,9 @@ static void HandleInputEvents(SDL_Joystick *joystick)
 #ifdef DEBUG_INPUT_EVENTS
                         SDL_Log("Axis 0x%.2x = %d", code, event->value);
 #endif
-                        HandleHat(SDL_EVDEV_GetEventTimestamp(event), joystick, hat_index, code % 2, event->value);
+                        if (HandleHat(SDL_EVDEV_GetEventTimestamp(event), joystick, hat_index, code % 2, event->value)) {
+                            ++joystick->hwdata->events_delivered;
+                        }
                         break;
                     }
                     SDL_FALLTHROUGH;
@@ -1994,10 +2350,13 @@ static void HandleInputEvents(SDL_Joystick *joystick)
 #ifdef DEBUG_INPUT_EVENTS
                     SDL_Log("Axis 0x%.2x = %d", code, event->value);
 #endif
-                    event->value = AxisCorrect(joystick, code, event->value);
-                    SDL_SendJoystickAxis(SDL_EVDEV_GetEventTimestamp(event), joystick,
-                                            joystick->hwdata->abs_map[code],
-                                            event->value);
+                    if (code >= ABS_MAX) {
+                        break;
+                    }
+                    // Only the last value of each axis in a report is sent, when the report is complete
+                    joystick->hwdata->pending_abs[code] = AxisCorrect(joystick, code, event->value);
+                    joystick->hwdata->pending_abs_mask |= ((Uint64)1 << code);
+                    joystick->hwdata->pending_abs_timestamp = SDL_EVDEV_GetEventTimestamp(event);
                     break;
                 }
                 break;
@@ -2019,11 +2378,14 @@ static void HandleInputEvents(SDL_Joystick *joystick)
                     SDL_Log("Event SYN_DROPPED detected");
 #endif
                     joystick->hwdata->recovering_from_dropped = true;
+                    joystick->hwdata->pending_abs_mask = 0;
                     break;
                 case SYN_REPORT:
                     if (joystick->hwdata->recovering_from_dropped) {
                         joystick->hwdata->recovering_from_dropped = false;
                         PollAllValues(SDL_GetTicksNS(), joystick); // try to sync up to current state now
+                    } else {
+                        SendPendingAxes(joystick);
                     }
                     break;
                 default:
@@ -2045,7 +2407,7 @@ static void HandleInputEvents(SDL_Joystick *joystick)
     if (joystick->hwdata->report_sensor) {
         SDL_assert(joystick->hwdata->fd_sensor >= 0);
 
-        while ((len = read(joystick->hwdata->fd_sensor, events, sizeof(events))) > 0) {
+        while ((len = ReadJoystickEvents(joystick->hwdata->fd_sensor, joystick->hwdata->ring_sensor, events, sizeof(events))) > 0) {
             len /= sizeof(events[0]);
             for (i = 0; i < len; ++i) {
                 unsigned int j;
@@ -2053,6 +2415,8 @@ static void HandleInputEvents(SDL_Joystick *joystick)
 
                 code = event->code;
 
+                ++joystick->hwdata->events_read;
+
                 /* If the kernel sent a SYN_DROPPED, we are supposed to ignore the
                    rest of the packet (the end of it signified by a SYN_REPORT) */
                 if (joystick->hwdata->recovering_from_dropped_sensor &&
@@ -2118,6 +2482,7 @@ static void HandleInputEvents(SDL_Joystick *joystick)
                             SDL_SendJoystickSensor(timestamp, joystick, SDL_SENSOR_ACCEL,
                                                    SDL_US_TO_NS(joystick->hwdata->sensor_tick),
                                                    data, 3);
+                            joystick->hwdata->events_delivered += 2;
                         }
                         break;
                     default:
@@ -2194,6 +2559,7 @@ static void LINUX_JoystickUpdate(SDL_Joystick *joystick)
         HandleClassicEvents(joystick);
     } else {
         HandleInputEvents(joystick);
+        UpdateInputCounters(joystick);
     }
 
     // Deliver ball motion updates
@@ -2220,6 +2586,8 @@ static void LINUX_JoystickClose(SDL_Joystick *joystick)
             ioctl(joystick->hwdata->fd, EVIOCRMFF, joystick->hwdata->effect.id);
             joystick->hwdata->effect.id = -1;
         }
+        StopReadingInput(joystick->hwdata->ring);
+        StopReadingInput(joystick->hwdata->ring_sensor);
         if (joystick->hwdata->fd >= 0) {
             close(joystick->hwdata->fd);
         }
@@ -2256,6 +2624,8 @@ static void LINUX_JoystickQuit(void)
         inotify_fd = -1;
     }
 
+    StopInputThread();
+
     for (item = SDL_joylist; item; item = next) {
         next = item->next;
         FreeJoylistItem(item);
@@ -26,6 +26,7 @@
 
 struct SDL_joylist_item;
 struct SDL_sensorlist_item;
+struct LINUX_InputRing;
 
 // The private structure used to keep track of a joystick
 struct joystick_hwdata
@@ -35,6 +36,9 @@ struct joystick_hwdata
     int fd_sensor;
     struct SDL_joylist_item *item;
     struct SDL_sensorlist_item *item_sensor;
+    // events queued by the input thread, if it's running
+    struct LINUX_InputRing *ring;
+    struct LINUX_InputRing *ring_sensor;
     SDL_GUID guid;
     char *fname; // Used in haptic subsystem
 
@@ -112,6 +116,17 @@ struct joystick_hwdata
     // Set when gamepad is pending removal due to ENODEV read error
     bool gone;
     bool sensor_gone;
+
+    // Axis values received since the last SYN_REPORT
+    int pending_abs[ABS_MAX];
+    Uint64 pending_abs_mask;
+    Uint64 pending_abs_timestamp;
+
+    // Input events read from the device and state changes sent to the application
+    Uint64 events_read;
+    Uint64 events_delivered;
+    Uint64 published_events_read;
+    Uint64 published_events_delivered;
 };
 
 #endif // SDL_sysjoystick_c_h_
@@ -63,6 +63,8 @@ SDL_Process *SDL_CreateProcessWithProperties(SDL_PropertiesID props)
         return NULL;
     }
     process->background = SDL_GetBooleanProperty(props, SDL_PROP_PROCESS_CREATE_BACKGROUND_BOOLEAN, false);
+    process->stdout_done = true;
+    process->stderr_done = true;
 
     process->props = SDL_CreateProperties();
     if (!process->props) {
@@ -103,6 +105,11 @@ void *SDL_ReadProcess(SDL_Process *process, size_t *datasize, int *exitcode)
         return NULL;
     }
 
+    if (process->output_callback) {
+        SDL_SetError("Process output is being delivered to a callback");
+        return NULL;
+    }
+
     SDL_IOStream *io = (SDL_IOStream *)SDL_GetPointerProperty(process->props, SDL_PROP_PROCESS_STDOUT_POINTER, NULL);
     if (!io) {
         SDL_SetError("Process not created with I/O enabled");
@@ -161,12 +168,69 @@ bool SDL_KillProcess(SDL_Process *process, bool force)
     return SDL_SYS_KillProcess(process, force);
 }
 
-bool SDL_WaitProcess(SDL_Process *process, bool block, int *exitcode)
+bool SDL_SetProcessOutputCallback(SDL_Process *process, SDL_ProcessOutputCallback callback, void *userdata)
 {
     CHECK_PARAM(!process) {
         return SDL_InvalidParamError("process");
     }
 
+    if (callback && !SDL_HasProperty(process->props, SDL_PROP_PROCESS_STDOUT_POINTER) &&
+                    !SDL_HasProperty(process->props, SDL_PROP_PROCESS_STDERR_POINTER)) {
+        return SDL_SetError("Process not created with standard output or standard error available");
+    }
+
+    process->output_callback = callback;
+    process->output_userdata = userdata;
+    process->stdout_done = !callback || !SDL_HasProperty(process->props, SDL_PROP_PROCESS_STDOUT_POINTER);
+    process->stderr_done = !callback || !SDL_HasProperty(process->props, SDL_PROP_PROCESS_STDERR_POINTER);
+    return true;
+}
+
+bool SDL_IsProcessFinished(SDL_Process *process)
+{
+    return !process->alive && process->stdout_done && process->stderr_done;
+}
+
+int SDL_WaitProcesses(SDL_Process **processes, int num_processes, Sint32 timeoutMS)
+{
+    CHECK_PARAM(!processes && num_processes > 0) {
+        SDL_InvalidParamError("processes");
+        return -1;
+    }
+    CHECK_PARAM(num_processes < 0) {
+        SDL_InvalidParamError("num_processes");
+        return -1;
+    }
+
+    int finished = 0;
+    for (int i = 0; i < num_processes; ++i) {
+        CHECK_PARAM(!processes[i]) {
+            SDL_InvalidParamError("processes");
+            return -1;
+        }
+        if (SDL_IsProcessFinished(processes[i])) {
+            ++finished;
+        }
+    }
+    if (finished == num_processes) {
+        return finished;
+    }
+
+    if (!SDL_SYS_WaitProcesses(processes, num_processes, timeoutMS)) {
+        return -1;
+    }
+
+    finished = 0;
+    for (int i = 0; i < num_processes; ++i) {
+        if (SDL_IsProcessFinished(processes[i])) {
+            ++finished;
+        }
+    }
+    return finished;
+}
+
+bool SDL_UpdateProcessExit(SDL_Process *process, bool block, int *exitcode)
+{
     if (!process->alive) {
         if (exitcode) {
             *exitcode = process->exitcode;
@@ -187,6 +251,24 @@ bool SDL_WaitProcess(SDL_Process *process, bool block, int *exitcode)
     return false;
 }
 
+bool SDL_WaitProcess(SDL_Process *process, bool block, int *exitcode)
+{
+    CHECK_PARAM(!process) {
+        return SDL_InvalidParamError("process");
+    }
+
+    if (process->output_callback) {
+        // Keep the output flowing, otherwise the process could block on a full pipe
+        do {
+            if (SDL_WaitProcesses(&process, 1, block ? -1 : 0) < 0) {
+                return false;
+            }
+        } while (block && !SDL_IsProcessFinished(process));
+    }
+
+    return SDL_UpdateProcessExit(process, block, exitcode);
+}
+
 void SDL_DestroyProcess(SDL_Process *process)
 {
     if (!process) {
@@ -195,7 +277,7 @@ void SDL_DestroyProcess(SDL_Process *process)
 
     // Check to see if the process has exited, will reap zombies on POSIX platforms
     if (process->alive) {
-        SDL_WaitProcess(process, false, NULL);
+        SDL_UpdateProcessExit(process, false, NULL);
     }
 
     SDL_SYS_DestroyProcess(process);
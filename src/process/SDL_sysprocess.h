@@ -31,12 +31,27 @@ struct SDL_Process
     bool background;
     int exitcode;
     SDL_PropertiesID props;
+    SDL_ProcessOutputCallback output_callback;
+    void *output_userdata;
+    bool stdout_done;   // stdout isn't piped to a callback, or has reached end of file
+    bool stderr_done;   // stderr isn't piped to a callback, or has reached end of file
     SDL_ProcessData *internal;
 };
 
+// Size of the buffer output is read into before it's handed to the callback
+#define SDL_PROCESS_OUTPUT_CHUNK_SIZE (64 * 1024)
+
+// Reap the process if it has exited, without delivering any output
+extern bool SDL_UpdateProcessExit(SDL_Process *process, bool block, int *exitcode);
+extern bool SDL_IsProcessFinished(SDL_Process *process);
+
 bool SDL_SYS_CreateProcessWithProperties(SDL_Process *process, SDL_PropertiesID props);
 bool SDL_SYS_KillProcess(SDL_Process *process, bool force);
 bool SDL_SYS_WaitProcess(SDL_Process *process, bool block, int *exitcode);
 void SDL_SYS_DestroyProcess(SDL_Process *process);
 
+// Wait up to timeoutMS for output or exit on any of the processes, deliver
+// the output that is ready and reap the processes that have exited.
+bool SDL_SYS_WaitProcesses(SDL_Process **processes, int num_processes, Sint32 timeoutMS);
+
 #endif // SDL_sysprocess_h_
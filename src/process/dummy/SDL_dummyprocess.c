@@ -40,6 +40,11 @@ bool SDL_SYS_WaitProcess(SDL_Process *process, bool block, int *exitcode)
     return SDL_Unsupported();
 }
 
+bool SDL_SYS_WaitProcesses(SDL_Process **processes, int num_processes, Sint32 timeoutMS)
+{
+    return SDL_Unsupported();
+}
+
 void SDL_SYS_DestroyProcess(SDL_Process *process)
 {
     return;
@@ -30,8 +30,12 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <poll.h>
 #include <unistd.h>
 #include <sys/wait.h>
+#ifdef SDL_PLATFORM_LINUX
+#include <sys/syscall.h>
+#endif
 
 #include "../SDL_sysprocess.h"
 #include "../../io/SDL_iostream_c.h"
@@ -46,10 +50,23 @@
 #define READ_END 0
 #define WRITE_END 1
 
+// How often to check on processes that can't be waited on with poll()
+#define PROCESS_POLL_INTERVAL_MS 10
+
 struct SDL_ProcessData {
     pid_t pid;
+    int pidfd;  // readable when the process exits, or -1 if not available
 };
 
+static int OpenProcessFD(pid_t pid)
+{
+#if defined(SDL_PLATFORM_LINUX) && defined(SYS_pidfd_open)
+    return (int)syscall(SYS_pidfd_open, pid, 0);
+#else
+    return -1;
+#endif
+}
+
 static void CleanupStream(void *userdata, void *value)
 {
     SDL_Process *process = (SDL_Process *)value;
@@ -184,6 +201,7 @@ bool SDL_SYS_CreateProcessWithProperties(SDL_Process *process, SDL_PropertiesID
         SDL_free(envp);
         return false;
     }
+    data->pidfd = -1;
     process->internal = data;
 
     posix_spawnattr_t attr;
@@ -376,6 +394,7 @@ bool SDL_SYS_CreateProcessWithProperties(SDL_Process *process, SDL_PropertiesID
             SDL_SetError("posix_spawn() failed: %s", strerror(errno));
             goto posix_spawn_fail_all;
         }
+        data->pidfd = OpenProcessFD(data->pid);
     }
     SDL_SetNumberProperty(process->props, SDL_PROP_PROCESS_PID_NUMBER, data->pid);
 
@@ -489,6 +508,169 @@ bool SDL_SYS_WaitProcess(SDL_Process *process, bool block, int *exitcode)
     }
 }
 
+static int GetOutputFD(SDL_Process *process, bool is_stderr)
+{
+    SDL_IOStream *io = (SDL_IOStream *)SDL_GetPointerProperty(process->props, is_stderr ? SDL_PROP_PROCESS_STDERR_POINTER : SDL_PROP_PROCESS_STDOUT_POINTER, NULL);
+    if (!io) {
+        return -1;
+    }
+    return (int)SDL_GetNumberProperty(SDL_GetIOProperties(io), SDL_PROP_IOSTREAM_FILE_DESCRIPTOR_NUMBER, -1);
+}
+
+// Read everything that's ready on an output pipe, returns true if anything happened
+static bool DeliverOutput(SDL_Process *process, bool is_stderr, int fd, char *buffer)
+{
+    bool *done = is_stderr ? &process->stderr_done : &process->stdout_done;
+    bool activity = false;
+
+    while (!*done) {
+        const ssize_t amount = read(fd, buffer, SDL_PROCESS_OUTPUT_CHUNK_SIZE);
+        if (amount > 0) {
+            process->output_callback(process->output_userdata, process, is_stderr, buffer, (size_t)amount);
+            activity = true;
+            if (amount < SDL_PROCESS_OUTPUT_CHUNK_SIZE) {
+                break;  // the pipe is drained, don't spend a syscall finding out
+            }
+        } else if (amount < 0 && errno == EINTR) {
+            continue;
+        } else if (amount < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else {
+            // End of file or a broken pipe, either way there's no more output coming
+            *done = true;
+            process->output_callback(process->output_userdata, process, is_stderr, NULL, 0);
+            activity = true;
+        }
+    }
+    return activity;
+}
+
+typedef struct PollSource
+{
+    SDL_Process *process;
+    int kind;  // 0 = stdout, 1 = stderr, 2 = exit
+} PollSource;
+
+bool SDL_SYS_WaitProcesses(SDL_Process **processes, int num_processes, Sint32 timeoutMS)
+{
+    const Uint64 deadline = (timeoutMS > 0) ? (SDL_GetTicks() + timeoutMS) : 0;
+    struct pollfd *fds = (struct pollfd *)SDL_malloc(num_processes * 3 * sizeof(*fds));
+    PollSource *sources = (PollSource *)SDL_malloc(num_processes * 3 * sizeof(*sources));
+    char *buffer = NULL;
+    bool result = true;
+
+    if (!fds || !sources) {
+        SDL_free(fds);
+        SDL_free(sources);
+        return false;
+    }
+
+    for (;;) {
+        bool need_interval = false;
+        bool activity = false;
+        nfds_t nfds = 0;
+
+        for (int i = 0; i < num_processes; ++i) {
+            SDL_Process *process = processes[i];
+            for (int kind = 0; kind < 2; ++kind) {
+                if (!(kind ? process->stderr_done : process->stdout_done)) {
+                    const int fd = GetOutputFD(process, (kind == 1));
+                    if (fd < 0) {
+                        // The stream was closed, so no more output is coming
+                        if (kind) {
+                            process->stderr_done = true;
+                        } else {
+                            process->stdout_done = true;
+                        }
+                        process->output_callback(process->output_userdata, process, (kind == 1), NULL, 0);
+                        activity = true;
+                        continue;
+                    }
+                    fds[nfds].fd = fd;
+                    fds[nfds].events = POLLIN;
+                    sources[nfds].process = process;
+                    sources[nfds].kind = kind;
+                    ++nfds;
+                }
+            }
+            if (process->alive) {
+                if (process->internal->pidfd >= 0) {
+                    fds[nfds].fd = process->internal->pidfd;
+                    fds[nfds].events = POLLIN;
+                    sources[nfds].process = process;
+                    sources[nfds].kind = 2;
+                    ++nfds;
+                } else {
+                    // No pidfd (background process, old kernel or not Linux), check on it periodically
+                    need_interval = true;
+                }
+            }
+        }
+
+        int wait = -1;
+        if (timeoutMS >= 0) {
+            const Uint64 now = SDL_GetTicks();
+            wait = (timeoutMS == 0 || now >= deadline) ? 0 : (int)(deadline - now);
+        }
+        if (need_interval && (wait < 0 || wait > PROCESS_POLL_INTERVAL_MS)) {
+            wait = PROCESS_POLL_INTERVAL_MS;
+        }
+        if (activity || (nfds == 0 && !need_interval)) {
+            break;  // something already happened, or there's nothing left to wait for
+        }
+
+        const int rc = poll(fds, nfds, wait);
+        if (rc < 0 && errno != EINTR) {
+            result = SDL_SetError("poll() failed: %s", strerror(errno));
+            break;
+        }
+
+        for (nfds_t i = 0; rc > 0 && i < nfds; ++i) {
+            if (!fds[i].revents) {
+                continue;
+            }
+            SDL_Process *process = sources[i].process;
+            if (sources[i].kind == 2) {
+                if (SDL_UpdateProcessExit(process, false, NULL)) {
+                    activity = true;
+                }
+            } else {
+                if (!buffer) {
+                    buffer = (char *)SDL_malloc(SDL_PROCESS_OUTPUT_CHUNK_SIZE);
+                    if (!buffer) {
+                        result = false;
+                        break;
+                    }
+                }
+                if (DeliverOutput(process, (sources[i].kind == 1), fds[i].fd, buffer)) {
+                    activity = true;
+                }
+            }
+        }
+        if (!result) {
+            break;
+        }
+
+        if (need_interval) {
+            for (int i = 0; i < num_processes; ++i) {
+                SDL_Process *process = processes[i];
+                if (process->alive && process->internal->pidfd < 0 && SDL_UpdateProcessExit(process, false, NULL)) {
+                    activity = true;
+                }
+            }
+        }
+
+        if (activity || timeoutMS == 0 || (timeoutMS > 0 && SDL_GetTicks() >= deadline)) {
+            break;
+        }
+    }
+
+    SDL_free(buffer);
+    SDL_free(fds);
+    SDL_free(sources);
+    return result;
+}
+
 void SDL_SYS_DestroyProcess(SDL_Process *process)
 {
     SDL_IOStream *io;
@@ -508,6 +690,9 @@ void SDL_SYS_DestroyProcess(SDL_Process *process)
         SDL_CloseIO(io);
     }
 
+    if (process->internal && process->internal->pidfd >= 0) {
+        close(process->internal->pidfd);
+    }
     SDL_free(process->internal);
 }
 
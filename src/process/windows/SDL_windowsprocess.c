@@ -29,6 +29,9 @@
 #define READ_END 0
 #define WRITE_END 1
 
+// Anonymous pipes can't be waited on, so output is checked this often
+#define PROCESS_POLL_INTERVAL_MS 10
+
 struct SDL_ProcessData {
     PROCESS_INFORMATION process_information;
 };
@@ -574,6 +577,127 @@ bool SDL_SYS_WaitProcess(SDL_Process *process, bool block, int *exitcode)
     }
 }
 
+static HANDLE GetOutputHandle(SDL_Process *process, bool is_stderr)
+{
+    SDL_IOStream *io = (SDL_IOStream *)SDL_GetPointerProperty(process->props, is_stderr ? SDL_PROP_PROCESS_STDERR_POINTER : SDL_PROP_PROCESS_STDOUT_POINTER, NULL);
+    if (!io) {
+        return INVALID_HANDLE_VALUE;
+    }
+    return (HANDLE)SDL_GetPointerProperty(SDL_GetIOProperties(io), SDL_PROP_IOSTREAM_WINDOWS_HANDLE_POINTER, INVALID_HANDLE_VALUE);
+}
+
+// Read everything that's ready on an output pipe, returns true if anything happened
+static bool DeliverOutput(SDL_Process *process, bool is_stderr, HANDLE handle, char *buffer)
+{
+    bool *done = is_stderr ? &process->stderr_done : &process->stdout_done;
+    bool activity = false;
+
+    while (!*done) {
+        DWORD amount = 0;
+        if (ReadFile(handle, buffer, SDL_PROCESS_OUTPUT_CHUNK_SIZE, &amount, NULL)) {
+            if (amount == 0) {
+                break;
+            }
+            process->output_callback(process->output_userdata, process, is_stderr, buffer, (size_t)amount);
+            activity = true;
+            if (amount < SDL_PROCESS_OUTPUT_CHUNK_SIZE) {
+                break;
+            }
+        } else if (GetLastError() == ERROR_NO_DATA) {
+            break;  // the pipe is in PIPE_NOWAIT mode and nothing is ready
+        } else {
+            // ERROR_BROKEN_PIPE is the normal end of output, anything else is just as final
+            *done = true;
+            process->output_callback(process->output_userdata, process, is_stderr, NULL, 0);
+            activity = true;
+        }
+    }
+    return activity;
+}
+
+bool SDL_SYS_WaitProcesses(SDL_Process **processes, int num_processes, Sint32 timeoutMS)
+{
+    const Uint64 deadline = (timeoutMS > 0) ? (SDL_GetTicks() + timeoutMS) : 0;
+    HANDLE handles[MAXIMUM_WAIT_OBJECTS];
+    char *buffer = NULL;
+    bool result = true;
+
+    for (;;) {
+        bool need_interval = false;
+        bool activity = false;
+        DWORD nhandles = 0;
+
+        for (int i = 0; i < num_processes; ++i) {
+            SDL_Process *process = processes[i];
+            for (int kind = 0; kind < 2; ++kind) {
+                const bool is_stderr = (kind == 1);
+                if (is_stderr ? process->stderr_done : process->stdout_done) {
+                    continue;
+                }
+                const HANDLE handle = GetOutputHandle(process, is_stderr);
+                if (handle == INVALID_HANDLE_VALUE) {
+                    // The stream was closed, so no more output is coming
+                    if (is_stderr) {
+                        process->stderr_done = true;
+                    } else {
+                        process->stdout_done = true;
+                    }
+                    process->output_callback(process->output_userdata, process, is_stderr, NULL, 0);
+                    activity = true;
+                    continue;
+                }
+                if (!buffer) {
+                    buffer = (char *)SDL_malloc(SDL_PROCESS_OUTPUT_CHUNK_SIZE);
+                    if (!buffer) {
+                        return false;
+                    }
+                }
+                if (DeliverOutput(process, is_stderr, handle, buffer)) {
+                    activity = true;
+                }
+                need_interval = true;
+            }
+            if (process->alive) {
+                if (SDL_UpdateProcessExit(process, false, NULL)) {
+                    activity = true;
+                } else if (nhandles < SDL_arraysize(handles)) {
+                    handles[nhandles++] = process->internal->process_information.hProcess;
+                } else {
+                    need_interval = true;
+                }
+            }
+        }
+
+        if (activity || (nhandles == 0 && !need_interval)) {
+            break;  // something happened, or there's nothing left to wait for
+        }
+
+        DWORD wait = INFINITE;
+        if (timeoutMS >= 0) {
+            const Uint64 now = SDL_GetTicks();
+            if (timeoutMS == 0 || now >= deadline) {
+                break;
+            }
+            wait = (DWORD)(deadline - now);
+        }
+        if (need_interval && (wait == INFINITE || wait > PROCESS_POLL_INTERVAL_MS)) {
+            wait = PROCESS_POLL_INTERVAL_MS;
+        }
+
+        if (nhandles > 0) {
+            if (WaitForMultipleObjects(nhandles, handles, FALSE, wait) == WAIT_FAILED) {
+                result = WIN_SetError("WaitForMultipleObjects()");
+                break;
+            }
+        } else {
+            SDL_Delay(wait);
+        }
+    }
+
+    SDL_free(buffer);
+    return result;
+}
+
 void SDL_SYS_DestroyProcess(SDL_Process *process)
 {
     SDL_ProcessData *data = process->internal;
@@ -25,6 +25,7 @@
 #include "SDL_sysrender.h"
 #include "SDL_render_debug_font.h"
 #include "software/SDL_render_sw_c.h"
+#include "../SDL_trace_c.h"
 #include "../events/SDL_windowevents_c.h"
 #include "../video/SDL_pixels_c.h"
 #include "../video/SDL_video_c.h"
@@ -320,7 +321,10 @@ static bool FlushRenderCommands(SDL_Renderer *renderer)
 
     DebugLogRenderCommands(renderer->render_commands);
 
+    SDL_TRACE_COUNTER("SDL_Renderer vertex bytes", (double)renderer->vertex_data_used);
+    SDL_TRACE_ZONE_BEGIN(trace_zone, "RunCommandQueue");
     result = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
+    SDL_TRACE_ZONE_END(trace_zone, "RunCommandQueue");
 
     // Move the whole render command queue to the unused pool so we can reuse them next time.
     if (renderer->render_commands_tail) {
@@ -5587,6 +5591,8 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
         }
     }
 
+    SDL_TRACE_ZONE_BEGIN(trace_zone, "SDL_RenderPresent");
+
     if (renderer->transparent_window) {
         SDL_RenderApplyWindowShape(renderer);
     }
@@ -5607,6 +5613,9 @@ bool SDL_RenderPresent(SDL_Renderer *renderer)
         (!presented && renderer->wanted_vsync)) {
         SDL_SimulateRenderVSync(renderer);
     }
+
+    SDL_TRACE_ZONE_END(trace_zone, "SDL_RenderPresent");
+    SDL_TRACE_FRAME_MARK(NULL);
     return true;
 }
 
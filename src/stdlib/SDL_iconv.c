@@ -22,65 +22,6 @@
 
 // This file contains portable iconv functions for SDL
 
-#if defined(HAVE_ICONV) && defined(HAVE_ICONV_H)
-#ifndef SDL_USE_LIBICONV
-// Define LIBICONV_PLUG to use iconv from the base instead of ports and avoid linker errors.
-#define LIBICONV_PLUG 1
-#endif
-#include <iconv.h>
-#include <errno.h>
-
-SDL_COMPILE_TIME_ASSERT(iconv_t, sizeof(iconv_t) <= sizeof(SDL_iconv_t));
-
-SDL_iconv_t SDL_iconv_open(const char *tocode, const char *fromcode)
-{
-    return (SDL_iconv_t)((uintptr_t)iconv_open(tocode, fromcode));
-}
-
-int SDL_iconv_close(SDL_iconv_t cd)
-{
-    if ((size_t)cd == SDL_ICONV_ERROR) {
-        return -1;
-    }
-    return iconv_close((iconv_t)((uintptr_t)cd));
-}
-
-size_t SDL_iconv(SDL_iconv_t cd,
-          const char **inbuf, size_t *inbytesleft,
-          char **outbuf, size_t *outbytesleft)
-{
-    if ((size_t)cd == SDL_ICONV_ERROR) {
-        return SDL_ICONV_ERROR;
-    }
-    /* iconv's second parameter may or may not be `const char const *` depending on the
-       C runtime's whims. Casting to void * seems to make everyone happy, though. */
-    const size_t retCode = iconv((iconv_t)((uintptr_t)cd), (void *)inbuf, inbytesleft, outbuf, outbytesleft);
-    if (retCode == (size_t)-1) {
-        switch (errno) {
-        case E2BIG:
-            return SDL_ICONV_E2BIG;
-        case EILSEQ:
-            return SDL_ICONV_EILSEQ;
-        case EINVAL:
-            return SDL_ICONV_EINVAL;
-        default:
-            return SDL_ICONV_ERROR;
-        }
-    }
-    return retCode;
-}
-
-#else
-
-/* Lots of useful information on Unicode at:
-    http://www.cl.cam.ac.uk/~mgk25/unicode.html
-*/
-
-#define UNICODE_BOM 0xFEFF
-
-#define UNKNOWN_ASCII   '?'
-#define UNKNOWN_UNICODE 0xFFFD
-
 enum
 {
     ENCODING_UNKNOWN,
@@ -110,12 +51,6 @@ enum
 #define ENCODING_UCS4NATIVE  ENCODING_UCS4LE
 #endif
 
-struct SDL_iconv_data_t
-{
-    int src_fmt;
-    int dst_fmt;
-};
-
 static struct
 {
     const char *name;
@@ -158,6 +93,874 @@ static struct
 /* *INDENT-ON* */ // clang-format on
 };
 
+static int SDL_GetEncodingFormat(const char *name)
+{
+    int i;
+
+    for (i = 0; i < SDL_arraysize(encodings); ++i) {
+        if (SDL_strcasecmp(name, encodings[i].name) == 0) {
+            return encodings[i].format;
+        }
+    }
+    return ENCODING_UNKNOWN;
+}
+
+/* Fast paths for conversions between UTF-8 and the fixed byte order UTF-16,
+   UTF-32 and UCS-4 encodings, used by both the system iconv and our own.
+
+   These only convert input that is entirely valid and stop in front of
+   anything else, including the noncharacters U+FFFE and U+FFFF, which the
+   different iconv implementations don't agree on. Whatever is left over is
+   handed to the regular conversion, so the output is exactly the same as
+   it would have been without them.
+
+   UTF-8 input is validated with SIMD where available, and runs of ASCII are
+   widened or narrowed 16 characters at a time. Everything else goes through
+   a simple scalar loop, which doesn't have to check anything for UTF-8 input
+   that has already been validated.
+*/
+
+#if defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64)) && !defined(_M_ARM64EC) && (SDL_BYTEORDER == SDL_LIL_ENDIAN)
+#define SDL_ICONV_NEON
+#endif
+
+static Uint32 SDL_iconv_GetUnit(const Uint8 *src, int unit, bool bigendian)
+{
+    if (unit == 2) {
+        if (bigendian) {
+            return ((Uint32)src[0] << 8) | (Uint32)src[1];
+        } else {
+            return ((Uint32)src[1] << 8) | (Uint32)src[0];
+        }
+    } else {
+        if (bigendian) {
+            return ((Uint32)src[0] << 24) | ((Uint32)src[1] << 16) | ((Uint32)src[2] << 8) | (Uint32)src[3];
+        } else {
+            return ((Uint32)src[3] << 24) | ((Uint32)src[2] << 16) | ((Uint32)src[1] << 8) | (Uint32)src[0];
+        }
+    }
+}
+
+static void SDL_iconv_PutUnit(Uint8 *dst, Uint32 value, int unit, bool bigendian)
+{
+    if (unit == 2) {
+        if (bigendian) {
+            dst[0] = (Uint8)(value >> 8);
+            dst[1] = (Uint8)value;
+        } else {
+            dst[1] = (Uint8)(value >> 8);
+            dst[0] = (Uint8)value;
+        }
+    } else {
+        if (bigendian) {
+            dst[0] = (Uint8)(value >> 24);
+            dst[1] = (Uint8)(value >> 16);
+            dst[2] = (Uint8)(value >> 8);
+            dst[3] = (Uint8)value;
+        } else {
+            dst[3] = (Uint8)(value >> 24);
+            dst[2] = (Uint8)(value >> 16);
+            dst[1] = (Uint8)(value >> 8);
+            dst[0] = (Uint8)value;
+        }
+    }
+}
+
+// Returns the length of the longest prefix made up of complete, valid UTF-8 characters
+static size_t UTF8_ValidPrefix_Scalar(const Uint8 *src, size_t len)
+{
+    size_t i = 0;
+
+    while (i < len) {
+        const Uint8 c = src[i];
+        Uint8 lo = 0x80, hi = 0xBF;
+        size_t n;
+
+        if (c < 0x80) {
+            ++i;
+            continue;
+        } else if (c < 0xC2) {
+            break; // Continuation byte or overlong sequence
+        } else if (c < 0xE0) {
+            n = 2;
+        } else if (c < 0xF0) {
+            if (c == 0xE0) {
+                lo = 0xA0; // Overlong sequence
+            } else if (c == 0xED) {
+                hi = 0x9F; // Surrogate
+            }
+            n = 3;
+        } else if (c < 0xF5) {
+            if (c == 0xF0) {
+                lo = 0x90; // Overlong sequence
+            } else if (c == 0xF4) {
+                hi = 0x8F; // Past U+10FFFF
+            }
+            n = 4;
+        } else {
+            break;
+        }
+        if (len - i < n || src[i + 1] < lo || src[i + 1] > hi) {
+            break;
+        }
+        if (n >= 3 && (src[i + 2] & 0xC0) != 0x80) {
+            break;
+        }
+        if (n == 4 && (src[i + 3] & 0xC0) != 0x80) {
+            break;
+        }
+        if (c == 0xEF && src[i + 1] == 0xBF && src[i + 2] >= 0xBE) {
+            break; // U+FFFE or U+FFFF
+        }
+        i += n;
+    }
+    return i;
+}
+
+/* The SIMD validators use the lookup table algorithm from "Validating UTF-8
+   In Less Than One Instruction Per Byte" (John Keiser, Daniel Lemire, 2021).
+   Each byte is classified by the high and low nibble of the byte before it
+   and the high nibble of the byte itself, and the three table lookups are
+   combined into a mask of the errors that pair of bytes could be part of.
+   Third and fourth bytes of a sequence are checked separately.
+
+   They stop at the first block with an error in it, back up to the start of
+   the character that block begins in, and let the scalar validator find out
+   exactly where the error is.
+*/
+#define UTF8_TOO_SHORT      (1 << 0)
+#define UTF8_TOO_LONG       (1 << 1)
+#define UTF8_OVERLONG_3     (1 << 2)
+#define UTF8_TOO_LARGE      (1 << 3)
+#define UTF8_SURROGATE      (1 << 4)
+#define UTF8_OVERLONG_2     (1 << 5)
+#define UTF8_TOO_LARGE_1000 (1 << 6)
+#define UTF8_OVERLONG_4     (1 << 6)
+#define UTF8_TWO_CONTS      (1 << 7)
+#define UTF8_CARRY          (UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTS)
+
+// Indexed by the high nibble of the first byte of a pair
+#define UTF8_BYTE_1_HIGH_TABLE                                                                  \
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,                                \
+    UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG, UTF8_TOO_LONG,                                \
+    UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS, UTF8_TWO_CONTS,                            \
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,                                                          \
+    UTF8_TOO_SHORT,                                                                            \
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,                                         \
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4
+
+// Indexed by the low nibble of the first byte of a pair
+#define UTF8_BYTE_1_LOW_TABLE                                                                   \
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,                          \
+    UTF8_CARRY | UTF8_OVERLONG_2,                                                              \
+    UTF8_CARRY,                                                                                \
+    UTF8_CARRY,                                                                                \
+    UTF8_CARRY | UTF8_TOO_LARGE,                                                               \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,                        \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,                                         \
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000
+
+// Indexed by the high nibble of the second byte of a pair
+#define UTF8_BYTE_2_HIGH_TABLE                                                                  \
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,                            \
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT,                            \
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4, \
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,      \
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,       \
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTS | UTF8_SURROGATE | UTF8_TOO_LARGE,       \
+    UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT, UTF8_TOO_SHORT
+
+// A character that starts before pos and hasn't ended yet has its first byte in the last three
+static size_t UTF8_CharBoundary(const Uint8 *src, size_t pos)
+{
+    if (src[pos - 1] >= 0xC0) {
+        return pos - 1;
+    } else if (src[pos - 2] >= 0xE0) {
+        return pos - 2;
+    } else if (src[pos - 3] >= 0xF0) {
+        return pos - 3;
+    }
+    return pos;
+}
+
+#ifdef SDL_SSE4_1_INTRINSICS
+static size_t SDL_TARGETING("sse4.1") UTF8_ValidPrefix_SSE41(const Uint8 *src, size_t len)
+{
+    const __m128i byte_1_high_table = _mm_setr_epi8(UTF8_BYTE_1_HIGH_TABLE);
+    const __m128i byte_1_low_table = _mm_setr_epi8(UTF8_BYTE_1_LOW_TABLE);
+    const __m128i byte_2_high_table = _mm_setr_epi8(UTF8_BYTE_2_HIGH_TABLE);
+    const __m128i incomplete_max = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i zero = _mm_setzero_si128();
+    __m128i prev = zero;
+    __m128i prev_incomplete = zero;
+    size_t pos = 0, valid = 0;
+
+    while (len - pos >= 16) {
+        const __m128i input = _mm_loadu_si128((const __m128i *)(src + pos));
+        __m128i error;
+
+        if (_mm_movemask_epi8(input) == 0) {
+            // All ASCII, only a character left unfinished in the last block can be wrong
+            error = prev_incomplete;
+            prev_incomplete = zero;
+        } else {
+            const __m128i prev1 = _mm_alignr_epi8(input, prev, 15);
+            const __m128i prev2 = _mm_alignr_epi8(input, prev, 14);
+            const __m128i prev3 = _mm_alignr_epi8(input, prev, 13);
+            const __m128i byte_1_high = _mm_shuffle_epi8(byte_1_high_table, _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+            const __m128i byte_1_low = _mm_shuffle_epi8(byte_1_low_table, _mm_and_si128(prev1, nibble));
+            const __m128i byte_2_high = _mm_shuffle_epi8(byte_2_high_table, _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+            const __m128i special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+            const __m128i must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8(0xE0 - 0x80)),
+                                                _mm_subs_epu8(prev3, _mm_set1_epi8(0xF0 - 0x80)));
+            const __m128i nonchar = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(prev2, _mm_set1_epi8((char)0xEF)),
+                                                                _mm_cmpeq_epi8(prev1, _mm_set1_epi8((char)0xBF))),
+                                                  _mm_cmpeq_epi8(_mm_or_si128(input, _mm_set1_epi8(1)), _mm_set1_epi8((char)0xBF)));
+
+            error = _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8((char)0x80)), special);
+            error = _mm_or_si128(error, nonchar);
+            prev_incomplete = _mm_subs_epu8(input, incomplete_max);
+        }
+        if (!_mm_testz_si128(error, error)) {
+            break;
+        }
+        prev = input;
+        pos += 16;
+        valid = UTF8_CharBoundary(src, pos);
+    }
+    return valid + UTF8_ValidPrefix_Scalar(src + valid, len - valid);
+}
+#endif // SDL_SSE4_1_INTRINSICS
+
+#ifdef SDL_AVX2_INTRINSICS
+static size_t SDL_TARGETING("avx2") UTF8_ValidPrefix_AVX2(const Uint8 *src, size_t len)
+{
+    const __m256i byte_1_high_table = _mm256_setr_epi8(UTF8_BYTE_1_HIGH_TABLE, UTF8_BYTE_1_HIGH_TABLE);
+    const __m256i byte_1_low_table = _mm256_setr_epi8(UTF8_BYTE_1_LOW_TABLE, UTF8_BYTE_1_LOW_TABLE);
+    const __m256i byte_2_high_table = _mm256_setr_epi8(UTF8_BYTE_2_HIGH_TABLE, UTF8_BYTE_2_HIGH_TABLE);
+    const __m256i incomplete_max = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i zero = _mm256_setzero_si256();
+    __m256i prev = zero;
+    __m256i prev_incomplete = zero;
+    size_t pos = 0, valid = 0;
+
+    while (len - pos >= 32) {
+        const __m256i input = _mm256_loadu_si256((const __m256i *)(src + pos));
+        __m256i error;
+
+        if (_mm256_movemask_epi8(input) == 0) {
+            error = prev_incomplete;
+            prev_incomplete = zero;
+        } else {
+            // The last 16 bytes of the previous block followed by the first 16 of this one
+            const __m256i shifted = _mm256_permute2x128_si256(prev, input, 0x21);
+            const __m256i prev1 = _mm256_alignr_epi8(input, shifted, 15);
+            const __m256i prev2 = _mm256_alignr_epi8(input, shifted, 14);
+            const __m256i prev3 = _mm256_alignr_epi8(input, shifted, 13);
+            const __m256i byte_1_high = _mm256_shuffle_epi8(byte_1_high_table, _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+            const __m256i byte_1_low = _mm256_shuffle_epi8(byte_1_low_table, _mm256_and_si256(prev1, nibble));
+            const __m256i byte_2_high = _mm256_shuffle_epi8(byte_2_high_table, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+            const __m256i special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+            const __m256i must23 = _mm256_or_si256(_mm256_subs_epu8(prev2, _mm256_set1_epi8(0xE0 - 0x80)),
+                                                   _mm256_subs_epu8(prev3, _mm256_set1_epi8(0xF0 - 0x80)));
+            const __m256i nonchar = _mm256_and_si256(_mm256_and_si256(_mm256_cmpeq_epi8(prev2, _mm256_set1_epi8((char)0xEF)),
+                                                                      _mm256_cmpeq_epi8(prev1, _mm256_set1_epi8((char)0xBF))),
+                                                     _mm256_cmpeq_epi8(_mm256_or_si256(input, _mm256_set1_epi8(1)), _mm256_set1_epi8((char)0xBF)));
+
+            error = _mm256_xor_si256(_mm256_and_si256(must23, _mm256_set1_epi8((char)0x80)), special);
+            error = _mm256_or_si256(error, nonchar);
+            prev_incomplete = _mm256_subs_epu8(input, incomplete_max);
+        }
+        if (!_mm256_testz_si256(error, error)) {
+            break;
+        }
+        prev = input;
+        pos += 32;
+        valid = UTF8_CharBoundary(src, pos);
+    }
+    return valid + UTF8_ValidPrefix_Scalar(src + valid, len - valid);
+}
+#endif // SDL_AVX2_INTRINSICS
+
+#ifdef SDL_ICONV_NEON
+static size_t UTF8_ValidPrefix_NEON(const Uint8 *src, size_t len)
+{
+    static const Uint8 byte_1_high_data[16] = { UTF8_BYTE_1_HIGH_TABLE };
+    static const Uint8 byte_1_low_data[16] = { UTF8_BYTE_1_LOW_TABLE };
+    static const Uint8 byte_2_high_data[16] = { UTF8_BYTE_2_HIGH_TABLE };
+    static const Uint8 incomplete_max_data[16] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1 };
+    const uint8x16_t byte_1_high_table = vld1q_u8(byte_1_high_data);
+    const uint8x16_t byte_1_low_table = vld1q_u8(byte_1_low_data);
+    const uint8x16_t byte_2_high_table = vld1q_u8(byte_2_high_data);
+    const uint8x16_t incomplete_max = vld1q_u8(incomplete_max_data);
+    const uint8x16_t nibble = vdupq_n_u8(0x0F);
+    const uint8x16_t zero = vdupq_n_u8(0);
+    uint8x16_t prev = zero;
+    uint8x16_t prev_incomplete = zero;
+    size_t pos = 0, valid = 0;
+
+    while (len - pos >= 16) {
+        const uint8x16_t input = vld1q_u8(src + pos);
+        uint8x16_t error;
+
+        if (vmaxvq_u8(input) < 0x80) {
+            error = prev_incomplete;
+            prev_incomplete = zero;
+        } else {
+            const uint8x16_t prev1 = vextq_u8(prev, input, 15);
+            const uint8x16_t prev2 = vextq_u8(prev, input, 14);
+            const uint8x16_t prev3 = vextq_u8(prev, input, 13);
+            const uint8x16_t byte_1_high = vqtbl1q_u8(byte_1_high_table, vshrq_n_u8(prev1, 4));
+            const uint8x16_t byte_1_low = vqtbl1q_u8(byte_1_low_table, vandq_u8(prev1, nibble));
+            const uint8x16_t byte_2_high = vqtbl1q_u8(byte_2_high_table, vshrq_n_u8(input, 4));
+            const uint8x16_t special = vandq_u8(vandq_u8(byte_1_high, byte_1_low), byte_2_high);
+            const uint8x16_t must23 = vorrq_u8(vqsubq_u8(prev2, vdupq_n_u8(0xE0 - 0x80)),
+                                               vqsubq_u8(prev3, vdupq_n_u8(0xF0 - 0x80)));
+            const uint8x16_t nonchar = vandq_u8(vandq_u8(vceqq_u8(prev2, vdupq_n_u8(0xEF)),
+                                                         vceqq_u8(prev1, vdupq_n_u8(0xBF))),
+                                                vceqq_u8(vorrq_u8(input, vdupq_n_u8(1)), vdupq_n_u8(0xBF)));
+
+            error = veorq_u8(vandq_u8(must23, vdupq_n_u8(0x80)), special);
+            error = vorrq_u8(error, nonchar);
+            prev_incomplete = vqsubq_u8(input, incomplete_max);
+        }
+        if (vmaxvq_u8(error) != 0) {
+            break;
+        }
+        prev = input;
+        pos += 16;
+        valid = UTF8_CharBoundary(src, pos);
+    }
+    return valid + UTF8_ValidPrefix_Scalar(src + valid, len - valid);
+}
+#endif // SDL_ICONV_NEON
+
+static size_t UTF8_ValidPrefix(const Uint8 *src, size_t len)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (len >= 64 && SDL_HasAVX2()) {
+        return UTF8_ValidPrefix_AVX2(src, len);
+    }
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (len >= 32 && SDL_HasSSE41()) {
+        return UTF8_ValidPrefix_SSE41(src, len);
+    }
+#endif
+#ifdef SDL_ICONV_NEON
+    if (len >= 32 && SDL_HasNEON()) {
+        return UTF8_ValidPrefix_NEON(src, len);
+    }
+#endif
+    return UTF8_ValidPrefix_Scalar(src, len);
+}
+
+/* Convert leading ASCII between UTF-8 and 2 or 4 byte code units, in blocks
+   of 16 characters. These return the number of characters converted, which
+   is 0 if the input doesn't start with a block of ASCII. */
+#ifdef SDL_SSE2_INTRINSICS
+static size_t SDL_TARGETING("sse2") ASCII_Widen_SSE2(const Uint8 *src, size_t count, Uint8 *dst, int unit, bool bigendian)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i;
+
+    for (i = 0; count - i >= 16; i += 16) {
+        const __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i lo, hi;
+
+        if (_mm_movemask_epi8(v) != 0) {
+            break;
+        }
+        if (bigendian) {
+            lo = _mm_unpacklo_epi8(zero, v);
+            hi = _mm_unpackhi_epi8(zero, v);
+        } else {
+            lo = _mm_unpacklo_epi8(v, zero);
+            hi = _mm_unpackhi_epi8(v, zero);
+        }
+        if (unit == 2) {
+            _mm_storeu_si128((__m128i *)(dst + i * 2), lo);
+            _mm_storeu_si128((__m128i *)(dst + i * 2 + 16), hi);
+        } else if (bigendian) {
+            _mm_storeu_si128((__m128i *)(dst + i * 4), _mm_unpacklo_epi16(zero, lo));
+            _mm_storeu_si128((__m128i *)(dst + i * 4 + 16), _mm_unpackhi_epi16(zero, lo));
+            _mm_storeu_si128((__m128i *)(dst + i * 4 + 32), _mm_unpacklo_epi16(zero, hi));
+            _mm_storeu_si128((__m128i *)(dst + i * 4 + 48), _mm_unpackhi_epi16(zero, hi));
+        } else {
+            _mm_storeu_si128((__m128i *)(dst + i * 4), _mm_unpacklo_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(dst + i * 4 + 16), _mm_unpackhi_epi16(lo, zero));
+            _mm_storeu_si128((__m128i *)(dst + i * 4 + 32), _mm_unpacklo_epi16(hi, zero));
+            _mm_storeu_si128((__m128i *)(dst + i * 4 + 48), _mm_unpackhi_epi16(hi, zero));
+        }
+    }
+    return i;
+}
+
+static size_t SDL_TARGETING("sse2") ASCII_Narrow_SSE2(const Uint8 *src, size_t count, Uint8 *dst, int unit, bool bigendian)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t i;
+
+    if (unit == 2) {
+        // Everything but the low 7 bits of each code unit has to be clear
+        const __m128i mask = bigendian ? _mm_set1_epi16((short)0x80FF) : _mm_set1_epi16((short)0xFF80);
+
+        for (i = 0; count - i >= 16; i += 16) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(src + i * 2));
+            __m128i b = _mm_loadu_si128((const __m128i *)(src + i * 2 + 16));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(_mm_or_si128(a, b), mask), zero)) != 0xFFFF) {
+                break;
+            }
+            if (bigendian) {
+                a = _mm_srli_epi16(a, 8);
+                b = _mm_srli_epi16(b, 8);
+            }
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(a, b));
+        }
+    } else {
+        const __m128i mask = bigendian ? _mm_set1_epi32((int)0x80FFFFFF) : _mm_set1_epi32((int)0xFFFFFF80);
+
+        for (i = 0; count - i >= 16; i += 16) {
+            __m128i a = _mm_loadu_si128((const __m128i *)(src + i * 4));
+            __m128i b = _mm_loadu_si128((const __m128i *)(src + i * 4 + 16));
+            __m128i c = _mm_loadu_si128((const __m128i *)(src + i * 4 + 32));
+            __m128i d = _mm_loadu_si128((const __m128i *)(src + i * 4 + 48));
+            const __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(all, mask), zero)) != 0xFFFF) {
+                break;
+            }
+            if (bigendian) {
+                a = _mm_srli_epi32(a, 24);
+                b = _mm_srli_epi32(b, 24);
+                c = _mm_srli_epi32(c, 24);
+                d = _mm_srli_epi32(d, 24);
+            }
+            _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+        }
+    }
+    return i;
+}
+#endif // SDL_SSE2_INTRINSICS
+
+#ifdef SDL_ICONV_NEON
+static size_t ASCII_Widen_NEON(const Uint8 *src, size_t count, Uint8 *dst, int unit, bool bigendian)
+{
+    const uint8x16_t zero = vdupq_n_u8(0);
+    size_t i;
+
+    for (i = 0; count - i >= 16; i += 16) {
+        const uint8x16_t v = vld1q_u8(src + i);
+        uint8x16_t lo, hi;
+
+        if (vmaxvq_u8(v) >= 0x80) {
+            break;
+        }
+        if (bigendian) {
+            lo = vzip1q_u8(zero, v);
+            hi = vzip2q_u8(zero, v);
+        } else {
+            lo = vzip1q_u8(v, zero);
+            hi = vzip2q_u8(v, zero);
+        }
+        if (unit == 2) {
+            vst1q_u8(dst + i * 2, lo);
+            vst1q_u8(dst + i * 2 + 16, hi);
+        } else {
+            const uint16x8_t zero16 = vdupq_n_u16(0);
+            const uint16x8_t lo16 = vreinterpretq_u16_u8(lo);
+            const uint16x8_t hi16 = vreinterpretq_u16_u8(hi);
+
+            if (bigendian) {
+                vst1q_u8(dst + i * 4, vreinterpretq_u8_u16(vzip1q_u16(zero16, lo16)));
+                vst1q_u8(dst + i * 4 + 16, vreinterpretq_u8_u16(vzip2q_u16(zero16, lo16)));
+                vst1q_u8(dst + i * 4 + 32, vreinterpretq_u8_u16(vzip1q_u16(zero16, hi16)));
+                vst1q_u8(dst + i * 4 + 48, vreinterpretq_u8_u16(vzip2q_u16(zero16, hi16)));
+            } else {
+                vst1q_u8(dst + i * 4, vreinterpretq_u8_u16(vzip1q_u16(lo16, zero16)));
+                vst1q_u8(dst + i * 4 + 16, vreinterpretq_u8_u16(vzip2q_u16(lo16, zero16)));
+                vst1q_u8(dst + i * 4 + 32, vreinterpretq_u8_u16(vzip1q_u16(hi16, zero16)));
+                vst1q_u8(dst + i * 4 + 48, vreinterpretq_u8_u16(vzip2q_u16(hi16, zero16)));
+            }
+        }
+    }
+    return i;
+}
+
+static size_t ASCII_Narrow_NEON(const Uint8 *src, size_t count, Uint8 *dst, int unit, bool bigendian)
+{
+    size_t i;
+
+    if (unit == 2) {
+        for (i = 0; count - i >= 16; i += 16) {
+            uint8x16_t a = vld1q_u8(src + i * 2);
+            uint8x16_t b = vld1q_u8(src + i * 2 + 16);
+            uint16x8_t a16, b16;
+
+            if (bigendian) {
+                a = vrev16q_u8(a);
+                b = vrev16q_u8(b);
+            }
+            a16 = vreinterpretq_u16_u8(a);
+            b16 = vreinterpretq_u16_u8(b);
+            if (vmaxvq_u16(vorrq_u16(a16, b16)) >= 0x80) {
+                break;
+            }
+            vst1q_u8(dst + i, vcombine_u8(vmovn_u16(a16), vmovn_u16(b16)));
+        }
+    } else {
+        for (i = 0; count - i >= 16; i += 16) {
+            uint8x16_t a = vld1q_u8(src + i * 4);
+            uint8x16_t b = vld1q_u8(src + i * 4 + 16);
+            uint8x16_t c = vld1q_u8(src + i * 4 + 32);
+            uint8x16_t d = vld1q_u8(src + i * 4 + 48);
+            uint32x4_t a32, b32, c32, d32;
+
+            if (bigendian) {
+                a = vrev32q_u8(a);
+                b = vrev32q_u8(b);
+                c = vrev32q_u8(c);
+                d = vrev32q_u8(d);
+            }
+            a32 = vreinterpretq_u32_u8(a);
+            b32 = vreinterpretq_u32_u8(b);
+            c32 = vreinterpretq_u32_u8(c);
+            d32 = vreinterpretq_u32_u8(d);
+            if (vmaxvq_u32(vorrq_u32(vorrq_u32(a32, b32), vorrq_u32(c32, d32))) >= 0x80) {
+                break;
+            }
+            vst1q_u8(dst + i, vcombine_u8(vmovn_u16(vcombine_u16(vmovn_u32(a32), vmovn_u32(b32))),
+                                          vmovn_u16(vcombine_u16(vmovn_u32(c32), vmovn_u32(d32)))));
+        }
+    }
+    return i;
+}
+#endif // SDL_ICONV_NEON
+
+static size_t ASCII_Widen(const Uint8 *src, size_t count, Uint8 *dst, int unit, bool bigendian)
+{
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return ASCII_Widen_SSE2(src, count, dst, unit, bigendian);
+    }
+#endif
+#ifdef SDL_ICONV_NEON
+    if (SDL_HasNEON()) {
+        return ASCII_Widen_NEON(src, count, dst, unit, bigendian);
+    }
+#endif
+    return 0;
+}
+
+static size_t ASCII_Narrow(const Uint8 *src, size_t count, Uint8 *dst, int unit, bool bigendian)
+{
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return ASCII_Narrow_SSE2(src, count, dst, unit, bigendian);
+    }
+#endif
+#ifdef SDL_ICONV_NEON
+    if (SDL_HasNEON()) {
+        return ASCII_Narrow_NEON(src, count, dst, unit, bigendian);
+    }
+#endif
+    return 0;
+}
+
+static size_t SDL_iconv_FromUTF8(const Uint8 **src, size_t *srclen, Uint8 **dst, size_t *dstlen, int unit, bool bigendian)
+{
+    // No character takes up more code units than it has UTF-8 bytes
+    const size_t len = UTF8_ValidPrefix(*src, SDL_min(*srclen, *dstlen / unit));
+    const Uint8 *s = *src;
+    const Uint8 *end = s + len;
+    Uint8 *d = *dst;
+    size_t count = 0;
+
+    if (unit == 1) {
+        SDL_memcpy(d, s, len);
+        d += len;
+        for (; s < end; ++s) {
+            if ((*s & 0xC0) != 0x80) {
+                ++count;
+            }
+        }
+    }
+
+    while (s < end) {
+        Uint32 ch = s[0];
+
+        if (ch < 0x80) {
+            const size_t n = ASCII_Widen(s, (size_t)(end - s), d, unit, bigendian);
+            s += n;
+            d += n * unit;
+            count += n;
+
+            // Finish off the run of ASCII one character at a time
+            while (s < end && *s < 0x80) {
+                SDL_iconv_PutUnit(d, *s++, unit, bigendian);
+                d += unit;
+                ++count;
+            }
+            continue;
+        } else if (ch < 0xE0) {
+            ch = ((ch & 0x1F) << 6) | (s[1] & 0x3F);
+            s += 2;
+        } else if (ch < 0xF0) {
+            ch = ((ch & 0x0F) << 12) | ((Uint32)(s[1] & 0x3F) << 6) | (s[2] & 0x3F);
+            s += 3;
+        } else {
+            ch = ((ch & 0x07) << 18) | ((Uint32)(s[1] & 0x3F) << 12) | ((Uint32)(s[2] & 0x3F) << 6) | (s[3] & 0x3F);
+            s += 4;
+        }
+
+        if (unit == 2 && ch >= 0x10000) {
+            ch -= 0x10000;
+            SDL_iconv_PutUnit(d, 0xD800 | (ch >> 10), 2, bigendian);
+            SDL_iconv_PutUnit(d + 2, 0xDC00 | (ch & 0x3FF), 2, bigendian);
+            d += 4;
+        } else {
+            SDL_iconv_PutUnit(d, ch, unit, bigendian);
+            d += unit;
+        }
+        ++count;
+    }
+
+    *src = end;
+    *srclen -= len;
+    *dstlen -= (size_t)(d - *dst);
+    *dst = d;
+    return count;
+}
+
+static size_t SDL_iconv_ToUTF8(const Uint8 **src, size_t *srclen, Uint8 **dst, size_t *dstlen, int unit, bool bigendian)
+{
+    const Uint8 *s = *src;
+    const Uint8 *end = s + (*srclen - (*srclen % unit));
+    Uint8 *d = *dst;
+    Uint8 *dend = d + *dstlen;
+    size_t count = 0;
+
+    while (s < end) {
+        Uint32 ch = SDL_iconv_GetUnit(s, unit, bigendian);
+        size_t used = unit;
+
+        if (ch < 0x80) {
+            const size_t n = ASCII_Narrow(s, SDL_min((size_t)(end - s) / unit, (size_t)(dend - d)), d, unit, bigendian);
+            s += n * unit;
+            d += n;
+            count += n;
+
+            // Finish off the run of ASCII one character at a time
+            while (s < end && d < dend && (ch = SDL_iconv_GetUnit(s, unit, bigendian)) < 0x80) {
+                *d++ = (Uint8)ch;
+                s += unit;
+                ++count;
+            }
+            if (d == dend) {
+                break;
+            }
+            continue;
+        } else {
+            if (ch >= 0xD800 && ch <= 0xDFFF) {
+                Uint32 low;
+
+                if (unit != 2 || ch > 0xDBFF || (size_t)(end - s) < 4) {
+                    break;
+                }
+                low = SDL_iconv_GetUnit(s + 2, 2, bigendian);
+                if (low < 0xDC00 || low > 0xDFFF) {
+                    break;
+                }
+                ch = ((((ch & 0x3FF) << 10) | (low & 0x3FF))) + 0x10000;
+                used = 4;
+            } else if (ch == 0xFFFE || ch == 0xFFFF || ch > 0x10FFFF) {
+                break;
+            }
+
+            if (ch <= 0x7FF) {
+                if (dend - d < 2) {
+                    break;
+                }
+                d[0] = 0xC0 | (Uint8)(ch >> 6);
+                d[1] = 0x80 | (Uint8)(ch & 0x3F);
+                d += 2;
+            } else if (ch <= 0xFFFF) {
+                if (dend - d < 3) {
+                    break;
+                }
+                d[0] = 0xE0 | (Uint8)(ch >> 12);
+                d[1] = 0x80 | (Uint8)((ch >> 6) & 0x3F);
+                d[2] = 0x80 | (Uint8)(ch & 0x3F);
+                d += 3;
+            } else {
+                if (dend - d < 4) {
+                    break;
+                }
+                d[0] = 0xF0 | (Uint8)(ch >> 18);
+                d[1] = 0x80 | (Uint8)((ch >> 12) & 0x3F);
+                d[2] = 0x80 | (Uint8)((ch >> 6) & 0x3F);
+                d[3] = 0x80 | (Uint8)(ch & 0x3F);
+                d += 4;
+            }
+        }
+        s += used;
+        ++count;
+    }
+
+    *srclen -= (size_t)(s - *src);
+    *src = s;
+    *dstlen -= (size_t)(d - *dst);
+    *dst = d;
+    return count;
+}
+
+// Returns the code unit size of an encoding the fast paths handle, or 0
+static int SDL_iconv_FastUnit(int format, bool *bigendian)
+{
+    *bigendian = false;
+    switch (format) {
+    case ENCODING_UTF8:
+        return 1;
+    case ENCODING_UTF16BE:
+        *bigendian = true;
+        SDL_FALLTHROUGH;
+    case ENCODING_UTF16LE:
+        return 2;
+    case ENCODING_UTF32BE:
+    case ENCODING_UCS4BE:
+        *bigendian = true;
+        SDL_FALLTHROUGH;
+    case ENCODING_UTF32LE:
+    case ENCODING_UCS4LE:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+static bool SDL_iconv_HasFastPath(int src_fmt, int dst_fmt)
+{
+    bool bigendian;
+    const int src_unit = SDL_iconv_FastUnit(src_fmt, &bigendian);
+    const int dst_unit = SDL_iconv_FastUnit(dst_fmt, &bigendian);
+
+    return src_unit && dst_unit && (src_unit == 1 || dst_unit == 1);
+}
+
+// The most output the fast path can produce from the given amount of input
+static size_t SDL_iconv_FastPathBound(int src_fmt, int dst_fmt, size_t srclen)
+{
+    bool bigendian;
+    const int src_unit = SDL_iconv_FastUnit(src_fmt, &bigendian);
+    const int dst_unit = SDL_iconv_FastUnit(dst_fmt, &bigendian);
+
+    if (src_unit == 2) {
+        return srclen + srclen / 2; // Three UTF-8 bytes for each code unit
+    } else if (src_unit == 4) {
+        return srclen;
+    }
+    return srclen * dst_unit;
+}
+
+// Converts as much as possible with the fast path, returning the number of characters converted
+static size_t SDL_iconv_FastPath(int src_fmt, int dst_fmt, const char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft)
+{
+    const Uint8 *src = (const Uint8 *)*inbuf;
+    Uint8 *dst = (Uint8 *)*outbuf;
+    bool src_bigendian, dst_bigendian;
+    const int src_unit = SDL_iconv_FastUnit(src_fmt, &src_bigendian);
+    const int dst_unit = SDL_iconv_FastUnit(dst_fmt, &dst_bigendian);
+    size_t count;
+
+    if (src_unit == 1 && dst_unit) {
+        count = SDL_iconv_FromUTF8(&src, inbytesleft, &dst, outbytesleft, dst_unit, dst_bigendian);
+    } else if (dst_unit == 1 && src_unit) {
+        count = SDL_iconv_ToUTF8(&src, inbytesleft, &dst, outbytesleft, src_unit, src_bigendian);
+    } else {
+        return 0;
+    }
+    *inbuf = (const char *)src;
+    *outbuf = (char *)dst;
+    return count;
+}
+
+#if defined(HAVE_ICONV) && defined(HAVE_ICONV_H)
+#ifndef SDL_USE_LIBICONV
+// Define LIBICONV_PLUG to use iconv from the base instead of ports and avoid linker errors.
+#define LIBICONV_PLUG 1
+#endif
+#include <iconv.h>
+#include <errno.h>
+
+SDL_COMPILE_TIME_ASSERT(iconv_t, sizeof(iconv_t) <= sizeof(SDL_iconv_t));
+
+SDL_iconv_t SDL_iconv_open(const char *tocode, const char *fromcode)
+{
+    return (SDL_iconv_t)((uintptr_t)iconv_open(tocode, fromcode));
+}
+
+int SDL_iconv_close(SDL_iconv_t cd)
+{
+    if ((size_t)cd == SDL_ICONV_ERROR) {
+        return -1;
+    }
+    return iconv_close((iconv_t)((uintptr_t)cd));
+}
+
+size_t SDL_iconv(SDL_iconv_t cd,
+          const char **inbuf, size_t *inbytesleft,
+          char **outbuf, size_t *outbytesleft)
+{
+    if ((size_t)cd == SDL_ICONV_ERROR) {
+        return SDL_ICONV_ERROR;
+    }
+    /* iconv's second parameter may or may not be `const char const *` depending on the
+       C runtime's whims. Casting to void * seems to make everyone happy, though. */
+    const size_t retCode = iconv((iconv_t)((uintptr_t)cd), (void *)inbuf, inbytesleft, outbuf, outbytesleft);
+    if (retCode == (size_t)-1) {
+        switch (errno) {
+        case E2BIG:
+            return SDL_ICONV_E2BIG;
+        case EILSEQ:
+            return SDL_ICONV_EILSEQ;
+        case EINVAL:
+            return SDL_ICONV_EINVAL;
+        default:
+            return SDL_ICONV_ERROR;
+        }
+    }
+    return retCode;
+}
+
+#else
+
+/* Lots of useful information on Unicode at:
+    http://www.cl.cam.ac.uk/~mgk25/unicode.html
+*/
+
+#define UNICODE_BOM 0xFEFF
+
+#define UNKNOWN_ASCII   '?'
+#define UNKNOWN_UNICODE 0xFFFD
+
+struct SDL_iconv_data_t
+{
+    int src_fmt;
+    int dst_fmt;
+};
+
 static const char *getlocale(char *buffer, size_t bufsize)
 {
     const char *lang;
@@ -194,9 +997,7 @@ static const char *getlocale(char *buffer, size_t bufsize)
 
 SDL_iconv_t SDL_iconv_open(const char *tocode, const char *fromcode)
 {
-    int src_fmt = ENCODING_UNKNOWN;
-    int dst_fmt = ENCODING_UNKNOWN;
-    int i;
+    int src_fmt, dst_fmt;
     char fromcode_buffer[64];
     char tocode_buffer[64];
 
@@ -206,20 +1007,8 @@ SDL_iconv_t SDL_iconv_open(const char *tocode, const char *fromcode)
     if (!tocode || !*tocode) {
         tocode = getlocale(tocode_buffer, sizeof(tocode_buffer));
     }
-    for (i = 0; i < SDL_arraysize(encodings); ++i) {
-        if (SDL_strcasecmp(fromcode, encodings[i].name) == 0) {
-            src_fmt = encodings[i].format;
-            if (dst_fmt != ENCODING_UNKNOWN) {
-                break;
-            }
-        }
-        if (SDL_strcasecmp(tocode, encodings[i].name) == 0) {
-            dst_fmt = encodings[i].format;
-            if (src_fmt != ENCODING_UNKNOWN) {
-                break;
-            }
-        }
-    }
+    src_fmt = SDL_GetEncodingFormat(fromcode);
+    dst_fmt = SDL_GetEncodingFormat(tocode);
     if (src_fmt != ENCODING_UNKNOWN && dst_fmt != ENCODING_UNKNOWN) {
         SDL_iconv_t cd = (SDL_iconv_t)SDL_malloc(sizeof(*cd));
         if (cd) {
@@ -241,6 +1030,8 @@ size_t SDL_iconv(SDL_iconv_t cd,
     size_t srclen, dstlen;
     Uint32 ch = 0;
     size_t total;
+    bool fastpath;
+    int fastpath_skip = 0;
 
     if ((size_t)cd == SDL_ICONV_ERROR) {
         return SDL_ICONV_ERROR;
@@ -329,8 +1120,30 @@ size_t SDL_iconv(SDL_iconv_t cd,
         break;
     }
 
+    fastpath = SDL_iconv_HasFastPath(cd->src_fmt, cd->dst_fmt);
     total = 0;
     while (srclen > 0) {
+        if (fastpath) {
+            if (fastpath_skip > 0) {
+                --fastpath_skip;
+            } else {
+                const size_t count = SDL_iconv_FastPath(cd->src_fmt, cd->dst_fmt, &src, &srclen, &dst, &dstlen);
+                if (count > 0) {
+                    *inbuf = src;
+                    *inbytesleft = srclen;
+                    *outbuf = dst;
+                    *outbytesleft = dstlen;
+                    total += count;
+                    if (srclen == 0) {
+                        break;
+                    }
+                } else {
+                    // Let a few characters go by before trying again
+                    fastpath_skip = 16;
+                }
+            }
+        }
+
         // Decode a character
         switch (cd->src_fmt) {
         case ENCODING_ASCII:
@@ -795,6 +1608,8 @@ char *SDL_iconv_string(const char *tocode, const char *fromcode, const char *inb
     char *outbuf;
     size_t outbytesleft;
     size_t retCode = 0;
+    int src_fmt, dst_fmt;
+    bool fastpath;
 
     if (!tocode || !*tocode) {
         tocode = "UTF-8";
@@ -808,6 +1623,13 @@ char *SDL_iconv_string(const char *tocode, const char *fromcode, const char *inb
     }
 
     stringsize = inbytesleft;
+    src_fmt = SDL_GetEncodingFormat(fromcode);
+    dst_fmt = SDL_GetEncodingFormat(tocode);
+    fastpath = SDL_iconv_HasFastPath(src_fmt, dst_fmt) && inbytesleft <= (SDL_SIZE_MAX - sizeof(Uint32)) / 4;
+    if (fastpath) {
+        // Make enough room that the fast path can convert everything in one go
+        stringsize = SDL_max(stringsize, SDL_iconv_FastPathBound(src_fmt, dst_fmt, inbytesleft));
+    }
     string = (char *)SDL_malloc(stringsize + sizeof(Uint32));
     if (!string) {
         SDL_iconv_close(cd);
@@ -817,6 +1639,10 @@ char *SDL_iconv_string(const char *tocode, const char *fromcode, const char *inb
     outbytesleft = stringsize;
     SDL_memset(outbuf, 0, sizeof(Uint32));
 
+    if (fastpath) {
+        SDL_iconv_FastPath(src_fmt, dst_fmt, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+    }
+
     while (inbytesleft > 0) {
         const size_t oldinbytesleft = inbytesleft;
         retCode = SDL_iconv(cd, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
@@ -20,6 +20,8 @@
 */
 #include "SDL_internal.h"
 
+#include "SDL_sysstdlib.h"
+
 /* This file contains portable memory management functions for SDL */
 
 #ifndef HAVE_MALLOC
@@ -6449,15 +6451,322 @@ static void *SDLCALL real_realloc(IN void *pPtr, IN size_t dwBytes)
 }
 
 #elif defined(HAVE_MALLOC)
+#ifdef HAVE_MALLINFO2
+#include <malloc.h>
+#endif
 static void * SDLCALL real_malloc(size_t s) { return malloc(s); }
 static void * SDLCALL real_calloc(size_t n, size_t s) { return calloc(n, s); }
 static void * SDLCALL real_realloc(void *p, size_t s) { return realloc(p,s); }
 static void   SDLCALL real_free(void *p) { free(p); }
+#else
+#ifdef SDL_MALLOC_THREAD_CACHE
+#if defined(_MSC_VER)
+#define SDL_MALLOC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define SDL_MALLOC_THREAD_LOCAL __thread
+#else
+#undef SDL_MALLOC_THREAD_CACHE  // no compiler-supported thread-local variables
+#endif
+#endif
+
+#ifdef SDL_MALLOC_THREAD_CACHE
+/* Each thread keeps free lists of small blocks, one per size class, in front
+   of dlmalloc. Blocks move between a thread's cache and the shared heap in
+   batches, so most small allocations and frees don't touch the heap lock.
+   A block freed on another thread just goes into that thread's cache.
+
+   Only the owning thread touches a cache, so its counts are kept without
+   atomics. Whenever it refills or flushes a bin the thread publishes a
+   snapshot of them under the cache's lock, which is what
+   SDL_GetMemoryStats() reads. */
+#define CACHE_GRANULE       16
+#define CACHE_NUM_CLASSES   32
+#define CACHE_MAX_SIZE      (CACHE_NUM_CLASSES * CACHE_GRANULE)
+#define CACHE_MAX_BATCH     32
+#define CACHE_CLASS_SIZE(c) (((size_t)(c) + 1) * CACHE_GRANULE)
+// About 4K worth of blocks per batch, and a bin holds at most two batches
+#define CACHE_BATCH(c)      SDL_clamp((int)(4096 / CACHE_CLASS_SIZE(c)), 8, CACHE_MAX_BATCH)
+
+typedef struct SDL_MallocCacheBin
+{
+    void *head;
+    int count;
+} SDL_MallocCacheBin;
+
+typedef struct SDL_MallocCacheCounts
+{
+    Uint64 num_allocations;
+    Uint64 num_frees;
+    Uint64 hits;
+    Uint64 refills;
+    Uint64 flushes;
+    size_t cached_bytes;
+} SDL_MallocCacheCounts;
+
+typedef struct SDL_MallocThreadCache
+{
+    SDL_MallocCacheBin bins[CACHE_NUM_CLASSES];
+    SDL_MallocCacheCounts counts;       // only used by the owning thread
+    SDL_SpinLock lock;                  // protects published
+    SDL_MallocCacheCounts published;
+    bool owned;
+    struct SDL_MallocThreadCache *next;
+} SDL_MallocThreadCache;
+
+static SDL_MALLOC_THREAD_LOCAL SDL_MallocThreadCache *cache_current;
+static SDL_MALLOC_THREAD_LOCAL bool cache_disabled;
+static SDL_SpinLock cache_lock;
+static SDL_MallocThreadCache *cache_list;  // released caches are reused by new threads
+static SDL_TLSID cache_tls;
+
+static SDL_MallocCacheCounts cache_retired;  // the counts of caches that have been freed
+
+static void PublishCacheCounts(SDL_MallocThreadCache *cache)
+{
+    size_t cached_bytes = 0;
+    int i;
+
+    for (i = 0; i < CACHE_NUM_CLASSES; ++i) {
+        cached_bytes += cache->bins[i].count * CACHE_CLASS_SIZE(i);
+    }
+    cache->counts.cached_bytes = cached_bytes;
+
+    SDL_LockSpinlock(&cache->lock);
+    cache->published = cache->counts;
+    SDL_UnlockSpinlock(&cache->lock);
+}
+
+static void FlushCacheBin(SDL_MallocThreadCache *cache, SDL_MallocCacheBin *bin, int count)
+{
+    void *blocks[CACHE_MAX_BATCH];
+
+    while (count > 0) {
+        int i, n = SDL_min(count, CACHE_MAX_BATCH);
+        for (i = 0; i < n; ++i) {
+            blocks[i] = bin->head;
+            bin->head = *(void **)bin->head;
+        }
+        bin->count -= n;
+        count -= n;
+        dlbulk_free(blocks, n);
+        ++cache->counts.flushes;
+    }
+}
+
+static void SDLCALL ReleaseThreadCache(void *data)
+{
+    SDL_MallocThreadCache *cache = (SDL_MallocThreadCache *)data;
+    int i;
+
+    /* This runs from SDL_CleanupTLS(), which still frees the thread's TLS
+       storage afterwards. Those frees, and anything else this thread does
+       from now on, go straight to the heap instead of picking up a new
+       cache and TLS storage that nothing would ever clean up. */
+    cache_disabled = true;
+    if (cache_current == cache) {
+        cache_current = NULL;
+    }
+
+    for (i = 0; i < CACHE_NUM_CLASSES; ++i) {
+        FlushCacheBin(cache, &cache->bins[i], cache->bins[i].count);
+    }
+    PublishCacheCounts(cache);
+
+    SDL_LockSpinlock(&cache_lock);
+    cache->owned = false;
+    SDL_UnlockSpinlock(&cache_lock);
+}
+
+static SDL_MallocThreadCache *GetThreadCache(void)
+{
+    SDL_MallocThreadCache *cache = cache_current;
+    if (cache || cache_disabled) {
+        return cache;
+    }
+
+    // Allocations made while setting up go straight to the heap
+    cache_disabled = true;
+
+    SDL_LockSpinlock(&cache_lock);
+    for (cache = cache_list; cache; cache = cache->next) {
+        if (!cache->owned) {
+            break;
+        }
+    }
+    if (!cache) {
+        cache = (SDL_MallocThreadCache *)dlcalloc(1, sizeof(*cache));
+        if (cache) {
+            cache->next = cache_list;
+            cache_list = cache;
+        }
+    }
+    if (cache) {
+        cache->owned = true;
+    }
+    SDL_UnlockSpinlock(&cache_lock);
+
+    if (cache) {
+        // This flushes the cache when the thread calls SDL_CleanupTLS()
+        if (SDL_SetTLS(&cache_tls, cache, ReleaseThreadCache)) {
+            cache_current = cache;
+            cache_disabled = false;
+        } else {
+            ReleaseThreadCache(cache);
+            cache = NULL;
+        }
+    }
+    return cache;
+}
+
+void SDL_FreeMemoryCaches(void)
+{
+    SDL_MallocThreadCache **prev, *cache;
+
+    /* Caches released by their threads are empty and can go. Threads that
+       SDL didn't create, or that never called SDL_CleanupTLS(), still own
+       theirs, and since only the owner may touch a cache, their blocks stay
+       where they are. */
+    SDL_LockSpinlock(&cache_lock);
+    prev = &cache_list;
+    while ((cache = *prev) != NULL) {
+        if (cache->owned) {
+            prev = &cache->next;
+        } else {
+            cache_retired.num_allocations += cache->counts.num_allocations;
+            cache_retired.num_frees += cache->counts.num_frees;
+            cache_retired.hits += cache->counts.hits;
+            cache_retired.refills += cache->counts.refills;
+            cache_retired.flushes += cache->counts.flushes;
+            *prev = cache->next;
+            dlfree(cache);
+        }
+    }
+    SDL_UnlockSpinlock(&cache_lock);
+}
+
+static void * SDLCALL real_malloc(size_t size)
+{
+    SDL_MallocThreadCache *cache = GetThreadCache();
+    SDL_MallocCacheBin *bin;
+    void *mem;
+    int c;
+
+    if (!cache) {
+        return dlmalloc(size);
+    }
+    ++cache->counts.num_allocations;
+
+    if (size > CACHE_MAX_SIZE) {
+        return dlmalloc(size);
+    }
+
+    c = size ? (int)((size - 1) / CACHE_GRANULE) : 0;
+    bin = &cache->bins[c];
+    if (bin->head) {
+        mem = bin->head;
+        bin->head = *(void **)mem;
+        --bin->count;
+        ++cache->counts.hits;
+        return mem;
+    }
+
+    // Carve a batch of blocks out of the heap with a single lock
+    {
+        void *blocks[CACHE_MAX_BATCH];
+        size_t sizes[CACHE_MAX_BATCH];
+        int i, n = CACHE_BATCH(c);
+
+        for (i = 0; i < n; ++i) {
+            sizes[i] = CACHE_CLASS_SIZE(c);
+        }
+        if (!dlindependent_comalloc(n, sizes, blocks)) {
+            return dlmalloc(size);
+        }
+        ++cache->counts.refills;
+
+        for (i = 1; i < n; ++i) {
+            *(void **)blocks[i] = bin->head;
+            bin->head = blocks[i];
+        }
+        bin->count += n - 1;
+        PublishCacheCounts(cache);
+        return blocks[0];
+    }
+}
+
+static void SDLCALL real_free(void *mem)
+{
+    SDL_MallocThreadCache *cache;
+    SDL_MallocCacheBin *bin;
+    size_t usable;
+    int c;
+
+    if (!mem) {
+        return;
+    }
+
+    cache = GetThreadCache();
+    if (!cache) {
+        dlfree(mem);
+        return;
+    }
+    ++cache->counts.num_frees;
+
+    // Blocks go in the largest class they can satisfy
+    usable = dlmalloc_usable_size(mem);
+    if (usable < CACHE_GRANULE || usable / CACHE_GRANULE > CACHE_NUM_CLASSES) {
+        dlfree(mem);
+        return;
+    }
+    c = (int)(usable / CACHE_GRANULE) - 1;
+    bin = &cache->bins[c];
+    *(void **)mem = bin->head;
+    bin->head = mem;
+    if (++bin->count >= 2 * CACHE_BATCH(c)) {
+        FlushCacheBin(cache, bin, CACHE_BATCH(c));
+        PublishCacheCounts(cache);
+    }
+}
+
+static void * SDLCALL real_calloc(size_t nmemb, size_t size)
+{
+    void *mem;
+
+    if (size && nmemb > SDL_SIZE_MAX / size) {
+        return NULL;
+    }
+    size *= nmemb;
+    if (size > CACHE_MAX_SIZE) {
+        SDL_MallocThreadCache *cache = GetThreadCache();
+        if (cache) {
+            ++cache->counts.num_allocations;
+        }
+        return dlcalloc(1, size);
+    }
+
+    mem = real_malloc(size);
+    if (mem) {
+        SDL_memset(mem, 0, size);
+    }
+    return mem;
+}
+
+static void * SDLCALL real_realloc(void *mem, size_t size)
+{
+    if (!mem) {
+        return real_malloc(size);
+    }
+    // Cached blocks are ordinary heap blocks, so dlmalloc can resize them
+    return dlrealloc(mem, size);
+}
+
 #else
 #define real_malloc dlmalloc
 #define real_calloc dlcalloc
 #define real_realloc dlrealloc
 #define real_free dlfree
+#endif // SDL_MALLOC_THREAD_CACHE
+#define SDL_MALLOC_HAVE_STATS
 #endif
 
 // mark the allocator entry points as KEEPALIVE so we can call these from JavaScript.
@@ -6566,6 +6875,66 @@ int SDL_GetNumAllocations(void)
 #endif
 }
 
+#if !defined(SDL_MALLOC_HAVE_STATS) || !defined(SDL_MALLOC_THREAD_CACHE)
+void SDL_FreeMemoryCaches(void)
+{
+}
+#endif
+
+bool SDL_GetMemoryStats(SDL_MemoryStats *stats)
+{
+    CHECK_PARAM(!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+
+    SDL_zerop(stats);
+
+#ifdef SDL_MALLOC_HAVE_STATS
+    {
+        struct mallinfo info = dlmallinfo();
+        stats->heap_in_use = info.uordblks;
+        stats->heap_size = dlmalloc_footprint();
+        stats->heap_peak_size = dlmalloc_max_footprint();
+    }
+#ifdef SDL_MALLOC_THREAD_CACHE
+    {
+        SDL_MallocThreadCache *cache;
+
+        SDL_LockSpinlock(&cache_lock);
+        stats->num_allocations = cache_retired.num_allocations;
+        stats->num_frees = cache_retired.num_frees;
+        stats->cache_hits = cache_retired.hits;
+        stats->cache_refills = cache_retired.refills;
+        stats->cache_flushes = cache_retired.flushes;
+        for (cache = cache_list; cache; cache = cache->next) {
+            SDL_MallocCacheCounts counts;
+
+            SDL_LockSpinlock(&cache->lock);
+            counts = cache->published;
+            SDL_UnlockSpinlock(&cache->lock);
+
+            stats->num_allocations += counts.num_allocations;
+            stats->num_frees += counts.num_frees;
+            stats->cache_hits += counts.hits;
+            stats->cache_refills += counts.refills;
+            stats->cache_flushes += counts.flushes;
+            stats->cached_bytes += counts.cached_bytes;
+            ++stats->num_thread_caches;
+        }
+        SDL_UnlockSpinlock(&cache_lock);
+    }
+#endif
+#elif defined(HAVE_MALLINFO2)
+    {
+        // The C runtime allocator only tells us about its heap
+        struct mallinfo2 info = mallinfo2();
+        stats->heap_in_use = info.uordblks + info.hblkhd;
+        stats->heap_size = info.arena + info.hblkhd;
+    }
+#endif
+    return true;
+}
+
 void *SDL_malloc(size_t size)
 {
     void *mem;
@@ -6630,3 +6999,189 @@ void SDL_free(void *ptr)
     s_mem.free_func(ptr);
     DECREMENT_ALLOCATION_COUNT();
 }
+
+// Memory arenas hand out memory from large blocks and free it all at once
+
+#define SDL_ARENA_ALIGNMENT         16
+#define SDL_ARENA_DEFAULT_BLOCK_SIZE 4096
+
+struct SDL_MemoryArenaBlock
+{
+    SDL_AtomicInt refcount;     // one for the arena, plus one for each SDL_RetainArenaBlock()
+    size_t size;
+    size_t used;
+    struct SDL_MemoryArenaBlock *next;
+};
+
+#define ARENA_BLOCK_DATA(block) ((Uint8 *)((block) + 1))
+
+struct SDL_MemoryArena
+{
+    size_t block_size;
+    SDL_MemoryArenaBlock *blocks;   // blocks in use, the current one first
+    SDL_MemoryArenaBlock *spare;    // empty blocks kept by SDL_ResetMemoryArena()
+};
+
+SDL_MemoryArena *SDL_CreateMemoryArena(size_t block_size)
+{
+    SDL_MemoryArena *arena = (SDL_MemoryArena *)SDL_calloc(1, sizeof(*arena));
+    if (!arena) {
+        return NULL;
+    }
+    arena->block_size = block_size ? block_size : SDL_ARENA_DEFAULT_BLOCK_SIZE;
+    return arena;
+}
+
+static SDL_MemoryArenaBlock *CreateArenaBlock(size_t size)
+{
+    SDL_MemoryArenaBlock *block;
+
+    // Leave room to align the first allocation, since SDL_malloc() may not
+    if (size > SDL_SIZE_MAX - sizeof(*block) - SDL_ARENA_ALIGNMENT) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    size += SDL_ARENA_ALIGNMENT;
+
+    block = (SDL_MemoryArenaBlock *)SDL_malloc(sizeof(*block) + size);
+    if (!block) {
+        return NULL;
+    }
+    SDL_SetAtomicInt(&block->refcount, 1);
+    block->size = size;
+    block->used = 0;
+    block->next = NULL;
+    return block;
+}
+
+static void *AllocateFromArenaBlock(SDL_MemoryArenaBlock *block, size_t size)
+{
+    Uint8 *data = ARENA_BLOCK_DATA(block);
+    uintptr_t offset = ((uintptr_t)(data + block->used) + (SDL_ARENA_ALIGNMENT - 1)) & ~(uintptr_t)(SDL_ARENA_ALIGNMENT - 1);
+
+    offset -= (uintptr_t)data;
+    if (offset > block->size || size > block->size - offset) {
+        return NULL;
+    }
+    block->used = offset + size;
+    return data + offset;
+}
+
+void *SDL_AllocateArenaMemory(SDL_MemoryArena *arena, size_t size)
+{
+    SDL_MemoryArenaBlock *block;
+    void *mem;
+
+    CHECK_PARAM(!arena) {
+        SDL_InvalidParamError("arena");
+        return NULL;
+    }
+
+    if (!size) {
+        size = 1;
+    }
+
+    if (arena->blocks) {
+        mem = AllocateFromArenaBlock(arena->blocks, size);
+        if (mem) {
+            return mem;
+        }
+    }
+
+    if (size > arena->block_size / 2) {
+        // Big allocations get a block of their own, behind the current one
+        block = CreateArenaBlock(size);
+        if (!block) {
+            return NULL;
+        }
+        if (arena->blocks) {
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        } else {
+            arena->blocks = block;
+        }
+        return AllocateFromArenaBlock(block, size);
+    }
+
+    if (arena->spare) {
+        block = arena->spare;
+        arena->spare = block->next;
+    } else {
+        block = CreateArenaBlock(arena->block_size);
+        if (!block) {
+            return NULL;
+        }
+    }
+    block->next = arena->blocks;
+    arena->blocks = block;
+    return AllocateFromArenaBlock(block, size);
+}
+
+void SDL_ResetMemoryArena(SDL_MemoryArena *arena)
+{
+    SDL_MemoryArenaBlock *block, *next;
+
+    if (!arena) {
+        return;
+    }
+
+    for (block = arena->blocks; block; block = next) {
+        next = block->next;
+        if (block->size == arena->block_size + SDL_ARENA_ALIGNMENT &&
+            SDL_GetAtomicInt(&block->refcount) == 1) {
+            block->used = 0;
+            block->next = arena->spare;
+            arena->spare = block;
+        } else {
+            // Big blocks aren't kept, and retained blocks live on until they're released
+            SDL_ReleaseArenaBlock(block);
+        }
+    }
+    arena->blocks = NULL;
+}
+
+void SDL_DestroyMemoryArena(SDL_MemoryArena *arena)
+{
+    SDL_MemoryArenaBlock *block, *next;
+
+    if (!arena) {
+        return;
+    }
+
+    SDL_ResetMemoryArena(arena);
+    for (block = arena->spare; block; block = next) {
+        next = block->next;
+        SDL_free(block);
+    }
+    SDL_free(arena);
+}
+
+bool SDL_ArenaBlockContains(const SDL_MemoryArenaBlock *block, const void *mem)
+{
+    const Uint8 *data = ARENA_BLOCK_DATA(block);
+    return (const Uint8 *)mem >= data && (const Uint8 *)mem < data + block->used;
+}
+
+SDL_MemoryArenaBlock *SDL_FindArenaBlock(SDL_MemoryArena *arena, const void *mem)
+{
+    SDL_MemoryArenaBlock *block;
+
+    for (block = arena->blocks; block; block = block->next) {
+        if (SDL_ArenaBlockContains(block, mem)) {
+            return block;
+        }
+    }
+    return NULL;
+}
+
+void SDL_RetainArenaBlock(SDL_MemoryArenaBlock *block)
+{
+    SDL_AtomicIncRef(&block->refcount);
+}
+
+void SDL_ReleaseArenaBlock(SDL_MemoryArenaBlock *block)
+{
+    if (SDL_AtomicDecRef(&block->refcount)) {
+        SDL_free(block);
+    }
+}
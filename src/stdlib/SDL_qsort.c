@@ -25,509 +25,594 @@
 // tapdance to support the various qsort_r interfaces, or bridge from
 // the C runtime's non-SDLCALL compare functions.
 
-#ifdef assert
-#undef assert
-#endif
-#define assert SDL_assert
-#ifdef malloc
-#undef malloc
-#endif
-#define malloc SDL_malloc
-#ifdef free
-#undef free
-#endif
-#define free SDL_free
-#ifdef memcpy
-#undef memcpy
-#endif
-#define memcpy SDL_memcpy
-#ifdef memmove
-#undef memmove
-#endif
-#define memmove SDL_memmove
+/* This is pattern-defeating quicksort (pdqsort) by Orson Peters, which is
+   also under the zlib license: https://github.com/orlp/pdqsort
+
+   It's an introsort with a few extra tricks:
+   - Pivots are the median of three elements, or Tukey's ninther for larger
+     ranges.
+   - When the pivot is equal to the pivot of the range before it, all the
+     elements equal to it are moved to the front in one pass and left alone,
+     so arrays with lots of duplicates sort in linear time.
+   - Partitions that end up badly unbalanced swap a few elements around to
+     break up whatever pattern caused it, and after log2(n) of them we give
+     up and use heapsort, so the worst case is O(n log n).
+   - Ranges that didn't need any swaps to partition are checked for being
+     already sorted with an insertion sort that gives up after a few moves.
+
+   The original is C++ and moves the pivot into a temporary. Here, the pivot
+   stays at the start of the range while partitioning and elements are only
+   ever swapped, so we never allocate memory no matter how big they are.
+   We recurse into the smaller side of each partition, so the stack depth is
+   at most log2(n).
+*/
 
-/*
-This code came from Gareth McCaughan, under the zlib license.
-Specifically this: https://www.mccaughan.org.uk/software/qsort.c-1.16
+#define INSERTION_SORT_THRESHOLD     24
+#define NINTHER_THRESHOLD            128
+#define PARTIAL_INSERTION_SORT_LIMIT 8
 
-Everything below this comment until the HAVE_QSORT #endif was from Gareth
-(any minor changes will be noted inline).
+typedef struct SDL_SortContext
+{
+    size_t size;
+    SDL_CompareCallback_r compare;
+    void *userdata;
+} SDL_SortContext;
 
-Thank you to Gareth for relicensing this code under the zlib license for our
-benefit!
+#define LESS(a, b) (ctx->compare(ctx->userdata, (a), (b)) < 0)
 
-Update for SDL3: we have modified this from a qsort function to qsort_r.
+static int floor_log2(size_t n)
+{
+    int log = 0;
+    while (n >>= 1) {
+        ++log;
+    }
+    return log;
+}
 
---ryan.
-*/
+static SDL_INLINE void swap_elements(char *a, char *b, size_t size)
+{
+    if (((size | (uintptr_t)a | (uintptr_t)b) & (sizeof(Uint64) - 1)) == 0) {
+        Uint64 *aa = (Uint64 *)a, *bb = (Uint64 *)b;
+        do {
+            Uint64 t = *aa;
+            *aa++ = *bb;
+            *bb++ = t;
+        } while (size -= sizeof(Uint64));
+    } else if (((size | (uintptr_t)a | (uintptr_t)b) & (sizeof(Uint32) - 1)) == 0) {
+        Uint32 *aa = (Uint32 *)a, *bb = (Uint32 *)b;
+        do {
+            Uint32 t = *aa;
+            *aa++ = *bb;
+            *bb++ = t;
+        } while (size -= sizeof(Uint32));
+    } else {
+        do {
+            char t = *a;
+            *a++ = *b;
+            *b++ = t;
+        } while (--size);
+    }
+}
 
-/* This is a drop-in replacement for the C library's |qsort()| routine.
- *
- * It is intended for use where you know or suspect that your
- * platform's qsort is bad. If that isn't the case, then you
- * should probably use the qsort your system gives you in preference
- * to mine -- it will likely have been tested and tuned better.
- *
- * Features:
- *   - Median-of-three pivoting (and more)
- *   - Truncation and final polishing by a single insertion sort
- *   - Early truncation when no swaps needed in pivoting step
- *   - Explicit recursion, guaranteed not to overflow
- *   - A few little wrinkles stolen from the GNU |qsort()|.
- *     (For the avoidance of doubt, no code was stolen, only
- *     broad ideas.)
- *   - separate code for non-aligned / aligned / word-size objects
- *
- * Earlier releases of this code used an idiosyncratic licence
- * I wrote myself, because I'm an idiot. The code is now released
- * under the "zlib/libpng licence"; you will find the actual
- * terms in the next comment. I request (but do not require)
- * that if you make any changes beyond the name of the exported
- * routine and reasonable tweaks to the TRUNC_* and
- * PIVOT_THRESHOLD values, you modify the _ID string so as
- * to make it clear that you have changed the code.
- *
- * If you find problems with this code, or find ways of
- * making it significantly faster, please let me know!
- * My e-mail address, valid as of early 2016 and for the
- * foreseeable future, is
- *    gareth.mccaughan@pobox.com
- * Thanks!
- *
- * Gareth McCaughan
- */
-
-/* Copyright (c) 1998-2021 Gareth McCaughan
- *
- * This software is provided 'as-is', without any express or implied
- * warranty. In no event will the authors be held liable for any
- * damages arising from the use of this software.
- *
- * Permission is granted to anyone to use this software for any purpose,
- * including commercial applications, and to alter it and redistribute it
- * freely, subject to the following restrictions:
- *
- * 1. The origin of this software must not be misrepresented;
- *    you must not claim that you wrote the original software.
- *    If you use this software in a product, an acknowledgment
- *    in the product documentation would be appreciated but
- *    is not required.
- *
- * 2. Altered source versions must be plainly marked as such,
- *    and must not be misrepresented as being the original software.
- *
- * 3. This notice may not be removed or altered from any source
- *    distribution.
- */
-
-/* Revision history since release:
- *   1998-03-19 v1.12 First release I have any records of.
- *   2007-09-02 v1.13 Fix bug kindly reported by Dan Bodoh
- *                    (premature termination of recursion).
- *                    Add a few clarifying comments.
- *                    Minor improvements to debug output.
- *   2016-02-21 v1.14 Replace licence with 2-clause BSD,
- *                    and clarify a couple of things in
- *                    comments. No code changes.
- *   2016-03-10 v1.15 Fix bug kindly reported by Ryan Gordon
- *                    (pre-insertion-sort messed up).
- *                    Disable DEBUG_QSORT by default.
- *                    Tweak comments very slightly.
- *   2021-02-20 v1.16 Fix bug kindly reported by Ray Gardner
- *                    (error in recursion leading to possible
- *                    stack overflow).
- *                    When checking alignment, avoid casting
- *                    pointer to possibly-smaller integer.
- */
-
-/* BEGIN SDL CHANGE ... commented this out with an #if 0 block. --ryan. */
-#if 0
-#include <assert.h>
-#include <stdint.h>
-#include <stdlib.h>
-#include <string.h>
-
-#undef DEBUG_QSORT
-
-static char _ID[]="<qsort.c gjm WITH CHANGES FOR SDL3 1.16 2021-02-20>";
-#endif
-/* END SDL CHANGE ... commented this out with an #if 0 block. --ryan. */
-
-/* How many bytes are there per word? (Must be a power of 2,
- * and must in fact equal sizeof(int).)
- */
-#define WORD_BYTES sizeof(int)
-
-/* How big does our stack need to be? Answer: one entry per
- * bit in a |size_t|. (Actually, a bit less because we don't
- * recurse all the way down to size-1 subarrays.)
- */
-#define STACK_SIZE (8*sizeof(size_t))
-
-/* Different situations have slightly different requirements,
- * and we make life epsilon easier by using different truncation
- * points for the three different cases.
- * So far, I have tuned TRUNC_words and guessed that the same
- * value might work well for the other two cases. Of course
- * what works well on my machine might work badly on yours.
- */
-#define TRUNC_nonaligned	12
-#define TRUNC_aligned		12
-#define TRUNC_words		12*WORD_BYTES	/* nb different meaning */
-
-/* We use a simple pivoting algorithm for shortish sub-arrays
- * and a more complicated one for larger ones. The threshold
- * is PIVOT_THRESHOLD.
- */
-#define PIVOT_THRESHOLD 40
-
-typedef struct { char * first; char * last; } stack_entry;
-#define pushLeft {stack[stacktop].first=ffirst;stack[stacktop++].last=last;}
-#define pushRight {stack[stacktop].first=first;stack[stacktop++].last=llast;}
-#define doLeft {first=ffirst;llast=last;continue;}
-#define doRight {ffirst=first;last=llast;continue;}
-#define pop {if (--stacktop<0) break;\
-  first=ffirst=stack[stacktop].first;\
-  last=llast=stack[stacktop].last;\
-  continue;}
-
-/* Some comments on the implementation.
- * 1. When we finish partitioning the array into "low"
- *    and "high", we forget entirely about short subarrays,
- *    because they'll be done later by insertion sort.
- *    Doing lots of little insertion sorts might be a win
- *    on large datasets for locality-of-reference reasons,
- *    but it makes the code much nastier and increases
- *    bookkeeping overhead.
- * 2. We always save the longer and get to work on the
- *    shorter. This guarantees that whenever we push
- *    a k'th entry onto the stack we are about to get
- *    working on something of size <= N/2^k where N is
- *    the original array size; so the stack can't need
- *    more than log_2(max-array-size) entries.
- * 3. We choose a pivot by looking at the first, last
- *    and middle elements. We arrange them into order
- *    because it's easy to do that in conjunction with
- *    choosing the pivot, and it makes things a little
- *    easier in the partitioning step. Anyway, the pivot
- *    is the middle of these three. It's still possible
- *    to construct datasets where the algorithm takes
- *    time of order n^2, but it simply never happens in
- *    practice.
- * 3' Newsflash: On further investigation I find that
- *    it's easy to construct datasets where median-of-3
- *    simply isn't good enough. So on large-ish subarrays
- *    we do a more sophisticated pivoting: we take three
- *    sets of 3 elements, find their medians, and then
- *    take the median of those.
- * 4. We copy the pivot element to a separate place
- *    because that way we can always do our comparisons
- *    directly against a pointer to that separate place,
- *    and don't have to wonder "did we move the pivot
- *    element?". This makes the inner loop better.
- * 5. It's possible to make the pivoting even more
- *    reliable by looking at more candidates when n
- *    is larger. (Taking this to its logical conclusion
- *    results in a variant of quicksort that doesn't
- *    have that n^2 worst case.) However, the overhead
- *    from the extra bookkeeping means that it's just
- *    not worth while.
- * 6. This is pretty clean and portable code. Here are
- *    all the potential portability pitfalls and problems
- *    I know of:
- *      - In one place (the insertion sort) I construct
- *        a pointer that points just past the end of the
- *        supplied array, and assume that (a) it won't
- *        compare equal to any pointer within the array,
- *        and (b) it will compare equal to a pointer
- *        obtained by stepping off the end of the array.
- *        These might fail on some segmented architectures.
- *      - I assume that there are 8 bits in a |char| when
- *        computing the size of stack needed. This would
- *        fail on machines with 9-bit or 16-bit bytes.
- *      - I assume that if |((int)base&(sizeof(int)-1))==0|
- *        and |(size&(sizeof(int)-1))==0| then it's safe to
- *        get at array elements via |int*|s, and that if
- *        actually |size==sizeof(int)| as well then it's
- *        safe to treat the elements as |int|s. This might
- *        fail on systems that convert pointers to integers
- *        in non-standard ways.
- *      - I assume that |8*sizeof(size_t)<=INT_MAX|. This
- *        would be false on a machine with 8-bit |char|s,
- *        16-bit |int|s and 4096-bit |size_t|s. :-)
- */
-
-/* The recursion logic is the same in each case.
- * We keep chopping up until we reach subarrays of size
- * strictly less than Trunc; we leave these unsorted. */
-#define Recurse(Trunc)				\
-      { size_t l=last-ffirst,r=llast-first;	\
-        if (l<Trunc) {				\
-          if (r>=Trunc) doRight			\
-          else pop				\
-        }					\
-        else if (l<=r) { pushRight; doLeft }	\
-        else if (r>=Trunc) { pushLeft; doRight }\
-        else doLeft				\
-      }
-
-/* and so is the pivoting logic (note: last is inclusive): */
-#define Pivot(swapper,sz)			\
-  if ((size_t)(last-first)>PIVOT_THRESHOLD*sz) mid=pivot_big(first,mid,last,sz,compare,userdata);\
-  else {	\
-    if (compare(userdata,first,mid)<0) {			\
-      if (compare(userdata,mid,last)>0) {		\
-        swapper(mid,last);			\
-        if (compare(userdata,first,mid)>0) swapper(first,mid);\
-      }						\
-    }						\
-    else {					\
-      if (compare(userdata,mid,last)>0) swapper(first,last)\
-      else {					\
-        swapper(first,mid);			\
-        if (compare(userdata,mid,last)>0) swapper(mid,last);\
-      }						\
-    }						\
-    first+=sz; last-=sz;			\
-  }
-
-#ifdef DEBUG_QSORT
-#include <stdio.h>
-#endif
-
-/* and so is the partitioning logic: */
-#define Partition(swapper,sz) {			\
-  do {						\
-    while (compare(userdata,first,pivot)<0) first+=sz;	\
-    while (compare(userdata,pivot,last)<0) last-=sz;	\
-    if (first<last) {				\
-      swapper(first,last);			\
-      first+=sz; last-=sz; }			\
-    else if (first==last) { first+=sz; last-=sz; break; }\
-  } while (first<=last);			\
+static void sort2(char *a, char *b, const SDL_SortContext *ctx)
+{
+    if (LESS(b, a)) {
+        swap_elements(a, b, ctx->size);
+    }
 }
 
-/* and so is the pre-insertion-sort operation of putting
- * the smallest element into place as a sentinel.
- * Doing this makes the inner loop nicer. I got this
- * idea from the GNU implementation of qsort().
- * We find the smallest element from the first |nmemb|,
- * or the first |limit|, whichever is smaller;
- * therefore we must have ensured that the globally smallest
- * element is in the first |limit| (because our
- * quicksort recursion bottoms out only once we
- * reach subarrays smaller than |limit|).
- */
-#define PreInsertion(swapper,limit,sz)		\
-  first=base;					\
-  last=first + ((nmemb>limit ? limit : nmemb)-1)*sz;\
-  while (last!=base) {				\
-    if (compare(userdata,first,last)>0) first=last;	\
-    last-=sz; }					\
-  if (first!=base) swapper(first,(char*)base);
-
-/* and so is the insertion sort, in the first two cases: */
-#define Insertion(swapper)			\
-  last=((char*)base)+nmemb*size;		\
-  for (first=((char*)base)+size;first!=last;first+=size) {	\
-    char *test;					\
-    /* Find the right place for |first|.	\
-     * My apologies for var reuse. */		\
-    for (test=first-size;test>=(char*)base&&compare(userdata,test,first)>0;test-=size) ;	\
-    test+=size;					\
-    if (test!=first) {				\
-      /* Shift everything in [test,first)	\
-       * up by one, and place |first|		\
-       * where |test| is. */			\
-      memcpy(pivot,first,size);			\
-      memmove(test+size,test,first-test);	\
-      memcpy(test,pivot,size);			\
-    }						\
-  }
-
-#define SWAP_nonaligned(a,b) { \
-  register char *aa=(a),*bb=(b); \
-  register size_t sz=size; \
-  do { register char t=*aa; *aa++=*bb; *bb++=t; } while (--sz); }
-
-#define SWAP_aligned(a,b) { \
-  register int *aa=(int*)(a),*bb=(int*)(b); \
-  register size_t sz=size; \
-  do { register int t=*aa;*aa++=*bb; *bb++=t; } while (sz-=WORD_BYTES); }
-
-#define SWAP_words(a,b) { \
-  register int t=*((int*)a); *((int*)a)=*((int*)b); *((int*)b)=t; }
-
-/* ---------------------------------------------------------------------- */
-
-static char * pivot_big(char *first, char *mid, char *last, size_t size,
-                        int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
-  size_t d=(((last-first)/size)>>3)*size;
-#ifdef DEBUG_QSORT
-fprintf(stderr, "pivot_big: first=%p last=%p size=%lu n=%lu\n", first, (unsigned long)last, size, (unsigned long)((last-first+1)/size));
-#endif
-  char *m1,*m2,*m3;
-  { char *a=first, *b=first+d, *c=first+2*d;
-#ifdef DEBUG_QSORT
-fprintf(stderr,"< %d %d %d @ %p %p %p\n",*(int*)a,*(int*)b,*(int*)c, a,b,c);
-#endif
-    m1 = compare(userdata,a,b)<0 ?
-           (compare(userdata,b,c)<0 ? b : (compare(userdata,a,c)<0 ? c : a))
-         : (compare(userdata,a,c)<0 ? a : (compare(userdata,b,c)<0 ? c : b));
-  }
-  { char *a=mid-d, *b=mid, *c=mid+d;
-#ifdef DEBUG_QSORT
-fprintf(stderr,". %d %d %d @ %p %p %p\n",*(int*)a,*(int*)b,*(int*)c, a,b,c);
-#endif
-    m2 = compare(userdata,a,b)<0 ?
-           (compare(userdata,b,c)<0 ? b : (compare(userdata,a,c)<0 ? c : a))
-         : (compare(userdata,a,c)<0 ? a : (compare(userdata,b,c)<0 ? c : b));
-  }
-  { char *a=last-2*d, *b=last-d, *c=last;
-#ifdef DEBUG_QSORT
-fprintf(stderr,"> %d %d %d @ %p %p %p\n",*(int*)a,*(int*)b,*(int*)c, a,b,c);
-#endif
-    m3 = compare(userdata,a,b)<0 ?
-           (compare(userdata,b,c)<0 ? b : (compare(userdata,a,c)<0 ? c : a))
-         : (compare(userdata,a,c)<0 ? a : (compare(userdata,b,c)<0 ? c : b));
-  }
-#ifdef DEBUG_QSORT
-fprintf(stderr,"-> %d %d %d @ %p %p %p\n",*(int*)m1,*(int*)m2,*(int*)m3, m1,m2,m3);
-#endif
-  return compare(userdata,m1,m2)<0 ?
-           (compare(userdata,m2,m3)<0 ? m2 : (compare(userdata,m1,m3)<0 ? m3 : m1))
-         : (compare(userdata,m1,m3)<0 ? m1 : (compare(userdata,m2,m3)<0 ? m3 : m2));
+static void sort3(char *a, char *b, char *c, const SDL_SortContext *ctx)
+{
+    sort2(a, b, ctx);
+    sort2(b, c, ctx);
+    sort2(a, b, ctx);
 }
 
-/* ---------------------------------------------------------------------- */
-
-static void qsort_r_nonaligned(void *base, size_t nmemb, size_t size,
-           int (SDLCALL *compare)(void *, const void *, const void *), void *userdata) {
-
-  stack_entry stack[STACK_SIZE];
-  int stacktop=0;
-  char *first,*last;
-  char *pivot=malloc(size);
-  size_t trunc=TRUNC_nonaligned*size;
-  assert(pivot != NULL);
-
-  first=(char*)base; last=first+(nmemb-1)*size;
-
-  if ((size_t)(last-first)>=trunc) {
-    char *ffirst=first, *llast=last;
-    while (1) {
-      /* Select pivot */
-      { char * mid=first+size*((last-first)/size >> 1);
-        if (mid>=last) break;
-        Pivot(SWAP_nonaligned,size);
-        memcpy(pivot,mid,size);
-      }
-      /* Partition. */
-      Partition(SWAP_nonaligned,size);
-      /* Prepare to recurse/iterate. */
-      Recurse(trunc)
-    }
-  }
-  PreInsertion(SWAP_nonaligned,TRUNC_nonaligned,size);
-  Insertion(SWAP_nonaligned);
-  free(pivot);
+static void insertion_sort(char *begin, char *end, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+    char *cur;
+
+    for (cur = begin + size; cur < end; cur += size) {
+        char *sift;
+        for (sift = cur; sift != begin && LESS(sift, sift - size); sift -= size) {
+            swap_elements(sift, sift - size, size);
+        }
+    }
 }
 
-static void qsort_r_aligned(void *base, size_t nmemb, size_t size,
-           int (SDLCALL *compare)(void *,const void *, const void *), void *userdata) {
-
-  stack_entry stack[STACK_SIZE];
-  int stacktop=0;
-  char *first,*last;
-  char *pivot=malloc(size);
-  size_t trunc=TRUNC_aligned*size;
-  assert(pivot != NULL);
-
-  first=(char*)base; last=first+(nmemb-1)*size;
-
-  if ((size_t)(last-first)>=trunc) {
-    char *ffirst=first,*llast=last;
-    while (1) {
-      /* Select pivot */
-      { char * mid=first+size*((last-first)/size >> 1);
-        if (mid>=last) break;
-        Pivot(SWAP_aligned,size);
-        memcpy(pivot,mid,size);
-      }
-      /* Partition. */
-      Partition(SWAP_aligned,size);
-      /* Prepare to recurse/iterate. */
-      Recurse(trunc)
-    }
-  }
-  PreInsertion(SWAP_aligned,TRUNC_aligned,size);
-  Insertion(SWAP_aligned);
-  free(pivot);
+// The element before begin must be no greater than anything in the range
+static void unguarded_insertion_sort(char *begin, char *end, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+    char *cur;
+
+    for (cur = begin + size; cur < end; cur += size) {
+        char *sift;
+        for (sift = cur; LESS(sift, sift - size); sift -= size) {
+            swap_elements(sift, sift - size, size);
+        }
+    }
 }
 
-static void qsort_r_words(void *base, size_t nmemb,
-           int (SDLCALL *compare)(void *,const void *, const void *), void *userdata) {
-
-  stack_entry stack[STACK_SIZE];
-  int stacktop=0;
-  char *first,*last;
-  char *pivot=malloc(WORD_BYTES);
-  assert(pivot != NULL);
-
-  first=(char*)base; last=first+(nmemb-1)*WORD_BYTES;
-
-  if (last-first>=TRUNC_words) {
-    char *ffirst=first, *llast=last;
-    while (1) {
-#ifdef DEBUG_QSORT
-fprintf(stderr,"Doing %d:%d: ",
-        (first-(char*)base)/WORD_BYTES,
-        (last-(char*)base)/WORD_BYTES);
-#endif
-      /* Select pivot */
-      { char * mid=first+WORD_BYTES*((last-first) / (2*WORD_BYTES));
-        if (mid>=last) break;
-        Pivot(SWAP_words,WORD_BYTES);
-        *(int*)pivot=*(int*)mid;
-#ifdef DEBUG_QSORT
-fprintf(stderr,"pivot = %p = #%lu = %d\n", mid, (unsigned long)(((int*)mid)-((int*)base)), *(int*)mid);
-#endif
-      }
-      /* Partition. */
-      Partition(SWAP_words,WORD_BYTES);
-#ifdef DEBUG_QSORT
-fprintf(stderr, "after partitioning first=#%lu last=#%lu\n", (first-(char*)base)/4lu, (last-(char*)base)/4lu);
-#endif
-      /* Prepare to recurse/iterate. */
-      Recurse(TRUNC_words)
-    }
-  }
-  PreInsertion(SWAP_words,TRUNC_words/WORD_BYTES,WORD_BYTES);
-  /* Now do insertion sort. */
-  last=((char*)base)+nmemb*WORD_BYTES;
-  for (first=((char*)base)+WORD_BYTES;first!=last;first+=WORD_BYTES) {
-    /* Find the right place for |first|. My apologies for var reuse */
-    int *pl=(int*)(first-WORD_BYTES),*pr=(int*)first;
-    *(int*)pivot=*(int*)first;
-    for (;pl>=(int*)base&&compare(userdata,pl,pivot)>0;pr=pl,--pl) {
-      *pr=*pl; }
-    if (pr!=(int*)first) *pr=*(int*)pivot;
-  }
-  free(pivot);
+// Returns false, leaving the range partly sorted, if it takes too many moves
+static bool partial_insertion_sort(char *begin, char *end, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+    size_t moves = 0;
+    char *cur;
+
+    for (cur = begin + size; cur < end; cur += size) {
+        char *sift;
+        for (sift = cur; sift != begin && LESS(sift, sift - size); sift -= size) {
+            swap_elements(sift, sift - size, size);
+            ++moves;
+        }
+        if (moves > PARTIAL_INSERTION_SORT_LIMIT) {
+            return false;
+        }
+    }
+    return true;
 }
 
-/* ---------------------------------------------------------------------- */
+static void sift_down(char *base, size_t root, size_t count, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
 
-void SDL_qsort_r(void *base, size_t nmemb, size_t size,
-           SDL_CompareCallback_r compare, void *userdata) {
+    for (;;) {
+        size_t child = 2 * root + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count && LESS(base + child * size, base + (child + 1) * size)) {
+            ++child;
+        }
+        if (!LESS(base + root * size, base + child * size)) {
+            break;
+        }
+        swap_elements(base + root * size, base + child * size, size);
+        root = child;
+    }
+}
 
-  if (nmemb<=1) return;
-  if (((uintptr_t)base|size)&(WORD_BYTES-1))
-    qsort_r_nonaligned(base,nmemb,size,compare,userdata);
-  else if (size!=WORD_BYTES)
-    qsort_r_aligned(base,nmemb,size,compare,userdata);
-  else
-    qsort_r_words(base,nmemb,compare,userdata);
+static void heap_sort(char *begin, char *end, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+    const size_t count = (size_t)(end - begin) / size;
+    size_t i;
+
+    for (i = count / 2; i-- > 0;) {
+        sift_down(begin, i, count, ctx);
+    }
+    for (i = count; i-- > 1;) {
+        swap_elements(begin, begin + i * size, size);
+        sift_down(begin, 0, i, ctx);
+    }
+}
+
+// Moves the median of a few elements to the start of the range, and makes sure the range has elements on both sides of it at the ends
+static void choose_pivot(char *begin, char *end, size_t count, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+    char *mid = begin + (count / 2) * size;
+
+    if (count > NINTHER_THRESHOLD) {
+        sort3(begin, mid, end - size, ctx);
+        sort3(begin + size, mid - size, end - 2 * size, ctx);
+        sort3(begin + 2 * size, mid + size, end - 3 * size, ctx);
+        sort3(mid - size, mid, mid + size, ctx);
+        swap_elements(begin, mid, size);
+    } else {
+        sort3(mid, begin, end - size, ctx);
+    }
+}
+
+/* Partitions the range around the pivot at begin, with the elements less
+   than it first. Returns where the pivot ended up. */
+static char *partition_right(char *begin, char *end, bool *already_partitioned, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+    char *first = begin;
+    char *last = end;
+    char *pivot_pos;
+
+    // choose_pivot() left an element no less than the pivot at the end, so this stops
+    do {
+        first += size;
+    } while (LESS(first, begin));
+
+    // If nothing was less than the pivot, there's nothing stopping this at the start
+    if (first - size == begin) {
+        while (first < last) {
+            last -= size;
+            if (LESS(last, begin)) {
+                break;
+            }
+        }
+    } else {
+        do {
+            last -= size;
+        } while (!LESS(last, begin));
+    }
+
+    *already_partitioned = (first >= last);
+
+    while (first < last) {
+        swap_elements(first, last, size);
+        do {
+            first += size;
+        } while (LESS(first, begin));
+        do {
+            last -= size;
+        } while (!LESS(last, begin));
+    }
+
+    pivot_pos = first - size;
+    if (pivot_pos != begin) {
+        swap_elements(begin, pivot_pos, size);
+    }
+    return pivot_pos;
+}
+
+/* Like partition_right(), but puts elements equal to the pivot first. It's
+   used when nothing in the range can be less than the pivot, so it ends up
+   with everything equal to the pivot in front of it. */
+static char *partition_left(char *begin, char *end, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+    char *first = begin;
+    char *last = end;
+
+    do {
+        last -= size;
+    } while (LESS(begin, last));
+
+    if (last + size == end) {
+        while (first < last) {
+            first += size;
+            if (LESS(begin, first)) {
+                break;
+            }
+        }
+    } else {
+        do {
+            first += size;
+        } while (!LESS(begin, first));
+    }
+
+    while (first < last) {
+        swap_elements(first, last, size);
+        do {
+            last -= size;
+        } while (LESS(begin, last));
+        do {
+            first += size;
+        } while (!LESS(begin, first));
+    }
+
+    if (last != begin) {
+        swap_elements(begin, last, size);
+    }
+    return last;
+}
+
+static void pdqsort_loop(char *begin, char *end, int bad_allowed, bool leftmost, const SDL_SortContext *ctx)
+{
+    const size_t size = ctx->size;
+
+    for (;;) {
+        const size_t count = (size_t)(end - begin) / size;
+        size_t l_size, r_size;
+        bool already_partitioned;
+        char *pivot_pos;
+
+        if (count < INSERTION_SORT_THRESHOLD) {
+            if (leftmost) {
+                insertion_sort(begin, end, ctx);
+            } else {
+                unguarded_insertion_sort(begin, end, ctx);
+            }
+            return;
+        }
+
+        choose_pivot(begin, end, count, ctx);
+
+        /* If the element before the range is equal to the pivot, nothing in
+           the range is less than it, and the equal elements are done. */
+        if (!leftmost && !LESS(begin - size, begin)) {
+            begin = partition_left(begin, end, ctx) + size;
+            continue;
+        }
+
+        pivot_pos = partition_right(begin, end, &already_partitioned, ctx);
+        l_size = (size_t)(pivot_pos - begin) / size;
+        r_size = (size_t)(end - pivot_pos) / size - 1;
+
+        if (l_size < count / 8 || r_size < count / 8) {
+            if (--bad_allowed == 0) {
+                heap_sort(begin, end, ctx);
+                return;
+            }
+
+            // Shuffle some elements around to break up the pattern
+            if (l_size >= INSERTION_SORT_THRESHOLD) {
+                swap_elements(begin, begin + (l_size / 4) * size, size);
+                swap_elements(pivot_pos - size, pivot_pos - (l_size / 4) * size, size);
+                if (l_size > NINTHER_THRESHOLD) {
+                    swap_elements(begin + size, begin + (l_size / 4 + 1) * size, size);
+                    swap_elements(begin + 2 * size, begin + (l_size / 4 + 2) * size, size);
+                    swap_elements(pivot_pos - 2 * size, pivot_pos - (l_size / 4 + 1) * size, size);
+                    swap_elements(pivot_pos - 3 * size, pivot_pos - (l_size / 4 + 2) * size, size);
+                }
+            }
+            if (r_size >= INSERTION_SORT_THRESHOLD) {
+                swap_elements(pivot_pos + size, pivot_pos + (1 + r_size / 4) * size, size);
+                swap_elements(end - size, end - (r_size / 4) * size, size);
+                if (r_size > NINTHER_THRESHOLD) {
+                    swap_elements(pivot_pos + 2 * size, pivot_pos + (2 + r_size / 4) * size, size);
+                    swap_elements(pivot_pos + 3 * size, pivot_pos + (3 + r_size / 4) * size, size);
+                    swap_elements(end - 2 * size, end - (1 + r_size / 4) * size, size);
+                    swap_elements(end - 3 * size, end - (2 + r_size / 4) * size, size);
+                }
+            }
+        } else if (already_partitioned &&
+                   partial_insertion_sort(begin, pivot_pos, ctx) &&
+                   partial_insertion_sort(pivot_pos + size, end, ctx)) {
+            return;
+        }
+
+        // Recurse into the smaller side and keep going with the larger one
+        if (l_size < r_size) {
+            pdqsort_loop(begin, pivot_pos, bad_allowed, leftmost, ctx);
+            begin = pivot_pos + size;
+            leftmost = false;
+        } else {
+            pdqsort_loop(pivot_pos + size, end, bad_allowed, false, ctx);
+            end = pivot_pos;
+        }
+    }
+}
+
+void SDL_qsort_r(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata)
+{
+    SDL_SortContext ctx;
+
+    if (nmemb <= 1 || size == 0) {
+        return;
+    }
+
+    ctx.size = size;
+    ctx.compare = compare;
+    ctx.userdata = userdata;
+    pdqsort_loop((char *)base, (char *)base + nmemb * size, floor_log2(nmemb), true, &ctx);
+}
+
+/* The parallel sort partitions the array the same way, handing one side of
+   each partition to the default job pool, until there are about twice as
+   many pieces as there are threads to sort them. Each piece is then finished
+   off with pdqsort. Every piece is tracked by the same job counter, so the
+   caller only has to wait once, at the end, and helps sort while it does. */
+
+#define PARALLEL_SORT_MIN_COUNT 16384
+
+typedef struct SDL_ParallelSortTask
+{
+    char *begin;
+    char *end;
+    bool leftmost;
+    int depth;
+    const SDL_SortContext *ctx;
+    SDL_JobCounter *counter;
+} SDL_ParallelSortTask;
+
+static void SDLCALL parallel_sort_job(void *data);
+
+static void parallel_sort(char *begin, char *end, bool leftmost, int depth, const SDL_SortContext *ctx, SDL_JobCounter *counter)
+{
+    const size_t size = ctx->size;
+
+    for (;;) {
+        const size_t count = (size_t)(end - begin) / size;
+        SDL_ParallelSortTask *task;
+        bool already_partitioned;
+        char *pivot_pos;
+
+        if (depth <= 0 || count < PARALLEL_SORT_MIN_COUNT) {
+            pdqsort_loop(begin, end, floor_log2(count), leftmost, ctx);
+            return;
+        }
+
+        choose_pivot(begin, end, count, ctx);
+        if (!leftmost && !LESS(begin - size, begin)) {
+            begin = partition_left(begin, end, ctx) + size;
+            continue;
+        }
+        pivot_pos = partition_right(begin, end, &already_partitioned, ctx);
+        depth--;
+
+        task = (SDL_ParallelSortTask *)SDL_malloc(sizeof(*task));
+        if (task) {
+            task->begin = begin;
+            task->end = pivot_pos;
+            task->leftmost = leftmost;
+            task->depth = depth;
+            task->ctx = ctx;
+            task->counter = counter;
+            if (!SDL_SubmitJob(NULL, parallel_sort_job, task, NULL, counter)) {
+                SDL_free(task);
+                task = NULL;
+            }
+        }
+        if (!task) {
+            parallel_sort(begin, pivot_pos, leftmost, depth, ctx, counter);
+        }
+
+        begin = pivot_pos + size;
+        leftmost = false;
+    }
+}
+
+static void SDLCALL parallel_sort_job(void *data)
+{
+    SDL_ParallelSortTask *task = (SDL_ParallelSortTask *)data;
+
+    parallel_sort(task->begin, task->end, task->leftmost, task->depth, task->ctx, task->counter);
+    SDL_free(task);
+}
+
+void SDL_ParallelSort(void *base, size_t nmemb, size_t size, SDL_CompareCallback_r compare, void *userdata)
+{
+    SDL_SortContext ctx;
+    SDL_JobCounter *counter = NULL;
+    int num_threads = 0;
+
+    if (nmemb <= 1 || size == 0) {
+        return;
+    }
+
+    ctx.size = size;
+    ctx.compare = compare;
+    ctx.userdata = userdata;
+
+    if (nmemb >= PARALLEL_SORT_MIN_COUNT * 2 && SDL_GetNumLogicalCPUCores() > 1) {
+        num_threads = SDL_GetNumJobPoolThreads(NULL);
+        if (num_threads > 0) {
+            counter = SDL_CreateJobCounter();
+        }
+    }
+    if (!counter) {
+        pdqsort_loop((char *)base, (char *)base + nmemb * size, floor_log2(nmemb), true, &ctx);
+        return;
+    }
+
+    // The calling thread sorts too, while it waits.
+    parallel_sort((char *)base, (char *)base + nmemb * size, true, floor_log2((size_t)num_threads) + 2, &ctx, counter);
+    SDL_WaitJobCounter(NULL, counter);
+    SDL_DestroyJobCounter(counter);
+}
+
+/* Least significant digit radix sort, a byte at a time. The histograms for
+   every byte are counted in a single pass up front, which also tells us
+   which bytes are the same in every key, so we can skip sorting on them. */
+static Uint64 get_radix_key(const char *element, size_t key_size, Uint64 sign_bit)
+{
+    if (key_size == sizeof(Uint32)) {
+        Uint32 key;
+        SDL_memcpy(&key, element, sizeof(key));
+        return key ^ sign_bit;
+    } else {
+        Uint64 key;
+        SDL_memcpy(&key, element, sizeof(key));
+        return key ^ sign_bit;
+    }
+}
+
+bool SDL_RadixSort(void *base, size_t nmemb, size_t size, size_t key_offset, SDL_SortKeyType key_type)
+{
+    size_t key_size;
+    Uint64 sign_bit;
+    size_t (*counts)[256];
+    size_t counts_size;
+    char *src, *dst, *scratch;
+    size_t i;
+    int digit;
+
+    switch (key_type) {
+    case SDL_SORTKEY_UINT32:
+        key_size = sizeof(Uint32);
+        sign_bit = 0;
+        break;
+    case SDL_SORTKEY_SINT32:
+        key_size = sizeof(Uint32);
+        sign_bit = 0x80000000u;
+        break;
+    case SDL_SORTKEY_UINT64:
+        key_size = sizeof(Uint64);
+        sign_bit = 0;
+        break;
+    case SDL_SORTKEY_SINT64:
+        key_size = sizeof(Uint64);
+        sign_bit = SDL_UINT64_C(0x8000000000000000);
+        break;
+    default:
+        return SDL_InvalidParamError("key_type");
+    }
+
+    CHECK_PARAM(!base && nmemb > 0) {
+        return SDL_InvalidParamError("base");
+    }
+    CHECK_PARAM(size < key_size || key_offset > size - key_size) {
+        return SDL_InvalidParamError("key_offset");
+    }
+
+    if (nmemb <= 1) {
+        return true;
+    }
+
+    counts_size = key_size * sizeof(*counts);
+    if (nmemb > (SDL_SIZE_MAX - counts_size) / size) {
+        return SDL_OutOfMemory();
+    }
+    counts = (size_t (*)[256])SDL_malloc(counts_size + nmemb * size);
+    if (!counts) {
+        return false;
+    }
+    SDL_memset(counts, 0, counts_size);
+    scratch = (char *)counts + counts_size;
+
+    src = (char *)base + key_offset;
+    for (i = 0; i < nmemb; ++i, src += size) {
+        const Uint64 key = get_radix_key(src, key_size, sign_bit);
+        for (digit = 0; digit < (int)key_size; ++digit) {
+            ++counts[digit][(key >> (digit * 8)) & 0xFF];
+        }
+    }
+
+    src = (char *)base;
+    dst = scratch;
+    for (digit = 0; digit < (int)key_size; ++digit) {
+        const int shift = digit * 8;
+        size_t offset = 0;
+        char *element;
+
+        if (counts[digit][(get_radix_key(src + key_offset, key_size, sign_bit) >> shift) & 0xFF] == nmemb) {
+            continue; // This byte is the same in every key
+        }
+
+        for (i = 0; i < 256; ++i) {
+            const size_t count = counts[digit][i];
+            counts[digit][i] = offset;
+            offset += count;
+        }
+
+        element = src;
+        if (size == sizeof(Uint32)) {
+            for (i = 0; i < nmemb; ++i, element += size) {
+                const size_t index = counts[digit][(get_radix_key(element + key_offset, key_size, sign_bit) >> shift) & 0xFF]++;
+                SDL_memcpy(dst + index * sizeof(Uint32), element, sizeof(Uint32));
+            }
+        } else if (size == sizeof(Uint64)) {
+            for (i = 0; i < nmemb; ++i, element += size) {
+                const size_t index = counts[digit][(get_radix_key(element + key_offset, key_size, sign_bit) >> shift) & 0xFF]++;
+                SDL_memcpy(dst + index * sizeof(Uint64), element, sizeof(Uint64));
+            }
+        } else {
+            for (i = 0; i < nmemb; ++i, element += size) {
+                const size_t index = counts[digit][(get_radix_key(element + key_offset, key_size, sign_bit) >> shift) & 0xFF]++;
+                SDL_memcpy(dst + index * size, element, size);
+            }
+        }
+
+        element = src;
+        src = dst;
+        dst = element;
+    }
+
+    if (src != (char *)base) {
+        SDL_memcpy(base, src, nmemb * size);
+    }
+    SDL_free(counts);
+    return true;
 }
 
 static int SDLCALL qsort_non_r_bridge(void *userdata, const void *a, const void *b)
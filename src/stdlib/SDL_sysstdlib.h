@@ -28,5 +28,16 @@
 // this expects `from` to be a Unicode codepoint, and `to` to point to AT LEAST THREE Uint32s.
 int SDL_CaseFoldUnicode(Uint32 from, Uint32 *to);
 
+// Memory arena blocks can be retained to keep allocations alive past SDL_ResetMemoryArena()
+typedef struct SDL_MemoryArenaBlock SDL_MemoryArenaBlock;
+
+SDL_MemoryArenaBlock *SDL_FindArenaBlock(SDL_MemoryArena *arena, const void *mem);
+bool SDL_ArenaBlockContains(const SDL_MemoryArenaBlock *block, const void *mem);
+void SDL_RetainArenaBlock(SDL_MemoryArenaBlock *block);
+void SDL_ReleaseArenaBlock(SDL_MemoryArenaBlock *block);
+
+// Frees the per-thread allocator caches that no thread is using, called from SDL_Quit()
+void SDL_FreeMemoryCaches(void);
+
 #endif
 
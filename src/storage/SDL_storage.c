@@ -27,6 +27,7 @@
 // Available title storage drivers
 static TitleStorageBootStrap *titlebootstrap[] = {
     &GENERIC_titlebootstrap,
+    &PACK_titlebootstrap,  // only used if asked for by name, since "generic" always works.
     NULL
 };
 
@@ -45,6 +46,7 @@ static UserStorageBootStrap *userbootstrap[] = {
 struct SDL_Storage
 {
     SDL_StorageInterface iface;
+    SDL_StorageCommitInterface commit_iface;
     void *userdata;
 };
 
@@ -201,6 +203,11 @@ SDL_Storage *SDL_OpenStorage(const SDL_StorageInterface *iface, void *userdata)
     return storage;
 }
 
+void SDL_SetStorageCommitInterface(SDL_Storage *storage, const SDL_StorageCommitInterface *iface)
+{
+    SDL_copyp(&storage->commit_iface, iface);
+}
+
 bool SDL_CloseStorage(SDL_Storage *storage)
 {
     bool result = true;
@@ -224,6 +231,26 @@ bool SDL_StorageReady(SDL_Storage *storage)
     return true;
 }
 
+bool SDL_WaitStorageCommits(SDL_Storage *storage, Sint32 timeoutMS)
+{
+    CHECK_STORAGE_MAGIC()
+
+    if (storage->commit_iface.wait) {
+        return storage->commit_iface.wait(storage->userdata, timeoutMS);
+    }
+    return true;
+}
+
+int SDL_GetStoragePendingCommits(SDL_Storage *storage)
+{
+    CHECK_STORAGE_MAGIC_RET(-1)
+
+    if (storage->commit_iface.pending) {
+        return storage->commit_iface.pending(storage->userdata);
+    }
+    return 0;
+}
+
 bool SDL_GetStorageFileSize(SDL_Storage *storage, const char *path, Uint64 *length)
 {
     SDL_PathInfo info;
@@ -426,9 +453,22 @@ static bool GlobStorageDirectoryGetPathInfo(const char *path, SDL_PathInfo *info
     return SDL_GetStoragePathInfo((SDL_Storage *) userdata, path, info);
 }
 
-static bool GlobStorageDirectoryEnumerator(const char *path, SDL_EnumerateDirectoryCallback cb, void *cbuserdata, void *userdata)
+typedef struct GlobStorageEnumerationData
+{
+    SDL_SYS_EnumerateDirectoryTypedCallback cb;
+    void *cbuserdata;
+} GlobStorageEnumerationData;
+
+static SDL_EnumerationResult SDLCALL GlobStorageDirectoryCallback(void *userdata, const char *dirname, const char *fname)
+{
+    GlobStorageEnumerationData *data = (GlobStorageEnumerationData *) userdata;
+    return data->cb(data->cbuserdata, dirname, fname, SDL_PATHTYPE_NONE);  // storage backends don't tell us the type, the globber will ask.
+}
+
+static bool GlobStorageDirectoryEnumerator(const char *path, SDL_SYS_EnumerateDirectoryTypedCallback cb, void *cbuserdata, void *userdata)
 {
-    return SDL_EnumerateStorageDirectory((SDL_Storage *) userdata, path, cb, cbuserdata);
+    GlobStorageEnumerationData data = { cb, cbuserdata };
+    return SDL_EnumerateStorageDirectory((SDL_Storage *) userdata, path, GlobStorageDirectoryCallback, &data);
 }
 
 char **SDL_GlobStorageDirectory(SDL_Storage *storage, const char *path, const char *pattern, SDL_GlobFlags flags, int *count)
@@ -38,9 +38,20 @@ typedef struct UserStorageBootStrap
     SDL_Storage *(*create)(const char *, const char *, SDL_PropertiesID);
 } UserStorageBootStrap;
 
+// Storage that finishes writes in the background sets this after
+// SDL_OpenStorage(), so SDL_WaitStorageCommits() can reach it.
+typedef struct SDL_StorageCommitInterface
+{
+    bool (*wait)(void *userdata, Sint32 timeoutMS);
+    int (*pending)(void *userdata);
+} SDL_StorageCommitInterface;
+
+extern void SDL_SetStorageCommitInterface(SDL_Storage *storage, const SDL_StorageCommitInterface *iface);
+
 // Not all of these are available in a given build. Use #ifdefs, etc.
 
 extern TitleStorageBootStrap GENERIC_titlebootstrap;
+extern TitleStorageBootStrap PACK_titlebootstrap;
 // Steam does not have title storage APIs
 
 extern UserStorageBootStrap GENERIC_userbootstrap;
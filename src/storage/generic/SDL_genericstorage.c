@@ -22,6 +22,7 @@
 #include "SDL_internal.h"
 
 #include "../SDL_sysstorage.h"
+#include "../../filesystem/SDL_sysfilesystem.h"
 
 
 static char *GENERIC_INTERNAL_CreateFullPath(const char *base, const char *relative)
@@ -297,6 +298,523 @@ static const SDL_StorageInterface GENERIC_user_iface = {
     GENERIC_GetStorageSpaceRemaining
 };
 
+// Write-behind user storage: writes are staged in memory and a background
+// thread commits them in batches through SDL_AsyncIO. Each file is written
+// to a temporary name, flushed, and renamed over the original, so a crash
+// leaves either the old or the new contents of a file, never a mix.
+
+#define GENERIC_WRITE_BEHIND_MAX_OPEN_FILES 64
+
+typedef struct GenericStagedFile
+{
+    char *path;  // storage-relative path; also the key in the hash tables.
+    char *fullpath;
+    char *dirpath;   // the directory holding fullpath, synced after the rename.
+    char *temppath;  // a reserved name next to fullpath that no other file uses.
+    void *data;
+    Uint64 length;
+    SDL_Time staged_time;
+    SDL_AsyncIO *asyncio;
+    bool opened;
+    bool failed;
+} GenericStagedFile;
+
+typedef struct GenericWriteBehind
+{
+    char *basepath;
+    SDL_Mutex *lock;
+    SDL_Condition *cond;  // signaled when writes are staged, a batch completes, or on shutdown.
+    SDL_Thread *thread;
+    SDL_HashTable *pending;     // staged, waiting for the next batch.
+    SDL_HashTable *committing;  // the batch the thread is currently writing.
+    int num_pending;
+    int num_committing;
+    char *error;  // first failure since the last SDL_WaitStorageCommits().
+    Uint32 temp_tag;  // tells apart the temporary files of different instances.
+    SDL_AtomicInt temp_serial;
+    bool shutdown;
+} GenericWriteBehind;
+
+#define GENERIC_WRITE_BEHIND_TEMP_PREFIX ".sdl-write-behind-"
+
+static void SDLCALL GENERIC_DestroyStagedFile(void *unused, const void *key, const void *value)
+{
+    GenericStagedFile *file = (GenericStagedFile *)value;
+    SDL_free(file->path);
+    SDL_free(file->fullpath);
+    SDL_free(file->dirpath);
+    SDL_free(file->temppath);
+    SDL_free(file->data);
+    SDL_free(file);
+}
+
+typedef struct GenericBatch
+{
+    GenericStagedFile **files;
+    int count;
+} GenericBatch;
+
+static bool SDLCALL GENERIC_CollectStagedFile(void *userdata, const SDL_HashTable *table, const void *key, const void *value)
+{
+    GenericBatch *batch = (GenericBatch *)userdata;
+    batch->files[batch->count++] = (GenericStagedFile *)value;
+    return true;
+}
+
+// Called with wb->lock held.
+static void GENERIC_RecordWriteBehindError(GenericWriteBehind *wb, GenericStagedFile *file)
+{
+    file->failed = true;
+    if (!wb->error) {
+        SDL_asprintf(&wb->error, "Couldn't commit '%s': %s", file->path, SDL_GetError());
+    }
+}
+
+static bool GENERIC_StartStagedFile(GenericWriteBehind *wb, GenericStagedFile *file, SDL_AsyncIOQueue *queue)
+{
+    file->asyncio = SDL_AsyncIOFromFile(file->temppath, "w");
+    if (!file->asyncio) {
+        return false;
+    }
+    file->opened = true;
+
+    if (file->length == 0) {
+        return SDL_CloseAsyncIO(file->asyncio, true, queue, file);
+    }
+    if (!SDL_WriteAsyncIO(file->asyncio, file->data, 0, file->length, queue, file)) {
+        SDL_LockMutex(wb->lock);
+        GENERIC_RecordWriteBehindError(wb, file);
+        SDL_UnlockMutex(wb->lock);
+        return SDL_CloseAsyncIO(file->asyncio, false, queue, file);
+    }
+    return true;
+}
+
+static void GENERIC_CommitBatch(GenericWriteBehind *wb, GenericBatch *batch)
+{
+    SDL_AsyncIOQueue *queue = SDL_CreateAsyncIOQueue();
+    int next = 0;
+    int inflight = 0;
+
+    if (!queue) {
+        SDL_LockMutex(wb->lock);
+        for (int i = 0; i < batch->count; i++) {
+            GENERIC_RecordWriteBehindError(wb, batch->files[i]);
+        }
+        SDL_UnlockMutex(wb->lock);
+        return;
+    }
+
+    // Keep a bounded number of files open so huge batches don't run out of descriptors.
+    while (next < batch->count || inflight > 0) {
+        while (next < batch->count && inflight < GENERIC_WRITE_BEHIND_MAX_OPEN_FILES) {
+            GenericStagedFile *file = batch->files[next++];
+            if (GENERIC_StartStagedFile(wb, file, queue)) {
+                inflight++;
+            } else if (!file->failed) {
+                SDL_LockMutex(wb->lock);
+                GENERIC_RecordWriteBehindError(wb, file);
+                SDL_UnlockMutex(wb->lock);
+            }
+        }
+        if (inflight == 0) {
+            continue;
+        }
+
+        SDL_AsyncIOOutcome outcome;
+        if (!SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+            continue;
+        }
+
+        GenericStagedFile *file = (GenericStagedFile *)outcome.userdata;
+        if (outcome.type == SDL_ASYNCIO_TASK_CLOSE) {
+            if (outcome.result != SDL_ASYNCIO_COMPLETE && !file->failed) {
+                SDL_LockMutex(wb->lock);
+                GENERIC_RecordWriteBehindError(wb, file);
+                SDL_UnlockMutex(wb->lock);
+            }
+            inflight--;
+        } else {
+            if (outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != file->length) {
+                if (outcome.result == SDL_ASYNCIO_COMPLETE) {
+                    SDL_SetError("Resulting file length did not exactly match the source length");
+                }
+                SDL_LockMutex(wb->lock);
+                GENERIC_RecordWriteBehindError(wb, file);
+                SDL_UnlockMutex(wb->lock);
+            }
+            // Only flush to disk if the data is worth keeping.
+            if (!SDL_CloseAsyncIO(file->asyncio, !file->failed, queue, file)) {
+                inflight--;
+            }
+        }
+    }
+
+    SDL_DestroyAsyncIOQueue(queue);
+
+    // Everything that made it is now durable under its temporary name; swap it into place,
+    // and make the new directory entry durable too, or a crash could still bring back the old file.
+    const char *synced = NULL;
+    for (int i = 0; i < batch->count; i++) {
+        GenericStagedFile *file = batch->files[i];
+        if (!file->failed) {
+            if (!SDL_RenamePath(file->temppath, file->fullpath)) {
+                SDL_LockMutex(wb->lock);
+                GENERIC_RecordWriteBehindError(wb, file);
+                SDL_UnlockMutex(wb->lock);
+            } else if (!synced || SDL_strcmp(synced, file->dirpath) != 0) {
+                if (SDL_SYS_SyncDirectory(file->dirpath)) {
+                    synced = file->dirpath;
+                } else {
+                    SDL_LockMutex(wb->lock);
+                    GENERIC_RecordWriteBehindError(wb, file);
+                    SDL_UnlockMutex(wb->lock);
+                }
+            }
+        }
+        if (file->failed && file->opened) {
+            SDL_RemovePath(file->temppath);
+        }
+    }
+}
+
+static int SDLCALL GENERIC_WriteBehindThread(void *data)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)data;
+    GenericBatch batch = { NULL, 0 };
+    int capacity = 0;
+
+    SDL_LockMutex(wb->lock);
+    for (;;) {
+        while (wb->num_pending == 0 && !wb->shutdown) {
+            SDL_WaitCondition(wb->cond, wb->lock);
+        }
+        if (wb->num_pending == 0) {
+            break;  // shutting down and everything is committed.
+        }
+
+        // Everything staged so far becomes the next batch; writes that arrive
+        // while it is on its way to disk accumulate for the one after.
+        SDL_HashTable *table = wb->committing;
+        wb->committing = wb->pending;
+        wb->pending = table;
+        wb->num_committing = wb->num_pending;
+        wb->num_pending = 0;
+
+        if (wb->num_committing > capacity) {
+            GenericStagedFile **files = (GenericStagedFile **)SDL_realloc(batch.files, wb->num_committing * sizeof(*files));
+            if (files) {
+                batch.files = files;
+                capacity = wb->num_committing;
+            }
+        }
+        batch.count = 0;
+        if (wb->num_committing <= capacity) {
+            SDL_IterateHashTable(wb->committing, GENERIC_CollectStagedFile, &batch);
+        } else if (!wb->error) {
+            wb->error = SDL_strdup(SDL_GetError());
+        }
+        SDL_UnlockMutex(wb->lock);
+
+        GENERIC_CommitBatch(wb, &batch);
+
+        SDL_LockMutex(wb->lock);
+        SDL_ClearHashTable(wb->committing);
+        wb->num_committing = 0;
+        SDL_BroadcastCondition(wb->cond);
+    }
+    SDL_UnlockMutex(wb->lock);
+
+    SDL_free(batch.files);
+    return 0;
+}
+
+static bool GENERIC_WaitWriteBehind(GenericWriteBehind *wb, Sint32 timeoutMS)
+{
+    const Uint64 deadline = (timeoutMS > 0) ? (SDL_GetTicks() + timeoutMS) : 0;
+    bool result = true;
+
+    SDL_LockMutex(wb->lock);
+    while (wb->num_pending > 0 || wb->num_committing > 0) {
+        if (timeoutMS < 0) {
+            SDL_WaitCondition(wb->cond, wb->lock);
+        } else {
+            const Uint64 now = SDL_GetTicks();
+            if (now >= deadline) {
+                result = SDL_SetError("Timed out waiting for storage writes to be committed");
+                break;
+            }
+            SDL_WaitConditionTimeout(wb->cond, wb->lock, (Sint32)(deadline - now));
+        }
+    }
+    if (result && wb->error) {
+        result = SDL_SetError("%s", wb->error);
+        SDL_free(wb->error);
+        wb->error = NULL;
+    }
+    SDL_UnlockMutex(wb->lock);
+
+    return result;
+}
+
+// Operations that look at more than one file see the disk, so let staged writes land first.
+static void GENERIC_DrainWriteBehind(GenericWriteBehind *wb)
+{
+    SDL_LockMutex(wb->lock);
+    while (wb->num_pending > 0 || wb->num_committing > 0) {
+        SDL_WaitCondition(wb->cond, wb->lock);
+    }
+    SDL_UnlockMutex(wb->lock);
+}
+
+// Called with wb->lock held.
+static GenericStagedFile *GENERIC_FindStagedFile(GenericWriteBehind *wb, const char *path)
+{
+    const void *value = NULL;
+    if (SDL_FindInHashTable(wb->pending, path, &value) || SDL_FindInHashTable(wb->committing, path, &value)) {
+        return (GenericStagedFile *)value;
+    }
+    return NULL;
+}
+
+static bool GENERIC_WB_CloseStorage(void *userdata)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    bool result = true;
+
+    if (wb->thread) {
+        SDL_LockMutex(wb->lock);
+        wb->shutdown = true;
+        SDL_BroadcastCondition(wb->cond);
+        SDL_UnlockMutex(wb->lock);
+        SDL_WaitThread(wb->thread, NULL);
+    }
+    if (wb->error) {
+        result = SDL_SetError("%s", wb->error);
+        SDL_free(wb->error);
+    }
+    SDL_DestroyHashTable(wb->pending);
+    SDL_DestroyHashTable(wb->committing);
+    SDL_DestroyCondition(wb->cond);
+    SDL_DestroyMutex(wb->lock);
+    SDL_free(wb->basepath);
+    SDL_free(wb);
+    return result;
+}
+
+static bool GENERIC_WB_EnumerateStorageDirectory(void *userdata, const char *path, SDL_EnumerateDirectoryCallback callback, void *callback_userdata)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    GENERIC_DrainWriteBehind(wb);
+    return GENERIC_EnumerateStorageDirectory(wb->basepath, path, callback, callback_userdata);
+}
+
+static bool GENERIC_WB_GetStoragePathInfo(void *userdata, const char *path, SDL_PathInfo *info)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+
+    SDL_LockMutex(wb->lock);
+    const GenericStagedFile *file = GENERIC_FindStagedFile(wb, path);
+    if (file) {
+        info->type = SDL_PATHTYPE_FILE;
+        info->size = file->length;
+        info->create_time = file->staged_time;
+        info->modify_time = file->staged_time;
+        info->access_time = file->staged_time;
+    }
+    SDL_UnlockMutex(wb->lock);
+
+    if (file) {
+        return true;
+    }
+    return GENERIC_GetStoragePathInfo(wb->basepath, path, info);
+}
+
+static bool GENERIC_WB_ReadStorageFile(void *userdata, const char *path, void *destination, Uint64 length)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    bool found = false;
+    bool result = false;
+
+    SDL_LockMutex(wb->lock);
+    const GenericStagedFile *file = GENERIC_FindStagedFile(wb, path);
+    if (file) {
+        found = true;
+        if (file->length == length) {
+            SDL_memcpy(destination, file->data, (size_t)length);
+            result = true;
+        } else {
+            SDL_SetError("File length did not exactly match the destination length");
+        }
+    }
+    SDL_UnlockMutex(wb->lock);
+
+    if (found) {
+        return result;
+    }
+    return GENERIC_ReadStorageFile(wb->basepath, path, destination, length);
+}
+
+// Files are written next to their final name, so the rename stays within one directory.
+// The reserved prefix and the serial number keep them apart from the files in the storage,
+// including ones written in the same batch.
+static void GENERIC_CreateTempPath(GenericWriteBehind *wb, GenericStagedFile *file)
+{
+    const char *name = SDL_strrchr(file->fullpath, '/');
+#ifdef SDL_PLATFORM_WINDOWS
+    const char *backslash = SDL_strrchr(file->fullpath, '\\');
+    if (backslash > name) {
+        name = backslash;
+    }
+#endif
+    const size_t dirlen = name ? (size_t)(name - file->fullpath) + 1 : 0;
+
+    file->dirpath = dirlen ? SDL_strndup(file->fullpath, dirlen) : SDL_strdup(".");
+    SDL_asprintf(&file->temppath, "%.*s" GENERIC_WRITE_BEHIND_TEMP_PREFIX "%" SDL_PRIx32 "-%d.tmp",
+                 (int)dirlen, file->fullpath, wb->temp_tag, SDL_AddAtomicInt(&wb->temp_serial, 1));
+}
+
+static bool GENERIC_WB_WriteStorageFile(void *userdata, const char *path, const void *source, Uint64 length)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+
+    if (length > SDL_SIZE_MAX) {
+        return SDL_SetError("Write size exceeds SDL_SIZE_MAX");
+    }
+
+    GenericStagedFile *file = (GenericStagedFile *)SDL_calloc(1, sizeof(*file));
+    if (!file) {
+        return false;
+    }
+    file->path = SDL_strdup(path);
+    file->fullpath = GENERIC_INTERNAL_CreateFullPath(wb->basepath, path);
+    if (file->fullpath) {
+        GENERIC_CreateTempPath(wb, file);
+    }
+    file->data = SDL_malloc(length ? (size_t)length : 1);
+    file->length = length;
+    if (!file->path || !file->fullpath || !file->dirpath || !file->temppath || !file->data || !SDL_GetCurrentTime(&file->staged_time)) {
+        GENERIC_DestroyStagedFile(NULL, NULL, file);
+        return false;
+    }
+    SDL_memcpy(file->data, source, (size_t)length);
+
+    SDL_LockMutex(wb->lock);
+    const bool replacing = SDL_FindInHashTable(wb->pending, file->path, NULL);
+    const bool result = SDL_InsertIntoHashTable(wb->pending, file->path, file, true);
+    if (result) {
+        if (!replacing) {
+            wb->num_pending++;
+        }
+        SDL_BroadcastCondition(wb->cond);
+    }
+    SDL_UnlockMutex(wb->lock);
+
+    if (!result) {
+        GENERIC_DestroyStagedFile(NULL, NULL, file);
+    }
+    return result;
+}
+
+static bool GENERIC_WB_CreateStorageDirectory(void *userdata, const char *path)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    return GENERIC_CreateStorageDirectory(wb->basepath, path);
+}
+
+static bool GENERIC_WB_RemoveStoragePath(void *userdata, const char *path)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    GENERIC_DrainWriteBehind(wb);
+    return GENERIC_RemoveStoragePath(wb->basepath, path);
+}
+
+static bool GENERIC_WB_RenameStoragePath(void *userdata, const char *oldpath, const char *newpath)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    GENERIC_DrainWriteBehind(wb);
+    return GENERIC_RenameStoragePath(wb->basepath, oldpath, newpath);
+}
+
+static bool GENERIC_WB_CopyStorageFile(void *userdata, const char *oldpath, const char *newpath)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    GENERIC_DrainWriteBehind(wb);
+    return GENERIC_CopyStorageFile(wb->basepath, oldpath, newpath);
+}
+
+static Uint64 GENERIC_WB_GetStorageSpaceRemaining(void *userdata)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+    return GENERIC_GetStorageSpaceRemaining(wb->basepath);
+}
+
+static bool GENERIC_WB_WaitStorageCommits(void *userdata, Sint32 timeoutMS)
+{
+    return GENERIC_WaitWriteBehind((GenericWriteBehind *)userdata, timeoutMS);
+}
+
+static int GENERIC_WB_GetStoragePendingCommits(void *userdata)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)userdata;
+
+    SDL_LockMutex(wb->lock);
+    const int result = wb->num_pending + wb->num_committing;
+    SDL_UnlockMutex(wb->lock);
+
+    return result;
+}
+
+static const SDL_StorageInterface GENERIC_user_write_behind_iface = {
+    sizeof(SDL_StorageInterface),
+    GENERIC_WB_CloseStorage,
+    NULL,   // ready
+    GENERIC_WB_EnumerateStorageDirectory,
+    GENERIC_WB_GetStoragePathInfo,
+    GENERIC_WB_ReadStorageFile,
+    GENERIC_WB_WriteStorageFile,
+    GENERIC_WB_CreateStorageDirectory,
+    GENERIC_WB_RemoveStoragePath,
+    GENERIC_WB_RenameStoragePath,
+    GENERIC_WB_CopyStorageFile,
+    GENERIC_WB_GetStorageSpaceRemaining
+};
+
+static const SDL_StorageCommitInterface GENERIC_user_write_behind_commit_iface = {
+    GENERIC_WB_WaitStorageCommits,
+    GENERIC_WB_GetStoragePendingCommits
+};
+
+static SDL_Storage *GENERIC_OpenWriteBehindStorage(char *prefpath)
+{
+    GenericWriteBehind *wb = (GenericWriteBehind *)SDL_calloc(1, sizeof(*wb));
+    if (!wb) {
+        SDL_free(prefpath);
+        return NULL;
+    }
+    wb->basepath = prefpath;
+    wb->temp_tag = (Uint32)SDL_GetPerformanceCounter();
+    wb->lock = SDL_CreateMutex();
+    wb->cond = SDL_CreateCondition();
+    wb->pending = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, GENERIC_DestroyStagedFile, NULL);
+    wb->committing = SDL_CreateHashTable(0, false, SDL_HashString, SDL_KeyMatchString, GENERIC_DestroyStagedFile, NULL);
+    if (wb->lock && wb->cond && wb->pending && wb->committing) {
+        wb->thread = SDL_CreateThread(GENERIC_WriteBehindThread, "SDLStorageWriter", wb);
+    }
+    if (!wb->thread) {
+        GENERIC_WB_CloseStorage(wb);
+        return NULL;
+    }
+
+    SDL_Storage *result = SDL_OpenStorage(&GENERIC_user_write_behind_iface, wb);
+    if (result == NULL) {
+        GENERIC_WB_CloseStorage(wb);  // otherwise CloseStorage will free it.
+        return NULL;
+    }
+    SDL_SetStorageCommitInterface(result, &GENERIC_user_write_behind_commit_iface);
+    return result;
+}
+
 static SDL_Storage *GENERIC_User_Create(const char *org, const char *app, SDL_PropertiesID props)
 {
     SDL_Storage *result;
@@ -305,6 +823,10 @@ static SDL_Storage *GENERIC_User_Create(const char *org, const char *app, SDL_Pr
         return NULL;
     }
 
+    if (SDL_GetBooleanProperty(props, SDL_PROP_STORAGE_USER_WRITE_BEHIND_BOOLEAN, false)) {
+        return GENERIC_OpenWriteBehindStorage(prefpath);
+    }
+
     result = SDL_OpenStorage(&GENERIC_user_iface, prefpath);
     if (result == NULL) {
         SDL_free(prefpath);  // otherwise CloseStorage will free it.
@@ -0,0 +1,565 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#include "SDL_internal.h"
+
+#include "../SDL_sysstorage.h"
+#include "../../io/SDL_iostream_c.h"
+
+/* Read-only title storage from a single pack file.
+
+   All values are little endian. The file starts with a header:
+
+     Uint8  magic[4]       "SPAK"
+     Uint32 version        1
+     Uint32 num_entries
+     Uint32 names_size     size of the name table, in bytes
+     Uint32 index_crc      SDL_crc32() of the entry table and the name table
+     Uint32 reserved       0
+
+   followed by `num_entries` entries of 40 bytes each, sorted by name (byte
+   order, like strcmp()):
+
+     Uint32 name_offset    offset of the name in the name table
+     Uint32 name_length    length of the name, not counting its null terminator
+     Uint32 flags          PACK_ENTRY_DIRECTORY, PACK_ENTRY_DEFLATE
+     Uint32 reserved       0
+     Uint64 offset         where the data starts, from the start of the file
+     Uint64 size           size of the file
+     Uint64 stored_size    size of the data in the pack, which is different from
+                           `size` for compressed files
+
+   followed by the name table, which holds null-terminated paths like
+   "music/title.ogg", without a leading '/'. Every parent directory has its
+   own entry. The file data comes after that, and compressed files are raw
+   deflate streams.
+
+   test/testpackstorage.c can build these files. */
+
+#define PACK_MAGIC "SPAK"
+#define PACK_VERSION 1
+#define PACK_HEADER_SIZE 24
+#define PACK_ENTRY_SIZE 40
+
+#define PACK_ENTRY_DIRECTORY 0x01
+#define PACK_ENTRY_DEFLATE   0x02
+
+#define PACK_DEFAULT_FILENAME "title.pak"
+
+#define MZ_ASSERT(x) SDL_assert(x)
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define MINIZ_LITTLE_ENDIAN 1
+#else
+#define MINIZ_LITTLE_ENDIAN 0
+#endif
+#define MINIZ_USE_UNALIGNED_LOADS_AND_STORES 0
+#define MINIZ_SDL_NOUNUSED
+#define MINIZ_SDL_INFLATE
+#define MINIZ_NO_DEFLATE_APIS
+#define memcpy SDL_memcpy
+#define memset SDL_memset
+#include "../../video/miniz.h"
+#undef memcpy
+#undef memset
+
+typedef struct PackEntry
+{
+    const char *name;
+    size_t namelen;
+    Uint32 flags;
+    Uint64 offset;
+    Uint64 size;
+    Uint64 stored_size;
+} PackEntry;
+
+typedef struct PackStorage
+{
+    Uint8 *mapping;     // the whole pack file, from SDL_MapFile(), if it could be mapped.
+    size_t mapping_size;
+    SDL_IOStream *io;   // otherwise, the pack file is read through this...
+    SDL_Mutex *lock;    // ...which is locked, since the reads all share its file position.
+    char *names;
+    PackEntry *entries;
+    int num_entries;
+    SDL_Time create_time;
+    SDL_Time modify_time;
+    SDL_Time access_time;
+} PackStorage;
+
+static int PACK_CompareName(const PackEntry *entry, const char *name, size_t namelen)
+{
+    const int result = SDL_memcmp(entry->name, name, SDL_min(entry->namelen, namelen));
+    if (result != 0) {
+        return result;
+    } else if (entry->namelen < namelen) {
+        return -1;
+    } else if (entry->namelen > namelen) {
+        return 1;
+    }
+    return 0;
+}
+
+// returns the index of the first entry that isn't less than `name`.
+static int PACK_LowerBound(const PackStorage *pack, int lo, const char *name, size_t namelen)
+{
+    int hi = pack->num_entries;
+    while (lo < hi) {
+        const int mid = lo + ((hi - lo) / 2);
+        if (PACK_CompareName(&pack->entries[mid], name, namelen) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+// returns the index of the first entry at or after `lo` that doesn't start with `prefix`, assuming all entries before `lo` sort before it.
+static int PACK_PrefixEnd(const PackStorage *pack, int lo, const char *prefix, size_t prefixlen)
+{
+    int hi = pack->num_entries;
+    while (lo < hi) {
+        const int mid = lo + ((hi - lo) / 2);
+        const PackEntry *entry = &pack->entries[mid];
+        if ((entry->namelen >= prefixlen) && (SDL_memcmp(entry->name, prefix, prefixlen) == 0)) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void PACK_TrimPath(const char **path, size_t *pathlen)
+{
+    const char *ptr = *path;
+    size_t len = SDL_strlen(ptr);
+    while (*ptr == '/') {
+        ptr++;
+        len--;
+    }
+    while ((len > 0) && (ptr[len - 1] == '/')) {
+        len--;
+    }
+    *path = ptr;
+    *pathlen = len;
+}
+
+static const PackEntry *PACK_FindEntry(const PackStorage *pack, const char *path, size_t pathlen)
+{
+    const int i = PACK_LowerBound(pack, 0, path, pathlen);
+    if ((i < pack->num_entries) && (PACK_CompareName(&pack->entries[i], path, pathlen) == 0)) {
+        return &pack->entries[i];
+    }
+    return NULL;
+}
+
+static bool PACK_CloseStorage(void *userdata)
+{
+    PackStorage *pack = (PackStorage *)userdata;
+    SDL_UnmapFile(pack->mapping, pack->mapping_size);
+    if (pack->io) {
+        SDL_CloseIO(pack->io);
+    }
+    SDL_DestroyMutex(pack->lock);
+    SDL_free(pack->entries);
+    SDL_free(pack->names);
+    SDL_free(pack);
+    return true;
+}
+
+static bool PACK_EnumerateStorageDirectory(void *userdata, const char *path, SDL_EnumerateDirectoryCallback callback, void *callback_userdata)
+{
+    const PackStorage *pack = (const PackStorage *)userdata;
+    size_t pathlen;
+
+    PACK_TrimPath(&path, &pathlen);
+
+    if (pathlen > 0) {
+        const PackEntry *entry = PACK_FindEntry(pack, path, pathlen);
+        if (entry && !(entry->flags & PACK_ENTRY_DIRECTORY)) {
+            return SDL_SetError("Can't open directory: Not a directory");
+        }
+    }
+
+    // the callback gets "path/" as the directory name, or "" for the root.
+    char *dirname = (char *)SDL_malloc(pathlen + 2);
+    if (!dirname) {
+        return false;
+    }
+    SDL_memcpy(dirname, path, pathlen);
+    if (pathlen > 0) {
+        dirname[pathlen++] = '/';
+    }
+    dirname[pathlen] = '\0';
+
+    int i = PACK_LowerBound(pack, 0, dirname, pathlen);
+    const int end = PACK_PrefixEnd(pack, i, dirname, pathlen);
+    if ((i == end) && (pathlen > 0) && !PACK_FindEntry(pack, path, pathlen - 1)) {
+        SDL_free(dirname);
+        return SDL_SetError("Can't open directory: No such file or directory");
+    }
+
+    // a subdirectory's contents don't always come right after its own entry: "music.cfg" sorts
+    // between "music" and "music/title.ogg", because '.' comes before '/'. So entries are reported
+    // as they come, and each subdirectory's contents are skipped once we reach the first of them.
+    SDL_EnumerationResult result = SDL_ENUM_CONTINUE;
+    while ((result == SDL_ENUM_CONTINUE) && (i < end)) {
+        const PackEntry *entry = &pack->entries[i];
+        const char *fname = entry->name + pathlen;
+        const char *sep = SDL_strchr(fname, '/');
+        if (!sep) {
+            result = callback(callback_userdata, dirname, fname);
+            i++;
+            continue;
+        }
+
+        // a file in a subdirectory, report the subdirectory if it doesn't have its own entry.
+        const size_t prefixlen = (size_t)(sep - entry->name);
+        if (!PACK_FindEntry(pack, entry->name, prefixlen)) {
+            char *subdir = SDL_strndup(fname, sep - fname);
+            if (!subdir) {
+                result = SDL_ENUM_FAILURE;
+                break;
+            }
+            result = callback(callback_userdata, dirname, subdir);
+            SDL_free(subdir);
+        }
+
+        // skip everything inside this subdirectory, which starts here and is contiguous.
+        i = PACK_PrefixEnd(pack, i + 1, entry->name, prefixlen + 1);
+    }
+
+    SDL_free(dirname);
+
+    return (result != SDL_ENUM_FAILURE);
+}
+
+static bool PACK_GetStoragePathInfo(void *userdata, const char *path, SDL_PathInfo *info)
+{
+    const PackStorage *pack = (const PackStorage *)userdata;
+    size_t pathlen;
+
+    PACK_TrimPath(&path, &pathlen);
+
+    SDL_zerop(info);
+    info->create_time = pack->create_time;
+    info->modify_time = pack->modify_time;
+    info->access_time = pack->access_time;
+
+    if (pathlen == 0) {
+        info->type = SDL_PATHTYPE_DIRECTORY;
+        return true;
+    }
+
+    const PackEntry *entry = PACK_FindEntry(pack, path, pathlen);
+    if (entry) {
+        if (entry->flags & PACK_ENTRY_DIRECTORY) {
+            info->type = SDL_PATHTYPE_DIRECTORY;
+        } else {
+            info->type = SDL_PATHTYPE_FILE;
+            info->size = entry->size;
+        }
+        return true;
+    }
+
+    // maybe it's a directory that doesn't have its own entry?
+    const int i = PACK_LowerBound(pack, 0, path, pathlen);
+    for (int j = i; j < pack->num_entries; j++) {
+        const PackEntry *other = &pack->entries[j];
+        if ((other->namelen <= pathlen) || (SDL_memcmp(other->name, path, pathlen) != 0)) {
+            break;
+        } else if (other->name[pathlen] == '/') {
+            info->type = SDL_PATHTYPE_DIRECTORY;
+            return true;
+        }
+    }
+
+    SDL_zerop(info);
+    return SDL_SetError("Can't stat: No such file or directory");
+}
+
+// the index was checked against the size of the file when it was loaded, so this can't read past the end of it.
+static bool PACK_ReadData(PackStorage *pack, Uint64 offset, void *destination, size_t length)
+{
+    bool result = true;
+
+    if (pack->mapping) {
+        SDL_memcpy(destination, pack->mapping + offset, length);
+        return true;
+    }
+
+    SDL_LockMutex(pack->lock);
+    if (SDL_SeekIO(pack->io, (Sint64)offset, SDL_IO_SEEK_SET) < 0) {
+        result = false;
+    } else if (SDL_ReadIO(pack->io, destination, length) != length) {
+        result = SDL_SetError("Pack file is truncated");
+    }
+    SDL_UnlockMutex(pack->lock);
+
+    return result;
+}
+
+static bool PACK_ReadStorageFile(void *userdata, const char *path, void *destination, Uint64 length)
+{
+    PackStorage *pack = (PackStorage *)userdata;
+    size_t pathlen;
+
+    if (length > SDL_SIZE_MAX) {
+        return SDL_SetError("Read size exceeds SDL_SIZE_MAX");
+    }
+
+    PACK_TrimPath(&path, &pathlen);
+
+    const PackEntry *entry = PACK_FindEntry(pack, path, pathlen);
+    if (!entry) {
+        return SDL_SetError("Couldn't open %s: No such file or directory", path);
+    } else if (entry->flags & PACK_ENTRY_DIRECTORY) {
+        return SDL_SetError("Couldn't open %s: Is a directory", path);
+    } else if (length != entry->size) {
+        return SDL_SetError("File length did not exactly match the destination length");
+    } else if (length == 0) {
+        return true;
+    }
+
+    if (!(entry->flags & PACK_ENTRY_DEFLATE)) {
+        // stored files go straight into the app's buffer.
+        return PACK_ReadData(pack, entry->offset, destination, (size_t)length);
+    }
+
+    if (entry->stored_size > SDL_SIZE_MAX) {
+        return SDL_SetError("Read size exceeds SDL_SIZE_MAX");
+    }
+
+    // compressed files are inflated straight out of the mapping, or out of a copy of their data if there isn't one.
+    void *compressed = NULL;
+    if (pack->mapping) {
+        compressed = pack->mapping + entry->offset;
+    } else {
+        compressed = SDL_malloc((size_t)entry->stored_size);
+        if (!compressed) {
+            return false;
+        } else if (!PACK_ReadData(pack, entry->offset, compressed, (size_t)entry->stored_size)) {
+            SDL_free(compressed);
+            return false;
+        }
+    }
+
+    bool result = true;
+    const size_t rc = tinfl_decompress_mem_to_mem(destination, (size_t)length, compressed, (size_t)entry->stored_size, 0);
+    if (rc != length) {
+        result = SDL_SetError("Couldn't decompress %s: corrupt data", path);
+    }
+    if (!pack->mapping) {
+        SDL_free(compressed);
+    }
+
+    return result;
+}
+
+static Uint32 PACK_ReadLE32(const Uint8 *ptr)
+{
+    return ((Uint32)ptr[0]) | (((Uint32)ptr[1]) << 8) | (((Uint32)ptr[2]) << 16) | (((Uint32)ptr[3]) << 24);
+}
+
+static Uint64 PACK_ReadLE64(const Uint8 *ptr)
+{
+    return ((Uint64)PACK_ReadLE32(ptr)) | (((Uint64)PACK_ReadLE32(ptr + 4)) << 32);
+}
+
+static bool PACK_LoadIndex(PackStorage *pack, SDL_IOStream *io)
+{
+    Uint8 header[PACK_HEADER_SIZE];
+    const Sint64 filesize = SDL_GetIOSize(io);
+
+    if (filesize < 0) {
+        return false;
+    } else if (SDL_ReadIO(io, header, sizeof(header)) != sizeof(header)) {
+        return SDL_SetError("Not a pack file");
+    } else if (SDL_memcmp(header, PACK_MAGIC, 4) != 0) {
+        return SDL_SetError("Not a pack file");
+    } else if (PACK_ReadLE32(header + 4) != PACK_VERSION) {
+        return SDL_SetError("Unsupported pack file version %u", (unsigned int)PACK_ReadLE32(header + 4));
+    }
+
+    const Uint32 num_entries = PACK_ReadLE32(header + 8);
+    const Uint32 names_size = PACK_ReadLE32(header + 12);
+    const Uint32 index_crc = PACK_ReadLE32(header + 16);
+    const Uint64 entries_size = (Uint64)num_entries * PACK_ENTRY_SIZE;
+    if ((num_entries > SDL_MAX_SINT32 / PACK_ENTRY_SIZE) || (PACK_HEADER_SIZE + entries_size + names_size > (Uint64)filesize) ||
+        ((names_size == 0) && (num_entries > 0)) || ((names_size > 0) && (num_entries == 0))) {
+        return SDL_SetError("Pack file index is corrupt");
+    }
+
+    Uint8 *index = (Uint8 *)SDL_malloc((size_t)entries_size + 1);
+    pack->names = (char *)SDL_malloc((size_t)names_size + 1);
+    pack->entries = (PackEntry *)SDL_malloc((num_entries + 1) * sizeof(*pack->entries));
+    if (!index || !pack->names || !pack->entries) {
+        SDL_free(index);
+        return false;
+    }
+
+    if ((SDL_ReadIO(io, index, (size_t)entries_size) != entries_size) ||
+        (SDL_ReadIO(io, pack->names, names_size) != names_size)) {
+        SDL_free(index);
+        return SDL_SetError("Pack file is truncated");
+    }
+    pack->names[names_size] = '\0';
+
+    Uint32 crc = SDL_crc32(0, index, (size_t)entries_size);
+    crc = SDL_crc32(crc, pack->names, names_size);
+    if (crc != index_crc) {
+        SDL_free(index);
+        return SDL_SetError("Pack file index is corrupt");
+    }
+
+    for (Uint32 i = 0; i < num_entries; i++) {
+        const Uint8 *ptr = index + (i * PACK_ENTRY_SIZE);
+        PackEntry *entry = &pack->entries[i];
+        const Uint32 name_offset = PACK_ReadLE32(ptr);
+        const Uint32 name_length = PACK_ReadLE32(ptr + 4);
+
+        entry->flags = PACK_ReadLE32(ptr + 8);
+        entry->offset = PACK_ReadLE64(ptr + 16);
+        entry->size = PACK_ReadLE64(ptr + 24);
+        entry->stored_size = PACK_ReadLE64(ptr + 32);
+
+        bool valid = (name_length > 0) && (name_offset < names_size) && (name_length < (names_size - name_offset));
+        if (valid) {
+            entry->name = pack->names + name_offset;
+            entry->namelen = name_length;
+            valid = (entry->name[name_length] == '\0') && (SDL_strlen(entry->name) == name_length) &&
+                    (entry->name[0] != '/') && (entry->name[name_length - 1] != '/');
+        }
+        if (valid && (i > 0)) {
+            valid = (PACK_CompareName(&pack->entries[i - 1], entry->name, entry->namelen) < 0);  // must be sorted, without duplicates.
+        }
+        if (valid && !(entry->flags & PACK_ENTRY_DIRECTORY)) {
+            valid = (entry->offset <= (Uint64)filesize) && (entry->stored_size <= ((Uint64)filesize - entry->offset)) &&
+                    ((entry->flags & PACK_ENTRY_DEFLATE) || (entry->stored_size == entry->size));
+        }
+        if (!valid) {
+            SDL_free(index);
+            return SDL_SetError("Pack file index is corrupt");
+        }
+    }
+    pack->num_entries = (int)num_entries;
+
+    SDL_free(index);
+    return true;
+}
+
+static const SDL_StorageInterface PACK_title_iface = {
+    sizeof(SDL_StorageInterface),
+    PACK_CloseStorage,
+    NULL,   // ready
+    PACK_EnumerateStorageDirectory,
+    PACK_GetStoragePathInfo,
+    PACK_ReadStorageFile,
+    NULL,   // write_file
+    NULL,   // mkdir
+    NULL,   // remove
+    NULL,   // rename
+    NULL,   // copy
+    NULL    // space_remaining
+};
+
+static SDL_Storage *PACK_Title_Create(const char *override, SDL_PropertiesID props)
+{
+    SDL_Storage *result = NULL;
+    SDL_PathInfo info;
+    char *path = NULL;
+
+    // `override` can be the pack file itself, or a directory with a "title.pak" in it. The default is the base path.
+    if (!override) {
+        override = SDL_GetBasePath();
+        if (!override) {
+            return NULL;
+        }
+    }
+    if (SDL_GetPathInfo(override, &info) && (info.type == SDL_PATHTYPE_DIRECTORY)) {
+        const size_t slen = SDL_strlen(override);
+        const bool need_sep = (slen > 0) && (override[slen - 1] != '/') && (override[slen - 1] != '\\');
+        if (SDL_asprintf(&path, "%s%s%s", override, need_sep ? "/" : "", PACK_DEFAULT_FILENAME) < 0) {
+            return NULL;
+        }
+    } else {
+        path = SDL_strdup(override);
+        if (!path) {
+            return NULL;
+        }
+    }
+
+    PackStorage *pack = (PackStorage *)SDL_calloc(1, sizeof(*pack));
+    if (!pack) {
+        SDL_free(path);
+        return NULL;
+    }
+
+    if (SDL_GetPathInfo(path, &info)) {
+        pack->create_time = info.create_time;
+        pack->modify_time = info.modify_time;
+        pack->access_time = info.access_time;
+    }
+
+    /* Map the pack if we can, so reads are copies out of the mapping, with no system calls or locking.
+       Files that can't be mapped, like Android assets, are read through an SDL_IOStream instead, and
+       so is everything on platforms where SDL_MapFile() would load the whole pack into memory. */
+#ifdef SDL_HAVE_FILE_MAPPING
+    pack->mapping = (Uint8 *)SDL_MapFile(path, &pack->mapping_size, SDL_IO_ACCESS_RANDOM);
+#endif
+    if (pack->mapping) {
+        SDL_IOStream *io = SDL_IOFromConstMem(pack->mapping, pack->mapping_size);
+        if (io) {
+            if (PACK_LoadIndex(pack, io)) {
+                result = SDL_OpenStorage(&PACK_title_iface, pack);
+            }
+            SDL_CloseIO(io);
+        }
+    } else {
+        pack->io = SDL_IOFromFile(path, "rb");
+        if (pack->io) {
+            pack->lock = SDL_CreateMutex();
+            if (pack->lock && PACK_LoadIndex(pack, pack->io)) {
+                result = SDL_OpenStorage(&PACK_title_iface, pack);
+            }
+        }
+    }
+    SDL_free(path);
+
+    if (!result) {
+        SDL_UnmapFile(pack->mapping, pack->mapping_size);
+        if (pack->io) {
+            SDL_CloseIO(pack->io);
+        }
+        SDL_DestroyMutex(pack->lock);
+        SDL_free(pack->entries);
+        SDL_free(pack->names);
+        SDL_free(pack);
+    }
+    return result;
+}
+
+TitleStorageBootStrap PACK_titlebootstrap = {
+    "pack",
+    "SDL pack file title storage driver",
+    PACK_Title_Create
+};
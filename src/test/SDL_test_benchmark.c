@@ -0,0 +1,556 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include <SDL3/SDL_test.h>
+#include "SDL_test_internal.h"
+
+/* Cycles are read from the time stamp counter, which counts at a fixed rate
+   close to the nominal clock speed of the CPU, not the cycles actually spent
+   at the current clock speed. Other CPUs don't have a counter we can read
+   from user space, so only times are reported there. */
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#include <intrin.h>
+#define HAVE_CYCLE_COUNTER
+#define SDLTest_GetCycleCounter() __rdtsc()
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__i386__) || defined(__x86_64__))
+#define HAVE_CYCLE_COUNTER
+#define SDLTest_GetCycleCounter() __builtin_ia32_rdtsc()
+#else
+#define SDLTest_GetCycleCounter() 0
+#endif
+
+/* Invalid benchmark name/description message format */
+#define SDLTEST_INVALID_NAME_FORMAT "(Invalid)"
+
+/* Fewest samples taken of a benchmark that runs over its time budget */
+#define SDLTEST_MIN_BENCHMARK_SAMPLES 5
+
+/* Most a warmup sample can grow the number of iterations at once */
+#define SDLTEST_MAX_ITERATION_GROWTH 100
+
+typedef struct SDLTest_BenchmarkResult
+{
+    const char *suiteName;
+    const char *name;
+    int result;
+    int itemsPerIteration;
+    int iterations;
+    int samples;
+    double minNS;
+    double medianNS;
+    double meanNS;
+    double p95NS;
+    double p99NS;
+    double medianCycles;
+} SDLTest_BenchmarkResult;
+
+struct SDLTest_BenchmarkRunner {
+    struct
+    {
+        SDLTest_BenchmarkSuiteReference **benchmarkSuites;
+        char *filter;
+        char *jsonFile;
+        int warmupMS;
+        int timeMS;
+        int samples;
+    } user;
+
+    SDLTest_ArgumentParser argparser;
+};
+
+static const char *common_benchmark_usage[] = {
+    "[--filter suite_name|benchmark_name]",
+    "[--warmup ms]",
+    "[--time ms]",
+    "[--samples N]",
+    "[--json file]",
+    NULL
+};
+
+static int SDLCALL SDLTest_CompareDoubles(const void *a, const void *b)
+{
+    const double A = *(const double *)a;
+    const double B = *(const double *)b;
+    return (A < B) ? -1 : (A > B);
+}
+
+/* Nearest rank percentile of a sorted array */
+static double SDLTest_Percentile(const double *sorted, int count, int percent)
+{
+    int rank = (count * percent + 99) / 100;
+    return sorted[SDL_clamp(rank, 1, count) - 1];
+}
+
+static double SDLTest_Median(const double *sorted, int count)
+{
+    if (count % 2) {
+        return sorted[count / 2];
+    }
+    return (sorted[count / 2 - 1] + sorted[count / 2]) / 2.0;
+}
+
+static const char *SDLTest_FormatTime(double ns, char *buffer, size_t size)
+{
+    if (ns < 1000.0) {
+        SDL_snprintf(buffer, size, "%.2f ns", ns);
+    } else if (ns < 1000000.0) {
+        SDL_snprintf(buffer, size, "%.2f us", ns / 1000.0);
+    } else if (ns < 1000000000.0) {
+        SDL_snprintf(buffer, size, "%.2f ms", ns / 1000000.0);
+    } else {
+        SDL_snprintf(buffer, size, "%.2f s", ns / 1000000000.0);
+    }
+    return buffer;
+}
+
+static int SDLTest_TimeBenchmark(const SDLTest_BenchmarkReference *benchmark, void *data, int iterations, Uint64 *ns, Uint64 *cycles)
+{
+    Uint64 startCycles = SDLTest_GetCycleCounter();
+    Uint64 start = SDL_GetTicksNS();
+    int result = benchmark->benchmark(data, iterations);
+
+    *ns = SDL_GetTicksNS() - start;
+    *cycles = SDLTest_GetCycleCounter() - startCycles;
+    return result;
+}
+
+/**
+ * Warms up a benchmark, finds how many iterations make up a sample, and times the samples.
+ *
+ * \returns TEST_COMPLETED if all of that went well, otherwise the benchmark's return value.
+ */
+static int SDLTest_MeasureBenchmark(SDLTest_BenchmarkRunner *runner, const SDLTest_BenchmarkReference *benchmark, void *data, SDLTest_BenchmarkResult *result)
+{
+    const Uint64 warmupNS = (Uint64)runner->user.warmupMS * SDL_NS_PER_MS;
+    const Uint64 timeNS = (Uint64)runner->user.timeMS * SDL_NS_PER_MS;
+    const Uint64 sampleNS = SDL_max(timeNS / runner->user.samples, 1);
+    double *times;
+    double *cycles;
+    Uint64 start, ns, count;
+    int iterations = 1;
+    int samples;
+    int status;
+    int i;
+
+    times = (double *)SDL_malloc(2 * runner->user.samples * sizeof(*times));
+    if (!times) {
+        SDLTest_LogError("Unable to allocate memory for benchmark samples");
+        return TEST_ABORTED;
+    }
+    cycles = times + runner->user.samples;
+
+    /* Warm up, growing the number of iterations until a sample takes long enough to time accurately */
+    start = SDL_GetTicksNS();
+    for (;;) {
+        status = SDLTest_TimeBenchmark(benchmark, data, iterations, &ns, &count);
+        if (status != TEST_COMPLETED) {
+            SDL_free(times);
+            return status;
+        }
+        if (ns < sampleNS && iterations < SDL_MAX_SINT32) {
+            Uint64 next = ((Uint64)iterations * sampleNS) / SDL_max(ns, 1);
+            next = SDL_clamp(next, (Uint64)iterations * 2, (Uint64)iterations * SDLTEST_MAX_ITERATION_GROWTH);
+            iterations = (int)SDL_min(next, SDL_MAX_SINT32);
+            continue;
+        }
+        if (SDL_GetTicksNS() - start >= warmupNS) {
+            break;
+        }
+    }
+
+    /* Take the samples, giving up early on a benchmark that's running well over its budget */
+    start = SDL_GetTicksNS();
+    for (samples = 0; samples < runner->user.samples;) {
+        status = SDLTest_TimeBenchmark(benchmark, data, iterations, &ns, &count);
+        if (status != TEST_COMPLETED) {
+            SDL_free(times);
+            return status;
+        }
+        times[samples] = (double)ns / iterations;
+        cycles[samples] = (double)count / iterations;
+        ++samples;
+
+        if (samples >= SDLTEST_MIN_BENCHMARK_SAMPLES && (SDL_GetTicksNS() - start) > 2 * timeNS) {
+            break;
+        }
+    }
+
+    result->iterations = iterations;
+    result->samples = samples;
+    result->meanNS = 0.0;
+    for (i = 0; i < samples; ++i) {
+        result->meanNS += times[i];
+    }
+    result->meanNS /= samples;
+
+    SDL_qsort(times, samples, sizeof(*times), SDLTest_CompareDoubles);
+    SDL_qsort(cycles, samples, sizeof(*cycles), SDLTest_CompareDoubles);
+    result->minNS = times[0];
+    result->medianNS = SDLTest_Median(times, samples);
+    result->p95NS = SDLTest_Percentile(times, samples, 95);
+    result->p99NS = SDLTest_Percentile(times, samples, 99);
+    result->medianCycles = SDLTest_Median(cycles, samples);
+
+    SDL_free(times);
+    return TEST_COMPLETED;
+}
+
+static void SDLTest_LogBenchmarkResult(const SDLTest_BenchmarkResult *result)
+{
+    char median[32], p95[32], p99[32];
+
+    SDLTest_Log("%s>>> Benchmark '%s':%s %s/iteration (p95 %s, p99 %s), %d iterations x %d samples",
+                COLOR_YELLOW, result->name, COLOR_END,
+                SDLTest_FormatTime(result->medianNS, median, sizeof(median)),
+                SDLTest_FormatTime(result->p95NS, p95, sizeof(p95)),
+                SDLTest_FormatTime(result->p99NS, p99, sizeof(p99)),
+                result->iterations, result->samples);
+    if (result->itemsPerIteration > 0) {
+#ifdef HAVE_CYCLE_COUNTER
+        SDLTest_Log("    %.3f ns/item, %.2f cycles/item, %.1f million items/s",
+                    result->medianNS / result->itemsPerIteration,
+                    result->medianCycles / result->itemsPerIteration,
+                    result->itemsPerIteration / result->medianNS * 1000.0);
+#else
+        SDLTest_Log("    %.3f ns/item, %.1f million items/s",
+                    result->medianNS / result->itemsPerIteration,
+                    result->itemsPerIteration / result->medianNS * 1000.0);
+#endif
+    }
+}
+
+/**
+ * Runs a single benchmark, with its suite's setup and teardown.
+ *
+ * \returns the benchmark result, one of the TEST_RESULT_* values.
+ */
+static int SDLTest_RunBenchmark(SDLTest_BenchmarkRunner *runner, SDLTest_BenchmarkSuiteReference *benchmarkSuite, const SDLTest_BenchmarkReference *benchmark, bool forceRun, SDLTest_BenchmarkResult *result)
+{
+    void *data = NULL;
+    int status;
+
+    if (!benchmark->benchmark || !benchmark->name) {
+        SDLTest_LogError("Setup failure: benchmark references NULL");
+        return TEST_RESULT_SETUP_FAILURE;
+    }
+
+    if (!benchmark->enabled && !forceRun) {
+        SDLTest_Log("%s>>> Benchmark '%s':%s Skipped (Disabled)", COLOR_YELLOW, benchmark->name, COLOR_END);
+        return TEST_RESULT_SKIPPED;
+    }
+
+    SDLTest_ResetAssertSummary();
+
+    if (benchmarkSuite->benchmarkSetUp) {
+        benchmarkSuite->benchmarkSetUp(&data);
+        if (SDLTest_AssertSummaryToTestResult() == TEST_RESULT_FAILED) {
+            SDLTest_LogError("%s>>> Suite Setup '%s':%s %sFailed%s", COLOR_YELLOW, benchmarkSuite->name, COLOR_END, COLOR_RED, COLOR_END);
+            return TEST_RESULT_SETUP_FAILURE;
+        }
+    }
+
+    status = SDLTest_MeasureBenchmark(runner, benchmark, data, result);
+
+    if (benchmarkSuite->benchmarkTearDown) {
+        benchmarkSuite->benchmarkTearDown(data);
+    }
+
+    if (status == TEST_SKIPPED) {
+        SDLTest_Log("%s>>> Benchmark '%s':%s %sSkipped (Programmatically)%s", COLOR_YELLOW, benchmark->name, COLOR_END, COLOR_BLUE, COLOR_END);
+        return TEST_RESULT_SKIPPED;
+    } else if (status != TEST_COMPLETED || SDLTest_AssertSummaryToTestResult() == TEST_RESULT_FAILED) {
+        SDLTest_LogError("%s>>> Benchmark '%s':%s %sFailed%s", COLOR_YELLOW, benchmark->name, COLOR_END, COLOR_RED, COLOR_END);
+        return TEST_RESULT_FAILED;
+    }
+
+    SDLTest_LogBenchmarkResult(result);
+    return TEST_RESULT_PASSED;
+}
+
+static void SDLTest_WriteJSONString(SDL_IOStream *io, const char *str)
+{
+    SDL_WriteU8(io, '"');
+    for (; *str; ++str) {
+        const unsigned char ch = (unsigned char)*str;
+        if (ch == '"' || ch == '\\') {
+            SDL_IOprintf(io, "\\%c", ch);
+        } else if (ch < 0x20) {
+            SDL_IOprintf(io, "\\u%04x", ch);
+        } else {
+            SDL_WriteU8(io, ch);
+        }
+    }
+    SDL_WriteU8(io, '"');
+}
+
+static bool SDLTest_WriteBenchmarkJSON(const char *file, const SDLTest_BenchmarkResult *results, int count)
+{
+    const int version = SDL_GetVersion();
+    SDL_IOStream *io = SDL_IOFromFile(file, "w");
+    int i;
+
+    if (!io) {
+        SDLTest_LogError("Couldn't open '%s' for writing: %s", file, SDL_GetError());
+        return false;
+    }
+
+    SDL_IOprintf(io, "{\n  \"version\": \"%d.%d.%d\",\n  \"revision\": ",
+                 SDL_VERSIONNUM_MAJOR(version), SDL_VERSIONNUM_MINOR(version), SDL_VERSIONNUM_MICRO(version));
+    SDLTest_WriteJSONString(io, SDL_GetRevision());
+    SDL_IOprintf(io, ",\n  \"platform\": ");
+    SDLTest_WriteJSONString(io, SDL_GetPlatform());
+    SDL_IOprintf(io, ",\n  \"logical_cpu_cores\": %d,\n  \"benchmarks\": [", SDL_GetNumLogicalCPUCores());
+
+    for (i = 0; i < count; ++i) {
+        const SDLTest_BenchmarkResult *result = &results[i];
+        const bool passed = (result->result == TEST_RESULT_PASSED);
+
+        SDL_IOprintf(io, "%s\n    {\n      \"suite\": ", i > 0 ? "," : "");
+        SDLTest_WriteJSONString(io, result->suiteName);
+        SDL_IOprintf(io, ",\n      \"name\": ");
+        SDLTest_WriteJSONString(io, result->name);
+        SDL_IOprintf(io, ",\n      \"result\": \"%s\"",
+                     passed ? "passed" : (result->result == TEST_RESULT_SKIPPED) ? "skipped" : "failed");
+        if (passed) {
+            SDL_IOprintf(io, ",\n      \"iterations\": %d,\n      \"samples\": %d,\n      \"items_per_iteration\": %d",
+                         result->iterations, result->samples, result->itemsPerIteration);
+            SDL_IOprintf(io, ",\n      \"min_ns\": %.3f,\n      \"median_ns\": %.3f,\n      \"mean_ns\": %.3f,\n      \"p95_ns\": %.3f,\n      \"p99_ns\": %.3f",
+                         result->minNS, result->medianNS, result->meanNS, result->p95NS, result->p99NS);
+#ifdef HAVE_CYCLE_COUNTER
+            SDL_IOprintf(io, ",\n      \"median_cycles\": %.3f", result->medianCycles);
+#else
+            SDL_IOprintf(io, ",\n      \"median_cycles\": null");
+#endif
+            if (result->itemsPerIteration > 0) {
+                SDL_IOprintf(io, ",\n      \"ns_per_item\": %.4f", result->medianNS / result->itemsPerIteration);
+#ifdef HAVE_CYCLE_COUNTER
+                SDL_IOprintf(io, ",\n      \"cycles_per_item\": %.4f", result->medianCycles / result->itemsPerIteration);
+#else
+                SDL_IOprintf(io, ",\n      \"cycles_per_item\": null");
+#endif
+            }
+        }
+        SDL_IOprintf(io, "\n    }");
+    }
+    SDL_IOprintf(io, "\n  ]\n}\n");
+
+    if (!SDL_CloseIO(io)) {
+        SDLTest_LogError("Couldn't write '%s': %s", file, SDL_GetError());
+        return false;
+    }
+    SDLTest_Log("Benchmark results written to '%s'", file);
+    return true;
+}
+
+static bool SDLTest_BenchmarkMatchesFilter(const char *filter, const SDLTest_BenchmarkSuiteReference *benchmarkSuite, const SDLTest_BenchmarkReference *benchmark)
+{
+    if (!filter || !*filter) {
+        return true;
+    }
+    if (benchmarkSuite->name && SDL_strcasecmp(filter, benchmarkSuite->name) == 0) {
+        return true;
+    }
+    return (benchmark->name && SDL_strcasecmp(filter, benchmark->name) == 0);
+}
+
+int SDLTest_ExecuteBenchmarkRunner(SDLTest_BenchmarkRunner *runner)
+{
+    SDLTest_BenchmarkSuiteReference *benchmarkSuite;
+    const SDLTest_BenchmarkReference *benchmark;
+    SDLTest_BenchmarkResult *results;
+    const char *filter = runner->user.filter;
+    int totalNumberOfBenchmarks = 0;
+    int count = 0;
+    int passed = 0;
+    int failed = 0;
+    int skipped = 0;
+    int suiteCounter;
+    int benchmarkCounter;
+    int runResult;
+
+    /* Count the benchmarks that match the filter */
+    for (suiteCounter = 0; runner->user.benchmarkSuites[suiteCounter]; ++suiteCounter) {
+        benchmarkSuite = runner->user.benchmarkSuites[suiteCounter];
+        for (benchmarkCounter = 0; benchmarkSuite->benchmarks[benchmarkCounter]; ++benchmarkCounter) {
+            benchmark = benchmarkSuite->benchmarks[benchmarkCounter];
+            if (SDLTest_BenchmarkMatchesFilter(filter, benchmarkSuite, benchmark)) {
+                totalNumberOfBenchmarks++;
+            }
+        }
+    }
+
+    if (totalNumberOfBenchmarks == 0) {
+        SDLTest_LogError("Filter '%s' did not match any benchmark suite/benchmark.", filter ? filter : "");
+        for (suiteCounter = 0; runner->user.benchmarkSuites[suiteCounter]; ++suiteCounter) {
+            benchmarkSuite = runner->user.benchmarkSuites[suiteCounter];
+            SDLTest_Log("Benchmark suite: %s", benchmarkSuite->name ? benchmarkSuite->name : SDLTEST_INVALID_NAME_FORMAT);
+            for (benchmarkCounter = 0; benchmarkSuite->benchmarks[benchmarkCounter]; ++benchmarkCounter) {
+                benchmark = benchmarkSuite->benchmarks[benchmarkCounter];
+                SDLTest_Log("      benchmark: %s%s", benchmark->name, benchmark->enabled ? "" : " (disabled)");
+            }
+        }
+        return 2;
+    }
+
+    results = (SDLTest_BenchmarkResult *)SDL_calloc(totalNumberOfBenchmarks, sizeof(*results));
+    if (!results) {
+        SDLTest_LogError("Unable to allocate memory for benchmark results");
+        return 1;
+    }
+
+    SDLTest_Log("Benchmarking with %d ms warmup, %d ms and up to %d samples per benchmark",
+                runner->user.warmupMS, runner->user.timeMS, runner->user.samples);
+
+    for (suiteCounter = 0; runner->user.benchmarkSuites[suiteCounter]; ++suiteCounter) {
+        bool suiteStarted = false;
+
+        benchmarkSuite = runner->user.benchmarkSuites[suiteCounter];
+        for (benchmarkCounter = 0; benchmarkSuite->benchmarks[benchmarkCounter]; ++benchmarkCounter) {
+            SDLTest_BenchmarkResult *result = &results[count];
+
+            benchmark = benchmarkSuite->benchmarks[benchmarkCounter];
+            if (!SDLTest_BenchmarkMatchesFilter(filter, benchmarkSuite, benchmark)) {
+                continue;
+            }
+
+            if (!suiteStarted) {
+                SDLTest_Log("===== Benchmark Suite %i: '%s' started", suiteCounter + 1,
+                            benchmarkSuite->name ? benchmarkSuite->name : SDLTEST_INVALID_NAME_FORMAT);
+                suiteStarted = true;
+            }
+            if (benchmark->description) {
+                SDLTest_Log("Benchmark Description: '%s'", benchmark->description);
+            }
+
+            result->suiteName = benchmarkSuite->name ? benchmarkSuite->name : SDLTEST_INVALID_NAME_FORMAT;
+            result->name = benchmark->name ? benchmark->name : SDLTEST_INVALID_NAME_FORMAT;
+            result->itemsPerIteration = benchmark->itemsPerIteration;
+            /* A benchmark picked out by name runs even if it's disabled */
+            result->result = SDLTest_RunBenchmark(runner, benchmarkSuite, benchmark, (filter && *filter), result);
+            switch (result->result) {
+            case TEST_RESULT_PASSED:
+                passed++;
+                break;
+            case TEST_RESULT_SKIPPED:
+                skipped++;
+                break;
+            default:
+                failed++;
+                break;
+            }
+            count++;
+        }
+    }
+
+    runResult = (failed > 0) ? 1 : 0;
+    SDLTest_LogMessage(failed ? SDL_LOG_PRIORITY_ERROR : SDL_LOG_PRIORITY_INFO,
+                       "Benchmark Summary: Total=%d %sPassed=%d%s %sFailed=%d%s %sSkipped=%d%s",
+                       count, COLOR_GREEN, passed, COLOR_END, failed ? COLOR_RED : COLOR_GREEN, failed, COLOR_END,
+                       COLOR_BLUE, skipped, COLOR_END);
+
+    if (runner->user.jsonFile && !SDLTest_WriteBenchmarkJSON(runner->user.jsonFile, results, count)) {
+        runResult = 1;
+    }
+
+    SDL_free(results);
+    return runResult;
+}
+
+static int SDLCALL SDLTest_BenchmarkCommonArg(void *data, char **argv, int index)
+{
+    SDLTest_BenchmarkRunner *runner = data;
+
+    if (SDL_strcasecmp(argv[index], "--filter") == 0) {
+        if (argv[index + 1]) {
+            SDL_free(runner->user.filter);
+            runner->user.filter = SDL_strdup(argv[index + 1]);
+            return 2;
+        }
+    } else if (SDL_strcasecmp(argv[index], "--warmup") == 0) {
+        if (argv[index + 1]) {
+            runner->user.warmupMS = SDL_max(SDL_atoi(argv[index + 1]), 0);
+            return 2;
+        }
+    } else if (SDL_strcasecmp(argv[index], "--time") == 0) {
+        if (argv[index + 1]) {
+            runner->user.timeMS = SDL_max(SDL_atoi(argv[index + 1]), 1);
+            return 2;
+        }
+    } else if (SDL_strcasecmp(argv[index], "--samples") == 0) {
+        if (argv[index + 1]) {
+            runner->user.samples = SDL_max(SDL_atoi(argv[index + 1]), SDLTEST_MIN_BENCHMARK_SAMPLES);
+            return 2;
+        }
+    } else if (SDL_strcasecmp(argv[index], "--json") == 0) {
+        if (argv[index + 1]) {
+            SDL_free(runner->user.jsonFile);
+            runner->user.jsonFile = SDL_strdup(argv[index + 1]);
+            return 2;
+        }
+    }
+    return 0;
+}
+
+SDLTest_BenchmarkRunner *SDLTest_CreateBenchmarkRunner(SDLTest_CommonState *state, SDLTest_BenchmarkSuiteReference *benchmarkSuites[])
+{
+    SDLTest_BenchmarkRunner *runner;
+    SDLTest_ArgumentParser *argparser;
+
+    if (!state) {
+        SDLTest_LogError("SDL Benchmark Suites require a common state");
+        return NULL;
+    }
+
+    runner = SDL_calloc(1, sizeof(SDLTest_BenchmarkRunner));
+    if (!runner) {
+        SDLTest_LogError("Failed to allocate memory for benchmark runner");
+        return NULL;
+    }
+    runner->user.benchmarkSuites = benchmarkSuites;
+    runner->user.warmupMS = 100;
+    runner->user.timeMS = 1000;
+    runner->user.samples = 50;
+
+    runner->argparser.parse_arguments = SDLTest_BenchmarkCommonArg;
+    runner->argparser.usage = common_benchmark_usage;
+    runner->argparser.data = runner;
+
+    /* Find last argument description and append our description */
+    argparser = state->argparser;
+    for (;;) {
+        if (argparser->next == NULL) {
+            argparser->next = &runner->argparser;
+            break;
+        }
+        argparser = argparser->next;
+    }
+
+    return runner;
+}
+
+void SDLTest_DestroyBenchmarkRunner(SDLTest_BenchmarkRunner *runner)
+{
+    if (!runner) {
+        return;
+    }
+    SDL_free(runner->user.filter);
+    SDL_free(runner->user.jsonFile);
+    SDL_free(runner);
+}
@@ -0,0 +1,678 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "SDL_internal.h"
+
+#include "SDL_thread_c.h"
+
+// Each worker thread has its own queue of jobs. A thread takes jobs from the back of
+// its own queue, and when that's empty, steals from the front of the others. Jobs
+// submitted by threads outside the pool are spread across the queues round-robin.
+// Threads waiting on a counter take jobs the same way, so they never sit idle while
+// there's work they could be doing.
+#define JOBPOOL_SEARCH_YIELDS 4  // times an idle thread yields and looks for work again before it sleeps.
+#define PARALLEL_FOR_BATCHES_PER_THREAD 4
+
+typedef struct SDL_Job
+{
+    SDL_JobPool *pool;
+    SDL_JobCallback callback;
+    void *userdata;
+    SDL_JobCounter *counter;
+    struct SDL_Job *prev;
+    struct SDL_Job *next;
+} SDL_Job;
+
+struct SDL_JobCounter
+{
+    SDL_AtomicInt value;
+    SDL_SpinLock lock;  // protects `waiting`, and is held while `value` drops to zero.
+    SDL_Job *waiting;   // jobs that get scheduled when `value` reaches zero.
+};
+
+typedef struct SDL_JobQueue
+{
+    SDL_SpinLock lock;
+    SDL_Job *head;  // other threads steal from here.
+    SDL_Job *tail;  // the owning thread pushes and pops here.
+    Uint8 padding[SDL_CACHELINE_SIZE - sizeof(SDL_SpinLock) - 2 * sizeof(SDL_Job *)];  // keep each queue's lock on its own cache line.
+} SDL_JobQueue;
+
+typedef struct SDL_JobWorker
+{
+    SDL_JobPool *pool;
+    int index;
+    SDL_Thread *thread;
+} SDL_JobWorker;
+
+struct SDL_JobPool
+{
+    SDL_Mutex *lock;
+    SDL_Condition *condition;
+    SDL_JobQueue *queues;
+    int num_queues;
+    SDL_JobWorker *workers;
+    int num_threads;
+    SDL_AtomicInt pending;     // number of jobs sitting in queues.
+    SDL_AtomicInt active;      // number of jobs submitted but not finished, including ones waiting on a dependency.
+    SDL_AtomicInt idle;        // number of threads asleep on the condition.
+    SDL_AtomicInt waiting;     // number of those that are waiting for a count to reach zero, rather than for work.
+    SDL_AtomicInt next_queue;  // round-robin for jobs submitted from outside the pool.
+    SDL_AtomicInt stopping;
+};
+
+static SDL_TLSID job_worker_tls;
+static SDL_InitState default_pool_init;
+static SDL_JobPool *default_pool = NULL;
+
+static SDL_JobPool *GetJobPool(SDL_JobPool *pool)
+{
+    if (pool) {
+        return pool;
+    }
+
+    if (SDL_ShouldInit(&default_pool_init)) {
+        default_pool = SDL_CreateJobPool(0);
+        SDL_SetInitialized(&default_pool_init, (default_pool != NULL));
+    }
+    return default_pool;
+}
+
+// Returns the calling thread's own queue in this pool, or -1 if it isn't one of the pool's workers.
+static int GetHomeQueue(SDL_JobPool *pool)
+{
+    const SDL_JobWorker *worker = (const SDL_JobWorker *)SDL_GetTLS(&job_worker_tls);
+    if (worker && worker->pool == pool) {
+        return worker->index;
+    }
+    return -1;
+}
+
+static void WakeJobPoolThreads(SDL_JobPool *pool, bool all)
+{
+    SDL_LockMutex(pool->lock);
+    if (all) {
+        SDL_BroadcastCondition(pool->condition);
+    } else {
+        SDL_SignalCondition(pool->condition);
+    }
+    SDL_UnlockMutex(pool->lock);
+}
+
+static void ScheduleJob(SDL_Job *job)
+{
+    SDL_JobPool *pool = job->pool;
+    int which = GetHomeQueue(pool);
+    const bool from_worker = (which >= 0);
+
+    if (!from_worker) {
+        which = (int)((Uint32)SDL_AddAtomicInt(&pool->next_queue, 1) % (Uint32)pool->num_queues);
+    }
+
+    SDL_JobQueue *queue = &pool->queues[which];
+    SDL_LockSpinlock(&queue->lock);
+    job->next = NULL;
+    job->prev = queue->tail;
+    if (queue->tail) {
+        queue->tail->next = job;
+    } else {
+        queue->head = job;
+    }
+    queue->tail = job;
+    SDL_UnlockSpinlock(&queue->lock);
+
+    // This is an atomic read-modify-write, and so is the idle count change in threads going
+    // to sleep, so either that thread sees this job before it sleeps or we see that it's idle.
+    const int pending = SDL_AddAtomicInt(&pool->pending, 1) + 1;
+    if (from_worker && (pending == 1)) {
+        // a worker putting a job in its own queue will get to it next anyhow, only bother
+        // the others if there's more work piled up than this thread can take right now.
+    } else if (SDL_GetAtomicInt(&pool->idle) > 0) {
+        WakeJobPoolThreads(pool, false);
+    }
+}
+
+static SDL_Job *TakeJob(SDL_JobPool *pool, int home)
+{
+    const bool from_worker = (home >= 0);
+
+    if (!SDL_GetAtomicInt(&pool->pending)) {
+        return NULL;
+    }
+
+    if (!from_worker) {
+        home = (int)((Uint32)SDL_GetAtomicInt(&pool->next_queue) % (Uint32)pool->num_queues);
+    }
+
+    for (int i = 0; i < pool->num_queues; i++) {
+        SDL_JobQueue *queue = &pool->queues[(home + i) % pool->num_queues];
+        SDL_Job *job;
+
+        SDL_LockSpinlock(&queue->lock);
+        if (from_worker && (i == 0)) {
+            job = queue->tail;  // our own queue, take the newest, it's likely still warm.
+            if (job) {
+                queue->tail = job->prev;
+                if (queue->tail) {
+                    queue->tail->next = NULL;
+                } else {
+                    queue->head = NULL;
+                }
+            }
+        } else {
+            job = queue->head;  // someone else's, steal the oldest.
+            if (job) {
+                queue->head = job->next;
+                if (queue->head) {
+                    queue->head->prev = NULL;
+                } else {
+                    queue->tail = NULL;
+                }
+            }
+        }
+        SDL_UnlockSpinlock(&queue->lock);
+
+        if (job) {
+            SDL_AddAtomicInt(&pool->pending, -1);
+            return job;
+        }
+    }
+    return NULL;
+}
+
+// Returns true if this was the last unfinished job on the counter.
+static bool FinishJobCounter(SDL_JobCounter *counter)
+{
+    SDL_Job *released = NULL;
+    bool done;
+
+    SDL_LockSpinlock(&counter->lock);
+    done = (SDL_AddAtomicInt(&counter->value, -1) == 1);
+    if (done) {
+        // Schedule these in the order they were submitted.
+        while (counter->waiting) {
+            SDL_Job *job = counter->waiting;
+            counter->waiting = job->next;
+            job->next = released;
+            released = job;
+        }
+    }
+    SDL_UnlockSpinlock(&counter->lock);
+
+    // The counter might be gone already, since anyone waiting on it is free to go once it reaches zero.
+    while (released) {
+        SDL_Job *job = released;
+        released = job->next;
+        ScheduleJob(job);
+    }
+    return done;
+}
+
+static void RunJob(SDL_Job *job)
+{
+    SDL_JobPool *pool = job->pool;
+    SDL_JobCounter *counter = job->counter;
+    bool wake = false;
+
+    job->callback(job->userdata);
+    SDL_free(job);
+
+    if (counter && FinishJobCounter(counter)) {
+        wake = true;
+    }
+    if (SDL_AddAtomicInt(&pool->active, -1) == 1) {
+        wake = true;
+    }
+    if (wake && SDL_GetAtomicInt(&pool->waiting) > 0) {
+        WakeJobPoolThreads(pool, true);
+    }
+}
+
+// Run jobs from the pool until `value` reaches zero.
+static void HelpJobPool(SDL_JobPool *pool, SDL_AtomicInt *value)
+{
+    const int home = GetHomeQueue(pool);
+    int searches = 0;
+
+    while (SDL_GetAtomicInt(value) > 0) {
+        SDL_Job *job = TakeJob(pool, home);
+        if (job) {
+            RunJob(job);
+            searches = 0;
+            continue;
+        }
+
+        // the last few jobs are probably about to finish, so give them a moment before paying for a sleep and a wakeup.
+        if (searches < JOBPOOL_SEARCH_YIELDS) {
+            searches++;
+            SDL_Delay(0);
+            continue;
+        }
+        searches = 0;
+
+        SDL_LockMutex(pool->lock);
+        SDL_AddAtomicInt(&pool->idle, 1);
+        SDL_AddAtomicInt(&pool->waiting, 1);
+        if (!SDL_GetAtomicInt(&pool->pending) && SDL_GetAtomicInt(value) > 0) {
+            SDL_WaitCondition(pool->condition, pool->lock);
+        }
+        SDL_AddAtomicInt(&pool->waiting, -1);
+        SDL_AddAtomicInt(&pool->idle, -1);
+        SDL_UnlockMutex(pool->lock);
+    }
+}
+
+static int SDLCALL JobPoolWorker(void *data)
+{
+    SDL_JobWorker *worker = (SDL_JobWorker *)data;
+    SDL_JobPool *pool = worker->pool;
+    int searches = 0;
+
+    SDL_SetTLS(&job_worker_tls, worker, NULL);
+
+    while (!SDL_GetAtomicInt(&pool->stopping)) {
+        SDL_Job *job = TakeJob(pool, worker->index);
+        if (job) {
+            RunJob(job);
+            searches = 0;
+            continue;
+        }
+
+        // the app is often still submitting jobs, so give it a moment before paying for a sleep and a wakeup.
+        if (searches < JOBPOOL_SEARCH_YIELDS) {
+            searches++;
+            SDL_Delay(0);
+            continue;
+        }
+        searches = 0;
+
+        SDL_LockMutex(pool->lock);
+        SDL_AddAtomicInt(&pool->idle, 1);
+        if (!SDL_GetAtomicInt(&pool->pending) && !SDL_GetAtomicInt(&pool->stopping)) {
+            SDL_WaitCondition(pool->condition, pool->lock);
+        }
+        SDL_AddAtomicInt(&pool->idle, -1);
+        SDL_UnlockMutex(pool->lock);
+    }
+
+    SDL_SetTLS(&job_worker_tls, NULL, NULL);
+    return 0;
+}
+
+static int SDLCALL CompareWorkerCPUs(const void *a, const void *b)
+{
+    const SDL_CPUInfo *A = *(const SDL_CPUInfo *const *)a;
+    const SDL_CPUInfo *B = *(const SDL_CPUInfo *const *)b;
+    const bool A_efficient = (A->core_type == SDL_CPU_CORE_TYPE_EFFICIENCY);
+    const bool B_efficient = (B->core_type == SDL_CPU_CORE_TYPE_EFFICIENCY);
+
+    if (A_efficient != B_efficient) {
+        return A_efficient ? 1 : -1;
+    } else if (A->capacity != B->capacity) {
+        return (A->capacity > B->capacity) ? -1 : 1;
+    }
+    return (A->cpu < B->cpu) ? -1 : (A->cpu > B->cpu);
+}
+
+// Pick one logical CPU from each physical core, fastest cores first, so workers
+// don't share a core with each other unless there are more of them than cores.
+static int *GetWorkerCPUs(int *count)
+{
+    int num_cpus = 0;
+    int num_cores = 0;
+    SDL_CPUInfo **topology = SDL_GetCPUTopology(&num_cpus);
+    int *cpus;
+
+    if (!topology) {
+        return NULL;
+    }
+
+    for (int i = 0; i < num_cpus; i++) {
+        bool seen = false;
+        for (int j = 0; j < num_cores; j++) {
+            if (topology[j]->core == topology[i]->core) {
+                seen = true;
+                break;
+            }
+        }
+        if (!seen) {
+            topology[num_cores++] = topology[i];
+        }
+    }
+    SDL_qsort(topology, num_cores, sizeof(*topology), CompareWorkerCPUs);
+
+    cpus = (int *)SDL_malloc(num_cores * sizeof(*cpus));
+    if (cpus) {
+        for (int i = 0; i < num_cores; i++) {
+            cpus[i] = topology[i]->cpu;
+        }
+        *count = num_cores;
+    }
+    SDL_free(topology);
+    return cpus;
+}
+
+static void ShutdownJobPool(SDL_JobPool *pool)
+{
+    if (pool->workers) {
+        SDL_SetAtomicInt(&pool->stopping, 1);
+        WakeJobPoolThreads(pool, true);
+        for (int i = 0; i < pool->num_threads; i++) {
+            if (pool->workers[i].thread) {
+                SDL_WaitThread(pool->workers[i].thread, NULL);
+            }
+        }
+        SDL_free(pool->workers);
+    }
+    if (pool->condition) {
+        SDL_DestroyCondition(pool->condition);
+    }
+    if (pool->lock) {
+        SDL_DestroyMutex(pool->lock);
+    }
+    SDL_free(pool->queues);
+    SDL_free(pool);
+}
+
+SDL_JobPool *SDL_CreateJobPool(SDL_PropertiesID props)
+{
+    const char *name = SDL_GetStringProperty(props, SDL_PROP_JOBPOOL_CREATE_NAME_STRING, "SDLJob");
+    const Sint64 stacksize = SDL_GetNumberProperty(props, SDL_PROP_JOBPOOL_CREATE_STACKSIZE_NUMBER, 0);
+    const bool pin_threads = SDL_GetBooleanProperty(props, SDL_PROP_JOBPOOL_CREATE_PIN_THREADS_BOOLEAN, false);
+    Sint64 num_threads = SDL_GetNumberProperty(props, SDL_PROP_JOBPOOL_CREATE_NUM_THREADS_NUMBER, -1);
+    int *cpus = NULL;
+    int num_cpus = 0;
+    SDL_JobPool *pool;
+
+    CHECK_PARAM(SDL_HasProperty(props, SDL_PROP_JOBPOOL_CREATE_NUM_THREADS_NUMBER) && (num_threads < 0 || num_threads > SDL_MAX_SINT32)) {
+        SDL_InvalidParamError("num_threads");
+        return NULL;
+    }
+
+    if (num_threads < 0) {
+        // Leave a core for the thread that submits the jobs, it helps out while it waits for them.
+        num_threads = SDL_max(SDL_GetNumPhysicalCPUCores() - 1, 1);
+    }
+#ifdef SDL_THREADS_DISABLED
+    num_threads = 0;
+#endif
+
+    pool = (SDL_JobPool *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        return NULL;
+    }
+    pool->num_queues = SDL_max((int)num_threads, 1);
+    pool->queues = (SDL_JobQueue *)SDL_calloc(pool->num_queues, sizeof(*pool->queues));
+    if (!pool->queues ||
+        (pool->lock = SDL_CreateMutex()) == NULL ||
+        (pool->condition = SDL_CreateCondition()) == NULL) {
+        ShutdownJobPool(pool);
+        return NULL;
+    }
+
+    if (num_threads > 0) {
+        pool->workers = (SDL_JobWorker *)SDL_calloc((size_t)num_threads, sizeof(*pool->workers));
+        if (!pool->workers) {
+            ShutdownJobPool(pool);
+            return NULL;
+        }
+        pool->num_threads = (int)num_threads;
+    }
+
+    if (pin_threads && num_threads > 0) {
+        cpus = GetWorkerCPUs(&num_cpus);  // it's okay if this fails, the threads just won't be pinned.
+    }
+
+    for (int i = 0; i < pool->num_threads; i++) {
+        SDL_JobWorker *worker = &pool->workers[i];
+        SDL_PropertiesID thread_props = SDL_CreateProperties();
+        char threadname[32];
+
+        if (!thread_props) {
+            ShutdownJobPool(pool);
+            SDL_free(cpus);
+            return NULL;
+        }
+
+        worker->pool = pool;
+        worker->index = i;
+        SDL_snprintf(threadname, sizeof(threadname), "%s%d", name, i);
+        SDL_SetPointerProperty(thread_props, SDL_PROP_THREAD_CREATE_ENTRY_FUNCTION_POINTER, (void *)JobPoolWorker);
+        SDL_SetStringProperty(thread_props, SDL_PROP_THREAD_CREATE_NAME_STRING, threadname);
+        SDL_SetPointerProperty(thread_props, SDL_PROP_THREAD_CREATE_USERDATA_POINTER, worker);
+        SDL_SetNumberProperty(thread_props, SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER, stacksize);
+        if (cpus) {
+            // The fastest core is left for the app's own thread, unless there are workers enough to fill every core.
+            const int offset = (pool->num_threads < num_cpus) ? 1 : 0;
+            SDL_SetPointerProperty(thread_props, SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER, &cpus[(i + offset) % num_cpus]);
+            SDL_SetNumberProperty(thread_props, SDL_PROP_THREAD_CREATE_CPU_AFFINITY_COUNT_NUMBER, 1);
+        }
+        worker->thread = SDL_CreateThreadWithProperties(thread_props);
+        SDL_DestroyProperties(thread_props);
+
+        if (!worker->thread) {
+            ShutdownJobPool(pool);
+            SDL_free(cpus);
+            return NULL;
+        }
+    }
+    SDL_free(cpus);
+
+    return pool;
+}
+
+int SDL_GetNumJobPoolThreads(SDL_JobPool *pool)
+{
+    pool = GetJobPool(pool);
+    if (!pool) {
+        return -1;
+    }
+    return pool->num_threads;
+}
+
+void SDL_DestroyJobPool(SDL_JobPool *pool)
+{
+    if (!pool) {
+        return;
+    }
+
+    HelpJobPool(pool, &pool->active);
+    ShutdownJobPool(pool);
+}
+
+SDL_JobCounter *SDL_CreateJobCounter(void)
+{
+    return (SDL_JobCounter *)SDL_calloc(1, sizeof(SDL_JobCounter));
+}
+
+int SDL_GetJobCounterValue(SDL_JobCounter *counter)
+{
+    CHECK_PARAM(!counter) {
+        SDL_InvalidParamError("counter");
+        return -1;
+    }
+
+    return SDL_GetAtomicInt(&counter->value);
+}
+
+void SDL_DestroyJobCounter(SDL_JobCounter *counter)
+{
+    if (!counter) {
+        return;
+    }
+
+    // The thread that finished the last job might still be on its way out of the lock.
+    SDL_LockSpinlock(&counter->lock);
+    SDL_UnlockSpinlock(&counter->lock);
+    SDL_free(counter);
+}
+
+bool SDL_SubmitJob(SDL_JobPool *pool, SDL_JobCallback callback, void *userdata, SDL_JobCounter *dependency, SDL_JobCounter *counter)
+{
+    SDL_Job *job;
+
+    CHECK_PARAM(!callback) {
+        return SDL_InvalidParamError("callback");
+    }
+    CHECK_PARAM(dependency && dependency == counter) {
+        return SDL_SetError("A job can't depend on its own counter");
+    }
+
+    pool = GetJobPool(pool);
+    if (!pool) {
+        return false;
+    }
+
+    job = (SDL_Job *)SDL_malloc(sizeof(*job));
+    if (!job) {
+        return false;
+    }
+    job->pool = pool;
+    job->callback = callback;
+    job->userdata = userdata;
+    job->counter = counter;
+    job->prev = NULL;
+    job->next = NULL;
+
+    SDL_AddAtomicInt(&pool->active, 1);
+    if (counter) {
+        SDL_AddAtomicInt(&counter->value, 1);
+    }
+
+    if (dependency) {
+        SDL_LockSpinlock(&dependency->lock);
+        if (SDL_GetAtomicInt(&dependency->value) > 0) {
+            job->next = dependency->waiting;
+            dependency->waiting = job;
+            job = NULL;
+        }
+        SDL_UnlockSpinlock(&dependency->lock);
+    }
+
+    if (job) {
+        ScheduleJob(job);
+    }
+    return true;
+}
+
+bool SDL_WaitJobCounter(SDL_JobPool *pool, SDL_JobCounter *counter)
+{
+    CHECK_PARAM(!counter) {
+        return SDL_InvalidParamError("counter");
+    }
+
+    pool = GetJobPool(pool);
+    if (!pool) {
+        return false;
+    }
+
+    HelpJobPool(pool, &counter->value);
+
+    // Let the thread that finished the last job get out of the lock, so the counter can go away as soon as we return.
+    SDL_LockSpinlock(&counter->lock);
+    SDL_UnlockSpinlock(&counter->lock);
+    return true;
+}
+
+typedef struct SDL_ParallelForState
+{
+    SDL_AtomicInt next;
+    int count;
+    int batch_size;
+    SDL_ParallelForCallback callback;
+    void *userdata;
+} SDL_ParallelForState;
+
+static void SDLCALL ParallelForJob(void *userdata)
+{
+    SDL_ParallelForState *state = (SDL_ParallelForState *)userdata;
+
+    for (;;) {
+        int start, end;
+
+        // Never step past the end, so the index can't overflow no matter how many threads are taking batches.
+        do {
+            start = SDL_GetAtomicInt(&state->next);
+            if (start >= state->count) {
+                return;
+            }
+            end = (state->count - start > state->batch_size) ? (start + state->batch_size) : state->count;
+        } while (!SDL_CompareAndSwapAtomicInt(&state->next, start, end));
+
+        state->callback(state->userdata, start, end);
+    }
+}
+
+bool SDL_ParallelFor(SDL_JobPool *pool, int count, int batch_size, SDL_ParallelForCallback callback, void *userdata)
+{
+    SDL_ParallelForState state;
+    SDL_JobCounter counter;
+    int num_batches, num_helpers;
+
+    CHECK_PARAM(count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+    CHECK_PARAM(batch_size < 0) {
+        return SDL_InvalidParamError("batch_size");
+    }
+    CHECK_PARAM(!callback) {
+        return SDL_InvalidParamError("callback");
+    }
+
+    if (count == 0) {
+        return true;
+    }
+
+    pool = GetJobPool(pool);
+    if (!pool) {
+        return false;
+    }
+
+    if (batch_size == 0) {
+        batch_size = SDL_max(count / ((pool->num_threads + 1) * PARALLEL_FOR_BATCHES_PER_THREAD), 1);
+    }
+    num_batches = ((count - 1) / batch_size) + 1;
+    num_helpers = SDL_min(pool->num_threads, num_batches - 1);
+
+    SDL_SetAtomicInt(&state.next, 0);
+    state.count = count;
+    state.batch_size = batch_size;
+    state.callback = callback;
+    state.userdata = userdata;
+    SDL_zero(counter);
+
+    for (int i = 0; i < num_helpers; i++) {
+        if (!SDL_SubmitJob(pool, ParallelForJob, &state, NULL, &counter)) {
+            break;  // that's okay, this thread will pick up the slack.
+        }
+    }
+    ParallelForJob(&state);
+
+    return SDL_WaitJobCounter(pool, &counter);
+}
+
+void SDL_QuitJobs(void)
+{
+    if (SDL_ShouldQuit(&default_pool_init)) {
+        SDL_DestroyJobPool(default_pool);
+        default_pool = NULL;
+        SDL_SetInitialized(&default_pool_init, false);
+    }
+}
@@ -46,6 +46,10 @@ extern void SDL_SYS_SetupThread(const char *name);
 // This function sets the current thread priority
 extern bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority);
 
+/* This function sets the CPUs a thread can run on, or the current thread if
+   thread is NULL. If count is 0, the thread can run on any CPU. */
+extern bool SDL_SYS_SetThreadAffinity(SDL_Thread *thread, const int *cpus, int count);
+
 /* This function waits for the thread to finish and frees any data
    allocated by SDL_SYS_CreateThread()
  */
@@ -330,6 +330,13 @@ void SDL_RunThread(SDL_Thread *thread)
     // Perform any system-dependent setup - this function may not fail
     SDL_SYS_SetupThread(thread->name);
 
+    // Move to the requested CPUs, if any. The thread runs anywhere if this fails.
+    if (thread->cpus) {
+        SDL_SYS_SetThreadAffinity(NULL, thread->cpus, thread->num_cpus);
+        SDL_free(thread->cpus);
+        thread->cpus = NULL;
+    }
+
     // Get the thread id
     thread->threadid = SDL_GetCurrentThreadID();
 
@@ -365,11 +372,17 @@ SDL_Thread *SDL_CreateThreadWithPropertiesRuntime(SDL_PropertiesID props,
     const char *name = SDL_GetStringProperty(props, SDL_PROP_THREAD_CREATE_NAME_STRING, NULL);
     const size_t stacksize = (size_t) SDL_GetNumberProperty(props, SDL_PROP_THREAD_CREATE_STACKSIZE_NUMBER, 0);
     void *userdata = SDL_GetPointerProperty(props, SDL_PROP_THREAD_CREATE_USERDATA_POINTER, NULL);
+    const int *cpus = (const int *) SDL_GetPointerProperty(props, SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER, NULL);
+    const Sint64 num_cpus = SDL_GetNumberProperty(props, SDL_PROP_THREAD_CREATE_CPU_AFFINITY_COUNT_NUMBER, 0);
 
     if (!fn) {
         SDL_SetError("Thread entry function is NULL");
         return NULL;
     }
+    if (num_cpus < 0 || num_cpus > SDL_MAX_SINT32 || (num_cpus > 0 && !cpus)) {
+        SDL_InvalidParamError("SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER");
+        return NULL;
+    }
 
     SDL_InitMainThread();
 
@@ -393,12 +406,24 @@ SDL_Thread *SDL_CreateThreadWithPropertiesRuntime(SDL_PropertiesID props,
     thread->userdata = userdata;
     thread->stacksize = stacksize;
 
+    if (num_cpus > 0) {
+        thread->cpus = (int *)SDL_malloc((size_t)num_cpus * sizeof(*cpus));
+        if (!thread->cpus) {
+            SDL_free(thread->name);
+            SDL_free(thread);
+            return NULL;
+        }
+        SDL_memcpy(thread->cpus, cpus, (size_t)num_cpus * sizeof(*cpus));
+        thread->num_cpus = (int)num_cpus;
+    }
+
     SDL_SetObjectValid(thread, SDL_OBJECT_TYPE_THREAD, true);
 
     // Create the thread and go!
     if (!SDL_SYS_CreateThread(thread, pfnBeginThread, pfnEndThread)) {
         // Oops, failed.  Gotta free everything
         SDL_SetObjectValid(thread, SDL_OBJECT_TYPE_THREAD, false);
+        SDL_free(thread->cpus);
         SDL_free(thread->name);
         SDL_free(thread);
         thread = NULL;
@@ -463,6 +488,28 @@ bool SDL_SetCurrentThreadPriority(SDL_ThreadPriority priority)
     return SDL_SYS_SetThreadPriority(priority);
 }
 
+bool SDL_SetThreadAffinity(SDL_Thread *thread, const int *cpus, int count)
+{
+    int i;
+
+    CHECK_PARAM(thread && !ThreadValid(thread)) {
+        return SDL_InvalidParamError("thread");
+    }
+    CHECK_PARAM(count < 0 || (count > 0 && !cpus)) {
+        return SDL_InvalidParamError("cpus");
+    }
+    for (i = 0; i < count; ++i) {
+        CHECK_PARAM(cpus[i] < 0) {
+            return SDL_InvalidParamError("cpus");
+        }
+    }
+
+    if (thread && thread->threadid == SDL_GetCurrentThreadID()) {
+        thread = NULL;
+    }
+    return SDL_SYS_SetThreadAffinity(thread, cpus, count);
+}
+
 void SDL_WaitThread(SDL_Thread *thread, int *status)
 {
     if (!ThreadValid(thread)) {
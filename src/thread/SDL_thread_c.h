@@ -54,6 +54,8 @@ struct SDL_Thread
     SDL_error errbuf;
     char *name;
     size_t stacksize; // 0 for default, >0 for user-specified stack size.
+    int *cpus;        // the CPUs to run on, set by the thread itself when it starts.
+    int num_cpus;
     int(SDLCALL *userfunc)(void *);
     void *userdata;
     void *data;
@@ -96,4 +98,7 @@ extern SDL_TLSData *SDL_Generic_GetTLSData(void);
 extern bool SDL_Generic_SetTLSData(SDL_TLSData *data);
 extern void SDL_Generic_QuitTLSData(void);
 
+// Destroys the default job pool, after running any jobs left in it
+extern void SDL_QuitJobs(void);
+
 #endif // SDL_thread_c_h_
@@ -121,6 +121,11 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority sdl_priority)
     return true;
 }
 
+bool SDL_SYS_SetThreadAffinity(SDL_Thread *thread, const int *cpus, int count)
+{
+    return SDL_Unsupported();
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     Result res = threadJoin(thread->handle, U64_MAX);
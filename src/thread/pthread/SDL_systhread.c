@@ -30,6 +30,7 @@
 #include <signal.h>
 #endif
 #include <errno.h>
+#include <sched.h>
 
 #ifdef SDL_PLATFORM_LINUX
 #include <sys/time.h>
@@ -287,6 +288,47 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
 #endif // #if SDL_PLATFORM_RISCOS
 }
 
+bool SDL_SYS_SetThreadAffinity(SDL_Thread *thread, const int *cpus, int count)
+{
+#if (defined(SDL_PLATFORM_LINUX) || defined(SDL_PLATFORM_ANDROID)) && defined(CPU_SETSIZE)
+    cpu_set_t set;
+    int i;
+
+    CPU_ZERO(&set);
+    if (count == 0) {
+        for (i = 0; i < CPU_SETSIZE; ++i) {
+            CPU_SET(i, &set);
+        }
+    }
+    for (i = 0; i < count; ++i) {
+        if (cpus[i] >= CPU_SETSIZE) {
+            return SDL_SetError("CPU %d can't be used for thread affinity", cpus[i]);
+        }
+        CPU_SET(cpus[i], &set);
+    }
+
+#ifdef SDL_PLATFORM_ANDROID
+    // Bionic doesn't have pthread_setaffinity_np(), and we don't know other threads' kernel ids
+    if (thread) {
+        return SDL_Unsupported();
+    }
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        return SDL_SetError("sched_setaffinity() failed: %s", strerror(errno));
+    }
+#else
+    {
+        const int rc = pthread_setaffinity_np(thread ? thread->handle : pthread_self(), sizeof(set), &set);
+        if (rc != 0) {
+            return SDL_SetError("pthread_setaffinity_np() failed: %s", strerror(rc));
+        }
+    }
+#endif
+    return true;
+#else
+    return SDL_Unsupported();
+#endif
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     pthread_join(thread->handle, NULL);
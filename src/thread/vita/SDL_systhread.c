@@ -136,4 +136,9 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return true;
 }
 
+bool SDL_SYS_SetThreadAffinity(SDL_Thread *thread, const int *cpus, int count)
+{
+    return SDL_Unsupported();
+}
+
 #endif // SDL_THREAD_VITA
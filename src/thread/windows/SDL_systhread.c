@@ -183,6 +183,31 @@ bool SDL_SYS_SetThreadPriority(SDL_ThreadPriority priority)
     return true;
 }
 
+bool SDL_SYS_SetThreadAffinity(SDL_Thread *thread, const int *cpus, int count)
+{
+    HANDLE handle = thread ? thread->handle : GetCurrentThread();
+    DWORD_PTR mask = 0;
+    int i;
+
+    if (count == 0) {
+        DWORD_PTR system_mask;
+        if (!GetProcessAffinityMask(GetCurrentProcess(), &mask, &system_mask)) {
+            return WIN_SetError("GetProcessAffinityMask()");
+        }
+    }
+    for (i = 0; i < count; ++i) {
+        // Processor groups aren't supported, so this is limited to the first 64 CPUs
+        if (cpus[i] >= (int)(sizeof(mask) * 8)) {
+            return SDL_SetError("CPU %d can't be used for thread affinity", cpus[i]);
+        }
+        mask |= (DWORD_PTR)1 << cpus[i];
+    }
+    if (!SetThreadAffinityMask(handle, mask)) {
+        return WIN_SetError("SetThreadAffinityMask()");
+    }
+    return true;
+}
+
 void SDL_SYS_WaitThread(SDL_Thread *thread)
 {
     WaitForSingleObjectEx(thread->handle, INFINITE, FALSE);
@@ -603,17 +603,129 @@ done:
         dst = (Uint16)(d | d >> 16);       \
     } while (0)
 
+/*
+ * Translucent pixels are blended a whole run at a time, so the 32bpp case
+ * can process several pixels per instruction. The SIMD versions do exactly
+ * the same 32-bit arithmetic as BLIT_TRANSL_888, one pixel per lane, so the
+ * results are bit-identical to the scalar code.
+ */
+typedef void (*RLEBlendRunFunc)(const Uint32 *src, void *dst, int n);
+
+static void BlendRun_565(const Uint32 *src, void *dst, int n)
+{
+    Uint16 *dstp = (Uint16 *)dst;
+    int i;
+    for (i = 0; i < n; i++) {
+        BLIT_TRANSL_565(src[i], dstp[i]);
+    }
+}
+
+static void BlendRun_555(const Uint32 *src, void *dst, int n)
+{
+    Uint16 *dstp = (Uint16 *)dst;
+    int i;
+    for (i = 0; i < n; i++) {
+        BLIT_TRANSL_555(src[i], dstp[i]);
+    }
+}
+
+static void BlendRun_888(const Uint32 *src, void *dst, int n)
+{
+    Uint32 *dstp = (Uint32 *)dst;
+    int i;
+    for (i = 0; i < n; i++) {
+        BLIT_TRANSL_888(src[i], dstp[i]);
+    }
+}
+
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_TARGETING("sse4.1") BlendRun_888_SSE41(const Uint32 *src, void *dst, int n)
+{
+    Uint32 *d = (Uint32 *)dst;
+    const __m128i rb_mask = _mm_set1_epi32(0x00ff00ff);
+    const __m128i g_mask = _mm_set1_epi32(0x0000ff00);
+    const __m128i a_mask = _mm_set1_epi32((int)0xff000000);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        const __m128i dp = _mm_loadu_si128((const __m128i *)(d + i));
+        const __m128i alpha = _mm_srli_epi32(s, 24);
+        __m128i s1 = _mm_and_si128(s, rb_mask);
+        __m128i d1 = _mm_and_si128(dp, rb_mask);
+        __m128i s2 = _mm_and_si128(s, g_mask);
+        __m128i d2 = _mm_and_si128(dp, g_mask);
+
+        d1 = _mm_add_epi32(d1, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s1, d1), alpha), 8));
+        d1 = _mm_and_si128(d1, rb_mask);
+        d2 = _mm_add_epi32(d2, _mm_srli_epi32(_mm_mullo_epi32(_mm_sub_epi32(s2, d2), alpha), 8));
+        d2 = _mm_and_si128(d2, g_mask);
+        _mm_storeu_si128((__m128i *)(d + i), _mm_or_si128(_mm_or_si128(d1, d2), a_mask));
+    }
+    BlendRun_888(src + i, d + i, n - i);
+}
+#endif
+
+#ifdef SDL_NEON_INTRINSICS
+static void BlendRun_888_NEON(const Uint32 *src, void *dst, int n)
+{
+    Uint32 *d = (Uint32 *)dst;
+    const uint32x4_t rb_mask = vdupq_n_u32(0x00ff00ff);
+    const uint32x4_t g_mask = vdupq_n_u32(0x0000ff00);
+    const uint32x4_t a_mask = vdupq_n_u32(0xff000000);
+    int i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        const uint32x4_t s = vld1q_u32(src + i);
+        const uint32x4_t dp = vld1q_u32(d + i);
+        const uint32x4_t alpha = vshrq_n_u32(s, 24);
+        uint32x4_t s1 = vandq_u32(s, rb_mask);
+        uint32x4_t d1 = vandq_u32(dp, rb_mask);
+        uint32x4_t s2 = vandq_u32(s, g_mask);
+        uint32x4_t d2 = vandq_u32(dp, g_mask);
+
+        d1 = vandq_u32(vaddq_u32(d1, vshrq_n_u32(vmulq_u32(vsubq_u32(s1, d1), alpha), 8)), rb_mask);
+        d2 = vandq_u32(vaddq_u32(d2, vshrq_n_u32(vmulq_u32(vsubq_u32(s2, d2), alpha), 8)), g_mask);
+        vst1q_u32(d + i, vorrq_u32(vorrq_u32(d1, d2), a_mask));
+    }
+    BlendRun_888(src + i, d + i, n - i);
+}
+#endif
+
+static RLEBlendRunFunc RLEChooseBlendRun(const SDL_PixelFormatDetails *df)
+{
+    if (df->bytes_per_pixel == 2) {
+        if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
+            return BlendRun_565;
+        }
+        return BlendRun_555;
+    }
+
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        return BlendRun_888_SSE41;
+    }
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    if (SDL_HasNEON()) {
+        return BlendRun_888_NEON;
+    }
+#endif
+    return BlendRun_888;
+}
+
 // blit a pixel-alpha RLE surface clipped at the right and/or left edges
 static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
                              Uint8 *dstbuf, const SDL_Rect *srcrect)
 {
     const SDL_PixelFormatDetails *df = surf_dst->fmt;
+    const RLEBlendRunFunc blend_run = RLEChooseBlendRun(df);
     /*
      * clipped blitter: Ptype is the destination pixel type,
-     * Ctype the translucent count type, and do_blend the macro
-     * to blend one pixel.
+     * Ctype the opaque count type, and blend_run blends a
+     * run of translucent pixels.
      */
-#define RLEALPHACLIPBLIT(Ptype, Ctype, do_blend)                          \
+#define RLEALPHACLIPBLIT(Ptype, Ctype)                                    \
     do {                                                                  \
         int linecount = srcrect->h;                                       \
         int left = srcrect->x;                                            \
@@ -667,13 +779,9 @@ static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
                     }                                                     \
                     if (crun > right - cofs)                              \
                         crun = right - cofs;                              \
-                    if (crun > 0) {                                       \
-                        Ptype *dst = (Ptype *)dstbuf + cofs;              \
-                        Uint32 *src = (Uint32 *)srcbuf + (cofs - ofs);    \
-                        int i;                                            \
-                        for (i = 0; i < crun; i++)                        \
-                            do_blend(src[i], dst[i]);                     \
-                    }                                                     \
+                    if (crun > 0)                                         \
+                        blend_run((Uint32 *)srcbuf + (cofs - ofs),        \
+                                  (Ptype *)dstbuf + cofs, crun);          \
                     srcbuf += run * 4;                                    \
                     ofs += run;                                           \
                 }                                                         \
@@ -684,14 +792,10 @@ static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
 
     switch (df->bytes_per_pixel) {
     case 2:
-        if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_565);
-        } else {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_555);
-        }
+        RLEALPHACLIPBLIT(Uint16, Uint8);
         break;
     case 4:
-        RLEALPHACLIPBLIT(Uint32, Uint16, BLIT_TRANSL_888);
+        RLEALPHACLIPBLIT(Uint32, Uint16);
         break;
     }
 }
@@ -780,12 +884,14 @@ static bool SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, const SDL_Rect *srcr
         RLEAlphaClipBlit(w, srcbuf, surf_dst, dstbuf, srcrect);
     } else {
 
+        const RLEBlendRunFunc blend_run = RLEChooseBlendRun(df);
+
         /*
          * non-clipped blitter. Ptype is the destination pixel type,
-         * Ctype the translucent count type, and do_blend the
-         * macro to blend one pixel.
+         * Ctype the opaque count type, and blend_run blends a run
+         * of translucent pixels.
          */
-#define RLEALPHABLIT(Ptype, Ctype, do_blend)                         \
+#define RLEALPHABLIT(Ptype, Ctype)                                   \
     do {                                                             \
         int linecount = srcrect->h;                                  \
         do {                                                         \
@@ -816,14 +922,9 @@ static bool SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, const SDL_Rect *srcr
                 run = ((Uint16 *)srcbuf)[1];                         \
                 srcbuf += 4;                                         \
                 if (run) {                                           \
-                    Ptype *dst = (Ptype *)dstbuf + ofs;              \
-                    unsigned i;                                      \
-                    for (i = 0; i < run; i++) {                      \
-                        Uint32 src = *(Uint32 *)srcbuf;              \
-                        do_blend(src, *dst);                         \
-                        srcbuf += 4;                                 \
-                        dst++;                                       \
-                    }                                                \
+                    blend_run((Uint32 *)srcbuf, (Ptype *)dstbuf + ofs, \
+                              (int)run);                             \
+                    srcbuf += run * 4;                               \
                     ofs += run;                                      \
                 }                                                    \
             } while (ofs < w);                                       \
@@ -833,14 +934,10 @@ static bool SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, const SDL_Rect *srcr
 
         switch (df->bytes_per_pixel) {
         case 2:
-            if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_565);
-            } else {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_555);
-            }
+            RLEALPHABLIT(Uint16, Uint8);
             break;
         case 4:
-            RLEALPHABLIT(Uint32, Uint16, BLIT_TRANSL_888);
+            RLEALPHABLIT(Uint32, Uint16);
             break;
         }
     }
@@ -936,6 +1033,85 @@ static int copy_32(void *dst, const Uint32 *src, int n,
 #define ISTRANSL(pixel, fmt) \
     ((unsigned)((((pixel)&fmt->Amask) >> fmt->Ashift) - 1U) < 254U)
 
+/*
+ * Run scanning for the encoders:
+ * A pixel is "in the set" if (pixel & mask) equals key0 or key1. These
+ * return the first position at or after x where set membership differs
+ * from "in", or w if the run extends to the end of the line.
+ *
+ * This covers everything the encoders look for: colorkey matches
+ * (key0 == key1 == colorkey), opaque pixels (key0 == key1 == Amask) and
+ * translucent pixels (not in the set {0, Amask}), as long as alpha is
+ * 8 bits wide.
+ */
+typedef int (*RLEScanFunc)(const Uint32 *src, int x, int w, Uint32 mask, Uint32 key0, Uint32 key1, bool in);
+
+static int RLEScan32(const Uint32 *src, int x, int w, Uint32 mask, Uint32 key0, Uint32 key1, bool in)
+{
+    while (x < w) {
+        const Uint32 pixel = src[x] & mask;
+        if ((pixel == key0 || pixel == key1) != in) {
+            break;
+        }
+        x++;
+    }
+    return x;
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+static int SDL_TARGETING("sse2") RLEScan32SSE2(const Uint32 *src, int x, int w, Uint32 mask, Uint32 key0, Uint32 key1, bool in)
+{
+    const __m128i vmask = _mm_set1_epi32((int)mask);
+    const __m128i vkey0 = _mm_set1_epi32((int)key0);
+    const __m128i vkey1 = _mm_set1_epi32((int)key1);
+    const int expected = in ? 0xFFFF : 0;
+
+    for (; x + 4 <= w; x += 4) {
+        const __m128i pixels = _mm_and_si128(_mm_loadu_si128((const __m128i *)(src + x)), vmask);
+        const __m128i match = _mm_or_si128(_mm_cmpeq_epi32(pixels, vkey0), _mm_cmpeq_epi32(pixels, vkey1));
+        if (_mm_movemask_epi8(match) != expected) {
+            break;
+        }
+    }
+    // Find the exact position within the last group of four
+    return RLEScan32(src, x, w, mask, key0, key1, in);
+}
+#endif
+
+#if defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+static int RLEScan32NEON(const Uint32 *src, int x, int w, Uint32 mask, Uint32 key0, Uint32 key1, bool in)
+{
+    const uint32x4_t vmask = vdupq_n_u32(mask);
+    const uint32x4_t vkey0 = vdupq_n_u32(key0);
+    const uint32x4_t vkey1 = vdupq_n_u32(key1);
+
+    for (; x + 4 <= w; x += 4) {
+        const uint32x4_t pixels = vandq_u32(vld1q_u32(src + x), vmask);
+        const uint32x4_t match = vorrq_u32(vceqq_u32(pixels, vkey0), vceqq_u32(pixels, vkey1));
+        if (in ? (vminvq_u32(match) == 0) : (vmaxvq_u32(match) != 0)) {
+            break;
+        }
+    }
+    // Find the exact position within the last group of four
+    return RLEScan32(src, x, w, mask, key0, key1, in);
+}
+#endif
+
+static RLEScanFunc RLEChooseScan32(void)
+{
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        return RLEScan32SSE2;
+    }
+#endif
+#if defined(SDL_NEON_INTRINSICS) && (defined(__aarch64__) || defined(_M_ARM64))
+    if (SDL_HasNEON()) {
+        return RLEScan32NEON;
+    }
+#endif
+    return RLEScan32;
+}
+
 // convert surface to be quickly alpha-blittable onto dest, if possible
 static bool RLEAlphaSurface(SDL_Surface *surface)
 {
@@ -1023,6 +1199,8 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
         const SDL_PixelFormatDetails *sf = surface->fmt;
         Uint32 *src = (Uint32 *)surface->pixels;
         Uint8 *lastline = dst; // end of last non-blank line
+        const Uint32 amask = sf->Amask;
+        const RLEScanFunc scan = (sf->Abits == 8) ? RLEChooseScan32() : NULL;
 
         // opaque counts are 8 or 16 bits, depending on target depth
 #define ADD_OPAQUE_COUNTS(n, m)           \
@@ -1048,12 +1226,18 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
             do {
                 int run, skip, len;
                 skipstart = x;
-                while (x < w && !ISOPAQUE(src[x], sf)) {
-                    x++;
-                }
-                runstart = x;
-                while (x < w && ISOPAQUE(src[x], sf)) {
-                    x++;
+                if (scan) {
+                    x = scan(src, x, w, amask, amask, amask, false);
+                    runstart = x;
+                    x = scan(src, x, w, amask, amask, amask, true);
+                } else {
+                    while (x < w && !ISOPAQUE(src[x], sf)) {
+                        x++;
+                    }
+                    runstart = x;
+                    while (x < w && ISOPAQUE(src[x], sf)) {
+                        x++;
+                    }
                 }
                 skip = runstart - skipstart;
                 if (skip == w) {
@@ -1086,12 +1270,18 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
             do {
                 int run, skip, len;
                 skipstart = x;
-                while (x < w && !ISTRANSL(src[x], sf)) {
-                    x++;
-                }
-                runstart = x;
-                while (x < w && ISTRANSL(src[x], sf)) {
-                    x++;
+                if (scan) {
+                    x = scan(src, x, w, amask, 0, amask, true);
+                    runstart = x;
+                    x = scan(src, x, w, amask, 0, amask, false);
+                } else {
+                    while (x < w && !ISTRANSL(src[x], sf)) {
+                        x++;
+                    }
+                    runstart = x;
+                    while (x < w && ISTRANSL(src[x], sf)) {
+                        x++;
+                    }
                 }
                 skip = runstart - skipstart;
                 blankline &= (skip == w);
@@ -1138,17 +1328,7 @@ static bool RLEAlphaSurface(SDL_Surface *surface)
     return true;
 }
 
-static Uint32 getpix_8(const Uint8 *srcbuf)
-{
-    return *srcbuf;
-}
-
-static Uint32 getpix_16(const Uint8 *srcbuf)
-{
-    return *(const Uint16 *)srcbuf;
-}
-
-static Uint32 getpix_24(const Uint8 *srcbuf)
+static SDL_INLINE Uint32 getpix_24(const Uint8 *srcbuf)
 {
 #if SDL_BYTEORDER == SDL_LIL_ENDIAN
     return srcbuf[0] + (srcbuf[1] << 8) + (srcbuf[2] << 16);
@@ -1157,17 +1337,35 @@ static Uint32 getpix_24(const Uint8 *srcbuf)
 #endif
 }
 
-static Uint32 getpix_32(const Uint8 *srcbuf)
+/*
+ * Return the first position at or after x where the pixel's colorkey match
+ * differs from "transparent". 32bpp pixels go through the RLEScanFunc path.
+ */
+static int RLEScanColorkey(const Uint8 *srcbuf, int x, int w, int bpp,
+                           Uint32 ckey, Uint32 rgbmask, bool transparent)
 {
-    return *(const Uint32 *)srcbuf;
+    switch (bpp) {
+    case 1:
+        while (x < w && ((srcbuf[x] & rgbmask) == ckey) == transparent) {
+            x++;
+        }
+        break;
+    case 2:
+        while (x < w && ((((const Uint16 *)srcbuf)[x] & rgbmask) == ckey) == transparent) {
+            x++;
+        }
+        break;
+    case 3:
+        while (x < w && ((getpix_24(srcbuf + x * 3) & rgbmask) == ckey) == transparent) {
+            x++;
+        }
+        break;
+    default:
+        break;
+    }
+    return x;
 }
 
-typedef Uint32 (*getpix_func)(const Uint8 *);
-
-static const getpix_func getpixes[4] = {
-    getpix_8, getpix_16, getpix_24, getpix_32
-};
-
 static bool RLEColorkeySurface(SDL_Surface *surface)
 {
     SDL_Surface *dest;
@@ -1177,7 +1375,7 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
     Uint8 *srcbuf, *lastline;
     int maxsize = 0;
     const int bpp = surface->fmt->bytes_per_pixel;
-    getpix_func getpix;
+    RLEScanFunc scan = NULL;
     Uint32 ckey, rgbmask;
     int w, h;
 
@@ -1222,7 +1420,9 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
     rgbmask = ~surface->fmt->Amask;
     ckey = surface->map.info.colorkey & rgbmask;
     lastline = dst;
-    getpix = getpixes[bpp - 1];
+    if (bpp == 4) {
+        scan = RLEChooseScan32();
+    }
     w = surface->w;
     h = surface->h;
 
@@ -1247,12 +1447,14 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
             int skipstart = x;
 
             // find run of transparent, then opaque pixels
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) == ckey) {
-                x++;
-            }
-            runstart = x;
-            while (x < w && (getpix(srcbuf + x * bpp) & rgbmask) != ckey) {
-                x++;
+            if (scan) {
+                x = scan((const Uint32 *)srcbuf, x, w, rgbmask, ckey, ckey, true);
+                runstart = x;
+                x = scan((const Uint32 *)srcbuf, x, w, rgbmask, ckey, ckey, false);
+            } else {
+                x = RLEScanColorkey(srcbuf, x, w, bpp, ckey, rgbmask, true);
+                runstart = x;
+                x = RLEScanColorkey(srcbuf, x, w, bpp, ckey, rgbmask, false);
             }
             skip = runstart - skipstart;
             if (skip == w) {
@@ -1304,13 +1506,106 @@ static bool RLEColorkeySurface(SDL_Surface *surface)
     return true;
 }
 
+/*
+ * Locking an RLE surface throws away the encoding, and the next blit has to
+ * encode it again. Sprite sheets are often locked just to read pixels, so the
+ * old encoding is kept along with a hash of the pixels it was made from, and
+ * is reused if nothing changed while the surface was unlocked.
+ *
+ * The hash is taken when the encoding is discarded: up to that point the
+ * pixels can't have been modified since they are only reachable by locking.
+ * Preallocated surfaces keep their pixels accessible, so they aren't cached.
+ */
+struct SDL_RLECache
+{
+    void *data;
+    Uint64 hash;
+    Uint32 encoding;
+    Uint32 colorkey;
+    SDL_PixelFormat dst_format;
+};
+
+static Uint64 RLEHashPixels(const SDL_Surface *surface)
+{
+    const Uint8 *row = (const Uint8 *)surface->pixels;
+    const size_t len = (size_t)surface->w * surface->fmt->bytes_per_pixel;
+    Uint64 hash = 0;
+    int y;
+
+    for (y = 0; y < surface->h; y++) {
+        size_t i = 0;
+        for (; i + sizeof(Uint64) <= len; i += sizeof(Uint64)) {
+            Uint64 value;
+            SDL_memcpy(&value, row + i, sizeof(value));
+            hash = ((hash << 5) | (hash >> 59)) ^ value;
+            hash *= SDL_UINT64_C(0x9E3779B97F4A7C15);
+        }
+        for (; i < len; i++) {
+            hash = ((hash << 5) | (hash >> 59)) ^ row[i];
+            hash *= SDL_UINT64_C(0x9E3779B97F4A7C15);
+        }
+        row += surface->pitch;
+    }
+    return hash;
+}
+
+void SDL_FreeRLECache(SDL_Surface *surface)
+{
+    if (surface->rle_cache) {
+        SDL_free(surface->rle_cache->data);
+        SDL_free(surface->rle_cache);
+        surface->rle_cache = NULL;
+    }
+}
+
+// Take over the cached encoding if it matches the current pixels and blit setup
+static bool RLEUseCache(SDL_Surface *surface, Uint32 encoding)
+{
+    SDL_RLECache *cache = surface->rle_cache;
+    bool match;
+
+    if (!cache || !surface->map.info.dst_surface) {
+        return false;
+    }
+
+    match = (cache->encoding == encoding &&
+             cache->dst_format == surface->map.info.dst_surface->format &&
+             (encoding != SDL_COPY_RLE_COLORKEY || cache->colorkey == surface->map.info.colorkey) &&
+             cache->hash == RLEHashPixels(surface));
+    if (match) {
+        surface->map.data = cache->data;
+        cache->data = NULL;
+    }
+    SDL_FreeRLECache(surface);
+    return match;
+}
+
+static void RLECacheEncoding(SDL_Surface *surface, Uint32 encoding)
+{
+    SDL_RLECache *cache;
+
+    SDL_FreeRLECache(surface);
+
+    cache = (SDL_RLECache *)SDL_malloc(sizeof(*cache));
+    if (!cache) {
+        SDL_free(surface->map.data);
+        return;
+    }
+    cache->data = surface->map.data;
+    cache->hash = RLEHashPixels(surface);
+    cache->encoding = encoding;
+    cache->colorkey = surface->map.info.colorkey;
+    cache->dst_format = *(SDL_PixelFormat *)surface->map.data;
+    surface->rle_cache = cache;
+}
+
 bool SDL_RLESurface(SDL_Surface *surface)
 {
     int flags;
 
     // Clear any previous RLE conversion
     if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
-        SDL_UnRLESurface(surface);
+        SDL_UnRLESurface(surface, true);
     }
 
     // We don't support RLE encoding of bitmaps
@@ -1346,13 +1641,15 @@ bool SDL_RLESurface(SDL_Surface *surface)
         if (!surface->map.identity) {
             return false;
         }
-        if (!RLEColorkeySurface(surface)) {
+        if (!RLEUseCache(surface, SDL_COPY_RLE_COLORKEY) &&
+            !RLEColorkeySurface(surface)) {
             return false;
         }
         surface->map.blit = SDL_RLEBlit;
         surface->map.info.flags |= SDL_COPY_RLE_COLORKEY;
     } else {
-        if (!RLEAlphaSurface(surface)) {
+        if (!RLEUseCache(surface, SDL_COPY_RLE_ALPHAKEY) &&
+            !RLEAlphaSurface(surface)) {
             return false;
         }
         surface->map.blit = SDL_RLEAlphaBlit;
@@ -1371,9 +1668,11 @@ bool SDL_RLESurface(SDL_Surface *surface)
     return true;
 }
 
-void SDL_UnRLESurface(SDL_Surface *surface)
+void SDL_UnRLESurface(SDL_Surface *surface, bool keep_cache)
 {
     if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
+        const Uint32 encoding = surface->map.info.flags & (SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY);
+
         surface->internal_flags &= ~SDL_INTERNAL_SURFACE_RLEACCEL;
 
         surface->map.info.flags &= ~(SDL_COPY_RLE_COLORKEY | SDL_COPY_RLE_ALPHAKEY);
@@ -1383,7 +1682,13 @@ void SDL_UnRLESurface(SDL_Surface *surface)
             surface->saved_pixels = NULL;
         }
 
-        SDL_free(surface->map.data);
+        if (keep_cache &&
+            (surface->map.info.flags & SDL_COPY_RLE_DESIRED) &&
+            !(surface->flags & SDL_SURFACE_PREALLOCATED)) {
+            RLECacheEncoding(surface, encoding);
+        } else {
+            SDL_free(surface->map.data);
+        }
         surface->map.data = NULL;
 
         SDL_InvalidateMap(&surface->map);
@@ -27,6 +27,7 @@
 // Useful functions and variables from SDL_RLEaccel.c
 
 extern bool SDL_RLESurface(SDL_Surface *surface);
-extern void SDL_UnRLESurface(SDL_Surface *surface);
+extern void SDL_UnRLESurface(SDL_Surface *surface, bool keep_cache);
+extern void SDL_FreeRLECache(SDL_Surface *surface);
 
 #endif // SDL_RLEaccel_c_h_
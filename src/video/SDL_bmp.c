@@ -34,6 +34,7 @@
 
 #include "SDL_pixels_c.h"
 #include "SDL_surface_c.h"
+#include "../io/SDL_iostream_c.h"
 
 #define SAVE_32BIT_BMP
 
@@ -213,6 +214,7 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
     bool haveRGBMasks = false;
     bool haveAlphaMask = false;
     bool correctAlpha = false;
+    bool buffered = false;
 
     // The Win32 BMP file header (14 bytes)
     // char magic[2];
@@ -241,6 +243,9 @@ SDL_Surface *SDL_LoadBMP_IO(SDL_IOStream *src, bool closeio)
         goto done;
     }
 
+    // The headers and RLE data are read a byte or a field at a time
+    buffered = SDL_BeginBufferedIO(src);
+
     // Read in the BMP file header
     fp_offset = SDL_TellIO(src);
     if (fp_offset < 0) {
@@ -585,6 +590,9 @@ done:
         SDL_DestroySurface(surface);
         surface = NULL;
     }
+    if (buffered) {
+        SDL_EndBufferedIO(src);
+    }
     if (closeio && src) {
         SDL_CloseIO(src);
     }
@@ -674,6 +682,7 @@ SDL_Surface *SDL_LoadBMP(const char *file)
 static bool SDL_SaveBMP_IO_Internal(BMPSaveState *state, SDL_IOStream *dst, bool closeio)
 {
     bool was_error = true;
+    bool buffered;
     Sint64 fp_offset, new_offset;
     int i, pad;
     Uint8 *bits;
@@ -715,6 +724,9 @@ static bool SDL_SaveBMP_IO_Internal(BMPSaveState *state, SDL_IOStream *dst, bool
     Uint32 bV5ProfileSize = 0;
     Uint32 bV5Reserved = 0;
 
+    // The headers are written a field at a time
+    buffered = SDL_BeginBufferedIO(dst);
+
     if (SDL_LockSurface(state->intermediate_surface)) {
         const size_t bw = state->intermediate_surface->w * state->intermediate_surface->fmt->bytes_per_pixel;
 
@@ -889,6 +901,9 @@ static bool SDL_SaveBMP_IO_Internal(BMPSaveState *state, SDL_IOStream *dst, bool
     }
 
 done:
+    if (buffered && !SDL_EndBufferedIO(dst)) {
+        was_error = true;
+    }
     if (closeio && dst) {
         if (!SDL_CloseIO(dst)) {
             was_error = true;
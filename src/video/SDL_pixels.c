@@ -1562,7 +1562,7 @@ bool SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     map = &src->map;
 #ifdef SDL_HAVE_RLE
     if (src->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
-        SDL_UnRLESurface(src);
+        SDL_UnRLESurface(src, true);
     }
 #endif
     SDL_InvalidateMap(map);
@@ -27,6 +27,7 @@
 #include "SDL_rotate.h"
 #include "SDL_stb_c.h"
 #include "SDL_yuv_c.h"
+#include "../SDL_trace_c.h"
 #include "../render/SDL_sysrender.h"
 
 #include "SDL_surface_c.h"
@@ -610,6 +611,9 @@ bool SDL_SetSurfaceRLE(SDL_Surface *surface, bool enabled)
         surface->map.info.flags |= SDL_COPY_RLE_DESIRED;
     } else {
         surface->map.info.flags &= ~SDL_COPY_RLE_DESIRED;
+#ifdef SDL_HAVE_RLE
+        SDL_FreeRLECache(surface);
+#endif
     }
     if (surface->map.info.flags != flags) {
         SDL_InvalidateMap(&surface->map);
@@ -1018,6 +1022,7 @@ bool SDL_BlitSurfaceUnchecked(SDL_Surface *src, const SDL_Rect *srcrect,
 bool SDL_BlitSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect)
 {
     SDL_Rect r_src, r_dst;
+    bool result;
 
     // Make sure the surfaces aren't locked
     CHECK_PARAM(!SDL_SurfaceValid(src) || (!src->pixels && !SDL_MUSTLOCK(src))) {
@@ -1091,7 +1096,10 @@ bool SDL_BlitSurface(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst
         SDL_InvalidateMap(&src->map);
     }
 
-    return SDL_BlitSurfaceUnchecked(src, &r_src, dst, &r_dst);
+    SDL_TRACE_ZONE_BEGIN(trace_zone, "SDL_BlitSurface");
+    result = SDL_BlitSurfaceUnchecked(src, &r_src, dst, &r_dst);
+    SDL_TRACE_ZONE_END(trace_zone, "SDL_BlitSurface");
+    return result;
 }
 
 static bool SDL_BlitSurfaceClippedScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
@@ -1727,7 +1735,7 @@ bool SDL_LockSurface(SDL_Surface *surface)
 #ifdef SDL_HAVE_RLE
         // Perform the lock
         if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
-            SDL_UnRLESurface(surface);
+            SDL_UnRLESurface(surface, true);
         }
 #endif
     }
@@ -3070,8 +3078,9 @@ void SDL_DestroySurface(SDL_Surface *surface)
     }
 #ifdef SDL_HAVE_RLE
     if (surface->internal_flags & SDL_INTERNAL_SURFACE_RLEACCEL) {
-        SDL_UnRLESurface(surface);
+        SDL_UnRLESurface(surface, false);
     }
+    SDL_FreeRLECache(surface);
 #endif
     SDL_SetSurfacePalette(surface, NULL);
 
@@ -30,6 +30,8 @@
 // Surface internal flags
 typedef Uint32 SDL_SurfaceDataFlags;
 
+typedef struct SDL_RLECache SDL_RLECache;
+
 #define SDL_INTERNAL_SURFACE_DONTFREE   0x00000001u /**< Surface is referenced internally */
 #define SDL_INTERNAL_SURFACE_STACK      0x00000002u /**< Surface is allocated on the stack */
 #define SDL_INTERNAL_SURFACE_RLEACCEL   0x00000004u /**< Surface is RLE encoded */
@@ -81,6 +83,9 @@ struct SDL_Surface
 
     /** Original pixels when RLE is enabled */
     void *saved_pixels;
+
+    /** Previous RLE encoding, reused if the pixels haven't changed */
+    SDL_RLECache *rle_cache;
 };
 
 // Surface functions
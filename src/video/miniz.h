@@ -176,7 +176,10 @@
 //#define MINIZ_NO_DEFLATE_APIS
 
 // Define MINIZ_NO_INFLATE_APIS to disable all decompression API's.
+// (SDL: define MINIZ_SDL_INFLATE before including this to get them back.)
+#ifndef MINIZ_SDL_INFLATE
 #define MINIZ_NO_INFLATE_APIS
+#endif
 
 // Define MINIZ_NO_ARCHIVE_APIS to disable all ZIP archive API's.
 #define MINIZ_NO_ARCHIVE_APIS
@@ -257,6 +260,7 @@ extern "C" {
 // For more compatibility with zlib, miniz.c uses unsigned long for some parameters/struct members. Beware: mz_ulong can be either 32 or 64-bits!
 typedef unsigned long mz_ulong;
 
+#if !defined(MINIZ_SDL_NOUNUSED) || !defined(MINIZ_NO_DEFLATE_APIS)
 // mz_free() internally uses the MZ_FREE() macro (which by default calls free() unless you've modified the MZ_MALLOC macro) to release a block allocated from the heap.
 MINIZ_STATIC void mz_free(void *p);
 
@@ -267,6 +271,7 @@ MINIZ_STATIC mz_ulong mz_adler32(mz_ulong adler, const unsigned char *ptr, size_
 #define MZ_CRC32_INIT (0)
 // mz_crc32() returns the initial CRC-32 value to use when called with ptr==NULL.
 MINIZ_STATIC mz_ulong mz_crc32(mz_ulong crc, const unsigned char *ptr, size_t buf_len);
+#endif /* !MINIZ_SDL_NOUNUSED || !MINIZ_NO_DEFLATE_APIS */
 
 // Compression strategies.
 enum { MZ_DEFAULT_STRATEGY = 0, MZ_FILTERED = 1, MZ_HUFFMAN_ONLY = 2, MZ_RLE = 3, MZ_FIXED = 4 };
@@ -736,6 +741,7 @@ enum
 };
 
 // High level decompression functions:
+#ifndef MINIZ_SDL_NOUNUSED
 // tinfl_decompress_mem_to_heap() decompresses a block in memory to a heap block allocated via malloc().
 // On entry:
 //  pSrc_buf, src_buf_len: Pointer and size of the Deflate or zlib source data to decompress.
@@ -744,6 +750,7 @@ enum
 //  *pOut_len will be set to the decompressed data's size, which could be larger than src_buf_len on uncompressible data.
 //  The caller must call mz_free() on the returned block when it's no longer needed.
 MINIZ_STATIC void *tinfl_decompress_mem_to_heap(const void *pSrc_buf, size_t src_buf_len, size_t *pOut_len, int flags);
+#endif /* MINIZ_SDL_NOUNUSED */
 
 // tinfl_decompress_mem_to_mem() decompresses a block in memory to another block in memory.
 // Returns TINFL_DECOMPRESS_MEM_TO_MEM_FAILED on failure, or the number of bytes written on success.
@@ -753,7 +760,9 @@ MINIZ_STATIC size_t tinfl_decompress_mem_to_mem(void *pOut_buf, size_t out_buf_l
 // tinfl_decompress_mem_to_callback() decompresses a block in memory to an internal 32KB buffer, and a user provided callback function will be called to flush the buffer.
 // Returns 1 on success or 0 on failure.
 typedef int (*tinfl_put_buf_func_ptr)(const void* pBuf, int len, void *pUser);
+#ifndef MINIZ_SDL_NOUNUSED
 MINIZ_STATIC int tinfl_decompress_mem_to_callback(const void *pIn_buf, size_t *pIn_buf_size, tinfl_put_buf_func_ptr pPut_buf_func, void *pPut_buf_user, int flags);
+#endif
 
 struct tinfl_decompressor_tag; typedef struct tinfl_decompressor_tag tinfl_decompressor;
 
@@ -1049,6 +1058,7 @@ typedef unsigned char mz_validate_uint64[sizeof(mz_uint64)==8 ? 1 : -1];
 
 // ------------------- zlib-style API's
 
+#if !defined(MINIZ_SDL_NOUNUSED) || !defined(MINIZ_NO_DEFLATE_APIS)
 mz_ulong mz_adler32(mz_ulong adler, const unsigned char *ptr, size_t buf_len)
 {
   mz_uint32 i, s1 = (mz_uint32)(adler & 0xffff), s2 = (mz_uint32)(adler >> 16); size_t block_len = buf_len % 5552;
@@ -1079,6 +1089,7 @@ MINIZ_STATIC void mz_free(void *p)
 {
   MZ_FREE(p);
 }
+#endif /* !MINIZ_SDL_NOUNUSED || !MINIZ_NO_DEFLATE_APIS */
 
 #ifndef MINIZ_NO_ZLIB_APIS
 
@@ -1789,6 +1800,7 @@ common_exit:
 }
 
 // Higher level helper functions.
+#ifndef MINIZ_SDL_NOUNUSED
 void *tinfl_decompress_mem_to_heap(const void *pSrc_buf, size_t src_buf_len, size_t *pOut_len, int flags)
 {
   tinfl_decompressor decomp; void *pBuf = NULL, *pNew_buf; size_t src_buf_ofs = 0, out_buf_capacity = 0;
@@ -1817,6 +1829,8 @@ void *tinfl_decompress_mem_to_heap(const void *pSrc_buf, size_t src_buf_len, siz
   return pBuf;
 }
 
+#endif /* MINIZ_SDL_NOUNUSED */
+
 size_t tinfl_decompress_mem_to_mem(void *pOut_buf, size_t out_buf_len, const void *pSrc_buf, size_t src_buf_len, int flags)
 {
   tinfl_decompressor decomp; tinfl_status status; tinfl_init(&decomp);
@@ -1824,6 +1838,7 @@ size_t tinfl_decompress_mem_to_mem(void *pOut_buf, size_t out_buf_len, const voi
   return (status != TINFL_STATUS_DONE) ? TINFL_DECOMPRESS_MEM_TO_MEM_FAILED : out_buf_len;
 }
 
+#ifndef MINIZ_SDL_NOUNUSED
 int tinfl_decompress_mem_to_callback(const void *pIn_buf, size_t *pIn_buf_size, tinfl_put_buf_func_ptr pPut_buf_func, void *pPut_buf_user, int flags)
 {
   int result = 0;
@@ -1852,6 +1867,7 @@ int tinfl_decompress_mem_to_callback(const void *pIn_buf, size_t *pIn_buf_size,
   *pIn_buf_size = in_buf_ofs;
   return result;
 }
+#endif /* MINIZ_SDL_NOUNUSED */
 #endif /*#ifndef MINIZ_NO_INFLATE_APIS*/
 
 // ------------------- Low-level Compression (independent from all decompression API's)
@@ -0,0 +1,309 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Compares many small async reads started one at a time against the same
+   reads started as a batch, and checks scatter/gather I/O. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static const char *filename = "testasyncbatch.dat";
+static int count = 1000;
+static int chunk_size = 4096;
+
+static Uint8 ExpectedByte(size_t pos)
+{
+    return (Uint8)((pos * 31) ^ (pos >> 9));
+}
+
+static bool WaitForResults(SDL_AsyncIOQueue *queue, int num_tasks, Uint64 *bytes_transferred)
+{
+    bool result = true;
+    int i;
+
+    *bytes_transferred = 0;
+    for (i = 0; i < num_tasks; i++) {
+        SDL_AsyncIOOutcome outcome;
+        if (!SDL_WaitAsyncIOResult(queue, &outcome, -1)) {
+            SDL_Log("Waiting for async I/O failed");
+            return false;
+        }
+        if (outcome.result != SDL_ASYNCIO_COMPLETE) {
+            SDL_Log("Async I/O task failed: %s", SDL_GetError());
+            result = false;
+        }
+        *bytes_transferred += outcome.bytes_transferred;
+    }
+    return result;
+}
+
+static bool VerifyData(const char *name, const Uint8 *data, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; i++) {
+        if (data[i] != ExpectedByte(i)) {
+            SDL_Log("%s: data mismatch at offset %u", name, (unsigned int)i);
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Closing a file with batched requests that haven't been submitted waits for them */
+static bool TestCloseBeforeSubmit(SDL_AsyncIOQueue *queue, SDL_AsyncIOBatch *batch, size_t size)
+{
+    SDL_AsyncIOBatch *discarded = NULL;
+    SDL_AsyncIO *asyncio;
+    SDL_AsyncIOOutcome outcome;
+    Uint8 *data;
+    bool result = false;
+    int i;
+
+    data = (Uint8 *)SDL_calloc(1, size);
+    if (!data) {
+        return false;
+    }
+
+    /* Submitted after the close, the read still happens, then the close */
+    asyncio = SDL_AsyncIOFromFile(filename, "r");
+    if (!asyncio ||
+        !SDL_BatchReadAsyncIO(batch, asyncio, data, 0, size, NULL) ||
+        !SDL_CloseAsyncIO(asyncio, false, queue, NULL)) {
+        SDL_Log("Close before submit failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (SDL_GetAsyncIOResult(queue, &outcome)) {
+        SDL_Log("Close before submit finished before the batch was submitted");
+        goto done;
+    }
+    if (!SDL_SubmitAsyncIOBatch(batch)) {
+        SDL_Log("Submitting after close failed: %s", SDL_GetError());
+        goto done;
+    }
+    for (i = 0; i < 2; i++) {
+        if (!SDL_WaitAsyncIOResult(queue, &outcome, -1) || outcome.result != SDL_ASYNCIO_COMPLETE) {
+            SDL_Log("Close before submit task failed: %s", SDL_GetError());
+            goto done;
+        }
+        if (outcome.type != (i == 0 ? SDL_ASYNCIO_TASK_READ : SDL_ASYNCIO_TASK_CLOSE)) {
+            SDL_Log("Close before submit completed out of order");
+            goto done;
+        }
+    }
+    if (!VerifyData("read submitted after close", data, size)) {
+        goto done;
+    }
+
+    /* Discarded after the close, the close goes ahead on its own */
+    discarded = SDL_CreateAsyncIOBatch(queue);
+    asyncio = SDL_AsyncIOFromFile(filename, "r");
+    if (!discarded || !asyncio ||
+        !SDL_BatchReadAsyncIO(discarded, asyncio, data, 0, size, NULL) ||
+        !SDL_CloseAsyncIO(asyncio, false, queue, NULL)) {
+        SDL_Log("Close before discard failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (SDL_BatchReadAsyncIO(batch, asyncio, data, 0, size, NULL)) {
+        SDL_Log("Batching a request for a closing file should fail");
+        goto done;
+    }
+    SDL_DestroyAsyncIOBatch(discarded);
+    discarded = NULL;
+    if (!SDL_WaitAsyncIOResult(queue, &outcome, -1) || outcome.type != SDL_ASYNCIO_TASK_CLOSE || outcome.result != SDL_ASYNCIO_COMPLETE) {
+        SDL_Log("Close after discarding the batch failed: %s", SDL_GetError());
+        goto done;
+    }
+    result = true;
+
+done:
+    SDL_DestroyAsyncIOBatch(discarded);
+    SDL_free(data);
+    return result;
+}
+
+static double ElapsedMicroseconds(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 / SDL_GetPerformanceFrequency();
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AsyncIOQueue *queue = NULL;
+    SDL_AsyncIOBatch *batch = NULL;
+    SDL_AsyncIO *asyncio = NULL;
+    SDL_AsyncIOVector *vectors = NULL;
+    SDL_AsyncIOVector registered;
+    Uint8 *source = NULL, *data = NULL;
+    size_t total;
+    Uint64 transferred, start;
+    double single_us, batch_us;
+    int result = 1;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--count") == 0 && argv[i + 1]) {
+                count = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                chunk_size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || count <= 0 || chunk_size <= 0) {
+            static const char *options[] = { "[--count N]", "[--size BYTES]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    total = (size_t)count * chunk_size;
+    source = (Uint8 *)SDL_malloc(total);
+    data = (Uint8 *)SDL_malloc(total);
+    vectors = (SDL_AsyncIOVector *)SDL_malloc(count * sizeof(*vectors));
+    if (!source || !data || !vectors) {
+        goto done;
+    }
+    for (i = 0; i < (int)total; i++) {
+        source[i] = ExpectedByte(i);
+    }
+
+    queue = SDL_CreateAsyncIOQueue();
+    if (!queue) {
+        SDL_Log("SDL_CreateAsyncIOQueue failed: %s", SDL_GetError());
+        goto done;
+    }
+    batch = SDL_CreateAsyncIOBatch(queue);
+    if (!batch) {
+        SDL_Log("SDL_CreateAsyncIOBatch failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    /* Write the whole file with one gather write */
+    asyncio = SDL_AsyncIOFromFile(filename, "w+");
+    if (!asyncio) {
+        SDL_Log("SDL_AsyncIOFromFile failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (!SDL_RegisterAsyncIOFile(queue, asyncio)) {
+        SDL_Log("SDL_RegisterAsyncIOFile failed: %s", SDL_GetError());
+        goto done;
+    }
+    for (i = 0; i < count; i++) {
+        vectors[i].buffer = source + (size_t)i * chunk_size;
+        vectors[i].size = chunk_size;
+    }
+    if (!SDL_BatchWriteVectorAsyncIO(batch, asyncio, vectors, count, 0, NULL) ||
+        !SDL_SubmitAsyncIOBatch(batch) ||
+        !WaitForResults(queue, 1, &transferred)) {
+        SDL_Log("Gather write failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (transferred != total) {
+        SDL_Log("Gather write transferred %" SDL_PRIu64 " bytes, expected %u", transferred, (unsigned int)total);
+        goto done;
+    }
+
+    /* Read it back one request at a time */
+    SDL_memset(data, 0, total);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < count; i++) {
+        const size_t offset = (size_t)i * chunk_size;
+        if (!SDL_ReadAsyncIO(asyncio, data + offset, offset, chunk_size, queue, NULL)) {
+            SDL_Log("SDL_ReadAsyncIO failed: %s", SDL_GetError());
+            goto done;
+        }
+    }
+    if (!WaitForResults(queue, count, &transferred) || !VerifyData("single reads", data, total)) {
+        goto done;
+    }
+    single_us = ElapsedMicroseconds(start);
+
+    /* Read it back as a batch, into a registered buffer */
+    registered.buffer = data;
+    registered.size = total;
+    if (!SDL_RegisterAsyncIOBuffers(queue, &registered, 1)) {
+        SDL_Log("SDL_RegisterAsyncIOBuffers failed, continuing without: %s", SDL_GetError());
+    }
+    SDL_memset(data, 0, total);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < count; i++) {
+        const size_t offset = (size_t)i * chunk_size;
+        if (!SDL_BatchReadAsyncIO(batch, asyncio, data + offset, offset, chunk_size, NULL)) {
+            SDL_Log("SDL_BatchReadAsyncIO failed: %s", SDL_GetError());
+            goto done;
+        }
+    }
+    if (!SDL_SubmitAsyncIOBatch(batch)) {
+        SDL_Log("SDL_SubmitAsyncIOBatch failed: %s", SDL_GetError());
+        goto done;
+    }
+    if (!WaitForResults(queue, count, &transferred) || !VerifyData("batched reads", data, total)) {
+        goto done;
+    }
+    batch_us = ElapsedMicroseconds(start);
+    SDL_RegisterAsyncIOBuffers(queue, NULL, 0);
+
+    /* Read it back with one scatter read */
+    SDL_memset(data, 0, total);
+    for (i = 0; i < count; i++) {
+        vectors[i].buffer = data + (size_t)i * chunk_size;
+    }
+    if (!SDL_BatchReadVectorAsyncIO(batch, asyncio, vectors, count, 0, NULL) ||
+        !SDL_SubmitAsyncIOBatch(batch) ||
+        !WaitForResults(queue, 1, &transferred) ||
+        !VerifyData("scatter read", data, total)) {
+        SDL_Log("Scatter read failed: %s", SDL_GetError());
+        goto done;
+    }
+
+    SDL_Log("%d reads of %d bytes: one at a time %.0f us, batched %.0f us (%.2fx)",
+            count, chunk_size, single_us, batch_us, single_us / batch_us);
+
+    SDL_CloseAsyncIO(asyncio, false, queue, NULL);
+    asyncio = NULL;
+    if (!WaitForResults(queue, 1, &transferred)) {
+        goto done;
+    }
+    if (!TestCloseBeforeSubmit(queue, batch, total)) {
+        goto done;
+    }
+    SDL_RemovePath(filename);
+    result = 0;
+
+done:
+    if (asyncio) {
+        SDL_CloseAsyncIO(asyncio, false, queue, NULL);
+        WaitForResults(queue, 1, &transferred);
+        SDL_RemovePath(filename);
+    }
+    SDL_DestroyAsyncIOBatch(batch);
+    SDL_DestroyAsyncIOQueue(queue);
+    SDL_free(vectors);
+    SDL_free(data);
+    SDL_free(source);
+    SDLTest_CommonDestroyState(state);
+    SDL_Quit();
+    return result;
+}
@@ -0,0 +1,219 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Throughput of many small SDL_AsyncIO reads, spread over several files
+   at random offsets, and walking through a single file in order. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MAX_FILES 16
+
+static int iterations = 10;
+static int num_files = 4;
+static int file_size = 1024 * 1024;
+static int read_size = 4096;
+
+static SDL_AsyncIO *files[MAX_FILES];
+static char filenames[MAX_FILES][64];
+
+static Uint8 ExpectedByte(int file, size_t pos)
+{
+    return (Uint8)((pos * 13) ^ (pos >> 11) ^ (file * 101));
+}
+
+static bool CreateTestFiles(void)
+{
+    Uint8 *data = (Uint8 *)SDL_malloc(file_size);
+    int i;
+
+    if (!data) {
+        return false;
+    }
+    for (i = 0; i < num_files; i++) {
+        size_t pos;
+
+        for (pos = 0; pos < (size_t)file_size; pos++) {
+            data[pos] = ExpectedByte(i, pos);
+        }
+        SDL_snprintf(filenames[i], sizeof(filenames[i]), "testasynciothroughput%d.dat", i);
+        if (!SDL_SaveFile(filenames[i], data, file_size)) {
+            SDL_free(data);
+            return false;
+        }
+        files[i] = SDL_AsyncIOFromFile(filenames[i], "r");
+        if (!files[i]) {
+            SDL_free(data);
+            return false;
+        }
+    }
+    SDL_free(data);
+    return true;
+}
+
+static void DestroyTestFiles(SDL_AsyncIOQueue *queue)
+{
+    int i;
+
+    for (i = 0; i < num_files; i++) {
+        if (files[i]) {
+            SDL_AsyncIOOutcome outcome;
+            if (SDL_CloseAsyncIO(files[i], false, queue, NULL)) {
+                SDL_WaitAsyncIOResult(queue, &outcome, -1);
+            }
+            files[i] = NULL;
+        }
+        if (filenames[i][0]) {
+            SDL_RemovePath(filenames[i]);
+        }
+    }
+}
+
+/* Starts `count` reads, returns the number of bytes read, or -1 on failure. */
+static Sint64 RunReads(SDL_AsyncIOQueue *queue, Uint8 *buffers, int count, bool sequential)
+{
+    const int chunks_per_file = file_size / read_size;
+    Sint64 total = 0;
+    bool okay = true;
+    int i;
+
+    for (i = 0; i < count; i++) {
+        const int file = sequential ? 0 : (int)SDL_rand(num_files);
+        const int chunk = sequential ? (i % chunks_per_file) : (int)SDL_rand(chunks_per_file);
+        const Uint64 offset = (Uint64)chunk * read_size;
+        /* the userdata records what was read, so we can check it when it completes. */
+        void *userdata = (void *)(intptr_t)((file << 24) | chunk);
+
+        if (!SDL_ReadAsyncIO(files[file], buffers + (size_t)i * read_size, offset, read_size, queue, userdata)) {
+            SDL_Log("SDL_ReadAsyncIO failed: %s", SDL_GetError());
+            count = i;
+            okay = false;
+            break;
+        }
+    }
+
+    for (i = 0; i < count; i++) {
+        SDL_AsyncIOOutcome outcome;
+        const intptr_t info = (intptr_t)SDL_WaitAsyncIOResult(queue, &outcome, -1) ? (intptr_t)outcome.userdata : -1;
+        const int file = (int)(info >> 24);
+        const size_t base = (size_t)(info & 0xFFFFFF) * read_size;
+        const Uint8 *data = (const Uint8 *)outcome.buffer;
+        int j;
+
+        if (info < 0 || outcome.result != SDL_ASYNCIO_COMPLETE || outcome.bytes_transferred != (Uint64)read_size) {
+            SDL_Log("Async read failed");
+            okay = false;
+            continue;
+        }
+        for (j = 0; j < read_size; j++) {
+            if (data[j] != ExpectedByte(file, base + j)) {
+                SDL_Log("Data mismatch in file %d at offset %u", file, (unsigned int)(base + j));
+                okay = false;
+                break;
+            }
+        }
+        total += (Sint64)outcome.bytes_transferred;
+    }
+    return okay ? total : -1;
+}
+
+static bool Benchmark(const char *name, SDL_AsyncIOQueue *queue, bool sequential)
+{
+    const int count = sequential ? (file_size / read_size) : (num_files * file_size / read_size);
+    Uint8 *buffers = (Uint8 *)SDL_malloc((size_t)count * read_size);
+    Sint64 total = 0;
+    Uint64 start, end;
+    double seconds;
+    int i;
+
+    if (!buffers) {
+        return false;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        const Sint64 amount = RunReads(queue, buffers, count, sequential);
+        if (amount < 0) {
+            SDL_free(buffers);
+            return false;
+        }
+        total += amount;
+    }
+    end = SDL_GetPerformanceCounter();
+    SDL_free(buffers);
+
+    seconds = (double)(end - start) / SDL_GetPerformanceFrequency();
+    SDL_Log("%-11s %6d reads of %d bytes: %10.0f reads/s %8.1f MB/s",
+            name, count * iterations, read_size,
+            (count * iterations) / seconds, (total / (1024.0 * 1024.0)) / seconds);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_AsyncIOQueue *queue = NULL;
+    int result = 1;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--files") == 0 && argv[i + 1]) {
+                num_files = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--file-size") == 0 && argv[i + 1]) {
+                file_size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--read-size") == 0 && argv[i + 1]) {
+                read_size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || iterations <= 0 || num_files <= 0 || num_files > MAX_FILES ||
+            read_size <= 0 || file_size < read_size || (file_size / read_size) > 0xFFFFFF) {
+            static const char *options[] = { "[--iterations N]", "[--files N]", "[--file-size BYTES]", "[--read-size BYTES]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    SDL_srand(0);
+
+    queue = SDL_CreateAsyncIOQueue();
+    if (!queue) {
+        SDL_Log("SDL_CreateAsyncIOQueue failed: %s", SDL_GetError());
+    } else if (!CreateTestFiles()) {
+        SDL_Log("Couldn't create test files: %s", SDL_GetError());
+    } else if (Benchmark("random", queue, false) &&
+               Benchmark("sequential", queue, true)) {
+        result = 0;
+    }
+
+    DestroyTestFiles(queue);
+    SDL_DestroyAsyncIOQueue(queue);
+    SDLTest_CommonDestroyState(state);
+    SDL_Quit();
+    return result;
+}
@@ -46,6 +46,7 @@ static SDLTest_TestSuiteReference *testSuites[] = {
     &surfaceTestSuite,
     &timeTestSuite,
     &timerTestSuite,
+    &traceTestSuite,
     &videoTestSuite,
     &blitTestSuite,
     &subsystemsTestSuite, /* run last, not interfere with other test environment */
@@ -308,6 +308,71 @@ static int SDLCALL events_mainThreadCallbacks(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Takes an event that refers to temporary memory off the queue and pushes it again, the memory has to stay valid
+ *
+ * \sa SDL_SetClipboardText
+ * \sa SDL_PushEvent
+ * \sa SDL_PeepEvents
+ */
+static int SDLCALL events_repushTemporaryMemoryEvent(void *arg)
+{
+    SDL_Event event_out;
+    char *mime_type = NULL;
+    void *scribble[64];
+    int result;
+    int i;
+
+    /* Flush all events */
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    /* The clipboard update event lists the clipboard mime types in SDL's temporary memory */
+    SDL_SetClipboardText("Clipboard text");
+    SDLTest_AssertPass("Call to SDL_SetClipboardText()");
+
+    /* Pumping frees this thread's temporary memory, the queued event keeps its mime types alive */
+    SDL_PumpEvents();
+    result = SDL_PeepEvents(&event_out, 1, SDL_PEEKEVENT, SDL_EVENT_CLIPBOARD_UPDATE, SDL_EVENT_CLIPBOARD_UPDATE);
+    SDLTest_AssertCheck(result == 1, "Check result from SDL_PeepEvents(SDL_PEEKEVENT), expected: 1, got: %d", result);
+    result = SDL_PeepEvents(&event_out, 1, SDL_GETEVENT, SDL_EVENT_CLIPBOARD_UPDATE, SDL_EVENT_CLIPBOARD_UPDATE);
+    SDLTest_AssertCheck(result == 1, "Check result from SDL_PeepEvents(SDL_GETEVENT), expected: 1, got: %d", result);
+    if (result != 1 || event_out.clipboard.num_mime_types == 0) {
+        SDLTest_Log("Skipping the rest of the test: no clipboard mime types");
+        SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+        return TEST_COMPLETED;
+    }
+    mime_type = SDL_strdup(event_out.clipboard.mime_types[0]);
+    SDLTest_AssertCheck(mime_type != NULL, "Check the first mime type: %s", mime_type);
+
+    /* The memory now belongs to this thread until it next pumps, pushing the event again has to keep it alive */
+    SDL_PushEvent(&event_out);
+    SDLTest_AssertPass("Call to SDL_PushEvent() with the event taken off the queue");
+    SDL_PumpEvents();
+
+    /* Scribble over freshly allocated memory, which would likely reuse the mime types if they had been freed */
+    for (i = 0; i < SDL_arraysize(scribble); ++i) {
+        scribble[i] = SDL_malloc(256);
+        if (scribble[i]) {
+            SDL_memset(scribble[i], 0xFF, 256);
+        }
+    }
+
+    result = SDL_PeepEvents(&event_out, 1, SDL_GETEVENT, SDL_EVENT_CLIPBOARD_UPDATE, SDL_EVENT_CLIPBOARD_UPDATE);
+    SDLTest_AssertCheck(result == 1, "Check result from SDL_PeepEvents(SDL_GETEVENT), expected: 1, got: %d", result);
+    SDLTest_AssertCheck(result == 1 && event_out.clipboard.num_mime_types > 0 && mime_type &&
+                        SDL_strcmp(event_out.clipboard.mime_types[0], mime_type) == 0,
+                        "Check the first mime type after two trips through the queue");
+
+    for (i = 0; i < SDL_arraysize(scribble); ++i) {
+        SDL_free(scribble[i]);
+    }
+    SDL_free(mime_type);
+    SDL_ClearClipboardData();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -327,12 +392,17 @@ static const SDLTest_TestCaseReference eventsTest_mainThreadCallbacks = {
     events_mainThreadCallbacks, "events_mainThreadCallbacks", "Run callbacks on the main thread", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest_repushTemporaryMemoryEvent = {
+    events_repushTemporaryMemoryEvent, "events_repushTemporaryMemoryEvent", "Pushes an event with temporary memory taken off the queue again", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
     &eventsTest_pushPumpAndPollUserevent,
     &eventsTest_addDelEventWatch,
     &eventsTest_addDelEventWatchWithUserdata,
     &eventsTest_mainThreadCallbacks,
+    &eventsTest_repushTemporaryMemoryEvent,
     NULL
 };
 
@@ -603,6 +603,74 @@ static int SDLCALL iostrm_testFileRead(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests mapping a file into memory.
+ *
+ * \sa SDL_MapFile
+ * \sa SDL_UnmapFile
+ * \sa SDL_IOFromMappedFile
+ */
+static int SDLCALL iostrm_testMappedFile(void *arg)
+{
+    SDL_IOStream *rw;
+    SDL_PropertiesID props;
+    size_t size = 0;
+    void *mem;
+    int result;
+
+    /* Map the whole file */
+    mem = SDL_MapFile(IOStreamAlphabetFilename, &size, SDL_IO_ACCESS_SEQUENTIAL);
+    SDLTest_AssertPass("Call to SDL_MapFile() succeeded");
+    SDLTest_AssertCheck(mem != NULL, "Verify mapping file with SDL_MapFile does not return NULL");
+    SDLTest_AssertCheck(size == SDL_strlen(IOStreamAlphabetString), "Verify mapped size, expected %i, got %i", (int)SDL_strlen(IOStreamAlphabetString), (int)size);
+    if (mem) {
+        SDLTest_AssertCheck(SDL_memcmp(mem, IOStreamAlphabetString, size) == 0, "Verify mapped data matches the file");
+
+        /* The mapping is private, so writing to it doesn't change the file */
+        *(char *)mem = 'a';
+        SDL_UnmapFile(mem, size);
+        SDLTest_AssertPass("Call to SDL_UnmapFile() succeeded");
+    }
+
+    /* Missing files fail */
+    mem = SDL_MapFile("iostrm_nonexistent", &size, SDL_IO_ACCESS_NORMAL);
+    SDLTest_AssertCheck(mem == NULL, "Verify mapping a nonexistent file returns NULL");
+    SDLTest_AssertCheck(size == 0, "Verify size is 0 on failure, got %i", (int)size);
+
+    /* Read test through a mapped stream */
+    rw = SDL_IOFromMappedFile(IOStreamReadTestFilename, SDL_IO_ACCESS_RANDOM);
+    SDLTest_AssertPass("Call to SDL_IOFromMappedFile() succeeded");
+    SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_IOFromMappedFile does not return NULL");
+
+    /* Bail out if NULL */
+    if (rw == NULL) {
+        return TEST_ABORTED;
+    }
+
+    props = SDL_GetIOProperties(rw);
+    mem = SDL_GetPointerProperty(props, SDL_PROP_IOSTREAM_MEMORY_POINTER, NULL);
+    SDLTest_AssertCheck(mem != NULL, "Verify memory pointer property is set");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_IOSTREAM_MEMORY_SIZE_NUMBER, 0) == (Sint64)(sizeof(IOStreamHelloWorldTestString) - 1), "Verify memory size property");
+    if (mem) {
+        SDLTest_AssertCheck(SDL_memcmp(mem, IOStreamHelloWorldCompString, sizeof(IOStreamHelloWorldCompString) - 1) == 0, "Verify memory pointer property points at the file data");
+    }
+
+    /* Run generic tests */
+    testGenericIOStreamValidations(rw, false);
+
+    /* Close handle */
+    result = SDL_CloseIO(rw);
+    SDLTest_AssertPass("Call to SDL_CloseIO() succeeded");
+    SDLTest_AssertCheck(result == true, "Verify result value is true; got: %d", result);
+
+    /* The file was not modified through the earlier private mapping */
+    mem = SDL_LoadFile(IOStreamAlphabetFilename, &size);
+    SDLTest_AssertCheck(mem && SDL_memcmp(mem, IOStreamAlphabetString, size) == 0, "Verify file contents are unchanged");
+    SDL_free(mem);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Tests writing from file.
  *
@@ -913,10 +981,15 @@ static const SDLTest_TestCaseReference iostrmTest12 = {
     iostrm_testConstMemEmpty, "iostrm_testConstMemEmpty", "Tests opening empty (const) memory stream", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference iostrmTest13 = {
+    iostrm_testMappedFile, "iostrm_testMappedFile", "Tests mapping a file into memory", TEST_ENABLED
+};
+
 /* Sequence of IOStream test cases */
 static const SDLTest_TestCaseReference *iostrmTests[] = {
     &iostrmTest1, &iostrmTest2, &iostrmTest3, &iostrmTest4, &iostrmTest5, &iostrmTest6,
-    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, &iostrmTest11, &iostrmTest12, NULL
+    &iostrmTest7, &iostrmTest8, &iostrmTest9, &iostrmTest10, &iostrmTest11, &iostrmTest12,
+    &iostrmTest13, NULL
 };
 
 /* IOStream test suite (global) */
@@ -7,6 +7,13 @@
 #include "../src/joystick/usb_ids.h"
 #include "testautomation_suites.h"
 
+#ifdef SDL_PLATFORM_LINUX
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/uinput.h>
+#endif
+
 /* ================= Test Case Implementation ================== */
 
 /* Fixture */
@@ -279,6 +286,381 @@ static int SDLCALL joystick_testMappings(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check that a gamepad state snapshot matches the individual queries
+ *
+ * \sa SDL_GetGamepadState
+ */
+static int SDLCALL joystick_testGamepadState(void *arg)
+{
+    SDL_VirtualJoystickDesc desc;
+    SDL_Gamepad *gamepad = NULL;
+    SDL_GamepadState state;
+    SDL_JoystickID device_id;
+    int i;
+
+    SDL_INIT_INTERFACE(&desc);
+    desc.type = SDL_JOYSTICK_TYPE_GAMEPAD;
+    desc.naxes = SDL_GAMEPAD_AXIS_COUNT;
+    desc.nbuttons = SDL_GAMEPAD_BUTTON_COUNT;
+    desc.vendor_id = USB_VENDOR_NVIDIA;
+    desc.product_id = USB_PRODUCT_NVIDIA_SHIELD_CONTROLLER_V104;
+    desc.name = "Virtual NVIDIA SHIELD Controller";
+    device_id = SDL_AttachVirtualJoystick(&desc);
+    SDLTest_AssertCheck(device_id > 0, "SDL_AttachVirtualJoystick() -> %" SDL_PRIs32 " (expected > 0)", device_id);
+
+    gamepad = SDL_OpenGamepad(device_id);
+    SDLTest_AssertCheck(gamepad != NULL, "SDL_OpenGamepad() succeeded");
+    if (gamepad) {
+        SDL_Joystick *joystick = SDL_GetGamepadJoystick(gamepad);
+
+        SDLTest_AssertCheck(!SDL_GetGamepadState(gamepad, NULL), "SDL_GetGamepadState(gamepad, NULL) fails");
+        SDLTest_AssertCheck(!SDL_GetGamepadState(NULL, &state), "SDL_GetGamepadState(NULL, &state) fails");
+
+        SDL_SetJoystickVirtualButton(joystick, SDL_GAMEPAD_BUTTON_SOUTH, true);
+        SDL_SetJoystickVirtualButton(joystick, SDL_GAMEPAD_BUTTON_START, true);
+        SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_LEFTX, 12345);
+        SDL_SetJoystickVirtualAxis(joystick, SDL_GAMEPAD_AXIS_RIGHTY, -23456);
+        SDL_UpdateJoysticks();
+
+        SDLTest_AssertCheck(SDL_GetGamepadState(gamepad, &state), "SDL_GetGamepadState()");
+        for (i = 0; i < SDL_GAMEPAD_AXIS_COUNT; ++i) {
+            const Sint16 expected = SDL_GetGamepadAxis(gamepad, (SDL_GamepadAxis)i);
+            SDLTest_AssertCheck(state.axes[i] == expected, "state.axes[%d] -> %d (expected %d)", i, state.axes[i], expected);
+        }
+        for (; i < SDL_GAMEPAD_STATE_MAX_AXES; ++i) {
+            SDLTest_AssertCheck(state.axes[i] == 0, "Unused state.axes[%d] -> %d (expected 0)", i, state.axes[i]);
+        }
+        for (i = 0; i < SDL_GAMEPAD_BUTTON_COUNT; ++i) {
+            const bool expected = SDL_GetGamepadButton(gamepad, (SDL_GamepadButton)i);
+            const bool pressed = ((state.buttons & SDL_GAMEPAD_BUTTON_MASK(i)) != 0);
+            SDLTest_AssertCheck(pressed == expected, "state.buttons bit %d -> %d (expected %d)", i, pressed, expected);
+        }
+        SDLTest_AssertCheck(state.buttons == (SDL_GAMEPAD_BUTTON_MASK(SDL_GAMEPAD_BUTTON_SOUTH) | SDL_GAMEPAD_BUTTON_MASK(SDL_GAMEPAD_BUTTON_START)),
+                            "state.buttons -> 0x%" SDL_PRIx64, state.buttons);
+        SDLTest_AssertCheck(state.axes[SDL_GAMEPAD_AXIS_LEFTX] != 0, "state.axes[SDL_GAMEPAD_AXIS_LEFTX] is set");
+        SDLTest_AssertCheck(state.num_fingers == 0, "state.num_fingers -> %d (expected 0)", state.num_fingers);
+        SDLTest_AssertCheck(state.sensors == 0, "state.sensors -> 0x%" SDL_PRIx32 " (expected 0)", state.sensors);
+
+        SDL_CloseGamepad(gamepad);
+    }
+    SDLTest_AssertCheck(SDL_DetachVirtualJoystick(device_id), "SDL_DetachVirtualJoystick()");
+
+    return TEST_COMPLETED;
+}
+
+/* Returns the joystick button bound to a gamepad button, or -1 if there isn't one */
+static int GetGamepadButtonBinding(SDL_Gamepad *gamepad, SDL_GamepadButton button)
+{
+    SDL_GamepadBinding **bindings;
+    int i, count = 0, result = -1;
+
+    bindings = SDL_GetGamepadBindings(gamepad, &count);
+    for (i = 0; i < count; ++i) {
+        if (bindings[i]->output_type == SDL_GAMEPAD_BINDTYPE_BUTTON && bindings[i]->output.button == button &&
+            bindings[i]->input_type == SDL_GAMEPAD_BINDTYPE_BUTTON) {
+            result = bindings[i]->input.button;
+        }
+    }
+    SDL_free(bindings);
+    return result;
+}
+
+static void FormatTestMappingGUID(char *guid, size_t size, Uint16 product, Uint16 version)
+{
+    /* USB bus, vendor 0xABCD, little endian like SDL_GUIDToString() */
+    SDL_snprintf(guid, size, "03000000cdab0000%02x%02x0000%02x%02x0000",
+                 product & 0xFF, product >> 8, version & 0xFF, version >> 8);
+}
+
+/**
+ * Check loading a large gamepad mapping database
+ *
+ * \sa SDL_AddGamepadMappingsFromIO
+ * \sa SDL_GetGamepadMappingForGUID
+ */
+static int SDLCALL joystick_testMappingDatabase(void *arg)
+{
+    const int num_mappings = 2000;
+    const char *platform = SDL_GetPlatform();
+    const size_t line_size = 256;
+    SDL_VirtualJoystickDesc desc;
+    SDL_JoystickID device_id;
+    SDL_Gamepad *gamepad;
+    char *db;
+    char guid_string[33];
+    char *mapping;
+    size_t length = 0;
+    SDL_IOStream *io;
+    Uint64 start, elapsed;
+    int i, result;
+
+    db = (char *)SDL_malloc(num_mappings * line_size);
+    SDLTest_AssertCheck(db != NULL, "SDL_malloc()");
+    if (!db) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < num_mappings; ++i) {
+        FormatTestMappingGUID(guid_string, sizeof(guid_string), (Uint16)i, 1);
+        length += SDL_snprintf(db + length, line_size, "%s,Test Gamepad %d,a:b0,b:b1,x:b2,y:b3,leftx:a0,lefty:a1,platform:%s,\n", guid_string, i, platform);
+    }
+
+    start = SDL_GetTicksNS();
+    io = SDL_IOFromConstMem(db, length);
+    result = SDL_AddGamepadMappingsFromIO(io, true);
+    elapsed = SDL_GetTicksNS() - start;
+    SDLTest_AssertCheck(result == num_mappings, "SDL_AddGamepadMappingsFromIO() -> %d (expected %d)", result, num_mappings);
+    SDLTest_Log("Loaded %d mappings in %" SDL_PRIu64 " us", num_mappings, elapsed / SDL_NS_PER_US);
+
+    /* Loading them again updates the existing mappings */
+    io = SDL_IOFromConstMem(db, length);
+    result = SDL_AddGamepadMappingsFromIO(io, true);
+    SDLTest_AssertCheck(result == 0, "SDL_AddGamepadMappingsFromIO() again -> %d (expected 0)", result);
+
+    /* Look up an exact match */
+    FormatTestMappingGUID(guid_string, sizeof(guid_string), 1234, 1);
+    mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_string));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Gamepad 1234,") != NULL, "SDL_GetGamepadMappingForGUID() -> \"%s\"", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    /* Look up a match with a different version */
+    FormatTestMappingGUID(guid_string, sizeof(guid_string), 1999, 2);
+    mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_string));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Test Gamepad 1999,") != NULL, "SDL_GetGamepadMappingForGUID() with different version -> \"%s\"", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    /* Update a mapping and make sure the new bindings are used */
+    FormatTestMappingGUID(guid_string, sizeof(guid_string), 42, 1);
+    SDL_snprintf(db, line_size, "%s,Updated Gamepad,a:b1,b:b0,", guid_string);
+    result = SDL_AddGamepadMapping(db);
+    SDLTest_AssertCheck(result == 0, "SDL_AddGamepadMapping() update -> %d (expected 0)", result);
+    mapping = SDL_GetGamepadMappingForGUID(SDL_StringToGUID(guid_string));
+    SDLTest_AssertCheck(mapping && SDL_strstr(mapping, ",Updated Gamepad,a:b1,b:b0,") != NULL, "SDL_GetGamepadMappingForGUID() after update -> \"%s\"", mapping ? mapping : "NULL");
+    SDL_free(mapping);
+
+    /* Update the mapping of an open gamepad and make sure its cached bindings are replaced */
+    SDL_INIT_INTERFACE(&desc);
+    desc.type = SDL_JOYSTICK_TYPE_GAMEPAD;
+    desc.nbuttons = 2;
+    desc.name = "Virtual Remapped Gamepad";
+    device_id = SDL_AttachVirtualJoystick(&desc);
+    SDLTest_AssertCheck(device_id > 0, "SDL_AttachVirtualJoystick() -> %" SDL_PRIs32 " (expected > 0)", device_id);
+    SDL_GUIDToString(SDL_GetJoystickGUIDForID(device_id), guid_string, sizeof(guid_string));
+    SDL_snprintf(db, line_size, "%s,Remapped Gamepad,a:b0,b:b1,", guid_string);
+    SDLTest_AssertCheck(SDL_AddGamepadMapping(db) >= 0, "SDL_AddGamepadMapping() for the virtual gamepad");
+    gamepad = SDL_OpenGamepad(device_id);
+    SDLTest_AssertCheck(gamepad != NULL, "SDL_OpenGamepad() succeeded");
+    if (gamepad) {
+        SDLTest_AssertCheck(GetGamepadButtonBinding(gamepad, SDL_GAMEPAD_BUTTON_SOUTH) == 0, "SDL_GAMEPAD_BUTTON_SOUTH is bound to button 0");
+
+        SDL_snprintf(db, line_size, "%s,Remapped Gamepad,a:b1,b:b0,", guid_string);
+        result = SDL_AddGamepadMapping(db);
+        SDLTest_AssertCheck(result == 0, "SDL_AddGamepadMapping() update of an open gamepad -> %d (expected 0)", result);
+        SDLTest_AssertCheck(GetGamepadButtonBinding(gamepad, SDL_GAMEPAD_BUTTON_SOUTH) == 1, "SDL_GAMEPAD_BUTTON_SOUTH is bound to button 1 after the update");
+        SDLTest_AssertCheck(GetGamepadButtonBinding(gamepad, SDL_GAMEPAD_BUTTON_EAST) == 0, "SDL_GAMEPAD_BUTTON_EAST is bound to button 0 after the update");
+
+        SDL_SetJoystickVirtualButton(SDL_GetGamepadJoystick(gamepad), 1, true);
+        SDL_UpdateJoysticks();
+        SDLTest_AssertCheck(SDL_GetGamepadButton(gamepad, SDL_GAMEPAD_BUTTON_SOUTH), "Button 1 reports SDL_GAMEPAD_BUTTON_SOUTH after the update");
+        SDL_CloseGamepad(gamepad);
+    }
+    SDLTest_AssertCheck(SDL_DetachVirtualJoystick(device_id), "SDL_DetachVirtualJoystick()");
+
+    SDL_free(db);
+
+    return TEST_COMPLETED;
+}
+
+#ifdef SDL_PLATFORM_LINUX
+
+#define UINPUT_TEST_VENDOR  0x1209 /* pid.codes test VID */
+#define UINPUT_TEST_PRODUCT 0x0001
+
+/* Create an evdev gamepad with uinput, so its input goes through the Linux joystick driver.
+   Returns -1 if uinput isn't available, e.g. without permission to open /dev/uinput. */
+static int CreateUInputGamepad(void)
+{
+    struct uinput_user_dev dev;
+    int fd;
+
+    fd = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+
+    ioctl(fd, UI_SET_EVBIT, EV_KEY);
+    ioctl(fd, UI_SET_KEYBIT, BTN_SOUTH);
+    ioctl(fd, UI_SET_KEYBIT, BTN_EAST);
+    ioctl(fd, UI_SET_KEYBIT, BTN_START);
+    ioctl(fd, UI_SET_EVBIT, EV_ABS);
+    ioctl(fd, UI_SET_ABSBIT, ABS_X);
+    ioctl(fd, UI_SET_ABSBIT, ABS_Y);
+
+    SDL_zero(dev);
+    SDL_strlcpy(dev.name, "SDL uinput test gamepad", sizeof(dev.name));
+    dev.id.bustype = BUS_VIRTUAL;
+    dev.id.vendor = UINPUT_TEST_VENDOR;
+    dev.id.product = UINPUT_TEST_PRODUCT;
+    dev.id.version = 1;
+    dev.absmin[ABS_X] = dev.absmin[ABS_Y] = SDL_JOYSTICK_AXIS_MIN;
+    dev.absmax[ABS_X] = dev.absmax[ABS_Y] = SDL_JOYSTICK_AXIS_MAX;
+
+    if (write(fd, &dev, sizeof(dev)) != (ssize_t)sizeof(dev) || ioctl(fd, UI_DEV_CREATE) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+static void DestroyUInputGamepad(int fd)
+{
+    ioctl(fd, UI_DEV_DESTROY);
+    close(fd);
+}
+
+static bool WriteUInputEvent(int fd, int type, int code, int value)
+{
+    struct input_event event;
+
+    SDL_zero(event);
+    event.type = (Uint16)type;
+    event.code = (Uint16)code;
+    event.value = value;
+    return write(fd, &event, sizeof(event)) == (ssize_t)sizeof(event);
+}
+
+/* Wait for the Linux joystick driver to find the uinput gamepad and open it */
+static SDL_Joystick *OpenUInputGamepad(void)
+{
+    const Uint64 timeout = SDL_GetTicks() + 5000;
+
+    while (SDL_GetTicks() < timeout) {
+        SDL_JoystickID *joysticks;
+        SDL_Joystick *joystick = NULL;
+        int i, count = 0;
+
+        SDL_UpdateJoysticks();
+        joysticks = SDL_GetJoysticks(&count);
+        for (i = 0; i < count && !joystick; ++i) {
+            if (SDL_GetJoystickVendorForID(joysticks[i]) == UINPUT_TEST_VENDOR &&
+                SDL_GetJoystickProductForID(joysticks[i]) == UINPUT_TEST_PRODUCT) {
+                joystick = SDL_OpenJoystick(joysticks[i]);
+            }
+        }
+        SDL_free(joysticks);
+        if (joystick) {
+            return joystick;
+        }
+        SDL_Delay(10);
+    }
+    return NULL;
+}
+
+/* Update joysticks until button 0 and axis 0 have the expected values, returns false if that doesn't happen within a second */
+static bool WaitForJoystickState(SDL_Joystick *joystick, bool button, Sint16 axis)
+{
+    const Uint64 timeout = SDL_GetTicks() + 1000;
+
+    do {
+        SDL_UpdateJoysticks();
+        if (SDL_GetJoystickButton(joystick, 0) == button && SDL_GetJoystickAxis(joystick, 0) == axis) {
+            return true;
+        }
+        SDL_Delay(1);
+    } while (SDL_GetTicks() < timeout);
+    return false;
+}
+
+#endif /* SDL_PLATFORM_LINUX */
+
+/**
+ * Check that input from an evdev device goes through the Linux input thread
+ *
+ * This needs write access to /dev/uinput, and is skipped without it.
+ *
+ * \sa SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD
+ */
+static int SDLCALL joystick_testEvdevInputThread(void *arg)
+{
+#ifdef SDL_PLATFORM_LINUX
+    SDL_Joystick *joystick;
+    Uint64 timeout;
+    int fd, i;
+
+    fd = CreateUInputGamepad();
+    if (fd < 0) {
+        SDLTest_Log("Skipping test: couldn't create a uinput device");
+        return TEST_SKIPPED;
+    }
+
+    /* The hint is checked when the joystick subsystem is initialized */
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+    SDL_SetHint(SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD, "1");
+    SDL_InitSubSystem(SDL_INIT_GAMEPAD);
+
+    joystick = OpenUInputGamepad();
+    if (!joystick) {
+        SDLTest_Log("Skipping test: the uinput device wasn't detected: %s", SDL_GetError());
+        DestroyUInputGamepad(fd);
+        SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+        SDL_ResetHint(SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD);
+        SDL_InitSubSystem(SDL_INIT_GAMEPAD);
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertPass("Opened uinput gamepad \"%s\"", SDL_GetJoystickName(joystick));
+
+    /* Single reports, queued by the input thread and handled at the next update */
+    for (i = 0; i < 20; ++i) {
+        const bool down = ((i % 2) == 0);
+        const Sint16 value = down ? SDL_JOYSTICK_AXIS_MAX : SDL_JOYSTICK_AXIS_MIN;
+
+        WriteUInputEvent(fd, EV_KEY, BTN_SOUTH, down);
+        WriteUInputEvent(fd, EV_ABS, ABS_X, value);
+        WriteUInputEvent(fd, EV_SYN, SYN_REPORT, 0);
+        if (!WaitForJoystickState(joystick, down, value)) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(i == 20, "Joystick state tracked %d of 20 reports", i);
+
+    /* Far more events than the input ring holds, without updating. Whatever gets dropped
+       along the way, the joystick should resync to the final state. */
+    for (i = 0; i < 4000; ++i) {
+        WriteUInputEvent(fd, EV_ABS, ABS_X, (i % 2) ? 0 : SDL_JOYSTICK_AXIS_MIN);
+        WriteUInputEvent(fd, EV_SYN, SYN_REPORT, 0);
+        if ((i % 256) == 0) {
+            SDL_Delay(1); /* let the input thread keep up with the kernel buffer */
+        }
+    }
+    WriteUInputEvent(fd, EV_KEY, BTN_SOUTH, 1);
+    WriteUInputEvent(fd, EV_ABS, ABS_X, SDL_JOYSTICK_AXIS_MAX);
+    WriteUInputEvent(fd, EV_SYN, SYN_REPORT, 0);
+    SDL_Delay(50);
+    SDLTest_AssertCheck(WaitForJoystickState(joystick, true, SDL_JOYSTICK_AXIS_MAX),
+                        "Joystick state after overflowing the input ring: button %d, axis %d (expected 1, %d)",
+                        SDL_GetJoystickButton(joystick, 0), SDL_GetJoystickAxis(joystick, 0), SDL_JOYSTICK_AXIS_MAX);
+
+    /* Unplugging the device is noticed through the input ring too */
+    DestroyUInputGamepad(fd);
+    timeout = SDL_GetTicks() + 5000;
+    while (SDL_JoystickConnected(joystick) && SDL_GetTicks() < timeout) {
+        SDL_UpdateJoysticks();
+        SDL_Delay(10);
+    }
+    SDLTest_AssertCheck(!SDL_JoystickConnected(joystick), "SDL_JoystickConnected() after unplugging");
+    SDL_CloseJoystick(joystick);
+
+    SDL_QuitSubSystem(SDL_INIT_GAMEPAD);
+    SDL_ResetHint(SDL_HINT_JOYSTICK_LINUX_INPUT_THREAD);
+    SDL_InitSubSystem(SDL_INIT_GAMEPAD);
+
+    return TEST_COMPLETED;
+#else
+    SDLTest_Log("Skipping test: evdev input is only available on Linux");
+    return TEST_SKIPPED;
+#endif
+}
+
 /* ================= Test References ================== */
 
 /* Joystick routine test cases */
@@ -288,11 +670,117 @@ static const SDLTest_TestCaseReference joystickTest1 = {
 static const SDLTest_TestCaseReference joystickTest2 = {
     joystick_testMappings, "joystick_testMappings", "Test gamepad mapping functionality", TEST_ENABLED
 };
+static const SDLTest_TestCaseReference joystickTest3 = {
+    joystick_testGamepadState, "joystick_testGamepadState", "Test gamepad state snapshots", TEST_ENABLED
+};
+static const SDLTest_TestCaseReference joystickTest4 = {
+    joystick_testMappingDatabase, "joystick_testMappingDatabase", "Test loading a large gamepad mapping database", TEST_ENABLED
+};
+#ifdef SDL_PLATFORM_LINUX
+/* Removes the queued axis motion events for a joystick axis, returns how many there were and the last value */
+static int FlushJoystickAxisEvents(SDL_JoystickID which, Uint8 axis, Sint16 *value)
+{
+    SDL_Event events[64];
+    int i, count, found = 0;
+
+    SDL_PumpEvents();
+    count = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_EVENT_JOYSTICK_AXIS_MOTION, SDL_EVENT_JOYSTICK_AXIS_MOTION);
+    for (i = 0; i < count; ++i) {
+        if (events[i].jaxis.which == which && events[i].jaxis.axis == axis) {
+            *value = events[i].jaxis.value;
+            ++found;
+        }
+    }
+    return found;
+}
+#endif
+
+/**
+ * Check that evdev axis changes within one report are coalesced, and the input counters
+ *
+ * \sa SDL_GetJoystickProperties
+ */
+static int SDLCALL joystick_testEvdevCoalescing(void *arg)
+{
+#ifdef SDL_PLATFORM_LINUX
+    SDL_Joystick *joystick;
+    SDL_JoystickID which;
+    SDL_PropertiesID props;
+    Sint64 read_before, delivered_before, read_after, delivered_after;
+    Sint16 value = 0;
+    int fd, count;
+
+    fd = CreateUInputGamepad();
+    if (fd < 0) {
+        SDLTest_Log("Skipping test: couldn't create a uinput device");
+        return TEST_SKIPPED;
+    }
+    joystick = OpenUInputGamepad();
+    if (!joystick) {
+        SDLTest_Log("Skipping test: the uinput device wasn't detected: %s", SDL_GetError());
+        DestroyUInputGamepad(fd);
+        return TEST_SKIPPED;
+    }
+    which = SDL_GetJoystickID(joystick);
+    props = SDL_GetJoystickProperties(joystick);
+
+    /* Settle at a known state, then start counting */
+    WriteUInputEvent(fd, EV_ABS, ABS_X, 100);
+    WriteUInputEvent(fd, EV_SYN, SYN_REPORT, 0);
+    SDLTest_AssertCheck(WaitForJoystickState(joystick, false, 100), "Joystick axis 0 -> %d (expected 100)", SDL_GetJoystickAxis(joystick, 0));
+    FlushJoystickAxisEvents(which, 0, &value);
+    FlushJoystickAxisEvents(which, 1, &value);
+    read_before = SDL_GetNumberProperty(props, SDL_PROP_JOYSTICK_INPUT_EVENTS_READ_NUMBER, 0);
+    delivered_before = SDL_GetNumberProperty(props, SDL_PROP_JOYSTICK_INPUT_EVENTS_DELIVERED_NUMBER, 0);
+    SDLTest_AssertCheck(read_before >= 2, "SDL_PROP_JOYSTICK_INPUT_EVENTS_READ_NUMBER -> %" SDL_PRIs64 " (expected >= 2)", read_before);
+    SDLTest_AssertCheck(delivered_before >= 1, "SDL_PROP_JOYSTICK_INPUT_EVENTS_DELIVERED_NUMBER -> %" SDL_PRIs64 " (expected >= 1)", delivered_before);
+
+    /* One report with several values for each axis, only the last of each is delivered */
+    WriteUInputEvent(fd, EV_ABS, ABS_X, 1000);
+    WriteUInputEvent(fd, EV_ABS, ABS_Y, -1000);
+    WriteUInputEvent(fd, EV_ABS, ABS_X, 2000);
+    WriteUInputEvent(fd, EV_ABS, ABS_Y, -2000);
+    WriteUInputEvent(fd, EV_ABS, ABS_X, 3000);
+    WriteUInputEvent(fd, EV_SYN, SYN_REPORT, 0);
+    SDLTest_AssertCheck(WaitForJoystickState(joystick, false, 3000), "Joystick axis 0 -> %d (expected 3000)", SDL_GetJoystickAxis(joystick, 0));
+    SDLTest_AssertCheck(SDL_GetJoystickAxis(joystick, 1) == -2000, "Joystick axis 1 -> %d (expected -2000)", SDL_GetJoystickAxis(joystick, 1));
+
+    count = FlushJoystickAxisEvents(which, 0, &value);
+    SDLTest_AssertCheck(count == 1 && value == 3000, "Axis 0 motion events: %d, last value %d (expected 1, 3000)", count, value);
+    count = FlushJoystickAxisEvents(which, 1, &value);
+    SDLTest_AssertCheck(count == 1 && value == -2000, "Axis 1 motion events: %d, last value %d (expected 1, -2000)", count, value);
+
+    /* Five axis events and the SYN_REPORT were read, two axis updates were delivered */
+    read_after = SDL_GetNumberProperty(props, SDL_PROP_JOYSTICK_INPUT_EVENTS_READ_NUMBER, 0);
+    delivered_after = SDL_GetNumberProperty(props, SDL_PROP_JOYSTICK_INPUT_EVENTS_DELIVERED_NUMBER, 0);
+    SDLTest_AssertCheck(read_after - read_before == 6, "Input events read: %" SDL_PRIs64 " (expected 6)", read_after - read_before);
+    SDLTest_AssertCheck(delivered_after - delivered_before == 2, "Input events delivered: %" SDL_PRIs64 " (expected 2)", delivered_after - delivered_before);
+
+    SDL_CloseJoystick(joystick);
+    DestroyUInputGamepad(fd);
+    return TEST_COMPLETED;
+#else
+    SDLTest_Log("Skipping test: evdev input is only available on Linux");
+    return TEST_SKIPPED;
+#endif
+}
+
+static const SDLTest_TestCaseReference joystickTest5 = {
+    joystick_testEvdevInputThread, "joystick_testEvdevInputThread", "Test evdev input through the Linux input thread", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference joystickTest6 = {
+    joystick_testEvdevCoalescing, "joystick_testEvdevCoalescing", "Test evdev axis coalescing and input counters", TEST_ENABLED
+};
 
 /* Sequence of Joystick routine test cases */
 static const SDLTest_TestCaseReference *joystickTests[] = {
     &joystickTest1,
     &joystickTest2,
+    &joystickTest3,
+    &joystickTest4,
+    &joystickTest5,
+    &joystickTest6,
     NULL
 };
 
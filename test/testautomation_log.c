@@ -188,6 +188,210 @@ static int SDLCALL log_testHint(void *arg)
     return TEST_COMPLETED;
 }
 
+#define ASYNC_LOG_THREADS  4
+#define ASYNC_LOG_MESSAGES 500
+
+typedef struct AsyncLogState
+{
+    int count;
+    int dropped_warnings;
+    int out_of_order;
+    int bad_timestamps;
+    int next_index[ASYNC_LOG_THREADS];
+    Uint64 last_timestamp[ASYNC_LOG_THREADS];
+    SDL_Semaphore *release;
+} AsyncLogState;
+
+static void SDLCALL TestAsyncLogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    AsyncLogState *state = (AsyncLogState *)userdata;
+    Uint64 timestamp = SDL_GetLogMessageTimestamp();
+    int thread, index;
+
+    if (state->release) {
+        SDL_WaitSemaphore(state->release);
+        SDL_DestroySemaphore(state->release);
+        state->release = NULL;
+    }
+
+    if (category == SDL_LOG_CATEGORY_SYSTEM && priority == SDL_LOG_PRIORITY_WARN) {
+        ++state->dropped_warnings;
+        return;
+    }
+    if (SDL_strncmp(message, "async ", 6) != 0) {
+        /* Test harness output */
+        original_function(original_userdata, category, priority, message);
+        return;
+    }
+
+    ++state->count;
+    if (SDL_sscanf(message, "async %d %d", &thread, &index) == 2 && thread >= 0 && thread < ASYNC_LOG_THREADS) {
+        if (index != state->next_index[thread]) {
+            ++state->out_of_order;
+        }
+        state->next_index[thread] = index + 1;
+
+        if (timestamp == 0 || timestamp < state->last_timestamp[thread]) {
+            ++state->bad_timestamps;
+        }
+        state->last_timestamp[thread] = timestamp;
+    }
+}
+
+static int SDLCALL AsyncLogThread(void *data)
+{
+    int thread = (int)(intptr_t)data;
+    int i;
+
+    for (i = 0; i < ASYNC_LOG_MESSAGES; ++i) {
+        SDL_Log("async %d %d", thread, i);
+    }
+    return 0;
+}
+
+/**
+ * Check that asynchronous logging delivers messages from all threads in order
+ */
+static int SDLCALL log_testAsync(void *arg)
+{
+    AsyncLogState state;
+    SDL_Thread *threads[ASYNC_LOG_THREADS];
+    SDL_PropertiesID props;
+    bool result;
+    int i;
+
+    SDL_SetHint(SDL_HINT_LOGGING, NULL);
+    SDL_zero(state);
+    SDL_GetLogOutputFunction(&original_function, &original_userdata);
+    SDL_SetLogOutputFunction(TestAsyncLogOutput, &state);
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNC_LOGGING_OVERFLOW_POLICY_NUMBER, SDL_LOG_OVERFLOW_BLOCK);
+    result = SDL_StartAsyncLogging(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertPass("SDL_StartAsyncLogging() with SDL_LOG_OVERFLOW_BLOCK");
+    SDLTest_AssertCheck(result, "Check result value, expected: true, got: %s", result ? "true" : "false");
+
+    for (i = 0; i < ASYNC_LOG_THREADS; ++i) {
+        threads[i] = SDL_CreateThread(AsyncLogThread, "AsyncLogThread", (void *)(intptr_t)i);
+    }
+    for (i = 0; i < ASYNC_LOG_THREADS; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+    SDL_FlushLogs();
+    SDLTest_AssertPass("SDL_FlushLogs()");
+    SDLTest_AssertCheck(state.count == ASYNC_LOG_THREADS * ASYNC_LOG_MESSAGES, "Check message count, expected: %d, got: %d", ASYNC_LOG_THREADS * ASYNC_LOG_MESSAGES, state.count);
+    SDLTest_AssertCheck(state.out_of_order == 0, "Check messages out of order, expected: 0, got: %d", state.out_of_order);
+    SDLTest_AssertCheck(state.bad_timestamps == 0, "Check messages with bad timestamps, expected: 0, got: %d", state.bad_timestamps);
+
+    /* Stall the log thread on the first message so a small buffer overflows */
+    SDL_StopAsyncLogging();
+    SDLTest_AssertPass("SDL_StopAsyncLogging()");
+    SDL_zero(state);
+    state.release = SDL_CreateSemaphore(0);
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_SYSTEM, SDL_LOG_PRIORITY_WARN);
+
+    props = SDL_CreateProperties();
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNC_LOGGING_BUFFER_SIZE_NUMBER, 4096);
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNC_LOGGING_OVERFLOW_POLICY_NUMBER, SDL_LOG_OVERFLOW_DROP);
+    result = SDL_StartAsyncLogging(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertPass("SDL_StartAsyncLogging() with a 4096 byte buffer");
+    SDLTest_AssertCheck(result, "Check result value, expected: true, got: %s", result ? "true" : "false");
+
+    for (i = 0; i < ASYNC_LOG_MESSAGES; ++i) {
+        SDL_Log("async 0 %d", i);
+    }
+    SDL_SignalSemaphore(state.release);
+    SDL_FlushLogs();
+    SDLTest_AssertCheck(state.count < ASYNC_LOG_MESSAGES, "Check that messages were dropped, expected: < %d, got: %d", ASYNC_LOG_MESSAGES, state.count);
+    SDLTest_AssertCheck(state.dropped_warnings == 1, "Check dropped message warnings, expected: 1, got: %d", state.dropped_warnings);
+
+    SDL_StopAsyncLogging();
+    SDL_ResetLogPriorities();
+    SDL_SetLogOutputFunction(original_function, original_userdata);
+
+    return TEST_COMPLETED;
+}
+
+static void SDLCALL TestDeferredLogOutput(void *userdata, int category, SDL_LogPriority priority, const char *message)
+{
+    if (category == SDL_LOG_CATEGORY_CUSTOM) {
+        SDL_strlcpy((char *)userdata, message, 256);
+    } else {
+        /* Test harness output */
+        original_function(original_userdata, category, priority, message);
+    }
+}
+
+#define CHECK_DEFERRED_LOG(...)                                                        \
+    do {                                                                               \
+        SDL_snprintf(expected, sizeof(expected), __VA_ARGS__);                         \
+        SDL_LogCritical(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__);                         \
+        SDL_FlushLogs();                                                               \
+        SDLTest_AssertCheck(SDL_strcmp(message, expected) == 0,                        \
+                            "Check deferred message, expected: \"%s\", got: \"%s\"",    \
+                            expected, message);                                        \
+    } while (0)
+
+/**
+ * Check that deferred formatting produces the same text as SDL_snprintf()
+ */
+static int SDLCALL log_testDeferredFormat(void *arg)
+{
+    char message[256];
+    char expected[256];
+    char name[16];
+    char format[16];
+    char unterminated[4];
+    SDL_PropertiesID props;
+    bool result;
+
+    SDL_zero(message);
+    SDL_strlcpy(name, "stack", sizeof(name));
+    SDL_GetLogOutputFunction(&original_function, &original_userdata);
+    SDL_SetLogOutputFunction(TestDeferredLogOutput, message);
+
+    props = SDL_CreateProperties();
+    SDL_SetBooleanProperty(props, SDL_PROP_ASYNC_LOGGING_DEFERRED_FORMAT_BOOLEAN, true);
+    result = SDL_StartAsyncLogging(props);
+    SDL_DestroyProperties(props);
+    SDLTest_AssertPass("SDL_StartAsyncLogging() with deferred formatting");
+    SDLTest_AssertCheck(result, "Check result value, expected: true, got: %s", result ? "true" : "false");
+
+    CHECK_DEFERRED_LOG("%d %u %x %c %s", -1, 3000000000u, 0xabc, 'z', "literal");
+    CHECK_DEFERRED_LOG("%hhd %hu %ld %" SDL_PRIs64 " %zu", 257, 65537, -7L, SDL_MIN_SINT64, (size_t)42);
+    CHECK_DEFERRED_LOG("[%-6s] [%6.2f] [%*d] [%.*s]", "ab", 3.14159, 5, 7, 2, "xyz");
+    CHECK_DEFERRED_LOG("%s copied, %g%%", name, 0.5);
+
+    /* The string argument is copied, so changing it doesn't change the message */
+    SDL_LogCritical(SDL_LOG_CATEGORY_CUSTOM, "%s", name);
+    SDL_strlcpy(name, "changed", sizeof(name));
+    SDL_FlushLogs();
+    SDLTest_AssertCheck(SDL_strcmp(message, "stack") == 0, "Check copied string argument, expected: \"stack\", got: \"%s\"", message);
+
+    /* With a precision, string arguments don't have to be null terminated */
+    SDL_memcpy(unterminated, "abcd", sizeof(unterminated));
+    CHECK_DEFERRED_LOG("[%.3s] [%.*s] [%.8s]", unterminated, 4, unterminated, "ab");
+
+    /* The format string is copied, so it doesn't have to outlive the call */
+    SDL_strlcpy(format, "format %d", sizeof(format));
+    SDL_LogCritical(SDL_LOG_CATEGORY_CUSTOM, format, 1);
+    SDL_strlcpy(format, "changed %d", sizeof(format));
+    SDL_FlushLogs();
+    SDLTest_AssertCheck(SDL_strcmp(message, "format 1") == 0, "Check copied format string, expected: \"format 1\", got: \"%s\"", message);
+
+    /* Wide strings and very long conversion specifications can't be deferred, these are formatted immediately */
+    CHECK_DEFERRED_LOG("%ls", L"wide");
+    SDL_strlcpy(format, "[%-+-+-+8d]", sizeof(format));
+    CHECK_DEFERRED_LOG(format, 1);
+
+    SDL_StopAsyncLogging();
+    SDL_SetLogOutputFunction(original_function, original_userdata);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Log test cases */
@@ -195,9 +399,17 @@ static const SDLTest_TestCaseReference logTestHint = {
     log_testHint, "log_testHint", "Check SDL_HINT_LOGGING functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference logTestAsync = {
+    log_testAsync, "log_testAsync", "Check asynchronous logging", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference logTestDeferredFormat = {
+    log_testDeferredFormat, "log_testDeferredFormat", "Check deferred formatting of log messages", TEST_ENABLED
+};
+
 /* Sequence of Log test cases */
 static const SDLTest_TestCaseReference *logTests[] = {
-    &logTestHint, NULL
+    &logTestHint, &logTestAsync, &logTestDeferredFormat, NULL
 };
 
 /* Timer test suite (global) */
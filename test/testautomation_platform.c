@@ -490,6 +490,113 @@ static int SDLCALL platform_testGetPowerInfo(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Tests SDL_GetCPUTopology() and SDL_GetNumPhysicalCPUCores()
+ * \sa SDL_GetCPUTopology
+ * \sa SDL_GetNumPhysicalCPUCores
+ */
+static int SDLCALL platform_testCPUTopology(void *arg)
+{
+    SDL_CPUInfo **cpus;
+    int count = -1;
+    int num_physical;
+    int max_core = -1;
+    int i;
+
+    cpus = SDL_GetCPUTopology(&count);
+    SDLTest_AssertPass("SDL_GetCPUTopology()");
+    SDLTest_AssertCheck(cpus != NULL, "SDL_GetCPUTopology() != NULL");
+    if (!cpus) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(count > 0, "Validate CPU count, expected > 0, got: %d", count);
+    SDLTest_AssertCheck(cpus[count] == NULL, "Validate the array is NULL terminated");
+
+    for (i = 0; i < count; ++i) {
+        const SDL_CPUInfo *info = cpus[i];
+
+        SDLTest_AssertCheck(i == 0 || info->cpu > cpus[i - 1]->cpu, "Validate CPU %d is sorted", info->cpu);
+        SDLTest_AssertCheck(info->core >= 0 && info->core <= max_core + 1, "Validate core %d of CPU %d is numbered in order", info->core, info->cpu);
+        SDLTest_AssertCheck(info->package >= 0 && info->numa_node >= 0, "Validate package %d and NUMA node %d of CPU %d", info->package, info->numa_node, info->cpu);
+        SDLTest_AssertCheck(info->capacity >= 1 && info->capacity <= 1024, "Validate capacity %d of CPU %d", info->capacity, info->cpu);
+        SDLTest_AssertCheck(info->l2_cache_size >= 0 && info->l3_cache_size >= 0, "Validate cache sizes of CPU %d", info->cpu);
+        SDLTest_Log("CPU %d: core %d, package %d, node %d, type %d, capacity %d, L2 %d KB (%d), L3 %d KB (%d)",
+                    info->cpu, info->core, info->package, info->numa_node, (int)info->core_type, info->capacity,
+                    info->l2_cache_size / 1024, info->l2_cache_id, info->l3_cache_size / 1024, info->l3_cache_id);
+        max_core = SDL_max(max_core, info->core);
+    }
+
+    num_physical = SDL_GetNumPhysicalCPUCores();
+    SDLTest_AssertPass("SDL_GetNumPhysicalCPUCores()");
+    SDLTest_AssertCheck(num_physical == max_core + 1, "Validate physical core count, expected: %d, got: %d", max_core + 1, num_physical);
+    SDLTest_AssertCheck(num_physical <= count, "Validate physical core count %d is at most the logical CPU count %d", num_physical, count);
+
+    SDL_free(cpus);
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL platform_affinityThread(void *data)
+{
+    (void)data;
+    return 42;
+}
+
+/**
+ * Tests SDL_SetThreadAffinity() and the thread creation affinity properties
+ * \sa SDL_SetThreadAffinity
+ * \sa SDL_CreateThreadWithProperties
+ */
+static int SDLCALL platform_testThreadAffinity(void *arg)
+{
+    SDL_CPUInfo **cpus;
+    SDL_PropertiesID props;
+    SDL_Thread *thread;
+    int status = 0;
+    int cpu;
+    bool result;
+
+    cpus = SDL_GetCPUTopology(NULL);
+    if (!cpus) {
+        return TEST_ABORTED;
+    }
+    cpu = cpus[0]->cpu;
+    SDL_free(cpus);
+
+    result = SDL_SetThreadAffinity(NULL, &cpu, 1);
+    SDLTest_AssertPass("Call to SDL_SetThreadAffinity(NULL, { %d }, 1)", cpu);
+    if (!result) {
+        SDLTest_Log("Thread affinity isn't supported here: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+
+    result = SDL_SetThreadAffinity(NULL, NULL, 0);
+    SDLTest_AssertCheck(result, "Validate SDL_SetThreadAffinity(NULL, NULL, 0) lets the thread run anywhere again");
+
+    cpu = -1;
+    result = SDL_SetThreadAffinity(NULL, &cpu, 1);
+    SDLTest_AssertCheck(!result, "Validate SDL_SetThreadAffinity() fails with a negative CPU");
+    result = SDL_SetThreadAffinity(NULL, NULL, 1);
+    SDLTest_AssertCheck(!result, "Validate SDL_SetThreadAffinity() fails with a NULL CPU list");
+
+    props = SDL_CreateProperties();
+    SDL_SetPointerProperty(props, SDL_PROP_THREAD_CREATE_ENTRY_FUNCTION_POINTER, (void *)platform_affinityThread);
+    SDL_SetStringProperty(props, SDL_PROP_THREAD_CREATE_NAME_STRING, "affinity");
+    cpu = 0;
+    SDL_SetPointerProperty(props, SDL_PROP_THREAD_CREATE_CPU_AFFINITY_POINTER, &cpu);
+    SDL_SetNumberProperty(props, SDL_PROP_THREAD_CREATE_CPU_AFFINITY_COUNT_NUMBER, 1);
+    thread = SDL_CreateThreadWithProperties(props);
+    SDLTest_AssertCheck(thread != NULL, "Validate SDL_CreateThreadWithProperties() with a CPU affinity succeeded");
+    if (thread) {
+        result = SDL_SetThreadAffinity(thread, NULL, 0);
+        SDLTest_AssertPass("Call to SDL_SetThreadAffinity(thread, NULL, 0), result: %s", result ? "true" : SDL_GetError());
+        SDL_WaitThread(thread, &status);
+        SDLTest_AssertCheck(status == 42, "Validate thread status, expected: 42, got: %d", status);
+    }
+    SDL_DestroyProperties(props);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Platform test cases */
@@ -533,6 +640,14 @@ static const SDLTest_TestCaseReference platformTest10 = {
     platform_testGetPowerInfo, "platform_testGetPowerInfo", "Tests SDL_GetPowerInfo function", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference platformTest11 = {
+    platform_testCPUTopology, "platform_testCPUTopology", "Tests SDL_GetCPUTopology function", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference platformTest12 = {
+    platform_testThreadAffinity, "platform_testThreadAffinity", "Tests SDL_SetThreadAffinity function", TEST_ENABLED
+};
+
 /* Sequence of Platform test cases */
 static const SDLTest_TestCaseReference *platformTests[] = {
     &platformTest1,
@@ -545,6 +660,8 @@ static const SDLTest_TestCaseReference *platformTests[] = {
     &platformTest8,
     &platformTest9,
     &platformTest10,
+    &platformTest11,
+    &platformTest12,
     NULL
 };
 
@@ -1247,6 +1247,212 @@ stdlib_iconv(void *arg)
 }
 
 
+/* Encodes code points as UTF-8 or as 2 or 4 byte code units, the slow way */
+static size_t iconv_encode(Uint8 *dst, const Uint32 *text, int length, int unit, bool bigendian)
+{
+    Uint8 *start = dst;
+    int i;
+
+    for (i = 0; i < length; ++i) {
+        Uint32 units[2];
+        int num_units = 1, j, k;
+        Uint32 ch = text[i];
+
+        if (unit == 1) {
+            if (ch < 0x80) {
+                *dst++ = (Uint8)ch;
+            } else if (ch < 0x800) {
+                *dst++ = (Uint8)(0xC0 | (ch >> 6));
+                *dst++ = (Uint8)(0x80 | (ch & 0x3F));
+            } else if (ch < 0x10000) {
+                *dst++ = (Uint8)(0xE0 | (ch >> 12));
+                *dst++ = (Uint8)(0x80 | ((ch >> 6) & 0x3F));
+                *dst++ = (Uint8)(0x80 | (ch & 0x3F));
+            } else {
+                *dst++ = (Uint8)(0xF0 | (ch >> 18));
+                *dst++ = (Uint8)(0x80 | ((ch >> 12) & 0x3F));
+                *dst++ = (Uint8)(0x80 | ((ch >> 6) & 0x3F));
+                *dst++ = (Uint8)(0x80 | (ch & 0x3F));
+            }
+            continue;
+        }
+        units[0] = ch;
+        if (unit == 2 && ch >= 0x10000) {
+            units[0] = 0xD800 | ((ch - 0x10000) >> 10);
+            units[1] = 0xDC00 | ((ch - 0x10000) & 0x3FF);
+            num_units = 2;
+        }
+        for (j = 0; j < num_units; ++j) {
+            for (k = 0; k < unit; ++k) {
+                const int shift = bigendian ? (unit - 1 - k) * 8 : k * 8;
+                *dst++ = (Uint8)(units[j] >> shift);
+            }
+        }
+    }
+    return (size_t)(dst - start);
+}
+
+static Uint32 iconv_random_char(void)
+{
+    Uint32 ch;
+
+    switch (SDLTest_RandomIntegerInRange(0, 7)) {
+    case 0:
+        ch = (Uint32)SDLTest_RandomIntegerInRange(0x80, 0x7FF);
+        break;
+    case 1:
+        ch = (Uint32)SDLTest_RandomIntegerInRange(0x800, 0xFFFD);
+        break;
+    case 2:
+        ch = (Uint32)SDLTest_RandomIntegerInRange(0x10000, 0x10FFFF);
+        break;
+    default:
+        // Mostly ASCII, so there are runs of it
+        return (Uint32)SDLTest_RandomIntegerInRange(1, 0x7F);
+    }
+    if (ch >= 0xD800 && ch <= 0xDFFF) {
+        ch = 0xE000;
+    }
+    return ch;
+}
+
+static int SDLCALL
+stdlib_iconvFastPath(void *arg)
+{
+    static const struct
+    {
+        const char *name;
+        int unit;
+        bool bigendian;
+    } encodings[] = {
+        { "UTF-16LE", 2, false },
+        { "UTF-16BE", 2, true },
+        { "UTF-32LE", 4, false },
+        { "UTF-32BE", 4, true },
+        { "UCS-4", 4, true },
+        { "UTF-8", 1, false },
+    };
+    const int max_length = 300;
+    Uint32 *text = (Uint32 *)SDL_malloc(max_length * sizeof(*text));
+    Uint8 *utf8 = (Uint8 *)SDL_malloc(max_length * 4 + 8);
+    Uint8 *expected = (Uint8 *)SDL_malloc(max_length * 4 + 8);
+    int iteration;
+
+    SDLTest_AssertCheck(text && utf8 && expected, "Allocate buffers");
+    if (!text || !utf8 || !expected) {
+        SDL_free(text);
+        SDL_free(utf8);
+        SDL_free(expected);
+        return TEST_ABORTED;
+    }
+
+    for (iteration = 0; iteration < 100; ++iteration) {
+        const int length = SDLTest_RandomIntegerInRange(0, max_length - 1);
+        bool ok = true;
+        size_t utf8_len;
+        int i;
+
+        for (i = 0; i < length; ++i) {
+            text[i] = iconv_random_char();
+        }
+        utf8_len = iconv_encode(utf8, text, length, 1, false);
+
+        for (i = 0; i < SDL_arraysize(encodings); ++i) {
+            const size_t expected_len = iconv_encode(expected, text, length, encodings[i].unit, encodings[i].bigendian);
+            char *output, *roundtrip;
+            char chunked[1200];
+            const char *inbuf = (const char *)utf8;
+            size_t inbytesleft = utf8_len;
+            size_t chunked_len = 0;
+            SDL_iconv_t cd;
+
+            // Convert it all at once, and then back again
+            output = SDL_iconv_string(encodings[i].name, "UTF-8", (const char *)utf8, utf8_len);
+            if (!output || SDL_memcmp(output, expected, expected_len) != 0) {
+                SDLTest_AssertCheck(false, "UTF-8 to %s, %d characters", encodings[i].name, length);
+                ok = false;
+            } else {
+                roundtrip = SDL_iconv_string("UTF-8", encodings[i].name, output, expected_len);
+                if (!roundtrip || SDL_memcmp(roundtrip, utf8, utf8_len) != 0) {
+                    SDLTest_AssertCheck(false, "%s to UTF-8, %d characters", encodings[i].name, length);
+                    ok = false;
+                }
+                SDL_free(roundtrip);
+            }
+            SDL_free(output);
+
+            // Convert it a little bit at a time, running out of room in the middle of characters
+            cd = SDL_iconv_open(encodings[i].name, "UTF-8");
+            while (inbytesleft > 0) {
+                char *outbuf = chunked + chunked_len;
+                size_t outbytesleft = 7;
+                const size_t result = SDL_iconv(cd, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+
+                if (outbytesleft == 7 || (result != SDL_ICONV_E2BIG && inbytesleft > 0)) {
+                    break;
+                }
+                chunked_len += 7 - outbytesleft;
+            }
+            SDL_iconv_close(cd);
+            if (inbytesleft > 0 || chunked_len != expected_len || SDL_memcmp(chunked, expected, expected_len) != 0) {
+                SDLTest_AssertCheck(false, "UTF-8 to %s in small pieces, %d characters", encodings[i].name, length);
+                ok = false;
+            }
+        }
+
+        // Something invalid in the middle shouldn't change anything around it
+        if (length > 0) {
+            const int split = SDLTest_RandomIntegerInRange(0, length - 1);
+            const size_t head_len = iconv_encode(utf8, text, split, 1, false);
+            static const char *const invalid[] = { "\xFF", "\xC0\xAF", "\xED\xA0\x80", "\xF4\x90\x80\x80", "\xEF\xBF\xBF", "\xE2\x82" };
+            const char *bad = invalid[iteration % SDL_arraysize(invalid)];
+            const size_t bad_len = SDL_strlen(bad);
+            size_t tail_len;
+            char *output;
+
+            SDL_memcpy(utf8 + head_len, bad, bad_len);
+            utf8[head_len + bad_len] = '!';
+            tail_len = 1 + iconv_encode(utf8 + head_len + bad_len + 1, text + split, length - split, 1, false);
+            utf8_len = head_len + bad_len + tail_len;
+
+            output = SDL_iconv_string("UTF-32LE", "UTF-8", (const char *)utf8, utf8_len);
+            if (output) {
+                const size_t expected_head = iconv_encode(expected, text, split, 4, false);
+                size_t output_len;
+
+                for (output_len = 0; SDL_memcmp(output + output_len, "\0\0\0\0", 4) != 0; output_len += 4) {
+                }
+                if (SDL_memcmp(output, expected, expected_head) != 0) {
+                    SDLTest_AssertCheck(false, "Text before invalid UTF-8 is converted unchanged");
+                    ok = false;
+                }
+                expected[0] = '!';
+                expected[1] = expected[2] = expected[3] = 0;
+                i = (int)iconv_encode(expected + 4, text + split, length - split, 4, false) + 4;
+                if (output_len < expected_head + i || SDL_memcmp(output + output_len - i, expected, i) != 0) {
+                    SDLTest_AssertCheck(false, "Text after invalid UTF-8 is converted unchanged");
+                    ok = false;
+                }
+            } else {
+                SDLTest_AssertCheck(false, "Convert UTF-8 with errors in it");
+                ok = false;
+            }
+            SDL_free(output);
+        }
+
+        if (!ok) {
+            break;
+        }
+    }
+    SDLTest_AssertCheck(iteration == 100, "Converted %d random strings between UTF-8, UTF-16 and UTF-32", iteration);
+
+    SDL_free(text);
+    SDL_free(utf8);
+    SDL_free(expected);
+    return TEST_COMPLETED;
+}
+
+
 static int SDLCALL
 stdlib_strpbrk(void *arg)
 {
@@ -1445,6 +1651,213 @@ static int SDLCALL stdlib_strtod(void *arg)
     return TEST_COMPLETED;
 }
 
+/* The original bit-at-a-time algorithms, to check the table and hardware paths against */
+static Uint32 crc32_reference(Uint32 crc, const Uint8 *data, size_t len)
+{
+    size_t i;
+    int bit;
+
+    for (i = 0; i < len; ++i) {
+        Uint32 r = (Uint8)crc ^ data[i];
+        for (bit = 0; bit < 8; ++bit) {
+            r = (r & 1 ? 0 : (Uint32)0xEDB88320L) ^ r >> 1;
+        }
+        crc = (r ^ (Uint32)0xFF000000L) ^ crc >> 8;
+    }
+    return crc;
+}
+
+static Uint16 crc16_reference(Uint16 crc, const Uint8 *data, size_t len)
+{
+    size_t i;
+    int bit;
+
+    for (i = 0; i < len; ++i) {
+        Uint8 r = (Uint8)crc ^ data[i];
+        Uint16 value = 0;
+        for (bit = 0; bit < 8; ++bit) {
+            value = ((value ^ r) & 1 ? 0xA001 : 0) ^ value >> 1;
+            r >>= 1;
+        }
+        crc = value ^ crc >> 8;
+    }
+    return crc;
+}
+
+static int SDLCALL stdlib_crc(void *arg)
+{
+    const size_t size = 1024 * 1024;
+    const int iterations = 64;
+    Uint8 *buffer;
+    Uint32 crc32;
+    Uint16 crc16;
+    Uint64 start, elapsed;
+    size_t offset, len;
+    int i;
+
+    crc32 = SDL_crc32(0, "123456789", 9);
+    SDLTest_AssertCheck(crc32 == 0xCBF43926, "SDL_crc32(\"123456789\"), expected 0xCBF43926, got 0x%08" SDL_PRIX32, crc32);
+    crc16 = SDL_crc16(0, "123456789", 9);
+    SDLTest_AssertCheck(crc16 == 0xBB3D, "SDL_crc16(\"123456789\"), expected 0xBB3D, got 0x%04X", crc16);
+
+    buffer = (Uint8 *)SDL_malloc(size + 64);
+    SDLTest_AssertCheck(buffer != NULL, "SDL_malloc(%u)", (unsigned int)(size + 64));
+    if (!buffer) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < (int)(size + 64); ++i) {
+        buffer[i] = (Uint8)SDLTest_RandomUint32();
+    }
+
+    // Every length up to a few folding blocks, at every alignment, plus some large ones
+    for (offset = 0; offset < 16; ++offset) {
+        for (len = 0; len < 300; ++len) {
+            const Uint32 seed = SDLTest_RandomUint32();
+            if (SDL_crc32(seed, buffer + offset, len) != crc32_reference(seed, buffer + offset, len) ||
+                SDL_crc16((Uint16)seed, buffer + offset, len) != crc16_reference((Uint16)seed, buffer + offset, len)) {
+                break;
+            }
+        }
+        SDLTest_AssertCheck(len == 300, "CRCs of lengths 0-299 at offset %u match the reference, first mismatch at length %u", (unsigned int)offset, (unsigned int)len);
+    }
+    len = size - SDLTest_RandomIntegerInRange(0, 4096);
+    crc32 = SDL_crc32(0, buffer + 3, len);
+    SDLTest_AssertCheck(crc32 == crc32_reference(0, buffer + 3, len), "SDL_crc32() of %u bytes matches the reference", (unsigned int)len);
+    SDLTest_AssertCheck(SDL_crc32(SDL_crc32(0, buffer + 3, 1000), buffer + 1003, len - 1000) == crc32, "SDL_crc32() can be computed incrementally");
+    crc16 = SDL_crc16(0, buffer + 3, len);
+    SDLTest_AssertCheck(crc16 == crc16_reference(0, buffer + 3, len), "SDL_crc16() of %u bytes matches the reference", (unsigned int)len);
+    SDLTest_AssertCheck(SDL_crc16(SDL_crc16(0, buffer + 3, 1000), buffer + 1003, len - 1000) == crc16, "SDL_crc16() can be computed incrementally");
+
+    // Throughput, for comparing implementations
+    crc32 = 0;
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations; ++i) {
+        crc32 = SDL_crc32(crc32, buffer, size);
+    }
+    elapsed = SDL_max(SDL_GetTicksNS() - start, 1);
+    SDLTest_Log("SDL_crc32: %d MiB in %" SDL_PRIu64 " us, %" SDL_PRIu64 " MiB/s", iterations, (Uint64)(elapsed / SDL_NS_PER_US), (Uint64)(iterations * SDL_NS_PER_SECOND / elapsed));
+
+    crc16 = 0;
+    start = SDL_GetTicksNS();
+    for (i = 0; i < iterations; ++i) {
+        crc16 = SDL_crc16(crc16, buffer, size);
+    }
+    elapsed = SDL_max(SDL_GetTicksNS() - start, 1);
+    SDLTest_Log("SDL_crc16: %d MiB in %" SDL_PRIu64 " us, %" SDL_PRIu64 " MiB/s", iterations, (Uint64)(elapsed / SDL_NS_PER_US), (Uint64)(iterations * SDL_NS_PER_SECOND / elapsed));
+
+    SDL_free(buffer);
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL stdlib_memoryArena(void *arg)
+{
+    SDL_MemoryArena *arena;
+    Uint8 *small[100];
+    Uint8 *big = NULL, *mem;
+    bool ok = true;
+    int i;
+
+    arena = SDL_CreateMemoryArena(1024);
+    SDLTest_AssertCheck(arena != NULL, "SDL_CreateMemoryArena(1024)");
+    if (!arena) {
+        return TEST_ABORTED;
+    }
+
+    // Small allocations spread over several blocks, with a big one in the middle
+    for (i = 0; i < (int)SDL_arraysize(small); ++i) {
+        small[i] = (Uint8 *)SDL_AllocateArenaMemory(arena, i + 1);
+        if (!small[i] || ((uintptr_t)small[i] % 16) != 0) {
+            ok = false;
+            break;
+        }
+        SDL_memset(small[i], i, i + 1);
+        if (i == 50) {
+            big = (Uint8 *)SDL_AllocateArenaMemory(arena, 4096);
+            SDLTest_AssertCheck(big != NULL, "SDL_AllocateArenaMemory(4096) with 1024 byte blocks");
+            if (big) {
+                SDL_memset(big, 0xFF, 4096);
+            }
+        }
+    }
+    SDLTest_AssertCheck(ok, "SDL_AllocateArenaMemory() returns 16 byte aligned memory");
+    for (i = 0; ok && i < (int)SDL_arraysize(small); ++i) {
+        int j;
+        for (j = 0; j <= i; ++j) {
+            if (small[i][j] != (Uint8)i) {
+                ok = false;
+            }
+        }
+    }
+    SDLTest_AssertCheck(ok, "Arena allocations don't overlap");
+
+    SDL_ResetMemoryArena(arena);
+    SDLTest_AssertPass("Call to SDL_ResetMemoryArena()");
+    mem = (Uint8 *)SDL_AllocateArenaMemory(arena, 16);
+    SDLTest_AssertCheck(mem != NULL, "SDL_AllocateArenaMemory() after a reset");
+
+    mem = (Uint8 *)SDL_AllocateArenaMemory(arena, 0);
+    SDLTest_AssertCheck(mem != NULL, "SDL_AllocateArenaMemory(0) returns memory");
+
+    mem = (Uint8 *)SDL_AllocateArenaMemory(NULL, 16);
+    SDLTest_AssertCheck(mem == NULL, "SDL_AllocateArenaMemory(NULL) fails");
+
+    SDL_DestroyMemoryArena(arena);
+    SDLTest_AssertPass("Call to SDL_DestroyMemoryArena()");
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL MemoryStatsThread(void *arg)
+{
+    void *blocks[64];
+    int i;
+
+    for (i = 0; i < SDL_arraysize(blocks); ++i) {
+        blocks[i] = SDL_malloc(16 + (i % 8) * 16);
+    }
+    for (i = 0; i < SDL_arraysize(blocks); ++i) {
+        SDL_free(blocks[i]);
+    }
+    return 0;
+}
+
+static int SDLCALL stdlib_memoryStats(void *arg)
+{
+    SDL_MemoryStats before, after;
+    SDL_Thread *thread;
+    bool result;
+    int i, round;
+
+    result = SDL_GetMemoryStats(NULL);
+    SDLTest_AssertCheck(!result, "SDL_GetMemoryStats(NULL) fails");
+
+    result = SDL_GetMemoryStats(&before);
+    SDLTest_AssertCheck(result, "SDL_GetMemoryStats() succeeds: %s", result ? "" : SDL_GetError());
+    SDLTest_AssertCheck(before.heap_in_use <= before.heap_size || before.heap_size == 0, "Heap in use %d <= heap size %d", (int)before.heap_in_use, (int)before.heap_size);
+
+    /* Threads that exit return their cache, and the next thread picks it up again.
+       A thread that leaked its cache or TLS storage on the way out would hold on to a cache for good.
+       The first round lets this thread's own cache fill up with what creating threads needs. */
+    for (round = 0; round < 2; ++round) {
+        if (round == 1) {
+            SDL_GetMemoryStats(&before);
+        }
+        for (i = 0; i < 8; ++i) {
+            thread = SDL_CreateThread(MemoryStatsThread, "MemoryStats", NULL);
+            SDLTest_AssertCheck(thread != NULL, "SDL_CreateThread() succeeds");
+            SDL_WaitThread(thread, NULL);
+        }
+    }
+
+    SDL_GetMemoryStats(&after);
+    SDLTest_Log("Per-thread caches: %d before, %d after, cached bytes: %d before, %d after",
+                before.num_thread_caches, after.num_thread_caches, (int)before.cached_bytes, (int)after.cached_bytes);
+    SDLTest_AssertCheck(after.num_thread_caches == before.num_thread_caches, "Joined threads don't keep their caches");
+    SDLTest_AssertCheck(after.cached_bytes <= before.cached_bytes + 4096, "Joined threads return their cached blocks");
+    SDLTest_AssertCheck(after.num_frees >= before.num_frees, "Counts don't go backwards");
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Standard C routine test cases */
@@ -1488,6 +1901,10 @@ static const SDLTest_TestCaseReference stdlibTest_iconv = {
     stdlib_iconv, "stdlib_iconv", "Calls to SDL_iconv", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_iconvFastPath = {
+    stdlib_iconvFastPath, "stdlib_iconvFastPath", "Calls to SDL_iconv between UTF-8, UTF-16 and UTF-32", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference stdlibTest_strpbrk = {
     stdlib_strpbrk, "stdlib_strpbrk", "Calls to SDL_strpbrk", TEST_ENABLED
 };
@@ -1504,6 +1921,18 @@ static const SDLTest_TestCaseReference stdlibTest_strtod = {
     stdlib_strtod, "stdlib_strtod", "Calls to SDL_strtod", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference stdlibTest_crc = {
+    stdlib_crc, "stdlib_crc", "Calls to SDL_crc32 and SDL_crc16, with throughput", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_memoryArena = {
+    stdlib_memoryArena, "stdlib_memoryArena", "Calls to SDL_CreateMemoryArena and friends", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference stdlibTest_memoryStats = {
+    stdlib_memoryStats, "stdlib_memoryStats", "Calls to SDL_GetMemoryStats with threads that come and go", TEST_ENABLED
+};
+
 /* Sequence of Standard C routine test cases */
 static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_strnlen,
@@ -1516,10 +1945,14 @@ static const SDLTest_TestCaseReference *stdlibTests[] = {
     &stdlibTest_aligned_alloc,
     &stdlibTestOverflow,
     &stdlibTest_iconv,
+    &stdlibTest_iconvFastPath,
     &stdlibTest_strpbrk,
     &stdlibTest_wcstol,
     &stdlibTest_strtox,
     &stdlibTest_strtod,
+    &stdlibTest_crc,
+    &stdlibTest_memoryArena,
+    &stdlibTest_memoryStats,
     NULL
 };
 
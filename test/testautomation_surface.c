@@ -977,6 +977,116 @@ static int SDLCALL surface_testSurfaceRLEPixels(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Fill an ARGB8888 surface with a mix of transparent, translucent and opaque pixels */
+static void FillRLETestPattern(SDL_Surface *surface)
+{
+    int x, y;
+
+    for (y = 0; y < surface->h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; x++) {
+            Uint32 rgb = ((Uint32)(x * 7 + y) & 0xff) << 16 | ((Uint32)(x * y) & 0xff) << 8 | ((Uint32)(x + y * 3) & 0xff);
+            Uint32 alpha;
+            switch ((x / 5 + y / 3) % 4) {
+            case 0:
+                alpha = 0;
+                break;
+            case 1:
+                alpha = 255;
+                break;
+            default:
+                alpha = (Uint32)((x * 13 + y * 5) % 254) + 1;
+                break;
+            }
+            row[x] = (alpha << 24) | rgb;
+        }
+    }
+}
+
+/**
+ *  Tests that RLE blits match regular blits, including after the surface has been locked
+ */
+static int SDLCALL surface_testRLEBlitMatchesBlit(void *arg)
+{
+    const SDL_Rect srcrects[] = {
+        { 0, 0, 67, 41 },
+        { 3, 5, 50, 30 },
+    };
+    const SDL_Rect dstrects[] = {
+        { 2, 1, 0, 0 },
+        { -4, -2, 0, 0 },
+    };
+    SDL_Surface *sprite, *rle, *expected, *actual;
+    Uint32 *pixels;
+    int i, ret;
+    bool result;
+
+    sprite = SDL_CreateSurface(67, 41, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(sprite != NULL, "Verify sprite surface is not NULL");
+    expected = SDL_CreateSurface(80, 50, SDL_PIXELFORMAT_XRGB8888);
+    actual = SDL_CreateSurface(80, 50, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(expected != NULL && actual != NULL, "Verify destination surfaces are not NULL");
+    if (!sprite || !expected || !actual) {
+        SDL_DestroySurface(sprite);
+        SDL_DestroySurface(expected);
+        SDL_DestroySurface(actual);
+        return TEST_ABORTED;
+    }
+    FillRLETestPattern(sprite);
+    SDL_SetSurfaceBlendMode(sprite, SDL_BLENDMODE_BLEND);
+
+    rle = SDL_DuplicateSurface(sprite);
+    SDLTest_AssertCheck(rle != NULL, "Verify result from SDL_DuplicateSurface() is not NULL");
+    result = SDL_SetSurfaceRLE(rle, true);
+    SDLTest_AssertCheck(result, "Verify result from SDL_SetSurfaceRLE() is true");
+
+    for (i = 0; i < 3; i++) {
+        int r;
+
+        if (i == 2) {
+            /* Modify the pixels while locked, the RLE encoding must not be reused */
+            result = SDL_LockSurface(rle);
+            SDLTest_AssertCheck(result, "Verify result from SDL_LockSurface() is true");
+            pixels = (Uint32 *)rle->pixels;
+            pixels[0] = 0xff123456;
+            pixels[rle->pitch / 4 + 10] = 0x80654321;
+            SDL_UnlockSurface(rle);
+            pixels = (Uint32 *)sprite->pixels;
+            pixels[0] = 0xff123456;
+            pixels[sprite->pitch / 4 + 10] = 0x80654321;
+        } else if (i == 1) {
+            /* Lock without modification, the RLE encoding may be reused */
+            result = SDL_LockSurface(rle);
+            SDLTest_AssertCheck(result, "Verify result from SDL_LockSurface() is true");
+            SDL_UnlockSurface(rle);
+        }
+
+        for (r = 0; r < SDL_arraysize(srcrects); r++) {
+            SDL_Rect dstrect = dstrects[r];
+
+            SDL_FillSurfaceRect(expected, NULL, SDL_MapSurfaceRGB(expected, 40, 80, 120));
+            SDL_FillSurfaceRect(actual, NULL, SDL_MapSurfaceRGB(actual, 40, 80, 120));
+
+            result = SDL_BlitSurface(sprite, &srcrects[r], expected, &dstrect);
+            SDLTest_AssertCheck(result, "Verify result from SDL_BlitSurface() is true");
+            dstrect = dstrects[r];
+            result = SDL_BlitSurface(rle, &srcrects[r], actual, &dstrect);
+            SDLTest_AssertCheck(result, "Verify result from SDL_BlitSurface() with RLE surface is true");
+            SDLTest_AssertCheck(rle->pixels == NULL, "Verify RLE surface is encoded after blit");
+
+            ret = SDLTest_CompareSurfaces(actual, expected, 12);
+            SDLTest_AssertCheck(ret == 0, "Validate RLE blit pass %d, rect %d matches regular blit, expected: 0, got: %i", i, r, ret);
+        }
+    }
+
+    SDL_DestroySurface(rle);
+    SDL_DestroySurface(sprite);
+    SDL_DestroySurface(expected);
+    SDL_DestroySurface(actual);
+
+    return TEST_COMPLETED;
+}
+
 /**
  *  Tests surface conversion.
  */
@@ -2172,6 +2282,10 @@ static const SDLTest_TestCaseReference surfaceTestRLEPixels = {
     surface_testSurfaceRLEPixels, "surface_testSurfaceRLEPixels", "Tests surface operations with RLE surfaces.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTestRLEBlitMatchesBlit = {
+    surface_testRLEBlitMatchesBlit, "surface_testRLEBlitMatchesBlit", "Tests that RLE blits match regular blits.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestSurfaceConversion = {
     surface_testSurfaceConversion, "surface_testSurfaceConversion", "Tests surface conversion.", TEST_ENABLED
 };
@@ -2272,6 +2386,7 @@ static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTestLoadFailure,
     &surfaceTestNULLPixels,
     &surfaceTestRLEPixels,
+    &surfaceTestRLEBlitMatchesBlit,
     &surfaceTestSurfaceConversion,
     &surfaceTestCompleteSurfaceConversion,
     &surfaceTestBlitColorMod,
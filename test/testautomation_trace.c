@@ -0,0 +1,269 @@
+/**
+ * Trace test suite
+ */
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testautomation_suites.h"
+
+#define MAX_TRACE_EVENTS 64
+
+typedef struct TraceRecord
+{
+    SDL_TraceEvent events[MAX_TRACE_EVENTS];
+    char names[MAX_TRACE_EVENTS][64];
+    int count;
+} TraceRecord;
+
+static const char *TraceTestFilename = "trace_test.json";
+
+static SDL_TraceCallback original_callback;
+static void *original_userdata;
+
+static void SDLCALL TestTraceOutput(void *userdata, const SDL_TraceEvent *event)
+{
+    TraceRecord *record = (TraceRecord *)userdata;
+
+    /* Only keep events from this thread, the audio thread may be running */
+    if (event->thread != SDL_GetCurrentThreadID() || record->count == MAX_TRACE_EVENTS) {
+        return;
+    }
+    SDL_copyp(&record->events[record->count], event);
+    SDL_strlcpy(record->names[record->count], event->name, sizeof(record->names[record->count]));
+    record->events[record->count].name = record->names[record->count];
+    ++record->count;
+}
+
+static bool EnableTestTrace(TraceRecord *record)
+{
+    SDL_zerop(record);
+    SDL_GetTraceCallback(&original_callback, &original_userdata);
+    return SDL_SetTraceCallback(TestTraceOutput, record);
+}
+
+static void DisableTestTrace(void)
+{
+    SDL_SetTraceCallback(original_callback, original_userdata);
+}
+
+static int FindTraceEvent(const TraceRecord *record, int start, SDL_TraceEventType type, const char *name)
+{
+    int i;
+
+    for (i = start; i < record->count; ++i) {
+        if (record->events[i].type == type && SDL_strcmp(record->events[i].name, name) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/* Fixture */
+
+static void SDLCALL TraceTearDown(void *arg)
+{
+    SDL_RemovePath(TraceTestFilename);
+}
+
+/* Test case functions */
+
+/**
+ * Check that zones, counters and frame marks reach the trace callback
+ */
+static int SDLCALL trace_testCallback(void *arg)
+{
+    TraceRecord record, other_record;
+    SDL_TraceCallback callback = NULL;
+    void *userdata = NULL;
+    SDL_TraceZone outer, inner, zone;
+    int i;
+
+    if (!EnableTestTrace(&record)) {
+        SDLTest_Log("Tracing isn't available: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertPass("SDL_SetTraceCallback(TestTraceOutput, &record)");
+
+    SDL_GetTraceCallback(&callback, &userdata);
+    SDLTest_AssertCheck(callback == TestTraceOutput && userdata == &record, "Check SDL_GetTraceCallback() returns the callback that was set");
+
+    outer = SDL_BeginTraceZone("outer");
+    inner = SDL_BeginTraceZone("inner");
+    SDLTest_AssertCheck(outer != 0 && inner == outer, "Check zones are traced while there's a callback");
+    SDL_SetTraceCounter("counter", 42.5);
+    SDL_EndTraceZone(inner, "inner");
+    SDL_EndTraceZone(outer, "outer");
+    SDL_MarkTraceFrame(NULL);
+    DisableTestTrace();
+    SDLTest_AssertPass("Sent trace events");
+
+    SDLTest_AssertCheck(record.count == 6, "Check number of events, expected: 6, got: %d", record.count);
+    if (record.count == 6) {
+        static const SDL_TraceEventType types[] = {
+            SDL_TRACE_EVENT_ZONE_BEGIN, SDL_TRACE_EVENT_ZONE_BEGIN, SDL_TRACE_EVENT_COUNTER,
+            SDL_TRACE_EVENT_ZONE_END, SDL_TRACE_EVENT_ZONE_END, SDL_TRACE_EVENT_FRAME_MARK
+        };
+        static const char *names[] = { "outer", "inner", "counter", "inner", "outer", "Frame" };
+
+        for (i = 0; i < record.count; ++i) {
+            SDLTest_AssertCheck(record.events[i].type == types[i], "Check event %d type, expected: %d, got: %d", i, types[i], record.events[i].type);
+            SDLTest_AssertCheck(SDL_strcmp(record.events[i].name, names[i]) == 0, "Check event %d name, expected: %s, got: %s", i, names[i], record.events[i].name);
+            if (i > 0) {
+                SDLTest_AssertCheck(record.events[i].timestamp >= record.events[i - 1].timestamp, "Check event %d timestamp is in order", i);
+            }
+        }
+        SDLTest_AssertCheck(record.events[2].value == 42.5, "Check counter value, expected: 42.5, got: %g", record.events[2].value);
+    }
+
+    /* A zone only ends in the callback that saw it begin */
+    SDL_SetTraceCallback(TestTraceOutput, &record);
+    zone = SDL_BeginTraceZone("replaced");
+    SDL_zero(other_record);
+    SDL_SetTraceCallback(TestTraceOutput, &other_record);
+    SDL_EndTraceZone(zone, "replaced");
+    DisableTestTrace();
+    SDLTest_AssertCheck(other_record.count == 0, "Check a zone doesn't end in a callback that didn't see it begin, got: %d events", other_record.count);
+
+    /* Nothing should be sent without a callback */
+    record.count = 0;
+    zone = SDL_BeginTraceZone("untraced");
+    SDLTest_AssertCheck(zone == 0, "Check zones aren't traced without a callback, got: %" SDL_PRIu32, zone);
+    SDL_EndTraceZone(zone, "untraced");
+    SDLTest_AssertCheck(record.count == 0, "Check no events are sent after the callback is removed, got: %d", record.count);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that SDL's own hot paths are instrumented
+ */
+static int SDLCALL trace_testInstrumentation(void *arg)
+{
+    TraceRecord record;
+    SDL_Surface *src, *dst;
+    int begin, end;
+
+    src = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateSurface(16, 16, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(src && dst, "Create surfaces");
+    if (!src || !dst) {
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+        return TEST_ABORTED;
+    }
+
+    if (!EnableTestTrace(&record)) {
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+        SDLTest_Log("Tracing isn't available: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    SDL_PumpEvents();
+    DisableTestTrace();
+    SDLTest_AssertPass("Call SDL_BlitSurface() and SDL_PumpEvents()");
+
+    begin = FindTraceEvent(&record, 0, SDL_TRACE_EVENT_ZONE_BEGIN, "SDL_BlitSurface");
+    end = FindTraceEvent(&record, begin + 1, SDL_TRACE_EVENT_ZONE_END, "SDL_BlitSurface");
+    SDLTest_AssertCheck(begin >= 0 && end > begin, "Check SDL_BlitSurface() is traced");
+
+    begin = FindTraceEvent(&record, 0, SDL_TRACE_EVENT_ZONE_BEGIN, "SDL_PumpEvents");
+    end = FindTraceEvent(&record, begin + 1, SDL_TRACE_EVENT_ZONE_END, "SDL_PumpEvents");
+    SDLTest_AssertCheck(begin >= 0 && end > begin, "Check SDL_PumpEvents() is traced");
+    SDLTest_AssertCheck(FindTraceEvent(&record, 0, SDL_TRACE_EVENT_COUNTER, "SDL event queue") >= 0, "Check the event queue counter is traced");
+
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check the Chrome trace event file writer
+ */
+static int SDLCALL trace_testChromeTrace(void *arg)
+{
+    SDL_TraceCallback callback = NULL;
+    void *userdata = NULL;
+    SDL_TraceZone zone;
+    char *contents;
+    size_t size = 0;
+
+    SDL_GetTraceCallback(&original_callback, &original_userdata);
+
+    if (!SDL_StartChromeTrace(TraceTestFilename)) {
+        SDLTest_Log("Tracing isn't available: %s", SDL_GetError());
+        return TEST_SKIPPED;
+    }
+    SDLTest_AssertPass("SDL_StartChromeTrace(\"%s\")", TraceTestFilename);
+
+    zone = SDL_BeginTraceZone("zone \"quoted\"");
+    SDL_SetTraceCounter("counter", 7);
+    SDL_EndTraceZone(zone, "zone \"quoted\"");
+    SDL_MarkTraceFrame(NULL);
+    SDL_StopChromeTrace();
+    SDLTest_AssertPass("SDL_StopChromeTrace()");
+
+    SDL_GetTraceCallback(&callback, &userdata);
+    SDLTest_AssertCheck(callback == NULL, "Check SDL_StopChromeTrace() removes its callback");
+
+    contents = (char *)SDL_LoadFile(TraceTestFilename, &size);
+    SDLTest_AssertCheck(contents != NULL, "Load the trace file");
+    if (contents) {
+        SDLTest_AssertCheck(size > 0 && contents[0] == '[', "Check the trace starts with '['");
+        SDLTest_AssertCheck(size >= 3 && SDL_strcmp(contents + size - 3, "\n]\n") == 0, "Check the trace ends with ']'");
+        SDLTest_AssertCheck(SDL_strstr(contents, "\"name\":\"zone \\\"quoted\\\"\",\"cat\":\"SDL\",\"ph\":\"B\"") != NULL, "Check the zone begin was written with its name escaped");
+        SDLTest_AssertCheck(SDL_strstr(contents, "\"ph\":\"E\"") != NULL, "Check the zone end was written");
+        SDLTest_AssertCheck(SDL_strstr(contents, "\"args\":{\"value\":7}") != NULL, "Check the counter was written");
+        SDLTest_AssertCheck(SDL_strstr(contents, "\"name\":\"Frame\",\"cat\":\"SDL\",\"ph\":\"i\"") != NULL, "Check the frame mark was written");
+        SDL_free(contents);
+    }
+
+    /* Replacing the callback finishes the trace the same way */
+    if (!SDL_StartChromeTrace(TraceTestFilename)) {
+        SDLTest_AssertCheck(false, "SDL_StartChromeTrace(\"%s\"), error: %s", TraceTestFilename, SDL_GetError());
+        SDL_SetTraceCallback(original_callback, original_userdata);
+        return TEST_ABORTED;
+    }
+    zone = SDL_BeginTraceZone("open zone");
+    SDL_SetTraceCounter("counter", 8);
+    SDLTest_AssertCheck(SDL_SetTraceCallback(NULL, NULL), "SDL_SetTraceCallback(NULL, NULL)");
+    SDL_EndTraceZone(zone, "open zone");
+
+    contents = (char *)SDL_LoadFile(TraceTestFilename, &size);
+    SDLTest_AssertCheck(contents != NULL, "Load the trace file");
+    if (contents) {
+        SDLTest_AssertCheck(size >= 3 && SDL_strcmp(contents + size - 3, "\n]\n") == 0, "Check the replaced trace ends with ']'");
+        SDLTest_AssertCheck(SDL_strstr(contents, "\"args\":{\"value\":8}") != NULL, "Check buffered events were written when the trace was replaced");
+        SDL_free(contents);
+    }
+
+    SDL_SetTraceCallback(original_callback, original_userdata);
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Trace test cases */
+static const SDLTest_TestCaseReference traceTestCallback = {
+    trace_testCallback, "trace_testCallback", "Check that trace events reach the trace callback", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference traceTestInstrumentation = {
+    trace_testInstrumentation, "trace_testInstrumentation", "Check that SDL traces its own work", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference traceTestChromeTrace = {
+    trace_testChromeTrace, "trace_testChromeTrace", "Check writing a Chrome trace file", TEST_ENABLED
+};
+
+/* Sequence of Trace test cases */
+static const SDLTest_TestCaseReference *traceTests[] = {
+    &traceTestCallback, &traceTestInstrumentation, &traceTestChromeTrace, NULL
+};
+
+/* Trace test suite (global) */
+SDLTest_TestSuiteReference traceTestSuite = {
+    "Trace",
+    NULL,
+    traceTests,
+    TraceTearDown
+};
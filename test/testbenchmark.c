@@ -0,0 +1,81 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures SDL's hot paths with the SDL_test benchmark runner. Nothing here
+   needs a window or audio device, so it runs under the dummy and offscreen
+   video drivers too. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "testbenchmark_suites.h"
+
+/* All benchmark suites */
+static SDLTest_BenchmarkSuiteReference *benchmarkSuites[] = {
+    &audioBenchmarkSuite,
+    &blitBenchmarkSuite,
+    &eventsBenchmarkSuite,
+    &hashtableBenchmarkSuite,
+    &yuvBenchmarkSuite,
+    NULL
+};
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDLTest_BenchmarkRunner *runner;
+    int result;
+    int i;
+
+    /* Initialize test framework, audio streams work without the audio subsystem */
+    state = SDLTest_CommonCreateState(argv, SDL_INIT_VIDEO);
+    if (!state) {
+        return 1;
+    }
+
+    /* Everything is measured off screen */
+    state->num_windows = 0;
+
+    runner = SDLTest_CreateBenchmarkRunner(state, benchmarkSuites);
+    if (!runner) {
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (consumed <= 0) {
+            SDLTest_CommonLogUsage(state, argv[0], NULL);
+            SDLTest_DestroyBenchmarkRunner(runner);
+            SDLTest_CommonDestroyState(state);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    /* Initialize common state */
+    if (!SDLTest_CommonInit(state)) {
+        SDLTest_DestroyBenchmarkRunner(runner);
+        SDLTest_CommonQuit(state);
+        return 2;
+    }
+
+    result = SDLTest_ExecuteBenchmarkRunner(runner);
+
+    SDLTest_DestroyBenchmarkRunner(runner);
+    SDLTest_CommonQuit(state);
+    return result;
+}
@@ -0,0 +1,164 @@
+/**
+ * Audio conversion and resampling benchmark suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbenchmark_suites.h"
+
+#define AUDIO_FRAMES        4096
+#define AUDIO_MAX_CHANNELS  6
+
+typedef struct AudioBenchmarkData
+{
+    SDL_AudioStream *convert;
+    SDL_AudioStream *resample;
+    SDL_AudioStream *downmix;
+    Uint8 *src;
+    Uint8 *dst;
+    int dst_size;
+} AudioBenchmarkData;
+
+/* ================= Benchmark Helper Functions ================== */
+
+static SDL_AudioStream *CreateStream(SDL_AudioFormat src_format, int src_channels, int src_freq, SDL_AudioFormat dst_format, int dst_channels, int dst_freq)
+{
+    SDL_AudioSpec src_spec, dst_spec;
+    SDL_AudioStream *stream;
+
+    src_spec.format = src_format;
+    src_spec.channels = src_channels;
+    src_spec.freq = src_freq;
+    dst_spec.format = dst_format;
+    dst_spec.channels = dst_channels;
+    dst_spec.freq = dst_freq;
+    stream = SDL_CreateAudioStream(&src_spec, &dst_spec);
+    SDLTest_AssertCheck(stream != NULL, "Create %s %d channel %d Hz to %s %d channel %d Hz audio stream",
+                        SDL_GetAudioFormatName(src_format), src_channels, src_freq,
+                        SDL_GetAudioFormatName(dst_format), dst_channels, dst_freq);
+    return stream;
+}
+
+static void SDLCALL audioTearDown(void *arg)
+{
+    AudioBenchmarkData *data = (AudioBenchmarkData *)arg;
+
+    if (data) {
+        SDL_DestroyAudioStream(data->convert);
+        SDL_DestroyAudioStream(data->resample);
+        SDL_DestroyAudioStream(data->downmix);
+        SDL_free(data->src);
+        SDL_free(data->dst);
+        SDL_free(data);
+    }
+}
+
+static void SDLCALL audioSetUp(void **arg)
+{
+    const int src_size = AUDIO_FRAMES * AUDIO_MAX_CHANNELS * sizeof(float);
+    AudioBenchmarkData *data = (AudioBenchmarkData *)SDL_calloc(1, sizeof(*data));
+    float *samples;
+    int i;
+
+    SDLTest_AssertCheck(data != NULL, "Allocate benchmark data");
+    if (!data) {
+        return;
+    }
+
+    /* Leave plenty of room for the frames added by resampling */
+    data->dst_size = src_size * 2;
+    data->src = (Uint8 *)SDL_malloc(src_size);
+    data->dst = (Uint8 *)SDL_malloc(data->dst_size);
+    SDLTest_AssertCheck(data->src && data->dst, "Allocate audio buffers");
+
+    data->convert = CreateStream(SDL_AUDIO_S16, 2, 48000, SDL_AUDIO_F32, 2, 48000);
+    data->resample = CreateStream(SDL_AUDIO_F32, 2, 44100, SDL_AUDIO_F32, 2, 48000);
+    data->downmix = CreateStream(SDL_AUDIO_F32, 6, 48000, SDL_AUDIO_F32, 2, 48000);
+    if (!data->src || !data->dst || !data->convert || !data->resample || !data->downmix) {
+        audioTearDown(data);
+        return;
+    }
+
+    /* A sine wave is valid as any sample format the benchmarks read it as */
+    samples = (float *)data->src;
+    for (i = 0; i < AUDIO_FRAMES * AUDIO_MAX_CHANNELS; ++i) {
+        samples[i] = 0.5f * SDL_sinf((float)i * 0.01f);
+    }
+    *arg = data;
+}
+
+static int Convert(AudioBenchmarkData *data, SDL_AudioStream *stream, int src_frame_size, int iterations)
+{
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        if (!SDL_PutAudioStreamData(stream, data->src, AUDIO_FRAMES * src_frame_size)) {
+            SDLTest_LogError("SDL_PutAudioStreamData() failed: %s", SDL_GetError());
+            return TEST_ABORTED;
+        }
+        if (SDL_GetAudioStreamData(stream, data->dst, data->dst_size) < 0) {
+            SDLTest_LogError("SDL_GetAudioStreamData() failed: %s", SDL_GetError());
+            return TEST_ABORTED;
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Benchmarks ================== */
+
+/**
+ * Converts stereo S16 to F32 at the same rate.
+ */
+static int SDLCALL audio_benchmarkConvert(void *arg, int iterations)
+{
+    AudioBenchmarkData *data = (AudioBenchmarkData *)arg;
+
+    return Convert(data, data->convert, 2 * sizeof(Sint16), iterations);
+}
+
+/**
+ * Resamples stereo F32 from 44100 Hz to 48000 Hz.
+ */
+static int SDLCALL audio_benchmarkResample(void *arg, int iterations)
+{
+    AudioBenchmarkData *data = (AudioBenchmarkData *)arg;
+
+    return Convert(data, data->resample, 2 * sizeof(float), iterations);
+}
+
+/**
+ * Downmixes 5.1 F32 to stereo at the same rate.
+ */
+static int SDLCALL audio_benchmarkDownmix(void *arg, int iterations)
+{
+    AudioBenchmarkData *data = (AudioBenchmarkData *)arg;
+
+    return Convert(data, data->downmix, 6 * sizeof(float), iterations);
+}
+
+/* ================= Benchmark References ================== */
+
+static const SDLTest_BenchmarkReference audioBenchmark1 = {
+    audio_benchmarkConvert, "audio_benchmarkConvert", "Convert 4096 stereo frames from S16 to F32.", AUDIO_FRAMES, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference audioBenchmark2 = {
+    audio_benchmarkResample, "audio_benchmarkResample", "Resample 4096 stereo F32 frames from 44100 Hz to 48000 Hz.", AUDIO_FRAMES, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference audioBenchmark3 = {
+    audio_benchmarkDownmix, "audio_benchmarkDownmix", "Downmix 4096 F32 frames from 5.1 to stereo.", AUDIO_FRAMES, TEST_ENABLED
+};
+
+/* Sequence of Audio benchmarks */
+static const SDLTest_BenchmarkReference *audioBenchmarks[] = {
+    &audioBenchmark1, &audioBenchmark2, &audioBenchmark3, NULL
+};
+
+/* Audio benchmark suite (global) */
+SDLTest_BenchmarkSuiteReference audioBenchmarkSuite = {
+    "Audio",
+    audioSetUp,
+    audioBenchmarks,
+    audioTearDown
+};
@@ -0,0 +1,210 @@
+/**
+ * SDL_BlitSurface benchmark suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbenchmark_suites.h"
+
+#define BLIT_WIDTH  512
+#define BLIT_HEIGHT 512
+#define BLIT_PIXELS (BLIT_WIDTH * BLIT_HEIGHT)
+
+typedef struct BlitBenchmarkData
+{
+    SDL_Surface *argb8888;
+    SDL_Surface *xrgb8888;
+    SDL_Surface *rgb565;
+    SDL_Surface *small;
+    SDL_Surface *dst;
+    SDL_Surface *dst565;
+} BlitBenchmarkData;
+
+/* ================= Benchmark Helper Functions ================== */
+
+static void FillRandom(SDL_Surface *surface)
+{
+    Uint64 seed = 1;
+    int y, x;
+
+    for (y = 0; y < surface->h; ++y) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < surface->pitch; ++x) {
+            row[x] = (Uint8)SDL_rand_bits_r(&seed);
+        }
+    }
+}
+
+static SDL_Surface *CreateRandomSurface(int width, int height, SDL_PixelFormat format)
+{
+    SDL_Surface *surface = SDL_CreateSurface(width, height, format);
+
+    SDLTest_AssertCheck(surface != NULL, "Create %dx%d %s surface", width, height, SDL_GetPixelFormatName(format));
+    if (surface) {
+        FillRandom(surface);
+    }
+    return surface;
+}
+
+static void SDLCALL blitTearDown(void *arg)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)arg;
+
+    if (data) {
+        SDL_DestroySurface(data->argb8888);
+        SDL_DestroySurface(data->xrgb8888);
+        SDL_DestroySurface(data->rgb565);
+        SDL_DestroySurface(data->small);
+        SDL_DestroySurface(data->dst);
+        SDL_DestroySurface(data->dst565);
+        SDL_free(data);
+    }
+}
+
+static void SDLCALL blitSetUp(void **arg)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)SDL_calloc(1, sizeof(*data));
+
+    SDLTest_AssertCheck(data != NULL, "Allocate benchmark data");
+    if (!data) {
+        return;
+    }
+
+    data->argb8888 = CreateRandomSurface(BLIT_WIDTH, BLIT_HEIGHT, SDL_PIXELFORMAT_ARGB8888);
+    data->xrgb8888 = CreateRandomSurface(BLIT_WIDTH, BLIT_HEIGHT, SDL_PIXELFORMAT_XRGB8888);
+    data->rgb565 = CreateRandomSurface(BLIT_WIDTH, BLIT_HEIGHT, SDL_PIXELFORMAT_RGB565);
+    data->small = CreateRandomSurface(BLIT_WIDTH / 2, BLIT_HEIGHT / 2, SDL_PIXELFORMAT_XRGB8888);
+    data->dst = CreateRandomSurface(BLIT_WIDTH, BLIT_HEIGHT, SDL_PIXELFORMAT_XRGB8888);
+    data->dst565 = CreateRandomSurface(BLIT_WIDTH, BLIT_HEIGHT, SDL_PIXELFORMAT_RGB565);
+    if (!data->argb8888 || !data->xrgb8888 || !data->rgb565 || !data->small || !data->dst || !data->dst565) {
+        blitTearDown(data);
+        return;
+    }
+    *arg = data;
+}
+
+static int Blit(SDL_Surface *src, SDL_Surface *dst, SDL_BlendMode blendMode, int iterations)
+{
+    int i;
+
+    if (!SDL_SetSurfaceBlendMode(src, blendMode)) {
+        SDLTest_LogError("SDL_SetSurfaceBlendMode() failed: %s", SDL_GetError());
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < iterations; ++i) {
+        if (!SDL_BlitSurface(src, NULL, dst, NULL)) {
+            SDLTest_LogError("SDL_BlitSurface() failed: %s", SDL_GetError());
+            return TEST_ABORTED;
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Benchmarks ================== */
+
+/**
+ * Copies between surfaces of the same format.
+ */
+static int SDLCALL blit_benchmarkCopy(void *arg, int iterations)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)arg;
+
+    return Blit(data->xrgb8888, data->dst, SDL_BLENDMODE_NONE, iterations);
+}
+
+/**
+ * Converts ARGB8888 to XRGB8888 without blending.
+ */
+static int SDLCALL blit_benchmarkConvert(void *arg, int iterations)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)arg;
+
+    return Blit(data->argb8888, data->dst, SDL_BLENDMODE_NONE, iterations);
+}
+
+/**
+ * Converts RGB565 to XRGB8888.
+ */
+static int SDLCALL blit_benchmarkConvert565(void *arg, int iterations)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)arg;
+
+    return Blit(data->rgb565, data->dst, SDL_BLENDMODE_NONE, iterations);
+}
+
+/**
+ * Alpha blends ARGB8888 onto XRGB8888.
+ */
+static int SDLCALL blit_benchmarkBlend(void *arg, int iterations)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)arg;
+
+    return Blit(data->argb8888, data->dst, SDL_BLENDMODE_BLEND, iterations);
+}
+
+/**
+ * Alpha blends ARGB8888 onto RGB565.
+ */
+static int SDLCALL blit_benchmarkBlend565(void *arg, int iterations)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)arg;
+
+    return Blit(data->argb8888, data->dst565, SDL_BLENDMODE_BLEND, iterations);
+}
+
+/**
+ * Scales a surface up to twice its size.
+ */
+static int SDLCALL blit_benchmarkScale(void *arg, int iterations)
+{
+    BlitBenchmarkData *data = (BlitBenchmarkData *)arg;
+    static const SDL_ScaleMode scaleModes[] = { SDL_SCALEMODE_NEAREST, SDL_SCALEMODE_LINEAR };
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        if (!SDL_BlitSurfaceScaled(data->small, NULL, data->dst, NULL, scaleModes[i & 1])) {
+            SDLTest_LogError("SDL_BlitSurfaceScaled() failed: %s", SDL_GetError());
+            return TEST_ABORTED;
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Benchmark References ================== */
+
+static const SDLTest_BenchmarkReference blitBenchmark1 = {
+    blit_benchmarkCopy, "blit_benchmarkCopy", "Blit 512x512 XRGB8888 to XRGB8888.", BLIT_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference blitBenchmark2 = {
+    blit_benchmarkConvert, "blit_benchmarkConvert", "Blit 512x512 ARGB8888 to XRGB8888.", BLIT_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference blitBenchmark3 = {
+    blit_benchmarkConvert565, "blit_benchmarkConvert565", "Blit 512x512 RGB565 to XRGB8888.", BLIT_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference blitBenchmark4 = {
+    blit_benchmarkBlend, "blit_benchmarkBlend", "Alpha blend 512x512 ARGB8888 onto XRGB8888.", BLIT_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference blitBenchmark5 = {
+    blit_benchmarkBlend565, "blit_benchmarkBlend565", "Alpha blend 512x512 ARGB8888 onto RGB565.", BLIT_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference blitBenchmark6 = {
+    blit_benchmarkScale, "blit_benchmarkScale", "Scale 256x256 XRGB8888 to 512x512, alternating nearest and linear.", BLIT_PIXELS, TEST_ENABLED
+};
+
+/* Sequence of Blit benchmarks */
+static const SDLTest_BenchmarkReference *blitBenchmarks[] = {
+    &blitBenchmark1, &blitBenchmark2, &blitBenchmark3, &blitBenchmark4, &blitBenchmark5, &blitBenchmark6, NULL
+};
+
+/* Blit benchmark suite (global) */
+SDLTest_BenchmarkSuiteReference blitBenchmarkSuite = {
+    "Blit",
+    blitSetUp,
+    blitBenchmarks,
+    blitTearDown
+};
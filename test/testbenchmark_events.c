@@ -0,0 +1,157 @@
+/**
+ * Event queue benchmark suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbenchmark_suites.h"
+
+#define EVENTS_BATCH    256
+
+/* ================= Benchmark Helper Functions ================== */
+
+static void SDLCALL eventsSetUp(void **arg)
+{
+    (void)arg;
+
+    /* Start each benchmark with an empty queue */
+    SDL_PumpEvents();
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+}
+
+static void SDLCALL eventsTearDown(void *arg)
+{
+    (void)arg;
+
+    SDL_FlushEvents(SDL_EVENT_FIRST, SDL_EVENT_LAST);
+}
+
+static bool SDLCALL CountUserEvents(void *userdata, SDL_Event *event)
+{
+    if (event->type == SDL_EVENT_USER) {
+        ++*(int *)userdata;
+    }
+    return true;
+}
+
+static int PushAndPoll(int iterations)
+{
+    SDL_Event event;
+    int i, j, polled;
+
+    for (i = 0; i < iterations; ++i) {
+        for (j = 0; j < EVENTS_BATCH; ++j) {
+            SDL_zero(event);
+            event.type = SDL_EVENT_USER;
+            event.user.code = j;
+            if (!SDL_PushEvent(&event)) {
+                SDLTest_LogError("SDL_PushEvent() failed: %s", SDL_GetError());
+                return TEST_ABORTED;
+            }
+        }
+        polled = 0;
+        while (SDL_PollEvent(&event)) {
+            if (event.type == SDL_EVENT_USER) {
+                ++polled;
+            }
+        }
+        if (polled != EVENTS_BATCH) {
+            SDLTest_LogError("Polled %d events, expected %d", polled, EVENTS_BATCH);
+            return TEST_ABORTED;
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Benchmarks ================== */
+
+/**
+ * Pushes events one at a time and polls them back out.
+ */
+static int SDLCALL events_benchmarkPushPoll(void *arg, int iterations)
+{
+    (void)arg;
+
+    return PushAndPoll(iterations);
+}
+
+/**
+ * Pushes and polls events with an event watch installed.
+ */
+static int SDLCALL events_benchmarkPushPollWatched(void *arg, int iterations)
+{
+    int watched = 0;
+    int result;
+
+    (void)arg;
+
+    if (!SDL_AddEventWatch(CountUserEvents, &watched)) {
+        SDLTest_LogError("SDL_AddEventWatch() failed: %s", SDL_GetError());
+        return TEST_ABORTED;
+    }
+    result = PushAndPoll(iterations);
+    SDL_RemoveEventWatch(CountUserEvents, &watched);
+
+    if (result == TEST_COMPLETED && watched != iterations * EVENTS_BATCH) {
+        SDLTest_LogError("Event watch saw %d events, expected %d", watched, iterations * EVENTS_BATCH);
+        return TEST_ABORTED;
+    }
+    return result;
+}
+
+/**
+ * Adds and gets events in batches.
+ */
+static int SDLCALL events_benchmarkPeep(void *arg, int iterations)
+{
+    SDL_Event events[EVENTS_BATCH];
+    int i, j, count;
+
+    (void)arg;
+
+    for (i = 0; i < iterations; ++i) {
+        SDL_zeroa(events);
+        for (j = 0; j < EVENTS_BATCH; ++j) {
+            events[j].type = SDL_EVENT_USER;
+            events[j].user.code = j;
+        }
+        count = SDL_PeepEvents(events, EVENTS_BATCH, SDL_ADDEVENT, 0, 0);
+        if (count != EVENTS_BATCH) {
+            SDLTest_LogError("Added %d events, expected %d: %s", count, EVENTS_BATCH, SDL_GetError());
+            return TEST_ABORTED;
+        }
+        count = SDL_PeepEvents(events, EVENTS_BATCH, SDL_GETEVENT, SDL_EVENT_USER, SDL_EVENT_USER);
+        if (count != EVENTS_BATCH) {
+            SDLTest_LogError("Got %d events, expected %d: %s", count, EVENTS_BATCH, SDL_GetError());
+            return TEST_ABORTED;
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Benchmark References ================== */
+
+static const SDLTest_BenchmarkReference eventsBenchmark1 = {
+    events_benchmarkPushPoll, "events_benchmarkPushPoll", "Push 256 events one at a time and poll them.", EVENTS_BATCH, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference eventsBenchmark2 = {
+    events_benchmarkPushPollWatched, "events_benchmarkPushPollWatched", "Push 256 events one at a time and poll them, with an event watch.", EVENTS_BATCH, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference eventsBenchmark3 = {
+    events_benchmarkPeep, "events_benchmarkPeep", "Add 256 events at once and get them back.", EVENTS_BATCH, TEST_ENABLED
+};
+
+/* Sequence of Events benchmarks */
+static const SDLTest_BenchmarkReference *eventsBenchmarks[] = {
+    &eventsBenchmark1, &eventsBenchmark2, &eventsBenchmark3, NULL
+};
+
+/* Events benchmark suite (global) */
+SDLTest_BenchmarkSuiteReference eventsBenchmarkSuite = {
+    "Events",
+    eventsSetUp,
+    eventsBenchmarks,
+    eventsTearDown
+};
@@ -0,0 +1,173 @@
+/**
+ * Hash table benchmark suite
+ *
+ * SDL's hash table is internal, so this measures it through properties,
+ * which keep every name and value in one.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbenchmark_suites.h"
+
+#define HASHTABLE_KEYS  1024
+
+typedef struct HashtableBenchmarkData
+{
+    SDL_PropertiesID props;
+    char keys[HASHTABLE_KEYS][16];
+} HashtableBenchmarkData;
+
+/* ================= Benchmark Helper Functions ================== */
+
+static void SDLCALL hashtableTearDown(void *arg)
+{
+    HashtableBenchmarkData *data = (HashtableBenchmarkData *)arg;
+
+    if (data) {
+        SDL_DestroyProperties(data->props);
+        SDL_free(data);
+    }
+}
+
+static void SDLCALL hashtableSetUp(void **arg)
+{
+    HashtableBenchmarkData *data = (HashtableBenchmarkData *)SDL_calloc(1, sizeof(*data));
+    int i;
+
+    SDLTest_AssertCheck(data != NULL, "Allocate benchmark data");
+    if (!data) {
+        return;
+    }
+
+    data->props = SDL_CreateProperties();
+    SDLTest_AssertCheck(data->props != 0, "Create properties");
+    if (!data->props) {
+        hashtableTearDown(data);
+        return;
+    }
+
+    for (i = 0; i < HASHTABLE_KEYS; ++i) {
+        SDL_snprintf(data->keys[i], sizeof(data->keys[i]), "key.%d", i);
+        if (!SDL_SetNumberProperty(data->props, data->keys[i], i)) {
+            SDLTest_AssertCheck(false, "Set property %s: %s", data->keys[i], SDL_GetError());
+            hashtableTearDown(data);
+            return;
+        }
+    }
+    *arg = data;
+}
+
+/* ================= Benchmarks ================== */
+
+/**
+ * Looks up every key in the table.
+ */
+static int SDLCALL hashtable_benchmarkFind(void *arg, int iterations)
+{
+    HashtableBenchmarkData *data = (HashtableBenchmarkData *)arg;
+    Sint64 sum = 0;
+    int i, j;
+
+    for (i = 0; i < iterations; ++i) {
+        for (j = 0; j < HASHTABLE_KEYS; ++j) {
+            sum += SDL_GetNumberProperty(data->props, data->keys[j], 0);
+        }
+    }
+    if (sum != (Sint64)iterations * HASHTABLE_KEYS * (HASHTABLE_KEYS - 1) / 2) {
+        SDLTest_LogError("Property lookups returned the wrong values");
+        return TEST_ABORTED;
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Looks up keys that aren't in the table.
+ */
+static int SDLCALL hashtable_benchmarkFindMissing(void *arg, int iterations)
+{
+    HashtableBenchmarkData *data = (HashtableBenchmarkData *)arg;
+    int i, j;
+
+    for (i = 0; i < iterations; ++i) {
+        for (j = 0; j < HASHTABLE_KEYS; ++j) {
+            /* Same hash distribution, different string */
+            if (SDL_HasProperty(data->props, data->keys[j] + 1)) {
+                SDLTest_LogError("Found a property that was never set");
+                return TEST_ABORTED;
+            }
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Replaces the value of every key in the table.
+ */
+static int SDLCALL hashtable_benchmarkReplace(void *arg, int iterations)
+{
+    HashtableBenchmarkData *data = (HashtableBenchmarkData *)arg;
+    int i, j;
+
+    for (i = 0; i < iterations; ++i) {
+        for (j = 0; j < HASHTABLE_KEYS; ++j) {
+            if (!SDL_SetNumberProperty(data->props, data->keys[j], j)) {
+                SDLTest_LogError("SDL_SetNumberProperty() failed: %s", SDL_GetError());
+                return TEST_ABORTED;
+            }
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/**
+ * Fills a new table and destroys it again.
+ */
+static int SDLCALL hashtable_benchmarkCreate(void *arg, int iterations)
+{
+    HashtableBenchmarkData *data = (HashtableBenchmarkData *)arg;
+    int i, j;
+
+    for (i = 0; i < iterations; ++i) {
+        SDL_PropertiesID props = SDL_CreateProperties();
+        if (!props) {
+            SDLTest_LogError("SDL_CreateProperties() failed: %s", SDL_GetError());
+            return TEST_ABORTED;
+        }
+        for (j = 0; j < HASHTABLE_KEYS; ++j) {
+            SDL_SetNumberProperty(props, data->keys[j], j);
+        }
+        SDL_DestroyProperties(props);
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Benchmark References ================== */
+
+static const SDLTest_BenchmarkReference hashtableBenchmark1 = {
+    hashtable_benchmarkFind, "hashtable_benchmarkFind", "Look up 1024 keys that are in the table.", HASHTABLE_KEYS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference hashtableBenchmark2 = {
+    hashtable_benchmarkFindMissing, "hashtable_benchmarkFindMissing", "Look up 1024 keys that aren't in the table.", HASHTABLE_KEYS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference hashtableBenchmark3 = {
+    hashtable_benchmarkReplace, "hashtable_benchmarkReplace", "Replace the values of 1024 keys.", HASHTABLE_KEYS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference hashtableBenchmark4 = {
+    hashtable_benchmarkCreate, "hashtable_benchmarkCreate", "Insert 1024 keys into a new table, then destroy it.", HASHTABLE_KEYS, TEST_ENABLED
+};
+
+/* Sequence of Hashtable benchmarks */
+static const SDLTest_BenchmarkReference *hashtableBenchmarks[] = {
+    &hashtableBenchmark1, &hashtableBenchmark2, &hashtableBenchmark3, &hashtableBenchmark4, NULL
+};
+
+/* Hashtable benchmark suite (global) */
+SDLTest_BenchmarkSuiteReference hashtableBenchmarkSuite = {
+    "Hashtable",
+    hashtableSetUp,
+    hashtableBenchmarks,
+    hashtableTearDown
+};
@@ -0,0 +1,18 @@
+/**
+ * Reference to all benchmark suites.
+ *
+ */
+
+#ifndef testbenchmark_suites_h_
+#define testbenchmark_suites_h_
+
+#include <SDL3/SDL_test.h>
+
+/* Benchmark collections */
+extern SDLTest_BenchmarkSuiteReference audioBenchmarkSuite;
+extern SDLTest_BenchmarkSuiteReference blitBenchmarkSuite;
+extern SDLTest_BenchmarkSuiteReference eventsBenchmarkSuite;
+extern SDLTest_BenchmarkSuiteReference hashtableBenchmarkSuite;
+extern SDLTest_BenchmarkSuiteReference yuvBenchmarkSuite;
+
+#endif /* testbenchmark_suites_h_ */
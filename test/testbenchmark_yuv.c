@@ -0,0 +1,145 @@
+/**
+ * YUV conversion benchmark suite
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_test.h>
+#include "testbenchmark_suites.h"
+
+#define YUV_WIDTH   1280
+#define YUV_HEIGHT  720
+#define YUV_PIXELS  (YUV_WIDTH * YUV_HEIGHT)
+
+typedef struct YUVBenchmarkData
+{
+    Uint8 *yuv;
+    Uint8 *rgb;
+} YUVBenchmarkData;
+
+/* ================= Benchmark Helper Functions ================== */
+
+static void SDLCALL yuvTearDown(void *arg)
+{
+    YUVBenchmarkData *data = (YUVBenchmarkData *)arg;
+
+    if (data) {
+        SDL_free(data->yuv);
+        SDL_free(data->rgb);
+        SDL_free(data);
+    }
+}
+
+static void SDLCALL yuvSetUp(void **arg)
+{
+    YUVBenchmarkData *data = (YUVBenchmarkData *)SDL_calloc(1, sizeof(*data));
+    Uint64 seed = 1;
+    int i;
+
+    SDLTest_AssertCheck(data != NULL, "Allocate benchmark data");
+    if (!data) {
+        return;
+    }
+
+    /* Big enough for any of the packed or planar formats */
+    data->yuv = (Uint8 *)SDL_malloc(YUV_PIXELS * 2);
+    data->rgb = (Uint8 *)SDL_malloc(YUV_PIXELS * 4);
+    SDLTest_AssertCheck(data->yuv && data->rgb, "Allocate image buffers");
+    if (!data->yuv || !data->rgb) {
+        yuvTearDown(data);
+        return;
+    }
+
+    for (i = 0; i < YUV_PIXELS * 2; ++i) {
+        data->yuv[i] = (Uint8)SDL_rand_bits_r(&seed);
+    }
+    for (i = 0; i < YUV_PIXELS * 4; ++i) {
+        data->rgb[i] = (Uint8)SDL_rand_bits_r(&seed);
+    }
+    *arg = data;
+}
+
+static int Convert(SDL_PixelFormat src_format, const void *src, int src_pitch, SDL_PixelFormat dst_format, void *dst, int dst_pitch, int iterations)
+{
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        if (!SDL_ConvertPixels(YUV_WIDTH, YUV_HEIGHT, src_format, src, src_pitch, dst_format, dst, dst_pitch)) {
+            SDLTest_LogError("SDL_ConvertPixels() failed: %s", SDL_GetError());
+            return TEST_ABORTED;
+        }
+    }
+    return TEST_COMPLETED;
+}
+
+/* ================= Benchmarks ================== */
+
+/**
+ * Converts NV12 to XRGB8888.
+ */
+static int SDLCALL yuv_benchmarkNV12ToRGB(void *arg, int iterations)
+{
+    YUVBenchmarkData *data = (YUVBenchmarkData *)arg;
+
+    return Convert(SDL_PIXELFORMAT_NV12, data->yuv, YUV_WIDTH, SDL_PIXELFORMAT_XRGB8888, data->rgb, YUV_WIDTH * 4, iterations);
+}
+
+/**
+ * Converts IYUV to XRGB8888.
+ */
+static int SDLCALL yuv_benchmarkIYUVToRGB(void *arg, int iterations)
+{
+    YUVBenchmarkData *data = (YUVBenchmarkData *)arg;
+
+    return Convert(SDL_PIXELFORMAT_IYUV, data->yuv, YUV_WIDTH, SDL_PIXELFORMAT_XRGB8888, data->rgb, YUV_WIDTH * 4, iterations);
+}
+
+/**
+ * Converts YUY2 to XRGB8888.
+ */
+static int SDLCALL yuv_benchmarkYUY2ToRGB(void *arg, int iterations)
+{
+    YUVBenchmarkData *data = (YUVBenchmarkData *)arg;
+
+    return Convert(SDL_PIXELFORMAT_YUY2, data->yuv, YUV_WIDTH * 2, SDL_PIXELFORMAT_XRGB8888, data->rgb, YUV_WIDTH * 4, iterations);
+}
+
+/**
+ * Converts XRGB8888 to NV12.
+ */
+static int SDLCALL yuv_benchmarkRGBToNV12(void *arg, int iterations)
+{
+    YUVBenchmarkData *data = (YUVBenchmarkData *)arg;
+
+    return Convert(SDL_PIXELFORMAT_XRGB8888, data->rgb, YUV_WIDTH * 4, SDL_PIXELFORMAT_NV12, data->yuv, YUV_WIDTH, iterations);
+}
+
+/* ================= Benchmark References ================== */
+
+static const SDLTest_BenchmarkReference yuvBenchmark1 = {
+    yuv_benchmarkNV12ToRGB, "yuv_benchmarkNV12ToRGB", "Convert 1280x720 NV12 to XRGB8888.", YUV_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference yuvBenchmark2 = {
+    yuv_benchmarkIYUVToRGB, "yuv_benchmarkIYUVToRGB", "Convert 1280x720 IYUV to XRGB8888.", YUV_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference yuvBenchmark3 = {
+    yuv_benchmarkYUY2ToRGB, "yuv_benchmarkYUY2ToRGB", "Convert 1280x720 YUY2 to XRGB8888.", YUV_PIXELS, TEST_ENABLED
+};
+
+static const SDLTest_BenchmarkReference yuvBenchmark4 = {
+    yuv_benchmarkRGBToNV12, "yuv_benchmarkRGBToNV12", "Convert 1280x720 XRGB8888 to NV12.", YUV_PIXELS, TEST_ENABLED
+};
+
+/* Sequence of YUV benchmarks */
+static const SDLTest_BenchmarkReference *yuvBenchmarks[] = {
+    &yuvBenchmark1, &yuvBenchmark2, &yuvBenchmark3, &yuvBenchmark4, NULL
+};
+
+/* YUV benchmark suite (global) */
+SDLTest_BenchmarkSuiteReference yuvBenchmarkSuite = {
+    "YUV",
+    yuvSetUp,
+    yuvBenchmarks,
+    yuvTearDown
+};
@@ -151,6 +151,7 @@ int main(int argc, char *argv[])
         SDL_IOStream *stream;
         const char *text = "foo\n";
         SDL_PathInfo pathinfo;
+        int globcount = 0;
 
         if (!SDL_EnumerateDirectory(base_path, enum_callback, NULL)) {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Base path enumeration failed!");
@@ -167,6 +168,33 @@ int main(int argc, char *argv[])
             SDL_free(globlist);
         }
 
+        /* searching the subdirectories in parallel must give the same results, in the same order. */
+        globlist = SDL_GlobDirectory(base_path, "*/*", 0, &globcount);
+        if (globlist) {
+            char **globlist2;
+            int globcount2 = 0;
+
+            SDL_SetHint(SDL_HINT_FILESYSTEM_GLOB_THREADS, "4");
+            globlist2 = SDL_GlobDirectory(base_path, "*/*", 0, &globcount2);
+            SDL_ResetHint(SDL_HINT_FILESYSTEM_GLOB_THREADS);
+            if (!globlist2) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Threaded base path globbing failed: %s", SDL_GetError());
+            } else {
+                int i;
+                bool same = (globcount == globcount2);
+                for (i = 0; same && (i < globcount); i++) {
+                    same = (SDL_strcmp(globlist[i], globlist2[i]) == 0);
+                }
+                if (!same) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Threaded base path globbing gave different results!");
+                } else {
+                    SDL_Log("Threaded base path globbing found the same %d entries.", globcount);
+                }
+                SDL_free(globlist2);
+            }
+            SDL_free(globlist);
+        }
+
         /* !!! FIXME: put this in a subroutine and make it test more thoroughly (and put it in testautomation). */
         if (!SDL_CreateDirectory("testfilesystem-test")) {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CreateDirectory('testfilesystem-test') failed: %s", SDL_GetError());
@@ -230,6 +258,36 @@ int main(int argc, char *argv[])
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_IOFromFile('testfilesystem-A', 'w') failed: %s", SDL_GetError());
         }
 
+        /* copy something bigger than a single I/O buffer over a file that's longer than the source */
+        {
+            const size_t big_size = 3 * 1024 * 1024 + 17;
+            Uint8 *big = (Uint8 *)SDL_malloc(big_size);
+            if (big) {
+                size_t i, sizeC = 0;
+                Uint8 *copy;
+
+                for (i = 0; i < big_size; i++) {
+                    big[i] = (Uint8)((i * 7) ^ (i >> 13));
+                }
+                if (!SDL_SaveFile("testfilesystem-C", big, big_size)) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_SaveFile('testfilesystem-C') failed: %s", SDL_GetError());
+                } else if (!SDL_SaveFile("testfilesystem-D", big, big_size + 1024)) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_SaveFile('testfilesystem-D') failed: %s", SDL_GetError());
+                } else if (!SDL_CopyFile("testfilesystem-C", "testfilesystem-D")) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CopyFile('testfilesystem-C', 'testfilesystem-D') failed: %s", SDL_GetError());
+                } else {
+                    copy = (Uint8 *)SDL_LoadFile("testfilesystem-D", &sizeC);
+                    if (!copy || sizeC != big_size || SDL_memcmp(copy, big, big_size) != 0) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Contents of testfilesystem-D didn't match testfilesystem-C");
+                    }
+                    SDL_free(copy);
+                }
+                SDL_free(big);
+                SDL_RemovePath("testfilesystem-C");
+                SDL_RemovePath("testfilesystem-D");
+            }
+        }
+
         storage = SDL_OpenFileStorage(base_path);
         if (!storage) {
             SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to open base path storage object: %s", SDL_GetError());
@@ -309,6 +367,84 @@ int main(int argc, char *argv[])
 
     }
 
+    {
+        SDL_PropertiesID props = SDL_CreateProperties();
+        SDL_Storage *storage;
+
+        SDL_SetBooleanProperty(props, SDL_PROP_STORAGE_USER_WRITE_BEHIND_BOOLEAN, true);
+        storage = SDL_OpenUserStorage("libsdl", "test_filesystem", props);
+        SDL_DestroyProperties(props);
+        if (!storage) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_OpenUserStorage() with write-behind failed: %s", SDL_GetError());
+        } else {
+            const int num_files = 100;
+            char path[64];
+            char contents[64];
+            char readback[64];
+            SDL_PathInfo pathinfo;
+            Uint64 start;
+            int i;
+
+            start = SDL_GetTicksNS();
+            for (i = 0; i < num_files; i++) {
+                SDL_snprintf(path, sizeof(path), "testfilesystem-wb-%d", i);
+                SDL_snprintf(contents, sizeof(contents), "write-behind %d", i);
+                if (!SDL_WriteStorageFile(storage, path, contents, SDL_strlen(contents))) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_WriteStorageFile('%s') failed: %s", path, SDL_GetError());
+                }
+            }
+            SDL_Log("Staged %d storage writes in %" SDL_PRIu64 " us, %d pending", num_files, (SDL_GetTicksNS() - start) / SDL_NS_PER_US, SDL_GetStoragePendingCommits(storage));
+
+            /* Rewriting a path before it lands replaces the staged data, and reads see it right away. */
+            SDL_snprintf(contents, sizeof(contents), "rewritten");
+            SDL_WriteStorageFile(storage, "testfilesystem-wb-0", contents, SDL_strlen(contents));
+
+            /* A file that looks like a temporary name is committed in the same batch, and doesn't clash. */
+            SDL_WriteStorageFile(storage, "testfilesystem-wb-1.tmp", "user file", 9);
+            SDL_zeroa(readback);
+            if (!SDL_GetStoragePathInfo(storage, "testfilesystem-wb-0", &pathinfo) || pathinfo.size != SDL_strlen(contents) ||
+                !SDL_ReadStorageFile(storage, "testfilesystem-wb-0", readback, pathinfo.size) || SDL_strcmp(readback, contents) != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Staged storage write wasn't visible to reads!");
+            }
+
+            if (!SDL_WaitStorageCommits(storage, -1)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_WaitStorageCommits() failed: %s", SDL_GetError());
+            } else if (SDL_GetStoragePendingCommits(storage) != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Storage writes still pending after SDL_WaitStorageCommits()!");
+            } else {
+                SDL_Log("Committed %d storage writes in %" SDL_PRIu64 " us", num_files, (SDL_GetTicksNS() - start) / SDL_NS_PER_US);
+            }
+
+            for (i = 0; i < num_files; i++) {
+                SDL_snprintf(path, sizeof(path), "testfilesystem-wb-%d", i);
+                if (i == 0) {
+                    SDL_snprintf(contents, sizeof(contents), "rewritten");
+                } else {
+                    SDL_snprintf(contents, sizeof(contents), "write-behind %d", i);
+                }
+                SDL_zeroa(readback);
+                if (!SDL_GetStoragePathInfo(storage, path, &pathinfo) || pathinfo.size != SDL_strlen(contents) ||
+                    !SDL_ReadStorageFile(storage, path, readback, pathinfo.size) || SDL_strcmp(readback, contents) != 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Committed storage file '%s' has the wrong contents!", path);
+                }
+                if (!SDL_RemoveStoragePath(storage, path)) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_RemoveStoragePath('%s') failed: %s", path, SDL_GetError());
+                }
+            }
+
+            SDL_zeroa(readback);
+            if (!SDL_GetStoragePathInfo(storage, "testfilesystem-wb-1.tmp", &pathinfo) || pathinfo.size != 9 ||
+                !SDL_ReadStorageFile(storage, "testfilesystem-wb-1.tmp", readback, pathinfo.size) || SDL_strcmp(readback, "user file") != 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Committed storage file 'testfilesystem-wb-1.tmp' has the wrong contents!");
+            }
+            SDL_RemoveStoragePath(storage, "testfilesystem-wb-1.tmp");
+
+            if (!SDL_CloseStorage(storage)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_CloseStorage() with write-behind failed: %s", SDL_GetError());
+            }
+        }
+    }
+
     SDL_Quit();
     SDLTest_CommonDestroyState(state);
     return 0;
@@ -0,0 +1,198 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures SDL_iconv_string() throughput between UTF-8, UTF-16 and UTF-32,
+   for text that is all ASCII, mostly ASCII, and entirely made up of two,
+   three and four byte UTF-8 characters. Every conversion is converted back
+   to UTF-8 and checked against the original text. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct TextKind
+{
+    const char *name;
+    int ascii_percent;
+    Uint32 first;
+    Uint32 last;
+} TextKind;
+
+static const TextKind text_kinds[] = {
+    { "ASCII", 100, 0, 0 },
+    { "Mostly ASCII", 95, 0xA0, 0x17F },
+    { "Cyrillic", 10, 0x410, 0x44F },
+    { "CJK", 5, 0x4E00, 0x9FFF },
+    { "Emoji", 0, 0x1F300, 0x1F6FF },
+};
+
+static const char *encodings[] = { "UTF-16LE", "UTF-16BE", "UTF-32LE", "UCS-4" };
+
+static int iterations = 20;
+static size_t text_size = 1024 * 1024;
+
+static size_t EncodeUTF8(char *dst, Uint32 ch)
+{
+    if (ch < 0x80) {
+        dst[0] = (char)ch;
+        return 1;
+    } else if (ch < 0x800) {
+        dst[0] = (char)(0xC0 | (ch >> 6));
+        dst[1] = (char)(0x80 | (ch & 0x3F));
+        return 2;
+    } else if (ch < 0x10000) {
+        dst[0] = (char)(0xE0 | (ch >> 12));
+        dst[1] = (char)(0x80 | ((ch >> 6) & 0x3F));
+        dst[2] = (char)(0x80 | (ch & 0x3F));
+        return 3;
+    }
+    dst[0] = (char)(0xF0 | (ch >> 18));
+    dst[1] = (char)(0x80 | ((ch >> 12) & 0x3F));
+    dst[2] = (char)(0x80 | ((ch >> 6) & 0x3F));
+    dst[3] = (char)(0x80 | (ch & 0x3F));
+    return 4;
+}
+
+static char *CreateText(const TextKind *kind, size_t *length)
+{
+    char *text = (char *)SDL_malloc(text_size + 4);
+    Uint64 seed = 42;
+    size_t len = 0;
+
+    if (!text) {
+        return NULL;
+    }
+    while (len < text_size) {
+        Uint32 ch;
+
+        if ((int)SDL_rand_r(&seed, 100) < kind->ascii_percent) {
+            ch = 0x20 + SDL_rand_r(&seed, 0x5F);
+        } else {
+            ch = kind->first + SDL_rand_r(&seed, (Sint32)(kind->last - kind->first + 1));
+        }
+        len += EncodeUTF8(text + len, ch);
+    }
+    *length = len;
+    return text;
+}
+
+static double Throughput(size_t bytes, Uint64 elapsed)
+{
+    if (!elapsed) {
+        return 0.0;
+    }
+    return (bytes / (1024.0 * 1024.0)) / (elapsed / (double)SDL_NS_PER_SECOND);
+}
+
+static bool RunBenchmark(const TextKind *kind)
+{
+    size_t length;
+    char *text = CreateText(kind, &length);
+    bool result = true;
+    int i, j;
+
+    if (!text) {
+        return false;
+    }
+
+    for (i = 0; i < SDL_arraysize(encodings); ++i) {
+        Uint64 to_elapsed = 0, from_elapsed = 0;
+
+        for (j = 0; j < iterations; ++j) {
+            Uint64 start = SDL_GetTicksNS();
+            char *converted = SDL_iconv_string(encodings[i], "UTF-8", text, length);
+            char *roundtrip;
+            size_t converted_length;
+
+            to_elapsed += SDL_GetTicksNS() - start;
+            if (!converted) {
+                SDL_Log("Couldn't convert %s text to %s: %s", kind->name, encodings[i], SDL_GetError());
+                result = false;
+                break;
+            }
+
+            // The text has no NUL characters, so the result ends at the first zero code unit
+            if (SDL_strstr(encodings[i], "16")) {
+                for (converted_length = 0; converted[converted_length] || converted[converted_length + 1]; converted_length += 2) {
+                }
+            } else {
+                for (converted_length = 0; SDL_memcmp(converted + converted_length, "\0\0\0\0", 4) != 0; converted_length += 4) {
+                }
+            }
+
+            start = SDL_GetTicksNS();
+            roundtrip = SDL_iconv_string("UTF-8", encodings[i], converted, converted_length);
+            from_elapsed += SDL_GetTicksNS() - start;
+            if (!roundtrip || SDL_memcmp(roundtrip, text, length) != 0) {
+                SDL_Log("%s text didn't survive conversion to %s and back", kind->name, encodings[i]);
+                result = false;
+            }
+            SDL_free(roundtrip);
+            SDL_free(converted);
+            if (!result) {
+                break;
+            }
+        }
+
+        SDL_Log("%-12s UTF-8 -> %-8s %8.1f MB/s, back %8.1f MB/s", kind->name, encodings[i],
+                Throughput(length * j, to_elapsed), Throughput(length * j, from_elapsed));
+        if (!result) {
+            break;
+        }
+    }
+
+    SDL_free(text);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--size") == 0 && argv[i + 1]) {
+                text_size = (size_t)SDL_atoi(argv[i + 1]) * 1024;
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || iterations <= 0 || text_size == 0) {
+            static const char *options[] = { "[--iterations N]", "[--size KB]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    for (i = 0; i < SDL_arraysize(text_kinds); ++i) {
+        if (!RunBenchmark(&text_kinds[i])) {
+            result = 1;
+        }
+    }
+
+    SDLTest_CommonDestroyState(state);
+    SDL_Quit();
+    return result;
+}
@@ -0,0 +1,323 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Counts the stream calls made by the BMP and WAV loaders, with and without
+   SDL_HINT_IOSTREAM_BUFFERING. For a stream backed by a file descriptor,
+   every one of these calls is a system call. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+static int iterations = 100;
+
+typedef struct CountingStream
+{
+    SDL_IOStream *inner;
+    int reads;
+    int writes;
+    int seeks;
+} CountingStream;
+
+static Sint64 SDLCALL counting_size(void *userdata)
+{
+    CountingStream *stream = (CountingStream *)userdata;
+    return SDL_GetIOSize(stream->inner);
+}
+
+static Sint64 SDLCALL counting_seek(void *userdata, Sint64 offset, SDL_IOWhence whence)
+{
+    CountingStream *stream = (CountingStream *)userdata;
+    ++stream->seeks;
+    return SDL_SeekIO(stream->inner, offset, whence);
+}
+
+static size_t SDLCALL counting_read(void *userdata, void *ptr, size_t size, SDL_IOStatus *status)
+{
+    CountingStream *stream = (CountingStream *)userdata;
+    size_t amount;
+
+    ++stream->reads;
+    amount = SDL_ReadIO(stream->inner, ptr, size);
+    *status = SDL_GetIOStatus(stream->inner);
+    return amount;
+}
+
+static size_t SDLCALL counting_write(void *userdata, const void *ptr, size_t size, SDL_IOStatus *status)
+{
+    CountingStream *stream = (CountingStream *)userdata;
+    size_t amount;
+
+    ++stream->writes;
+    amount = SDL_WriteIO(stream->inner, ptr, size);
+    *status = SDL_GetIOStatus(stream->inner);
+    return amount;
+}
+
+static SDL_IOStream *OpenCountingStream(CountingStream *stream, SDL_IOStream *inner)
+{
+    SDL_IOStreamInterface iface;
+
+    SDL_zerop(stream);
+    stream->inner = inner;
+
+    SDL_INIT_INTERFACE(&iface);
+    iface.size = counting_size;
+    iface.seek = counting_seek;
+    iface.read = counting_read;
+    iface.write = counting_write;
+    return SDL_OpenIO(&iface, stream);
+}
+
+static int TotalCalls(const CountingStream *stream)
+{
+    return stream->reads + stream->writes + stream->seeks;
+}
+
+static void Report(const char *name, const CountingStream *plain, double plain_us, const CountingStream *buffered, double buffered_us)
+{
+    SDL_Log("%-10s unbuffered: %4d calls (%3d read, %3d write, %3d seek) %8.2f us   buffered: %4d calls (%3d read, %3d write, %3d seek) %8.2f us",
+            name,
+            TotalCalls(plain), plain->reads, plain->writes, plain->seeks, plain_us,
+            TotalCalls(buffered), buffered->reads, buffered->writes, buffered->seeks, buffered_us);
+}
+
+static double ElapsedMicroseconds(Uint64 start)
+{
+    return (double)(SDL_GetPerformanceCounter() - start) * 1000000.0 / SDL_GetPerformanceFrequency() / iterations;
+}
+
+static SDL_Surface *CreateTestSurface(void)
+{
+    SDL_Surface *surface = SDL_CreateSurface(64, 64, SDL_PIXELFORMAT_INDEX8);
+    SDL_Palette *palette;
+    int i, x, y;
+
+    if (!surface) {
+        return NULL;
+    }
+    palette = SDL_CreateSurfacePalette(surface);
+    if (!palette) {
+        SDL_DestroySurface(surface);
+        return NULL;
+    }
+    for (i = 0; i < palette->ncolors; i++) {
+        palette->colors[i].r = (Uint8)i;
+        palette->colors[i].g = (Uint8)(255 - i);
+        palette->colors[i].b = (Uint8)(i * 3);
+        palette->colors[i].a = 255;
+    }
+    for (y = 0; y < surface->h; y++) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < surface->w; x++) {
+            row[x] = (Uint8)(x ^ y);
+        }
+    }
+    return surface;
+}
+
+/* A WAV file with a handful of metadata chunks in front of the data */
+static SDL_IOStream *CreateTestWAV(void)
+{
+    SDL_IOStream *io = SDL_IOFromDynamicMem();
+    const Uint32 frames = 4096;
+    const Uint32 datasize = frames * 2 * sizeof(Sint16);
+    const int extra_chunks = 16;
+    Uint32 i;
+
+    if (!io) {
+        return NULL;
+    }
+    SDL_WriteIO(io, "RIFF", 4);
+    SDL_WriteU32LE(io, 4 + (8 + 16) + extra_chunks * (8 + 12) + (8 + datasize));
+    SDL_WriteIO(io, "WAVE", 4);
+
+    SDL_WriteIO(io, "fmt ", 4);
+    SDL_WriteU32LE(io, 16);
+    SDL_WriteU16LE(io, 1);           /* PCM */
+    SDL_WriteU16LE(io, 2);           /* channels */
+    SDL_WriteU32LE(io, 44100);       /* frequency */
+    SDL_WriteU32LE(io, 44100 * 4);   /* byte rate */
+    SDL_WriteU16LE(io, 4);           /* block align */
+    SDL_WriteU16LE(io, 16);          /* bits per sample */
+
+    for (i = 0; i < (Uint32)extra_chunks; i++) {
+        SDL_WriteIO(io, "junk", 4);
+        SDL_WriteU32LE(io, 12);
+        SDL_WriteIO(io, "metadata....", 12);
+    }
+
+    SDL_WriteIO(io, "data", 4);
+    SDL_WriteU32LE(io, datasize);
+    for (i = 0; i < frames * 2; i++) {
+        SDL_WriteS16LE(io, (Sint16)(i * 7));
+    }
+    return io;
+}
+
+static bool BenchmarkBMP(bool buffered, CountingStream *counts, double *us, SDL_Surface **result)
+{
+    SDL_Surface *surface = CreateTestSurface();
+    SDL_IOStream *mem = SDL_IOFromDynamicMem();
+    CountingStream stream;
+    SDL_IOStream *io;
+    Uint64 start;
+    int i;
+
+    if (!surface || !mem) {
+        return false;
+    }
+    SDL_SetHint(SDL_HINT_IOSTREAM_BUFFERING, buffered ? "1" : "0");
+
+    io = OpenCountingStream(&stream, mem);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+        if (!SDL_SaveBMP_IO(surface, io, false)) {
+            return false;
+        }
+    }
+    us[0] = ElapsedMicroseconds(start);
+    counts[0] = stream;
+    SDL_CloseIO(io);
+
+    io = OpenCountingStream(&stream, mem);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_DestroySurface(*result);
+        SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+        *result = SDL_LoadBMP_IO(io, false);
+        if (!*result) {
+            return false;
+        }
+    }
+    us[1] = ElapsedMicroseconds(start);
+    counts[1] = stream;
+    SDL_CloseIO(io);
+
+    counts[0].reads /= iterations;
+    counts[0].writes /= iterations;
+    counts[0].seeks /= iterations;
+    counts[1].reads /= iterations;
+    counts[1].writes /= iterations;
+    counts[1].seeks /= iterations;
+
+    SDL_CloseIO(mem);
+    SDL_DestroySurface(surface);
+    return true;
+}
+
+static bool BenchmarkWAV(bool buffered, CountingStream *counts, double *us, Uint8 **result, Uint32 *result_len)
+{
+    SDL_IOStream *mem = CreateTestWAV();
+    CountingStream stream;
+    SDL_IOStream *io;
+    SDL_AudioSpec spec;
+    Uint64 start;
+    int i;
+
+    if (!mem) {
+        return false;
+    }
+    SDL_SetHint(SDL_HINT_IOSTREAM_BUFFERING, buffered ? "1" : "0");
+
+    io = OpenCountingStream(&stream, mem);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_free(*result);
+        SDL_SeekIO(io, 0, SDL_IO_SEEK_SET);
+        if (!SDL_LoadWAV_IO(io, false, &spec, result, result_len)) {
+            return false;
+        }
+    }
+    *us = ElapsedMicroseconds(start);
+    *counts = stream;
+    SDL_CloseIO(io);
+
+    counts->reads /= iterations;
+    counts->writes /= iterations;
+    counts->seeks /= iterations;
+
+    SDL_CloseIO(mem);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    CountingStream plain_counts[2], buffered_counts[2];
+    double plain_us[2], buffered_us[2];
+    SDL_Surface *plain_surface = NULL, *buffered_surface = NULL;
+    Uint8 *plain_audio = NULL, *buffered_audio = NULL;
+    Uint32 plain_audio_len = 0, buffered_audio_len = 0;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || iterations <= 0) {
+            static const char *options[] = { "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    if (!BenchmarkBMP(false, plain_counts, plain_us, &plain_surface) ||
+        !BenchmarkBMP(true, buffered_counts, buffered_us, &buffered_surface)) {
+        SDL_Log("BMP benchmark failed: %s", SDL_GetError());
+        result = 1;
+    } else {
+        Report("BMP save", &plain_counts[0], plain_us[0], &buffered_counts[0], buffered_us[0]);
+        Report("BMP load", &plain_counts[1], plain_us[1], &buffered_counts[1], buffered_us[1]);
+
+        if (plain_surface->w != buffered_surface->w || plain_surface->h != buffered_surface->h ||
+            plain_surface->format != buffered_surface->format ||
+            SDL_memcmp(plain_surface->pixels, buffered_surface->pixels, (size_t)plain_surface->h * plain_surface->pitch) != 0) {
+            SDL_Log("Buffered BMP load doesn't match unbuffered load");
+            result = 1;
+        }
+    }
+
+    if (!BenchmarkWAV(false, &plain_counts[0], &plain_us[0], &plain_audio, &plain_audio_len) ||
+        !BenchmarkWAV(true, &buffered_counts[0], &buffered_us[0], &buffered_audio, &buffered_audio_len)) {
+        SDL_Log("WAV benchmark failed: %s", SDL_GetError());
+        result = 1;
+    } else {
+        Report("WAV load", &plain_counts[0], plain_us[0], &buffered_counts[0], buffered_us[0]);
+
+        if (plain_audio_len != buffered_audio_len || SDL_memcmp(plain_audio, buffered_audio, plain_audio_len) != 0) {
+            SDL_Log("Buffered WAV load doesn't match unbuffered load");
+            result = 1;
+        }
+    }
+
+    SDL_DestroySurface(plain_surface);
+    SDL_DestroySurface(buffered_surface);
+    SDL_free(plain_audio);
+    SDL_free(buffered_audio);
+    SDLTest_CommonDestroyState(state);
+    return result;
+}
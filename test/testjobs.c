@@ -0,0 +1,349 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Checks that SDL job pools run every job exactly once and in dependency
+   order, then measures how much it costs to schedule a job, how well
+   SDL_ParallelFor() scales with the number of threads, and how quickly a
+   chain of dependent jobs gets through the pool. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define CHAIN_CHECK_LENGTH  64
+#define TREE_FANOUT         4
+#define TREE_DEPTH          4
+
+typedef struct ChainLink
+{
+    int index;
+    SDL_AtomicInt *next_index;
+    bool in_order;
+} ChainLink;
+
+typedef struct TreeNode
+{
+    SDL_JobPool *pool;
+    int depth;
+    SDL_AtomicInt *leaves;
+} TreeNode;
+
+static int num_jobs = 100000;
+static int num_items = 1000000;
+
+static void SDLCALL EmptyJob(void *userdata)
+{
+    (void)userdata;
+}
+
+static void SDLCALL ChainJob(void *userdata)
+{
+    ChainLink *link = (ChainLink *)userdata;
+
+    // Every earlier link has finished, so this must be the next one to run
+    link->in_order = (SDL_AddAtomicInt(link->next_index, 1) == link->index);
+}
+
+static void SDLCALL TreeJob(void *userdata)
+{
+    TreeNode *node = (TreeNode *)userdata;
+    TreeNode children[TREE_FANOUT];
+    SDL_JobCounter *counter;
+    int i;
+
+    if (node->depth == 0) {
+        SDL_AddAtomicInt(node->leaves, 1);
+        return;
+    }
+
+    // Wait for the children from inside a job, which only works if the wait helps out
+    counter = SDL_CreateJobCounter();
+    for (i = 0; i < TREE_FANOUT; ++i) {
+        children[i].pool = node->pool;
+        children[i].depth = node->depth - 1;
+        children[i].leaves = node->leaves;
+        if (!counter || !SDL_SubmitJob(node->pool, TreeJob, &children[i], NULL, counter)) {
+            TreeJob(&children[i]);
+        }
+    }
+    if (counter) {
+        SDL_WaitJobCounter(node->pool, counter);
+        SDL_DestroyJobCounter(counter);
+    }
+}
+
+static void SDLCALL CountItems(void *userdata, int start, int end)
+{
+    SDL_AtomicInt *counts = (SDL_AtomicInt *)userdata;
+    int i;
+
+    for (i = start; i < end; ++i) {
+        SDL_AddAtomicInt(&counts[i], 1);
+    }
+}
+
+static void SDLCALL WorkOnItems(void *userdata, int start, int end)
+{
+    float *results = (float *)userdata;
+    int i, j;
+
+    for (i = start; i < end; ++i) {
+        float x = (float)i;
+        for (j = 0; j < 16; ++j) {
+            x = SDL_sqrtf(x * x + (float)j);
+        }
+        results[i] = x;
+    }
+}
+
+static SDL_JobPool *CreatePool(int num_threads)
+{
+    SDL_PropertiesID props = SDL_CreateProperties();
+    SDL_JobPool *pool;
+
+    SDL_SetNumberProperty(props, SDL_PROP_JOBPOOL_CREATE_NUM_THREADS_NUMBER, num_threads);
+    SDL_SetStringProperty(props, SDL_PROP_JOBPOOL_CREATE_NAME_STRING, "testjobs");
+    pool = SDL_CreateJobPool(props);
+    SDL_DestroyProperties(props);
+    if (!pool) {
+        SDL_Log("Couldn't create a job pool with %d threads: %s", num_threads, SDL_GetError());
+    }
+    return pool;
+}
+
+static bool CheckChain(SDL_JobPool *pool)
+{
+    ChainLink links[CHAIN_CHECK_LENGTH];
+    SDL_JobCounter *counters[CHAIN_CHECK_LENGTH];
+    SDL_AtomicInt next_index;
+    bool result = true;
+    int i;
+
+    SDL_SetAtomicInt(&next_index, 0);
+    for (i = 0; i < CHAIN_CHECK_LENGTH; ++i) {
+        counters[i] = SDL_CreateJobCounter();
+        links[i].index = i;
+        links[i].next_index = &next_index;
+        links[i].in_order = false;
+        if (!counters[i] || !SDL_SubmitJob(pool, ChainJob, &links[i], i > 0 ? counters[i - 1] : NULL, counters[i])) {
+            SDL_Log("Couldn't submit a job: %s", SDL_GetError());
+            result = false;
+            break;
+        }
+    }
+
+    while (i-- > 0) {
+        SDL_WaitJobCounter(pool, counters[i]);
+        if (result && !links[i].in_order) {
+            SDL_Log("Chained job %d ran out of order", i);
+            result = false;
+        }
+        SDL_DestroyJobCounter(counters[i]);
+    }
+    return result;
+}
+
+static bool CheckTree(SDL_JobPool *pool)
+{
+    SDL_AtomicInt leaves;
+    TreeNode root;
+    int expected = 1;
+    int i;
+
+    for (i = 0; i < TREE_DEPTH; ++i) {
+        expected *= TREE_FANOUT;
+    }
+
+    SDL_SetAtomicInt(&leaves, 0);
+    root.pool = pool;
+    root.depth = TREE_DEPTH;
+    root.leaves = &leaves;
+    TreeJob(&root);
+
+    if (SDL_GetAtomicInt(&leaves) != expected) {
+        SDL_Log("Nested jobs reached %d leaves, expected %d", SDL_GetAtomicInt(&leaves), expected);
+        return false;
+    }
+    return true;
+}
+
+static bool CheckParallelFor(SDL_JobPool *pool)
+{
+    static const int batch_sizes[] = { 0, 1, 7, 1000000 };
+    const int count = 100003;
+    SDL_AtomicInt *counts = (SDL_AtomicInt *)SDL_calloc(count, sizeof(*counts));
+    bool result = true;
+    int i, j;
+
+    if (!counts) {
+        return false;
+    }
+    for (i = 0; i < SDL_arraysize(batch_sizes) && result; ++i) {
+        if (!SDL_ParallelFor(pool, count, batch_sizes[i], CountItems, counts)) {
+            SDL_Log("SDL_ParallelFor() failed: %s", SDL_GetError());
+            result = false;
+            break;
+        }
+        for (j = 0; j < count; ++j) {
+            if (SDL_SetAtomicInt(&counts[j], 0) != 1) {
+                SDL_Log("SDL_ParallelFor() with batches of %d didn't handle item %d exactly once", batch_sizes[i], j);
+                result = false;
+                break;
+            }
+        }
+    }
+    SDL_free(counts);
+    return result;
+}
+
+static Uint64 TimeEmptyJobs(SDL_JobPool *pool)
+{
+    SDL_JobCounter *counter = SDL_CreateJobCounter();
+    Uint64 start = SDL_GetTicksNS();
+    int i;
+
+    for (i = 0; i < num_jobs; ++i) {
+        SDL_SubmitJob(pool, EmptyJob, NULL, NULL, counter);
+    }
+    SDL_WaitJobCounter(pool, counter);
+    SDL_DestroyJobCounter(counter);
+    return SDL_GetTicksNS() - start;
+}
+
+static Uint64 TimeChain(SDL_JobPool *pool, int length)
+{
+    SDL_JobCounter *counters[2];
+    Uint64 start;
+    int i;
+
+    counters[0] = SDL_CreateJobCounter();
+    counters[1] = SDL_CreateJobCounter();
+    start = SDL_GetTicksNS();
+    // Each job depends on the one before it, and each counter is reused once the job that last used it is done
+    for (i = 0; i < length; ++i) {
+        SDL_JobCounter *counter = counters[i & 1];
+        SDL_JobCounter *dependency = counters[(i + 1) & 1];
+
+        SDL_WaitJobCounter(pool, counter);
+        SDL_SubmitJob(pool, EmptyJob, NULL, i > 0 ? dependency : NULL, counter);
+    }
+    SDL_WaitJobCounter(pool, counters[0]);
+    SDL_WaitJobCounter(pool, counters[1]);
+    SDL_DestroyJobCounter(counters[0]);
+    SDL_DestroyJobCounter(counters[1]);
+    return SDL_GetTicksNS() - start;
+}
+
+static Uint64 TimeParallelFor(SDL_JobPool *pool, float *results)
+{
+    Uint64 start = SDL_GetTicksNS();
+
+    SDL_ParallelFor(pool, num_items, 0, WorkOnItems, results);
+    return SDL_GetTicksNS() - start;
+}
+
+static bool RunBenchmark(int num_threads, Uint64 *single_thread_time)
+{
+    SDL_JobPool *pool = CreatePool(num_threads);
+    float *results;
+    Uint64 empty_time, chain_time, for_time;
+    int chain_length = SDL_max(num_jobs / 10, 1);
+
+    if (!pool) {
+        return false;
+    }
+
+    if (!CheckChain(pool) || !CheckTree(pool) || !CheckParallelFor(pool)) {
+        SDL_DestroyJobPool(pool);
+        return false;
+    }
+
+    results = (float *)SDL_malloc(num_items * sizeof(*results));
+    if (!results) {
+        SDL_DestroyJobPool(pool);
+        return false;
+    }
+
+    empty_time = TimeEmptyJobs(pool);
+    chain_time = TimeChain(pool, chain_length);
+    // Run once untimed so page faults on the results and cold caches don't land on whichever pool goes first, the baseline
+    TimeParallelFor(pool, results);
+    for_time = TimeParallelFor(pool, results);
+    if (num_threads == 0) {
+        *single_thread_time = for_time;
+    }
+
+    SDL_Log("%2d threads: %6.0f ns/empty job, %6.0f ns/chained job, parallel for %4" SDL_PRIu64 " ms (%.2fx)",
+            num_threads, (double)empty_time / num_jobs, (double)chain_time / chain_length,
+            for_time / SDL_NS_PER_MS, for_time ? (double)*single_thread_time / for_time : 0.0);
+
+    SDL_free(results);
+    SDL_DestroyJobPool(pool);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int max_threads = SDL_max(SDL_GetNumLogicalCPUCores(), 4);
+    Uint64 single_thread_time = 0;
+    int num_threads;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--jobs") == 0 && argv[i + 1]) {
+                num_jobs = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--items") == 0 && argv[i + 1]) {
+                num_items = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || max_threads < 0 || num_jobs <= 0 || num_items <= 0) {
+            static const char *options[] = { "[--threads N]", "[--jobs N]", "[--items N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    SDL_Log("Default job pool: %d threads on %d physical / %d logical CPU cores",
+            SDL_GetNumJobPoolThreads(NULL), SDL_GetNumPhysicalCPUCores(), SDL_GetNumLogicalCPUCores());
+
+    // A pool with no threads runs everything on the thread that waits, which is the baseline for scaling
+    for (num_threads = 0;; num_threads = num_threads ? num_threads * 2 : 1) {
+        num_threads = SDL_min(num_threads, max_threads);
+        if (!RunBenchmark(num_threads, &single_thread_time)) {
+            result = 1;
+        }
+        if (num_threads == max_threads) {
+            break;
+        }
+    }
+
+    SDLTest_CommonDestroyState(state);
+    SDL_Quit();
+    return result;
+}
@@ -0,0 +1,527 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Decoder for binary log captures written by SDL_StartAsyncLogging()
+ *
+ * testlogdecode [--priority PRIORITY] FILE
+ *     Print the messages in a capture.
+ *
+ * testlogdecode --capture FILE
+ *     Time deferred logging, then write a capture to FILE and check that
+ *     it decodes to the same text as formatting the messages directly.
+ */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+/* These match the capture format in src/SDL_log.c */
+#define LOG_CAPTURE_MAGIC   "SDLLOG\x01"
+#define LOG_CAPTURE_FORMAT  1
+#define LOG_CAPTURE_MESSAGE 2
+#define LOG_CAPTURE_TEXT    3
+
+#define LOG_ARG_INT     'i'
+#define LOG_ARG_DOUBLE  'f'
+#define LOG_ARG_POINTER 'p'
+#define LOG_ARG_STRING  's'
+#define LOG_ARG_NULL    'n'
+
+#define MAX_SPEC_FLAGS  5
+#define MAX_SPEC_DIGITS 10
+
+#define MAX_SAMPLES 32
+#define BENCHMARK_MESSAGES 100000
+
+static const char *priority_names[] = {
+    NULL, "trace", "verbose", "debug", "info", "warn", "error", "critical"
+};
+
+static SDL_LogPriority min_priority = SDL_LOG_PRIORITY_TRACE;
+
+static char expected[MAX_SAMPLES][256];
+static int expected_count;
+static int decoded_count;
+static int errors;
+
+static Uint32 ReadU32(const Uint8 *src)
+{
+    return (Uint32)src[0] | ((Uint32)src[1] << 8) | ((Uint32)src[2] << 16) | ((Uint32)src[3] << 24);
+}
+
+static Uint64 ReadU64(const Uint8 *src)
+{
+    return (Uint64)ReadU32(src) | ((Uint64)ReadU32(src + 4) << 32);
+}
+
+static const Uint8 *DecodeValue(const Uint8 *args, const Uint8 *end, Uint8 type, Uint64 *value)
+{
+    if (!args || end - args < 9 || *args != type) {
+        return NULL;
+    }
+    *value = ReadU64(args + 1);
+    return args + 9;
+}
+
+/* This follows FormatLogArguments() in src/SDL_log.c */
+static size_t FormatArguments(char *text, size_t maxlen, const char *fmt, const Uint8 *args, size_t arglen)
+{
+    const Uint8 *end = args + arglen;
+    size_t length = 0;
+
+    while (*fmt && args) {
+        char spec[64];
+        size_t speclen = 0;
+        const char *flags;
+        const char *modifier = "";
+        char *dst;
+        size_t dstlen;
+        Uint64 value = 0;
+        int result = 0;
+
+        if (*fmt != '%') {
+            if (length < maxlen) {
+                text[length] = *fmt;
+            }
+            ++length;
+            ++fmt;
+            continue;
+        }
+
+        /* Deferred specifications are never longer than this, anything longer is a corrupt record */
+        spec[speclen++] = *fmt++;
+        flags = fmt;
+        while (*fmt == '-' || *fmt == '+' || *fmt == ' ' || *fmt == '#' || *fmt == '0') {
+            ++fmt;
+        }
+        if (fmt - flags > MAX_SPEC_FLAGS) {
+            break;
+        }
+        SDL_memcpy(&spec[speclen], flags, fmt - flags);
+        speclen += fmt - flags;
+        if (*fmt == '*') {
+            ++fmt;
+            args = DecodeValue(args, end, LOG_ARG_INT, &value);
+            speclen += SDL_snprintf(&spec[speclen], 16, "%d", (int)(Sint64)value);
+        } else {
+            const char *digits = fmt;
+            while (*fmt >= '0' && *fmt <= '9') {
+                ++fmt;
+            }
+            if (fmt - digits > MAX_SPEC_DIGITS) {
+                break;
+            }
+            SDL_memcpy(&spec[speclen], digits, fmt - digits);
+            speclen += fmt - digits;
+        }
+        if (*fmt == '.') {
+            ++fmt;
+            if (*fmt == '*') {
+                ++fmt;
+                args = DecodeValue(args, end, LOG_ARG_INT, &value);
+                if ((int)(Sint64)value >= 0) {
+                    speclen += SDL_snprintf(&spec[speclen], 16, ".%d", (int)(Sint64)value);
+                }
+            } else {
+                const char *digits = fmt;
+                while (*fmt >= '0' && *fmt <= '9') {
+                    ++fmt;
+                }
+                if (fmt - digits > MAX_SPEC_DIGITS) {
+                    break;
+                }
+                spec[speclen++] = '.';
+                SDL_memcpy(&spec[speclen], digits, fmt - digits);
+                speclen += fmt - digits;
+            }
+        }
+        while (*fmt == 'h' || *fmt == 'l' || *fmt == 'z' || *fmt == 'j' || *fmt == 't' || *fmt == 'L') {
+            ++fmt;
+        }
+        if (SDL_strncmp(fmt, "I64", 3) == 0) {
+            fmt += 3;
+        }
+        if (!args || !*fmt) {
+            break;
+        }
+
+        if (SDL_strchr("diuoxX", *fmt)) {
+            modifier = "ll";
+        }
+        speclen += SDL_snprintf(&spec[speclen], sizeof(spec) - speclen, "%s%c", modifier, *fmt);
+
+        dst = (length < maxlen) ? &text[length] : NULL;
+        dstlen = (length < maxlen) ? maxlen - length : 0;
+        switch (*fmt++) {
+        case '%':
+            result = SDL_snprintf(dst, dstlen, "%%");
+            break;
+        case 'd':
+        case 'i':
+            args = DecodeValue(args, end, LOG_ARG_INT, &value);
+            result = SDL_snprintf(dst, dstlen, spec, (long long)(Sint64)value);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            args = DecodeValue(args, end, LOG_ARG_INT, &value);
+            result = SDL_snprintf(dst, dstlen, spec, (unsigned long long)value);
+            break;
+        case 'c':
+            args = DecodeValue(args, end, LOG_ARG_INT, &value);
+            result = SDL_snprintf(dst, dstlen, spec, (int)(Sint64)value);
+            break;
+        case 'p':
+            /* The pointer is only meaningful in the process that logged it */
+            args = DecodeValue(args, end, LOG_ARG_POINTER, &value);
+            result = SDL_snprintf(dst, dstlen, spec, (void *)(uintptr_t)value);
+            break;
+        case 's':
+            if (args < end && *args == LOG_ARG_NULL) {
+                ++args;
+                result = SDL_snprintf(dst, dstlen, spec, (const char *)NULL);
+            } else if (args < end && *args == LOG_ARG_STRING && end - args >= 5) {
+                Uint32 string_length = ReadU32(args + 1);
+                if ((size_t)(end - args) < 5 + (size_t)string_length + 1) {
+                    args = NULL;
+                    break;
+                }
+                result = SDL_snprintf(dst, dstlen, spec, (const char *)(args + 5));
+                args += 5 + string_length + 1;
+            } else {
+                args = NULL;
+            }
+            break;
+        default:
+        {
+            double d;
+
+            args = DecodeValue(args, end, LOG_ARG_DOUBLE, &value);
+            SDL_memcpy(&d, &value, sizeof(d));
+            result = SDL_snprintf(dst, dstlen, spec, d);
+            break;
+        }
+        }
+        if (args && result > 0) {
+            length += result;
+        }
+    }
+
+    if (maxlen > 0) {
+        text[SDL_min(length, maxlen - 1)] = '\0';
+    }
+    return length;
+}
+
+static void OutputMessage(int category, SDL_LogPriority priority, Uint64 timestamp, const char *text)
+{
+    const char *name = "unknown";
+
+    if (priority < min_priority) {
+        return;
+    }
+    if (priority > SDL_LOG_PRIORITY_INVALID && priority < SDL_LOG_PRIORITY_COUNT) {
+        name = priority_names[priority];
+    }
+
+    if (expected_count > 0) {
+        /* Checking the capture written by --capture */
+        if (category != SDL_LOG_CATEGORY_CUSTOM) {
+            return;
+        }
+        if (decoded_count >= expected_count || SDL_strcmp(text, expected[decoded_count]) != 0) {
+            SDL_Log("Message %d decoded as \"%s\", expected \"%s\"", decoded_count, text,
+                    decoded_count < expected_count ? expected[decoded_count] : "");
+            ++errors;
+        }
+        ++decoded_count;
+        return;
+    }
+
+    SDL_Log("%" SDL_PRIu64 ".%09" SDL_PRIu64 " %s %d: %s",
+            timestamp / (Uint64)SDL_NS_PER_SECOND, timestamp % (Uint64)SDL_NS_PER_SECOND, name, category, text);
+}
+
+static bool DecodeCapture(const char *file)
+{
+    const char **formats = NULL;
+    Uint32 num_formats = 0;
+    size_t size = 0;
+    Uint8 *data = (Uint8 *)SDL_LoadFile(file, &size);
+    const Uint8 *src, *end;
+    bool result = true;
+
+    if (!data) {
+        SDL_Log("Couldn't load %s: %s", file, SDL_GetError());
+        return false;
+    }
+    if (size < 8 || SDL_memcmp(data, LOG_CAPTURE_MAGIC, 8) != 0) {
+        SDL_Log("%s isn't an SDL log capture", file);
+        SDL_free(data);
+        return false;
+    }
+
+    src = data + 8;
+    end = data + size;
+    while (src < end && result) {
+        const Uint8 type = *src++;
+
+        if (type == LOG_CAPTURE_FORMAT) {
+            Uint32 id, length;
+
+            if (end - src < 8) {
+                result = false;
+                break;
+            }
+            id = ReadU32(src);
+            length = ReadU32(src + 4);
+            src += 8;
+            if ((size_t)(end - src) < length || id == 0) {
+                result = false;
+                break;
+            }
+            if (id > num_formats) {
+                const char **new_formats = (const char **)SDL_realloc(formats, id * sizeof(*formats));
+                if (!new_formats) {
+                    result = false;
+                    break;
+                }
+                SDL_memset(&new_formats[num_formats], 0, (id - num_formats) * sizeof(*formats));
+                formats = new_formats;
+                num_formats = id;
+            }
+            formats[id - 1] = SDL_strndup((const char *)src, length);
+            src += length;
+        } else if (type == LOG_CAPTURE_MESSAGE || type == LOG_CAPTURE_TEXT) {
+            const char *fmt = NULL;
+            int category;
+            SDL_LogPriority priority;
+            Uint64 timestamp;
+            Uint32 length;
+
+            if (type == LOG_CAPTURE_MESSAGE) {
+                Uint32 id;
+
+                if (end - src < 4) {
+                    result = false;
+                    break;
+                }
+                id = ReadU32(src);
+                src += 4;
+                if (id == 0 || id > num_formats || !formats[id - 1]) {
+                    result = false;
+                    break;
+                }
+                fmt = formats[id - 1];
+            }
+            if (end - src < 20) {
+                result = false;
+                break;
+            }
+            category = (int)ReadU32(src);
+            priority = (SDL_LogPriority)ReadU32(src + 4);
+            timestamp = ReadU64(src + 8);
+            length = ReadU32(src + 16);
+            src += 20;
+            if ((size_t)(end - src) < length) {
+                result = false;
+                break;
+            }
+
+            if (fmt) {
+                char text[1024];
+
+                FormatArguments(text, sizeof(text), fmt, src, length);
+                OutputMessage(category, priority, timestamp, text);
+            } else {
+                char *text = SDL_strndup((const char *)src, length);
+                if (text) {
+                    OutputMessage(category, priority, timestamp, text);
+                    SDL_free(text);
+                }
+            }
+            src += length;
+        } else {
+            result = false;
+        }
+    }
+    if (!result) {
+        SDL_Log("%s is truncated or corrupt at offset %d", file, (int)(src - data));
+    }
+
+    while (num_formats > 0) {
+        SDL_free((void *)formats[--num_formats]);
+    }
+    SDL_free(formats);
+    SDL_free(data);
+    return result;
+}
+
+static bool StartCapture(SDL_IOStream *stream, bool deferred)
+{
+    SDL_PropertiesID props = SDL_CreateProperties();
+    bool result;
+
+    /* Large enough that the benchmark measures the logging threads, not the log thread */
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNC_LOGGING_BUFFER_SIZE_NUMBER, 16 * 1024 * 1024);
+    SDL_SetNumberProperty(props, SDL_PROP_ASYNC_LOGGING_OVERFLOW_POLICY_NUMBER, SDL_LOG_OVERFLOW_BLOCK);
+    SDL_SetBooleanProperty(props, SDL_PROP_ASYNC_LOGGING_DEFERRED_FORMAT_BOOLEAN, deferred);
+    SDL_SetPointerProperty(props, SDL_PROP_ASYNC_LOGGING_CAPTURE_STREAM_POINTER, stream);
+    result = SDL_StartAsyncLogging(props);
+    SDL_DestroyProperties(props);
+
+    if (!result) {
+        SDL_Log("Couldn't start asynchronous logging: %s", SDL_GetError());
+    }
+    return result;
+}
+
+static double TimeLogging(bool deferred)
+{
+    SDL_IOStream *stream = SDL_IOFromDynamicMem();
+    Uint64 start, end;
+    int i;
+
+    if (!stream || !StartCapture(stream, deferred)) {
+        SDL_CloseIO(stream);
+        return 0.0;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < BENCHMARK_MESSAGES; ++i) {
+        SDL_LogInfo(SDL_LOG_CATEGORY_CUSTOM, "frame %d took %.3f ms, %d objects in %s", i, i * 0.001, i & 1023, "main");
+    }
+    end = SDL_GetPerformanceCounter();
+
+    SDL_StopAsyncLogging();
+    SDL_CloseIO(stream);
+
+    return (double)(end - start) * 1000000000.0 / SDL_GetPerformanceFrequency() / BENCHMARK_MESSAGES;
+}
+
+#define LOG_SAMPLE(...)                                                                      \
+    do {                                                                                     \
+        SDL_LogInfo(SDL_LOG_CATEGORY_CUSTOM, __VA_ARGS__);                                   \
+        SDL_snprintf(expected[expected_count], sizeof(expected[expected_count]), __VA_ARGS__); \
+        ++expected_count;                                                                    \
+    } while (0)
+
+static bool WriteCapture(const char *file)
+{
+    SDL_IOStream *stream = SDL_IOFromFile(file, "wb");
+    const char *name = "capture";
+    /* An unset hint, so the compiler doesn't know the string is NULL */
+    const char *null_string = SDL_GetHint("testlogdecode_unset_hint");
+
+    if (!stream) {
+        SDL_Log("Couldn't create %s: %s", file, SDL_GetError());
+        return false;
+    }
+    if (!StartCapture(stream, true)) {
+        SDL_CloseIO(stream);
+        return false;
+    }
+
+    LOG_SAMPLE("plain text");
+    LOG_SAMPLE("%d %i %u %x %X %o", -42, 7, 4000000000u, 0xbeef, 0xbeef, 8);
+    LOG_SAMPLE("%hhd %hhu %hd %hu", 300, 300, 70000, 70000);
+    LOG_SAMPLE("%ld %lu %lld %llu", -123456789L, 123456789UL, -1234567890123LL, 1234567890123ULL);
+    LOG_SAMPLE("%" SDL_PRIs64 " %" SDL_PRIu64 " %" SDL_PRIx64, SDL_MIN_SINT64, SDL_MAX_UINT64, SDL_MAX_UINT64);
+    LOG_SAMPLE("%zu", (size_t)12345);
+    LOG_SAMPLE("[%5d] [%-5d] [%05d] [%+d] [% d]", 42, 42, 42, 42, 42);
+    LOG_SAMPLE("[%*d] [%-*d] [%.*f] [%.*s]", 6, 1, 6, 2, 2, 3.14159, 3, "abcdef");
+    LOG_SAMPLE("%f %.2f %10.4f %e %g %g", 1.5, 2.25, -3.125, 12345.678, 0.0001, 1e20);
+    LOG_SAMPLE("%s and %s, %c%c", name, "literal", 'o', 'k');
+    LOG_SAMPLE("%s", null_string);
+    LOG_SAMPLE("100%% done, %d%%", 50);
+    LOG_SAMPLE("%#x %#o", 255, 8);
+
+    /* Filtered out by the category priority, so it never reaches the capture */
+    SDL_LogDebug(SDL_LOG_CATEGORY_CUSTOM, "filtered %d", 1);
+
+    SDL_StopAsyncLogging();
+    SDL_CloseIO(stream);
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    const char *capture = NULL;
+    const char *file = NULL;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--capture") == 0 && argv[i + 1]) {
+                capture = argv[i + 1];
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--priority") == 0 && argv[i + 1]) {
+                int p;
+                for (p = SDL_LOG_PRIORITY_TRACE; p < SDL_LOG_PRIORITY_COUNT; ++p) {
+                    if (SDL_strcasecmp(argv[i + 1], priority_names[p]) == 0) {
+                        min_priority = (SDL_LogPriority)p;
+                        consumed = 2;
+                        break;
+                    }
+                }
+            } else if (!file && argv[i][0] != '-') {
+                file = argv[i];
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = { "[--priority PRIORITY] [--capture FILE | FILE]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+    if (!capture && !file) {
+        static const char *options[] = { "[--priority PRIORITY] [--capture FILE | FILE]", NULL };
+        SDLTest_CommonLogUsage(state, argv[0], options);
+        return 1;
+    }
+
+    if (capture) {
+        double formatted_ns, deferred_ns;
+
+        SDL_SetLogPriority(SDL_LOG_CATEGORY_CUSTOM, SDL_LOG_PRIORITY_INFO);
+
+        formatted_ns = TimeLogging(false);
+        deferred_ns = TimeLogging(true);
+        SDL_Log("Asynchronous logging: %.1f ns/message formatted, %.1f ns/message deferred", formatted_ns, deferred_ns);
+
+        if (!WriteCapture(capture) || !DecodeCapture(capture)) {
+            ++errors;
+        } else if (decoded_count != expected_count) {
+            SDL_Log("Decoded %d messages, expected %d", decoded_count, expected_count);
+            ++errors;
+        } else {
+            SDL_Log("Decoded %d messages from %s", decoded_count, capture);
+        }
+    } else if (!DecodeCapture(file)) {
+        ++errors;
+    }
+
+    SDLTest_CommonDestroyState(state);
+    return errors ? 1 : 0;
+}
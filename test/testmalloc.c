@@ -0,0 +1,220 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Measures SDL_malloc()/SDL_free() throughput from several threads at once.
+
+   Each thread keeps a set of live blocks of mostly small, random sizes and
+   replaces them at random. Some blocks are swapped with other threads
+   through a shared table, so they get freed on a different thread than the
+   one that allocated them. Every block is checked for damage before it is
+   freed. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define LIVE_BLOCKS     1024
+#define SHARED_BLOCKS   256
+
+typedef struct Worker
+{
+    SDL_Thread *thread;
+    Uint64 seed;
+    int operations;
+    bool failed;
+} Worker;
+
+static int num_operations = 1000000;
+static void *shared_blocks[SHARED_BLOCKS];
+
+static size_t RandomBlockSize(Uint64 *seed)
+{
+    Uint32 r = SDL_rand_bits_r(seed);
+
+    // Mostly small blocks, with the occasional big one
+    if ((r & 63) == 0) {
+        return 4096 + (r >> 16);
+    }
+    return 16 + (r >> 8) % 496;
+}
+
+static void *AllocateBlock(Uint64 *seed)
+{
+    size_t size = RandomBlockSize(seed);
+    Uint8 *block = (Uint8 *)SDL_malloc(size);
+    if (block) {
+        SDL_memcpy(block, &size, sizeof(size));
+        block[size - 1] = (Uint8)size;
+    }
+    return block;
+}
+
+static bool FreeBlock(void *mem)
+{
+    Uint8 *block = (Uint8 *)mem;
+    size_t size;
+    bool intact;
+
+    if (!block) {
+        return true;
+    }
+    SDL_memcpy(&size, block, sizeof(size));
+    intact = (size >= 16 && size < 4096 + 65536 && block[size - 1] == (Uint8)size);
+    SDL_free(block);
+    return intact;
+}
+
+static int SDLCALL WorkerThread(void *data)
+{
+    Worker *worker = (Worker *)data;
+    void *blocks[LIVE_BLOCKS];
+    int i;
+
+    for (i = 0; i < LIVE_BLOCKS; ++i) {
+        blocks[i] = AllocateBlock(&worker->seed);
+    }
+
+    for (i = 0; i < worker->operations; ++i) {
+        Uint32 slot = SDL_rand_r(&worker->seed, LIVE_BLOCKS);
+
+        if ((i & 63) == 0) {
+            // Trade a block with whichever thread touched this entry last
+            void **shared = &shared_blocks[SDL_rand_r(&worker->seed, SHARED_BLOCKS)];
+            blocks[slot] = SDL_SetAtomicPointer(shared, blocks[slot]);
+            continue;
+        }
+        if (!FreeBlock(blocks[slot])) {
+            worker->failed = true;
+        }
+        blocks[slot] = AllocateBlock(&worker->seed);
+        if (!blocks[slot]) {
+            worker->failed = true;
+        }
+    }
+
+    for (i = 0; i < LIVE_BLOCKS; ++i) {
+        if (!FreeBlock(blocks[i])) {
+            worker->failed = true;
+        }
+    }
+    return 0;
+}
+
+static bool RunBenchmark(int num_threads)
+{
+    Worker *workers = (Worker *)SDL_calloc(num_threads, sizeof(*workers));
+    Uint64 start, elapsed;
+    bool result = true;
+    int i;
+
+    if (!workers) {
+        return false;
+    }
+
+    start = SDL_GetTicksNS();
+    for (i = 0; i < num_threads; ++i) {
+        char name[32];
+
+        workers[i].seed = (Uint64)i * 0x9E3779B97F4A7C15ull + 1;
+        workers[i].operations = num_operations / num_threads;
+        SDL_snprintf(name, sizeof(name), "testmalloc%d", i);
+        workers[i].thread = SDL_CreateThread(WorkerThread, name, &workers[i]);
+        if (!workers[i].thread) {
+            SDL_Log("Couldn't create thread: %s", SDL_GetError());
+            result = false;
+            break;
+        }
+    }
+    for (i = 0; i < num_threads; ++i) {
+        if (workers[i].thread) {
+            SDL_WaitThread(workers[i].thread, NULL);
+            if (workers[i].failed) {
+                SDL_Log("Thread %d saw a damaged block or failed to allocate", i);
+                result = false;
+            }
+        }
+    }
+    elapsed = SDL_GetTicksNS() - start;
+
+    for (i = 0; i < SHARED_BLOCKS; ++i) {
+        if (!FreeBlock(SDL_SetAtomicPointer(&shared_blocks[i], NULL))) {
+            result = false;
+        }
+    }
+
+    SDL_Log("%2d threads: %d operations in %" SDL_PRIu64 " ms, %.1f million/s",
+            num_threads, num_operations, (Uint64)(elapsed / SDL_NS_PER_MS),
+            elapsed ? (num_operations / (elapsed / (double)SDL_NS_PER_SECOND)) / 1000000.0 : 0.0);
+
+    SDL_free(workers);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_MemoryStats stats;
+    int max_threads = SDL_max(SDL_GetNumLogicalCPUCores(), 4);
+    int num_threads;
+    int result = 0;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+                max_threads = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--operations") == 0 && argv[i + 1]) {
+                num_operations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || max_threads <= 0 || num_operations <= 0) {
+            static const char *options[] = { "[--threads N]", "[--operations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    for (num_threads = 1;; num_threads *= 2) {
+        num_threads = SDL_min(num_threads, max_threads);
+        if (!RunBenchmark(num_threads)) {
+            result = 1;
+        }
+        if (num_threads == max_threads) {
+            break;
+        }
+    }
+
+    if (SDL_GetMemoryStats(&stats)) {
+        SDL_Log("Allocations: %" SDL_PRIu64 ", frees: %" SDL_PRIu64, stats.num_allocations, stats.num_frees);
+        SDL_Log("Thread caches: %d, hits: %" SDL_PRIu64 ", refills: %" SDL_PRIu64 ", flushes: %" SDL_PRIu64 ", cached: %" SDL_PRIu64 " bytes",
+                stats.num_thread_caches, stats.cache_hits, stats.cache_refills, stats.cache_flushes, (Uint64)stats.cached_bytes);
+        SDL_Log("Heap: %" SDL_PRIu64 " bytes in use, %" SDL_PRIu64 " bytes from the system, peak %" SDL_PRIu64,
+                (Uint64)stats.heap_in_use, (Uint64)stats.heap_size, (Uint64)stats.heap_peak_size);
+    } else {
+        SDL_Log("No allocator statistics: %s", SDL_GetError());
+    }
+
+    SDLTest_CommonDestroyState(state);
+    SDL_Quit();
+    return result;
+}
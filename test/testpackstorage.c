@@ -0,0 +1,534 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Builds pack files for the "pack" title storage driver, and compares that
+   driver against the "generic" one:
+
+     testpackstorage --pack OUTPUT.pak DIRECTORY [--compress]
+
+   packs a directory tree. Without --pack, it makes a test tree, packs it,
+   checks that both drivers see the same files, and times reading them all. */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define MZ_ASSERT(x) SDL_assert(x)
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#define MINIZ_LITTLE_ENDIAN 1
+#else
+#define MINIZ_LITTLE_ENDIAN 0
+#endif
+#define MINIZ_USE_UNALIGNED_LOADS_AND_STORES 0
+#define MINIZ_SDL_NOUNUSED
+#define memcpy SDL_memcpy
+#define memset SDL_memset
+#include "../src/video/miniz.h"
+#undef memcpy
+#undef memset
+
+/* See src/storage/generic/SDL_packstorage.c for the file format. */
+#define PACK_MAGIC "SPAK"
+#define PACK_VERSION 1
+#define PACK_HEADER_SIZE 24
+#define PACK_ENTRY_SIZE 40
+#define PACK_ENTRY_DIRECTORY 0x01
+#define PACK_ENTRY_DEFLATE 0x02
+
+#define TREE_DIR "testpackstorage-tree"
+#define STORED_PACK "testpackstorage-stored.pak"
+#define COMPRESSED_PACK "testpackstorage-compressed.pak"
+
+typedef struct PackItem
+{
+    char *name;
+    Uint32 flags;
+    Uint64 offset;
+    Uint64 size;
+    Uint64 stored_size;
+} PackItem;
+
+static int num_files = 2000;
+static int file_size = 4096;
+static int iterations = 3;
+
+static int SDLCALL ComparePackItems(const void *a, const void *b)
+{
+    return SDL_strcmp(((const PackItem *)a)->name, ((const PackItem *)b)->name);
+}
+
+static mz_bool WriteCompressedData(const void *buf, int len, void *userdata)
+{
+    return SDL_WriteIO((SDL_IOStream *)userdata, buf, len) == (size_t)len;
+}
+
+/* Returns the compressed data in a memory stream, or NULL if it doesn't get any smaller. */
+static SDL_IOStream *CompressData(tdefl_compressor *compressor, const void *data, size_t size)
+{
+    SDL_IOStream *stream = SDL_IOFromDynamicMem();
+    if (!stream) {
+        return NULL;
+    }
+    if (tdefl_init(compressor, WriteCompressedData, stream, TDEFL_DEFAULT_MAX_PROBES) != TDEFL_STATUS_OKAY ||
+        tdefl_compress_buffer(compressor, data, size, TDEFL_FINISH) != TDEFL_STATUS_DONE ||
+        SDL_GetIOSize(stream) >= (Sint64)size) {
+        SDL_CloseIO(stream);
+        return NULL;
+    }
+    return stream;
+}
+
+static bool WritePack(const char *output, const char *directory, bool compress)
+{
+    PackItem *items = NULL;
+    char **names = NULL;
+    Uint8 *index = NULL;
+    SDL_IOStream *io = NULL;
+    tdefl_compressor *compressor = NULL;
+    Uint64 names_size = 0;
+    Uint64 offset;
+    bool result = false;
+    int count = 0;
+    int i;
+
+    names = SDL_GlobDirectory(directory, NULL, 0, &count);
+    if (!names) {
+        return false;
+    }
+
+    items = (PackItem *)SDL_calloc(count ? count : 1, sizeof(*items));
+    if (!items) {
+        goto done;
+    }
+    for (i = 0; i < count; i++) {
+        char *fullpath = NULL;
+        SDL_PathInfo info;
+        char *ptr;
+
+        SDL_asprintf(&fullpath, "%s/%s", directory, names[i]);
+        if (!fullpath || !SDL_GetPathInfo(fullpath, &info)) {
+            SDL_free(fullpath);
+            goto done;
+        }
+        SDL_free(fullpath);
+
+        items[i].name = names[i];
+        for (ptr = names[i]; *ptr; ptr++) {
+            if (*ptr == '\\') {
+                *ptr = '/';
+            }
+        }
+        if (info.type == SDL_PATHTYPE_DIRECTORY) {
+            items[i].flags = PACK_ENTRY_DIRECTORY;
+        } else {
+            items[i].size = info.size;
+        }
+        names_size += SDL_strlen(names[i]) + 1;
+    }
+    SDL_qsort(items, count, sizeof(*items), ComparePackItems);
+
+    if (compress) {
+        compressor = (tdefl_compressor *)SDL_malloc(sizeof(*compressor));
+        if (!compressor) {
+            goto done;
+        }
+    }
+
+    io = SDL_IOFromFile(output, "wb");
+    if (!io) {
+        goto done;
+    }
+
+    /* the file data goes after the index, which we fill in at the end. */
+    offset = PACK_HEADER_SIZE + ((Uint64)count * PACK_ENTRY_SIZE) + names_size;
+    index = (Uint8 *)SDL_calloc(1, (size_t)offset);
+    if (!index || SDL_WriteIO(io, index, (size_t)offset) != offset) {
+        goto done;
+    }
+
+    for (i = 0; i < count; i++) {
+        PackItem *item = &items[i];
+        SDL_IOStream *compressed = NULL;
+        char *fullpath = NULL;
+        size_t datalen = 0;
+        void *data;
+
+        if (item->flags & PACK_ENTRY_DIRECTORY) {
+            continue;
+        }
+
+        SDL_asprintf(&fullpath, "%s/%s", directory, item->name);
+        data = fullpath ? SDL_LoadFile(fullpath, &datalen) : NULL;
+        SDL_free(fullpath);
+        if (!data) {
+            goto done;
+        }
+
+        item->size = datalen;
+        item->offset = offset;
+        if (compressor) {
+            compressed = CompressData(compressor, data, datalen);
+        }
+        if (compressed) {
+            const void *mem = SDL_GetPointerProperty(SDL_GetIOProperties(compressed), SDL_PROP_IOSTREAM_DYNAMIC_MEMORY_POINTER, NULL);
+            item->flags |= PACK_ENTRY_DEFLATE;
+            item->stored_size = (Uint64)SDL_GetIOSize(compressed);
+            result = (SDL_WriteIO(io, mem, (size_t)item->stored_size) == item->stored_size);
+            SDL_CloseIO(compressed);
+        } else {
+            item->stored_size = datalen;
+            result = (SDL_WriteIO(io, data, datalen) == datalen);
+        }
+        SDL_free(data);
+        if (!result) {
+            goto done;
+        }
+        offset += item->stored_size;
+    }
+
+    /* now that we know where everything went, write the index. */
+    {
+        Uint8 *entry = index + PACK_HEADER_SIZE;
+        char *name = (char *)(entry + ((size_t)count * PACK_ENTRY_SIZE));
+        const char *names_start = name;
+        SDL_IOStream *header;
+        Uint32 crc;
+
+        for (i = 0; i < count; i++) {
+            const size_t len = SDL_strlen(items[i].name);
+            SDL_IOStream *mem = SDL_IOFromMem(entry, PACK_ENTRY_SIZE);
+            if (!mem) {
+                result = false;
+                goto done;
+            }
+            SDL_WriteU32LE(mem, (Uint32)(name - names_start));
+            SDL_WriteU32LE(mem, (Uint32)len);
+            SDL_WriteU32LE(mem, items[i].flags);
+            SDL_WriteU32LE(mem, 0);
+            SDL_WriteU64LE(mem, items[i].offset);
+            SDL_WriteU64LE(mem, items[i].size);
+            SDL_WriteU64LE(mem, items[i].stored_size);
+            SDL_CloseIO(mem);
+            SDL_memcpy(name, items[i].name, len + 1);
+            entry += PACK_ENTRY_SIZE;
+            name += len + 1;
+        }
+        crc = SDL_crc32(0, index + PACK_HEADER_SIZE, (size_t)(name - (char *)(index + PACK_HEADER_SIZE)));
+
+        header = SDL_IOFromMem(index, PACK_HEADER_SIZE);
+        if (!header) {
+            result = false;
+            goto done;
+        }
+        SDL_WriteIO(header, PACK_MAGIC, 4);
+        SDL_WriteU32LE(header, PACK_VERSION);
+        SDL_WriteU32LE(header, (Uint32)count);
+        SDL_WriteU32LE(header, (Uint32)names_size);
+        SDL_WriteU32LE(header, crc);
+        SDL_WriteU32LE(header, 0);
+        SDL_CloseIO(header);
+
+        result = (SDL_SeekIO(io, 0, SDL_IO_SEEK_SET) == 0) &&
+                 (SDL_WriteIO(io, index, (size_t)(name - (char *)index)) == (size_t)(name - (char *)index));
+    }
+
+done:
+    if (io && !SDL_CloseIO(io)) {
+        result = false;
+    }
+    SDL_free(compressor);
+    SDL_free(index);
+    SDL_free(items);
+    SDL_free(names);
+    return result;
+}
+
+static bool CreateTestTree(void)
+{
+    Uint8 *data = (Uint8 *)SDL_malloc(file_size);
+    bool result = true;
+    int i;
+
+    if (!data) {
+        return false;
+    }
+
+    for (i = 0; result && (i < num_files); i++) {
+        char path[128];
+        int j;
+
+        /* mostly compressible text, with a bit of noise. */
+        for (j = 0; j < file_size; j++) {
+            data[j] = (j % 61 == 0) ? (Uint8)SDL_rand(256) : (Uint8)('a' + ((i + j) % 26));
+        }
+        SDL_snprintf(path, sizeof(path), "%s/dir%d/sub%d", TREE_DIR, i % 10, (i / 10) % 10);
+        if (!SDL_CreateDirectory(path)) {
+            result = false;
+            break;
+        }
+        SDL_snprintf(path, sizeof(path), "%s/dir%d/sub%d/file%d.dat", TREE_DIR, i % 10, (i / 10) % 10, i);
+        result = SDL_SaveFile(path, data, file_size);
+    }
+
+    /* names that sort between a directory and its contents, because '.' and '-' come before '/'. */
+    if (result) {
+        static const char *siblings[] = { "dir0.cfg", "dir0-old/readme.txt", "dir1/sub0.txt", "dir1/sub0-old.txt" };
+        for (i = 0; result && (i < (int)SDL_arraysize(siblings)); i++) {
+            char path[128];
+            char *sep;
+
+            SDL_snprintf(path, sizeof(path), "%s/%s", TREE_DIR, siblings[i]);
+            sep = SDL_strrchr(path, '/');
+            *sep = '\0';
+            result = SDL_CreateDirectory(path);
+            *sep = '/';
+            result = result && SDL_SaveFile(path, siblings[i], SDL_strlen(siblings[i]));
+        }
+    }
+
+    SDL_free(data);
+    return result;
+}
+
+static void RemoveTree(const char *path)
+{
+    int count = 0;
+    char **names = SDL_GlobDirectory(path, NULL, 0, &count);
+    int i;
+
+    /* remove children before their parents. */
+    for (i = count - 1; i >= 0; i--) {
+        char *fullpath = NULL;
+        SDL_asprintf(&fullpath, "%s/%s", path, names[i]);
+        if (fullpath) {
+            SDL_RemovePath(fullpath);
+            SDL_free(fullpath);
+        }
+    }
+    SDL_free(names);
+    SDL_RemovePath(path);
+}
+
+static SDL_Storage *OpenTitleStorage(const char *driver, const char *path)
+{
+    SDL_Storage *storage;
+
+    SDL_SetHint(SDL_HINT_STORAGE_TITLE_DRIVER, driver);
+    storage = SDL_OpenTitleStorage(path, 0);
+    SDL_ResetHint(SDL_HINT_STORAGE_TITLE_DRIVER);
+    if (!storage) {
+        SDL_Log("Couldn't open %s with the %s driver: %s", path, driver, SDL_GetError());
+    }
+    return storage;
+}
+
+static int SDLCALL CompareStrings(const void *a, const void *b)
+{
+    return SDL_strcmp(*(const char *const *)a, *(const char *const *)b);
+}
+
+static bool CheckSameContents(SDL_Storage *expected, SDL_Storage *actual)
+{
+    int expected_count = 0, actual_count = 0;
+    char **expected_names = SDL_GlobStorageDirectory(expected, NULL, NULL, 0, &expected_count);
+    char **actual_names = SDL_GlobStorageDirectory(actual, NULL, NULL, 0, &actual_count);
+    bool result = true;
+    int i;
+
+    if (!expected_names || !actual_names) {
+        SDL_Log("Couldn't list the storage: %s", SDL_GetError());
+        result = false;
+    } else if (expected_count != actual_count) {
+        SDL_Log("Expected %d entries, got %d", expected_count, actual_count);
+        result = false;
+    } else {
+        /* the generic driver lists things in whatever order the OS gives them to us. */
+        SDL_qsort(expected_names, expected_count, sizeof(char *), CompareStrings);
+        SDL_qsort(actual_names, actual_count, sizeof(char *), CompareStrings);
+        for (i = 0; result && (i < expected_count); i++) {
+            SDL_PathInfo expected_info, actual_info;
+
+            if (SDL_strcmp(expected_names[i], actual_names[i]) != 0) {
+                SDL_Log("Expected '%s', got '%s'", expected_names[i], actual_names[i]);
+                result = false;
+            } else if (!SDL_GetStoragePathInfo(expected, expected_names[i], &expected_info) ||
+                       !SDL_GetStoragePathInfo(actual, actual_names[i], &actual_info)) {
+                SDL_Log("Couldn't get info for '%s': %s", expected_names[i], SDL_GetError());
+                result = false;
+            } else if (expected_info.type != actual_info.type || expected_info.size != actual_info.size) {
+                SDL_Log("Info for '%s' doesn't match", expected_names[i]);
+                result = false;
+            } else if (expected_info.type == SDL_PATHTYPE_FILE) {
+                Uint8 *expected_data = (Uint8 *)SDL_malloc((size_t)expected_info.size + 1);
+                Uint8 *actual_data = (Uint8 *)SDL_malloc((size_t)actual_info.size + 1);
+                if (!expected_data || !actual_data ||
+                    !SDL_ReadStorageFile(expected, expected_names[i], expected_data, expected_info.size) ||
+                    !SDL_ReadStorageFile(actual, actual_names[i], actual_data, actual_info.size)) {
+                    SDL_Log("Couldn't read '%s': %s", expected_names[i], SDL_GetError());
+                    result = false;
+                } else if (SDL_memcmp(expected_data, actual_data, (size_t)expected_info.size) != 0) {
+                    SDL_Log("Contents of '%s' don't match", expected_names[i]);
+                    result = false;
+                }
+                SDL_free(expected_data);
+                SDL_free(actual_data);
+            }
+        }
+    }
+    SDL_free(expected_names);
+    SDL_free(actual_names);
+    return result;
+}
+
+static bool Benchmark(const char *driver, const char *path, char **names, int count)
+{
+    Uint8 *buffer = (Uint8 *)SDL_malloc(file_size);
+    Uint64 start, end, total = 0;
+    double seconds;
+    int i, j;
+
+    if (!buffer) {
+        return false;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_Storage *storage = OpenTitleStorage(driver, path);
+        if (!storage) {
+            SDL_free(buffer);
+            return false;
+        }
+        for (j = 0; j < count; j++) {
+            Uint64 size = 0;
+            if (!SDL_GetStorageFileSize(storage, names[j], &size) || size > (Uint64)file_size ||
+                !SDL_ReadStorageFile(storage, names[j], buffer, size)) {
+                SDL_Log("Couldn't read '%s' with the %s driver: %s", names[j], driver, SDL_GetError());
+                SDL_CloseStorage(storage);
+                SDL_free(buffer);
+                return false;
+            }
+            total += size;
+        }
+        SDL_CloseStorage(storage);
+    }
+    end = SDL_GetPerformanceCounter();
+    SDL_free(buffer);
+
+    seconds = (double)(end - start) / SDL_GetPerformanceFrequency();
+    SDL_Log("%-32s %6d files: %10.0f files/s %8.1f MB/s", path, count * iterations,
+            (count * iterations) / seconds, (total / (1024.0 * 1024.0)) / seconds);
+    return true;
+}
+
+static bool RunTests(void)
+{
+    SDL_Storage *generic = NULL;
+    SDL_Storage *pack = NULL;
+    char **names = NULL;
+    int count = 0;
+    bool result = false;
+
+    RemoveTree(TREE_DIR);
+    if (!CreateTestTree()) {
+        SDL_Log("Couldn't create the test tree: %s", SDL_GetError());
+    } else if (!WritePack(STORED_PACK, TREE_DIR, false) || !WritePack(COMPRESSED_PACK, TREE_DIR, true)) {
+        SDL_Log("Couldn't write the pack files: %s", SDL_GetError());
+    } else if ((generic = OpenTitleStorage("generic", TREE_DIR)) != NULL) {
+        pack = OpenTitleStorage("pack", STORED_PACK);
+        result = pack && CheckSameContents(generic, pack);
+        SDL_CloseStorage(pack);
+        if (result) {
+            pack = OpenTitleStorage("pack", COMPRESSED_PACK);
+            result = pack && CheckSameContents(generic, pack);
+            SDL_CloseStorage(pack);
+        }
+        if (result) {
+            names = SDL_GlobStorageDirectory(generic, NULL, "*/*/*.dat", 0, &count);
+            result = names && Benchmark("generic", TREE_DIR, names, count) &&
+                     Benchmark("pack", STORED_PACK, names, count) &&
+                     Benchmark("pack", COMPRESSED_PACK, names, count);
+            SDL_free(names);
+        }
+        SDL_CloseStorage(generic);
+    }
+
+    RemoveTree(TREE_DIR);
+    SDL_RemovePath(STORED_PACK);
+    SDL_RemovePath(COMPRESSED_PACK);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    const char *pack_output = NULL;
+    const char *pack_input = NULL;
+    bool compress = false;
+    int result = 1;
+    int i;
+
+    /* these are here so the compiler doesn't complain that we don't use them. */
+    (void)tdefl_write_image_to_png_file_in_memory_ex;
+    (void)mz_free;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--pack") == 0 && argv[i + 1] && argv[i + 2]) {
+                pack_output = argv[i + 1];
+                pack_input = argv[i + 2];
+                consumed = 3;
+            } else if (SDL_strcmp(argv[i], "--compress") == 0) {
+                compress = true;
+                consumed = 1;
+            } else if (SDL_strcmp(argv[i], "--files") == 0 && argv[i + 1]) {
+                num_files = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--file-size") == 0 && argv[i + 1]) {
+                file_size = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || num_files <= 0 || file_size <= 0 || iterations <= 0) {
+            static const char *options[] = { "[--pack OUTPUT DIRECTORY]", "[--compress]", "[--files N]", "[--file-size BYTES]", "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    SDL_srand(0);
+
+    if (pack_output) {
+        if (WritePack(pack_output, pack_input, compress)) {
+            result = 0;
+        } else {
+            SDL_Log("Couldn't pack %s into %s: %s", pack_input, pack_output, SDL_GetError());
+        }
+    } else if (RunTests()) {
+        result = 0;
+    }
+
+    SDLTest_CommonDestroyState(state);
+    SDL_Quit();
+    return result;
+}
@@ -742,6 +742,105 @@ failed:
     return TEST_ABORTED;
 }
 
+typedef struct ProcessOutputCapture
+{
+    char output[2][64];
+    size_t length[2];
+    int eof[2];
+} ProcessOutputCapture;
+
+static void SDLCALL process_OutputCallback(void *userdata, SDL_Process *process, bool is_stderr, const void *data, size_t datasize)
+{
+    ProcessOutputCapture *capture = (ProcessOutputCapture *)userdata;
+    const int index = is_stderr ? 1 : 0;
+
+    if (!data) {
+        capture->eof[index]++;
+        return;
+    }
+    if (capture->length[index] + datasize < sizeof(capture->output[index])) {
+        SDL_memcpy(&capture->output[index][capture->length[index]], data, datasize);
+        capture->length[index] += datasize;
+    }
+}
+
+static int process_testWaitProcessesWithCallbacks(void *arg)
+{
+    TestProcessData *data = (TestProcessData *)arg;
+#define NUM_WAIT_PROCESSES 8
+    SDL_Process *processes[NUM_WAIT_PROCESSES];
+    ProcessOutputCapture captures[NUM_WAIT_PROCESSES];
+    char stdout_text[NUM_WAIT_PROCESSES][32];
+    char stderr_text[NUM_WAIT_PROCESSES][32];
+    char exit_code_text[NUM_WAIT_PROCESSES][16];
+    int finished = 0;
+    int i;
+
+    SDL_zeroa(processes);
+    SDL_zeroa(captures);
+
+    for (i = 0; i < NUM_WAIT_PROCESSES; i++) {
+        const char *process_args[] = {
+            data->childprocess_path,
+            "--stdout", stdout_text[i],
+            "--stderr", stderr_text[i],
+            "--exit-code", exit_code_text[i],
+            NULL,
+        };
+        SDL_PropertiesID props;
+
+        SDL_snprintf(stdout_text[i], sizeof(stdout_text[i]), "stdout of child %d", i);
+        SDL_snprintf(stderr_text[i], sizeof(stderr_text[i]), "stderr of child %d", i);
+        SDL_snprintf(exit_code_text[i], sizeof(exit_code_text[i]), "%d", i);
+
+        props = SDL_CreateProperties();
+        SDL_SetPointerProperty(props, SDL_PROP_PROCESS_CREATE_ARGS_POINTER, (void *)process_args);
+        SDL_SetNumberProperty(props, SDL_PROP_PROCESS_CREATE_STDOUT_NUMBER, SDL_PROCESS_STDIO_APP);
+        SDL_SetNumberProperty(props, SDL_PROP_PROCESS_CREATE_STDERR_NUMBER, SDL_PROCESS_STDIO_APP);
+        processes[i] = SDL_CreateProcessWithProperties(props);
+        SDL_DestroyProperties(props);
+        SDLTest_AssertCheck(processes[i] != NULL, "SDL_CreateProcessWithProperties() for child %d", i);
+        if (!processes[i]) {
+            goto failed;
+        }
+        SDLTest_AssertCheck(SDL_SetProcessOutputCallback(processes[i], process_OutputCallback, &captures[i]), "SDL_SetProcessOutputCallback()");
+    }
+
+    SDLTest_AssertCheck(SDL_ReadProcess(processes[0], NULL, NULL) == NULL, "SDL_ReadProcess() should fail while a callback is set");
+
+    while (finished < NUM_WAIT_PROCESSES) {
+        finished = SDL_WaitProcesses(processes, NUM_WAIT_PROCESSES, -1);
+        if (finished < 0) {
+            SDLTest_AssertCheck(false, "SDL_WaitProcesses() failed: %s", SDL_GetError());
+            goto failed;
+        }
+    }
+    SDLTest_AssertPass("All %d processes finished", NUM_WAIT_PROCESSES);
+    SDLTest_AssertCheck(SDL_WaitProcesses(processes, NUM_WAIT_PROCESSES, 0) == NUM_WAIT_PROCESSES, "SDL_WaitProcesses() on finished processes");
+
+    for (i = 0; i < NUM_WAIT_PROCESSES; i++) {
+        int exit_code = 0xdeadbeef;
+
+        SDLTest_AssertCheck(SDL_WaitProcess(processes[i], false, &exit_code), "Child %d should have exited", i);
+        SDLTest_AssertCheck(exit_code == i, "Exit code of child %d should be %d, is %d", i, i, exit_code);
+        SDLTest_CompareMemory(captures[i].output[0], captures[i].length[0], stdout_text[i], SDL_strlen(stdout_text[i]));
+        SDLTest_CompareMemory(captures[i].output[1], captures[i].length[1], stderr_text[i], SDL_strlen(stderr_text[i]));
+        SDLTest_AssertCheck(captures[i].eof[0] == 1 && captures[i].eof[1] == 1, "Child %d should report end of output once per stream", i);
+    }
+
+    for (i = 0; i < NUM_WAIT_PROCESSES; i++) {
+        SDL_DestroyProcess(processes[i]);
+    }
+    return TEST_COMPLETED;
+
+failed:
+    for (i = 0; i < NUM_WAIT_PROCESSES; i++) {
+        SDL_DestroyProcess(processes[i]);
+    }
+    return TEST_ABORTED;
+#undef NUM_WAIT_PROCESSES
+}
+
 static int process_testWriteToFinishedProcess(void *arg)
 {
     TestProcessData *data = (TestProcessData *)arg;
@@ -1167,6 +1266,10 @@ static const SDLTest_TestCaseReference processTestMultiprocessStdinToStdout = {
     process_testMultiprocessStdinToStdout, "process_testMultiprocessStdinToStdout", "Test writing to stdin and reading from stdout using the simplified API", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference processTestWaitProcessesWithCallbacks = {
+    process_testWaitProcessesWithCallbacks, "process_testWaitProcessesWithCallbacks", "Test waiting on several processes with output delivered to callbacks", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference processTestWriteToFinishedProcess = {
     process_testWriteToFinishedProcess, "process_testWriteToFinishedProcess", "Test writing to stdin of terminated process", TEST_ENABLED
 };
@@ -1201,6 +1304,7 @@ static const SDLTest_TestCaseReference *processTests[] = {
     &processTestStdinToStderr,
     &processTestSimpleStdinToStdout,
     &processTestMultiprocessStdinToStdout,
+    &processTestWaitProcessesWithCallbacks,
     &processTestWriteToFinishedProcess,
     &processTestNonExistingExecutable,
     &processTestBatBadButVulnerability,
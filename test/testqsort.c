@@ -436,6 +436,438 @@ static int SDLCALL qsort_testRandomSorted(void *arg)
     return TEST_COMPLETED;
 }
 
+#ifndef TEST_STDLIB_QSORT
+
+typedef struct {
+    int *values;
+    size_t count;
+    Uint64 comparisons;
+} CountingArray;
+
+static int SDLCALL
+compare_int_counting(void *userdata, const void *_a, const void *_b)
+{
+    CountingArray *array = (CountingArray *)userdata;
+    array->comparisons += 1;
+    return compare_int(_a, _b);
+}
+
+/* Generous bound on the comparisons an O(n log n) sort makes, to catch it
+   going quadratic on a pattern. */
+static Uint64 max_comparisons(size_t count)
+{
+    Uint64 log2 = 1;
+    while (((size_t)1 << log2) < count) {
+        ++log2;
+    }
+    return 4 * (Uint64)count * log2 + 64;
+}
+
+static void check_sorted_counting_array(const char *pattern, const int *input, const CountingArray *array)
+{
+    int *presences = SDL_calloc(array->count, sizeof(int));
+    Uint64 count_non_sorted = 0;
+    Uint64 count_changed = 0;
+    size_t i;
+
+    SDL_assert(presences != NULL);
+    for (i = 0; i < array->count; i++) {
+        presences[array->values[i]] += 1;
+        presences[input[i]] -= 1;
+        if (i > 0 && array->values[i - 1] > array->values[i]) {
+            count_non_sorted += 1;
+        }
+    }
+    for (i = 0; i < array->count; i++) {
+        if (presences[i] != 0) {
+            count_changed += 1;
+        }
+    }
+    SDLTest_AssertCheck(count_non_sorted == 0, "[%s] Array (size=%d) is sorted (bad count=%" SDL_PRIu64 ")", pattern, (int)array->count, count_non_sorted);
+    SDLTest_AssertCheck(count_changed == 0, "[%s] No elements were lost (bad count=%" SDL_PRIu64 ")", pattern, count_changed);
+    SDLTest_AssertCheck(array->comparisons <= max_comparisons(array->count), "[%s] %" SDL_PRIu64 " comparisons, expected at most %" SDL_PRIu64, pattern, array->comparisons, max_comparisons(array->count));
+    SDL_free(presences);
+}
+
+static int SDLCALL qsort_testPatterns(void *arg)
+{
+    static const char *patterns[] = { "equal", "few unique", "organ pipe", "sawtooth", "interleaved", "sorted blocks" };
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        int *input = SDL_malloc(sizeof(int) * arraylen);
+        CountingArray array;
+        int pattern;
+
+        array.values = SDL_malloc(sizeof(int) * arraylen);
+        array.count = arraylen;
+        SDL_assert(input != NULL && array.values != NULL);
+
+        for (pattern = 0; pattern < SDL_arraysize(patterns); pattern++) {
+            unsigned int i;
+
+            for (i = 0; i < arraylen; i++) {
+                switch (pattern) {
+                case 0:
+                    input[i] = (int)arraylen / 2;
+                    break;
+                case 1:
+                    input[i] = SDLTest_RandomIntegerInRange(0, 3);
+                    break;
+                case 2:
+                    input[i] = (i < arraylen / 2) ? (int)i : (int)(arraylen - 1 - i);
+                    break;
+                case 3:
+                    input[i] = (int)(i % 64);
+                    break;
+                case 4:
+                    input[i] = (i % 2) ? (int)i : (int)(arraylen - 1 - i);
+                    break;
+                default:
+                    input[i] = (int)((i / 100) * 100 + (99 - i % 100)) % (int)arraylen;
+                    break;
+                }
+            }
+
+            SDL_memcpy(array.values, input, sizeof(int) * arraylen);
+            array.comparisons = 0;
+            SDL_qsort_r(array.values, arraylen, sizeof(int), compare_int_counting, &array);
+            check_sorted_counting_array(patterns[pattern], input, &array);
+        }
+
+        SDL_free(input);
+        SDL_free(array.values);
+    }
+    return TEST_COMPLETED;
+}
+
+/* M. D. McIlroy, "A Killer Adversary for Quicksort": the compare function
+   decides the values of the elements as the sort runs, in whatever way
+   makes its pivots worst. */
+typedef struct {
+    int *values;
+    int gas;
+    int num_solid;
+    int candidate;
+    Uint64 comparisons;
+} Adversary;
+
+static int SDLCALL
+compare_adversary(void *userdata, const void *_a, const void *_b)
+{
+    Adversary *adversary = (Adversary *)userdata;
+    const int a = *((const int *)_a);
+    const int b = *((const int *)_b);
+
+    adversary->comparisons += 1;
+    if (adversary->values[a] == adversary->gas && adversary->values[b] == adversary->gas) {
+        if (a == adversary->candidate) {
+            adversary->values[a] = adversary->num_solid++;
+        } else {
+            adversary->values[b] = adversary->num_solid++;
+        }
+    }
+    if (adversary->values[a] == adversary->gas) {
+        adversary->candidate = a;
+    } else if (adversary->values[b] == adversary->gas) {
+        adversary->candidate = b;
+    }
+    return adversary->values[a] - adversary->values[b];
+}
+
+static int SDLCALL qsort_testAdversary(void *arg)
+{
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        int *indices = SDL_malloc(sizeof(int) * arraylen);
+        Adversary adversary;
+        Uint64 count_non_sorted = 0;
+        unsigned int i;
+
+        adversary.values = SDL_malloc(sizeof(int) * arraylen);
+        SDL_assert(indices != NULL && adversary.values != NULL);
+        adversary.gas = (int)arraylen;
+        adversary.num_solid = 0;
+        adversary.candidate = 0;
+        adversary.comparisons = 0;
+        for (i = 0; i < arraylen; i++) {
+            indices[i] = i;
+            adversary.values[i] = adversary.gas;
+        }
+
+        SDL_qsort_r(indices, arraylen, sizeof(int), compare_adversary, &adversary);
+
+        for (i = 1; i < arraylen; i++) {
+            if (adversary.values[indices[i - 1]] > adversary.values[indices[i]]) {
+                count_non_sorted += 1;
+            }
+        }
+        SDLTest_AssertCheck(count_non_sorted == 0, "Array (size=%d) is sorted (bad count=%" SDL_PRIu64 ")", (int)arraylen, count_non_sorted);
+        SDLTest_AssertCheck(adversary.comparisons <= max_comparisons(arraylen), "%" SDL_PRIu64 " comparisons, expected at most %" SDL_PRIu64, adversary.comparisons, max_comparisons(arraylen));
+
+        SDL_free(indices);
+        SDL_free(adversary.values);
+    }
+    return TEST_COMPLETED;
+}
+
+#define RADIX_ELEMENT_SIZE 13
+#define RADIX_KEY_OFFSET   3
+#define RADIX_INDEX_OFFSET 9
+
+static Sint64 get_radix_test_key(const Uint8 *element, SDL_SortKeyType key_type, Uint64 *unsigned_key)
+{
+    switch (key_type) {
+    case SDL_SORTKEY_UINT32:
+    {
+        Uint32 key;
+        SDL_memcpy(&key, element + RADIX_KEY_OFFSET, sizeof(key));
+        *unsigned_key = key;
+        return 0;
+    }
+    case SDL_SORTKEY_SINT32:
+    {
+        Sint32 key;
+        SDL_memcpy(&key, element + RADIX_KEY_OFFSET, sizeof(key));
+        *unsigned_key = 0;
+        return key;
+    }
+    case SDL_SORTKEY_UINT64:
+    {
+        Uint64 key;
+        SDL_memcpy(&key, element + RADIX_KEY_OFFSET, sizeof(key));
+        *unsigned_key = key;
+        return 0;
+    }
+    default:
+    {
+        Sint64 key;
+        SDL_memcpy(&key, element + RADIX_KEY_OFFSET, sizeof(key));
+        *unsigned_key = 0;
+        return key;
+    }
+    }
+}
+
+static int SDLCALL qsort_testRadixSort(void *arg)
+{
+    static const SDL_SortKeyType key_types[] = { SDL_SORTKEY_UINT32, SDL_SORTKEY_SINT32, SDL_SORTKEY_UINT64, SDL_SORTKEY_SINT64 };
+    unsigned int iteration;
+    Uint64 key64 = 0;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        const unsigned int arraylen = arraylens[iteration];
+        Uint8 *elements = SDL_malloc(RADIX_ELEMENT_SIZE * arraylen);
+        int type;
+
+        SDL_assert(elements != NULL);
+        for (type = 0; type < SDL_arraysize(key_types); type++) {
+            int few_unique;
+
+            for (few_unique = 0; few_unique < 2; few_unique++) {
+                Uint64 count_non_sorted = 0, count_unstable = 0;
+                Uint64 input_sum = 0, sorted_sum = 0;
+                Uint32 input_index_sum = 0, sorted_index_sum = 0;
+                unsigned int i;
+
+                for (i = 0; i < arraylen; i++) {
+                    Uint8 *element = elements + i * RADIX_ELEMENT_SIZE;
+                    Uint64 key = ((Uint64)SDLTest_RandomUint32() << 32) | SDLTest_RandomUint32();
+                    if (few_unique) {
+                        // Keys differ only in the sign bit and a few other bits, so most bytes are the same
+                        key = (key & SDL_UINT64_C(0x8000000080000101));
+                    }
+                    SDL_memcpy(element + RADIX_KEY_OFFSET, &key, sizeof(key));
+                    SDL_memcpy(element + RADIX_INDEX_OFFSET, &i, sizeof(i));
+                    element[0] = (Uint8)i;
+                    input_sum += (Uint64)get_radix_test_key(element, key_types[type], &key);
+                    input_sum += key;
+                    input_index_sum += i;
+                }
+
+                SDLTest_AssertCheck(SDL_RadixSort(elements, arraylen, RADIX_ELEMENT_SIZE, RADIX_KEY_OFFSET, key_types[type]),
+                                    "SDL_RadixSort(%d, %d) succeeded", (int)arraylen, (int)key_types[type]);
+
+                for (i = 0; i < arraylen; i++) {
+                    const Uint8 *element = elements + i * RADIX_ELEMENT_SIZE;
+                    Uint32 index;
+                    Uint64 ukey;
+                    Sint64 skey = get_radix_test_key(element, key_types[type], &ukey);
+
+                    SDL_memcpy(&index, element + RADIX_INDEX_OFFSET, sizeof(index));
+                    if (element[0] != (Uint8)index) {
+                        count_unstable += 1; // The element was torn apart
+                    }
+                    if (i > 0) {
+                        const Uint8 *prev = element - RADIX_ELEMENT_SIZE;
+                        Uint32 prev_index;
+                        Uint64 prev_ukey;
+                        Sint64 prev_skey = get_radix_test_key(prev, key_types[type], &prev_ukey);
+
+                        SDL_memcpy(&prev_index, prev + RADIX_INDEX_OFFSET, sizeof(prev_index));
+                        if (prev_skey > skey || (prev_skey == skey && prev_ukey > ukey)) {
+                            count_non_sorted += 1;
+                        } else if (prev_skey == skey && prev_ukey == ukey && prev_index > index) {
+                            count_unstable += 1;
+                        }
+                    }
+                    sorted_sum += (Uint64)skey;
+                    sorted_sum += ukey;
+                    sorted_index_sum += index;
+                }
+                SDLTest_AssertCheck(count_non_sorted == 0, "Array (size=%d, key type=%d) is sorted (bad count=%" SDL_PRIu64 ")", (int)arraylen, (int)key_types[type], count_non_sorted);
+                SDLTest_AssertCheck(count_unstable == 0, "Sort is stable (bad count=%" SDL_PRIu64 ")", count_unstable);
+                SDLTest_AssertCheck(input_sum == sorted_sum && input_index_sum == sorted_index_sum, "No elements were lost");
+            }
+        }
+
+        SDL_free(elements);
+    }
+
+    SDLTest_AssertCheck(SDL_RadixSort(NULL, 0, 8, 0, SDL_SORTKEY_UINT64), "Sorting an empty array succeeds");
+    SDLTest_AssertCheck(!SDL_RadixSort(&key64, 1, 8, 4, SDL_SORTKEY_UINT64), "A key past the end of the element fails");
+    SDLTest_AssertCheck(!SDL_RadixSort(&key64, 1, 4, 0, SDL_SORTKEY_UINT64), "A key bigger than the element fails");
+    SDLTest_AssertCheck(!SDL_RadixSort(&key64, 1, 8, 0, (SDL_SortKeyType)42), "An invalid key type fails");
+    return TEST_COMPLETED;
+}
+
+static int SDLCALL
+compare_int_atomic(void *userdata, const void *_a, const void *_b)
+{
+    SDL_AddAtomicInt((SDL_AtomicInt *)userdata, 1);
+    return compare_int(_a, _b);
+}
+
+static int SDLCALL qsort_testParallelSort(void *arg)
+{
+    unsigned int iteration;
+    (void)arg;
+
+    for (iteration = 0; iteration < count_arraylens; iteration++) {
+        // Make sure the array is big enough to be split up
+        const unsigned int arraylen = SDL_max(arraylens[iteration], 200000);
+        int *ints = SDL_malloc(sizeof(int) * arraylen);
+        int *sorted = SDL_malloc(sizeof(int) * arraylen);
+        int pattern;
+
+        SDL_assert(ints != NULL && sorted != NULL);
+        for (pattern = 0; pattern < 3; pattern++) {
+            SDL_AtomicInt comparisons;
+            unsigned int i;
+
+            for (i = 0; i < arraylen; i++) {
+                if (pattern == 0) {
+                    ints[i] = SDLTest_RandomIntegerInRange(0, MAX_RANDOM_INT_VALUE - 1);
+                } else if (pattern == 1) {
+                    ints[i] = SDLTest_RandomIntegerInRange(0, 3);
+                } else {
+                    ints[i] = (int)((arraylen - 1 - i) % MAX_RANDOM_INT_VALUE);
+                }
+            }
+            SDL_memcpy(sorted, ints, sizeof(int) * arraylen);
+            SDL_SetAtomicInt(&comparisons, 0);
+            SDLTest_AssertPass("About to call SDL_ParallelSort(%d, %d), pattern %d", (int)arraylen, (int)sizeof(int), pattern);
+            SDL_ParallelSort(sorted, arraylen, sizeof(int), compare_int_atomic, &comparisons);
+            SDLTest_AssertCheck(SDL_GetAtomicInt(&comparisons) > 0, "The compare function got the userdata pointer");
+            TEST_ARRAY_IS_SORTED(int, sorted, arraylen, INT_ISLE);
+            CHECK_ELEMS_SORTED_ARRAY_RANDOM_INT(int, sorted, ints, arraylen);
+        }
+
+        SDL_free(ints);
+        SDL_free(sorted);
+    }
+    return TEST_COMPLETED;
+}
+
+#endif // !TEST_STDLIB_QSORT
+
+typedef struct {
+    Uint32 key;
+    Uint32 value;
+} BenchmarkElement;
+
+static int SDLCALL
+compare_benchmark_element(void *userdata, const void *_a, const void *_b)
+{
+    const BenchmarkElement *a = (const BenchmarkElement *)_a;
+    const BenchmarkElement *b = (const BenchmarkElement *)_b;
+    (void)userdata;
+    return (a->key < b->key) ? -1 : ((a->key > b->key) ? 1 : 0);
+}
+
+static double elapsed_ms(Uint64 start)
+{
+    return (SDL_GetTicksNS() - start) / (double)SDL_NS_PER_MS;
+}
+
+static void run_benchmark(unsigned int arraylen)
+{
+    static const char *patterns[] = { "random", "sorted", "reversed", "few unique" };
+    BenchmarkElement *input = SDL_malloc(sizeof(*input) * arraylen);
+    BenchmarkElement *sorted = SDL_malloc(sizeof(*sorted) * arraylen);
+    int pattern;
+
+    if (!input || !sorted) {
+        SDL_LogError(SDL_LOG_CATEGORY_TEST, "Out of memory");
+        SDL_free(input);
+        SDL_free(sorted);
+        return;
+    }
+
+    for (pattern = 0; pattern < SDL_arraysize(patterns); pattern++) {
+        double qsort_ms, parallel_ms = 0.0, radix_ms = 0.0;
+        unsigned int i;
+        Uint64 start;
+
+        for (i = 0; i < arraylen; i++) {
+            switch (pattern) {
+            case 0:
+                input[i].key = SDLTest_RandomUint32();
+                break;
+            case 1:
+                input[i].key = i;
+                break;
+            case 2:
+                input[i].key = arraylen - i;
+                break;
+            default:
+                input[i].key = SDLTest_RandomUint32() % 16;
+                break;
+            }
+            input[i].value = i;
+        }
+
+        SDL_memcpy(sorted, input, sizeof(*input) * arraylen);
+        start = SDL_GetTicksNS();
+        SDL_qsort_r(sorted, arraylen, sizeof(*sorted), compare_benchmark_element, NULL);
+        qsort_ms = elapsed_ms(start);
+
+#ifndef TEST_STDLIB_QSORT
+        SDL_memcpy(sorted, input, sizeof(*input) * arraylen);
+        start = SDL_GetTicksNS();
+        SDL_ParallelSort(sorted, arraylen, sizeof(*sorted), compare_benchmark_element, NULL);
+        parallel_ms = elapsed_ms(start);
+
+        SDL_memcpy(sorted, input, sizeof(*input) * arraylen);
+        start = SDL_GetTicksNS();
+        SDL_RadixSort(sorted, arraylen, sizeof(*sorted), 0, SDL_SORTKEY_UINT32);
+        radix_ms = elapsed_ms(start);
+#endif
+
+        SDL_Log("%9u %-10s  SDL_qsort_r %9.3f ms  SDL_ParallelSort %9.3f ms  SDL_RadixSort %9.3f ms",
+                arraylen, patterns[pattern], qsort_ms, parallel_ms, radix_ms);
+    }
+
+    SDL_free(input);
+    SDL_free(sorted);
+}
+
 static const SDLTest_TestCaseReference qsortTestAlreadySorted = {
     qsort_testAlreadySorted, "qsort_testAlreadySorted", "Test sorting already sorted array", TEST_ENABLED
 };
@@ -452,11 +884,35 @@ static const SDLTest_TestCaseReference qsortTestRandomSorted = {
     qsort_testRandomSorted, "qsort_testRandomSorted", "Test sorting a random array", TEST_ENABLED
 };
 
+#ifndef TEST_STDLIB_QSORT
+static const SDLTest_TestCaseReference qsortTestPatterns = {
+    qsort_testPatterns, "qsort_testPatterns", "Test sorting arrays with common patterns in O(n log n) comparisons", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference qsortTestAdversary = {
+    qsort_testAdversary, "qsort_testAdversary", "Test sorting with an adversarial compare function in O(n log n) comparisons", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference qsortTestRadixSort = {
+    qsort_testRadixSort, "qsort_testRadixSort", "Test sorting with SDL_RadixSort", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference qsortTestParallelSort = {
+    qsort_testParallelSort, "qsort_testParallelSort", "Test sorting with SDL_ParallelSort", TEST_ENABLED
+};
+#endif
+
 static const SDLTest_TestCaseReference *qsortTests[] = {
     &qsortTestAlreadySorted,
     &qsortTestAlreadySortedExceptLast,
     &qsortTestReverseSorted,
     &qsortTestRandomSorted,
+#ifndef TEST_STDLIB_QSORT
+    &qsortTestPatterns,
+    &qsortTestAdversary,
+    &qsortTestRadixSort,
+    &qsortTestParallelSort,
+#endif
     NULL
 };
 
@@ -479,6 +935,8 @@ int main(int argc, char *argv[])
     SDLTest_CommonState *state;
     SDLTest_TestSuiteRunner *runner;
     bool list = false;
+    bool benchmark = false;
+    bool custom_arraylens = false;
 
     /* Initialize test framework */
     state = SDLTest_CommonCreateState(argv, 0);
@@ -497,10 +955,11 @@ int main(int argc, char *argv[])
 
             if (SDL_strcasecmp(argv[i], "--array-lengths") == 0) {
                 count_arraylens = 0;
+                custom_arraylens = true;
                 consumed = 1;
                 while (argv[i + consumed] && argv[i + consumed][0] != '-') {
                     char *endptr = NULL;
-                    unsigned int arraylen = (unsigned int)SDL_strtoul(argv[i + 1], &endptr, 10);
+                    unsigned int arraylen = (unsigned int)SDL_strtoul(argv[i + consumed], &endptr, 10);
                     if (*endptr != '\0') {
                         count_arraylens = 0;
                         break;
@@ -519,12 +978,16 @@ int main(int argc, char *argv[])
             } else if (SDL_strcasecmp(argv[i], "--list") == 0) {
                 consumed = 1;
                 list = true;
+            } else if (SDL_strcasecmp(argv[i], "--benchmark") == 0) {
+                consumed = 1;
+                benchmark = true;
             }
         }
         if (consumed <= 0) {
             static const char *options[] = {
                 "[--list]",
                 "[--array-lengths N1 [N2 [N3 [...]]]",
+                "[--benchmark]",
                 NULL
             };
             SDLTest_CommonLogUsage(state, argv[0], options);
@@ -547,6 +1010,21 @@ int main(int argc, char *argv[])
             }
         }
         result = 0;
+    } else if (benchmark) {
+        /* Time each sort on a few sizes of arrays, or the ones given with --array-lengths */
+        static const unsigned int benchmark_arraylens[] = { 1000, 100000, 1000000, 10000000 };
+        unsigned int iteration;
+
+        if (!custom_arraylens) {
+            for (iteration = 0; iteration < SDL_arraysize(benchmark_arraylens); iteration++) {
+                run_benchmark(benchmark_arraylens[iteration]);
+            }
+        } else {
+            for (iteration = 0; iteration < count_arraylens; iteration++) {
+                run_benchmark(arraylens[iteration]);
+            }
+        }
+        result = 0;
     } else {
         result = SDLTest_ExecuteTestSuiteRunner(runner);
     }
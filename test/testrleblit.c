@@ -0,0 +1,149 @@
+/*
+  Copyright (C) 1997-2026 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of RLE accelerated blits against the regular blitters */
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define SPRITE_W 256
+#define SPRITE_H 256
+
+static int iterations = 200;
+
+/* Sprite sheet like content: transparent gaps, opaque bodies, translucent edges */
+static void FillSprite(SDL_Surface *surface, bool colorkey)
+{
+    int x, y;
+
+    for (y = 0; y < surface->h; y++) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+        for (x = 0; x < surface->w; x++) {
+            const int cx = (x % 64) - 32;
+            const int cy = (y % 64) - 32;
+            const int d2 = cx * cx + cy * cy;
+            Uint32 rgb = ((Uint32)(x ^ y) & 0xff) << 16 | ((Uint32)(x * 3) & 0xff) << 8 | ((Uint32)(y * 5) & 0xff);
+            Uint32 alpha;
+
+            if (d2 > 28 * 28) {
+                alpha = 0;
+            } else if (d2 > 24 * 24 && !colorkey) {
+                alpha = 255 - (Uint32)(d2 - 24 * 24) * 255 / (28 * 28 - 24 * 24);
+            } else {
+                alpha = 255;
+            }
+            if (colorkey) {
+                row[x] = alpha ? (0xff000000 | rgb | 0x010000) : 0xff000000;
+            } else {
+                row[x] = (alpha << 24) | rgb;
+            }
+        }
+    }
+}
+
+static double TimeBlits(SDL_Surface *sprite, SDL_Surface *screen, bool relock)
+{
+    Uint64 start, end;
+    int i;
+
+    /* Warm up, this also performs the RLE encoding */
+    SDL_BlitSurface(sprite, NULL, screen, NULL);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; i++) {
+        SDL_Rect dstrect;
+
+        if (relock) {
+            SDL_LockSurface(sprite);
+            SDL_UnlockSurface(sprite);
+        }
+        dstrect.x = (i * 37) % (screen->w - SPRITE_W);
+        dstrect.y = (i * 23) % (screen->h - SPRITE_H);
+        dstrect.w = SPRITE_W;
+        dstrect.h = SPRITE_H;
+        SDL_BlitSurface(sprite, NULL, screen, &dstrect);
+    }
+    end = SDL_GetPerformanceCounter();
+
+    return (double)(end - start) * 1000000.0 / SDL_GetPerformanceFrequency() / iterations;
+}
+
+static void RunBenchmark(const char *name, SDL_Surface *sprite, SDL_Surface *screen)
+{
+    SDL_Surface *rle = SDL_DuplicateSurface(sprite);
+    double plain_us, rle_us, relock_us;
+
+    SDL_SetSurfaceRLE(sprite, false);
+    plain_us = TimeBlits(sprite, screen, false);
+
+    SDL_SetSurfaceRLE(rle, true);
+    rle_us = TimeBlits(rle, screen, false);
+    relock_us = TimeBlits(rle, screen, true);
+
+    SDL_Log("%-10s plain: %8.2f us/blit  RLE: %8.2f us/blit (%.2fx)  RLE after lock: %8.2f us/blit",
+            name, plain_us, rle_us, plain_us / rle_us, relock_us);
+
+    SDL_DestroySurface(rle);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_Surface *screen, *sprite;
+    int i;
+
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+                iterations = SDL_atoi(argv[i + 1]);
+                consumed = 2;
+            }
+        }
+        if (consumed <= 0 || iterations <= 0) {
+            static const char *options[] = { "[--iterations N]", NULL };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+        i += consumed;
+    }
+
+    screen = SDL_CreateSurface(1024, 768, SDL_PIXELFORMAT_XRGB8888);
+    sprite = SDL_CreateSurface(SPRITE_W, SPRITE_H, SDL_PIXELFORMAT_ARGB8888);
+    if (!screen || !sprite) {
+        SDL_Log("Couldn't create surfaces: %s", SDL_GetError());
+        return 1;
+    }
+    SDL_FillSurfaceRect(screen, NULL, SDL_MapSurfaceRGB(screen, 32, 64, 96));
+
+    FillSprite(sprite, false);
+    SDL_SetSurfaceBlendMode(sprite, SDL_BLENDMODE_BLEND);
+    RunBenchmark("alpha", sprite, screen);
+
+    FillSprite(sprite, true);
+    SDL_SetSurfaceBlendMode(sprite, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceColorKey(sprite, true, 0xff000000);
+    RunBenchmark("colorkey", sprite, screen);
+
+    SDL_DestroySurface(sprite);
+    SDL_DestroySurface(screen);
+    SDLTest_CommonDestroyState(state);
+    return 0;
+}